@@ -0,0 +1,72 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <coreobjects/unit_factory.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/data_rule_factory.h>
+#include <opendaq/logger_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/scheduler_factory.h>
+#include <opendaq/signal_factory.h>
+
+namespace daq::benchmarks
+{
+
+// Logs only errors so that logging stays off the measured path
+inline ContextPtr createBenchmarkContext()
+{
+    const auto logger = Logger(nullptr, LogLevel::Error);
+    return Context(Scheduler(logger, 1), logger, nullptr, nullptr, nullptr);
+}
+
+inline DataDescriptorPtr createValueDescriptor(SampleType sampleType = SampleType::Float64, const ScalingPtr& scaling = nullptr)
+{
+    return DataDescriptorBuilder().setSampleType(sampleType).setPostScaling(scaling).build();
+}
+
+inline DataDescriptorPtr createDomainDescriptor()
+{
+    return DataDescriptorBuilder()
+        .setSampleType(SampleType::Int64)
+        .setRule(LinearDataRule(1, 0))
+        .setTickResolution(Ratio(1, 1000000))
+        .setOrigin("1970-01-01T00:00:00Z")
+        .setUnit(Unit("s", -1, "seconds", "time"))
+        .build();
+}
+
+// Creates a value signal with its own domain signal
+inline SignalConfigPtr createSignalWithDomain(const ContextPtr& context,
+                                              const std::string& localId,
+                                              const DataDescriptorPtr& valueDescriptor = createValueDescriptor())
+{
+    const auto domainSignal = SignalWithDescriptor(context, createDomainDescriptor(), nullptr, localId + "_domain");
+    auto signal = SignalWithDescriptor(context, valueDescriptor, nullptr, localId);
+    signal.setDomainSignal(domainSignal);
+    return signal;
+}
+
+// Creates a value packet with an implicit linear domain packet starting at the given offset
+inline DataPacketPtr createPacketWithDomain(const SignalPtr& signal, SizeT sampleCount, Int offset)
+{
+    const auto domainPacket = DataPacket(signal.getDomainSignal().getDescriptor(), sampleCount, offset);
+    return DataPacketWithDomain(domainPacket, signal.getDescriptor(), sampleCount);
+}
+
+}
@@ -0,0 +1,41 @@
+#include "benchmark_device_tree.h"
+#include <opendaq/search_filter_factory.h>
+#include <benchmark/benchmark.h>
+#include <string>
+
+using namespace daq;
+using namespace daq::benchmarks;
+
+// Finds a channel of the last child device by its relative path
+static void BM_FindComponent(benchmark::State& state)
+{
+    const auto childDeviceCount = static_cast<size_t>(state.range(0));
+    const auto device = createDeviceTree(childDeviceCount);
+    const auto path = "Dev/mock_phys_dev_" + std::to_string(childDeviceCount - 1) + "/IO/mockfolderB/mockchB2";
+
+    for (auto _ : state)
+    {
+        const auto component = device.findComponent(path);
+        if (!component.assigned())
+        {
+            state.SkipWithError("Component not found");
+            break;
+        }
+        benchmark::DoNotOptimize(component.getObject());
+    }
+}
+BENCHMARK(BM_FindComponent)->ArgName("child_devices")->Arg(10)->Arg(100)->Arg(400);
+
+// Searches the whole tree for the channels with a given local ID, one per child device
+static void BM_SearchComponentsByLocalId(benchmark::State& state)
+{
+    const auto device = createDeviceTree(static_cast<size_t>(state.range(0)));
+    const auto componentCount = device.getItems(search::Recursive(search::Any())).getCount();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(device.getItems(search::Recursive(search::LocalId("mockchB2"))).getCount());
+
+    state.counters["components"] = static_cast<double>(componentCount);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * componentCount));
+}
+BENCHMARK(BM_SearchComponentsByLocalId)->ArgName("child_devices")->Arg(10)->Arg(100)->Arg(400)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,258 @@
+#include "benchmark_device_tree.h"
+#include <config_protocol/config_client_device_impl.h>
+#include <config_protocol/config_protocol_client.h>
+#include <config_protocol/config_protocol_server.h>
+#include <config_protocol/config_server_revision_tracker.h>
+#include <coreobjects/property_factory.h>
+#include <coreobjects/user_factory.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/mock/advanced_components_setup_utils.h>
+#include <opendaq/search_filter_factory.h>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using namespace daq;
+using namespace daq::config_protocol;
+
+namespace
+{
+
+// Connects a config protocol client to a server in the same process. The latency simulates the round trip time of
+// the connection; requests sent through the async callback wait for it concurrently.
+class ConfigProtocolLoopback
+{
+public:
+    explicit ConfigProtocolLoopback(const DevicePtr& serverDevice, ConfigServerRevisionTrackerPtr revisionTracker = nullptr)
+        : serverDevice(serverDevice)
+        , revisionTracker(std::move(revisionTracker))
+    {
+        createServer();
+    }
+
+    DevicePtr connect(uint16_t protocolVersion = GetLatestConfigProtocolVersion(), bool enableAsyncRequests = false)
+    {
+        client = std::make_unique<ConfigProtocolClient<ConfigClientDeviceImpl>>(
+            NullContext(),
+            [this](const PacketBuffer& requestPacket) { return sendRequestAndGetReply(requestPacket); },
+            [this](const PacketBuffer& requestPacket) { sendNoReplyRequest(requestPacket); },
+            nullptr,
+            nullptr,
+            nullptr);
+
+        auto clientDevice = client->connect(nullptr, protocolVersion);
+        if (enableAsyncRequests)
+            client->getClientComm()->setSendAsyncRequestCallback([this](PacketBuffer& requestPacket)
+                                                                 { return sendAsyncRequest(requestPacket); });
+        return clientDevice;
+    }
+
+    // Notifications sent by the device while disconnected are lost, as on a broken connection
+    void disconnect()
+    {
+        std::scoped_lock lock(serverSync);
+        server.reset();
+    }
+
+    // Each connection has its own server; the revision tracker is shared between them
+    void reconnect(const ConfigServerRevisionTrackerPtr& revisionTracker)
+    {
+        this->revisionTracker = revisionTracker;
+        createServer();
+        client->reconnect(False);
+    }
+
+    ConfigProtocolClientCommPtr getClientComm() const
+    {
+        return client->getClientComm();
+    }
+
+    std::chrono::microseconds latency{0};
+    size_t replyBytes = 0;
+
+private:
+    void createServer()
+    {
+        std::scoped_lock lock(serverSync);
+        server = std::make_unique<ConfigProtocolServer>(
+            serverDevice,
+            [this](const PacketBuffer& notificationPacket)
+            {
+                if (client)
+                    client->triggerNotificationPacket(notificationPacket);
+            },
+            User("", ""),
+            ClientType::Control,
+            test_utils::dummyExtSigFolder(serverDevice.getContext()));
+        if (revisionTracker)
+            server->setRevisionTracker(revisionTracker);
+    }
+
+    PacketBuffer processRequestAndGetReply(const PacketBuffer& requestPacket)
+    {
+        std::scoped_lock lock(serverSync);
+        auto replyPacket = server->processRequestAndGetReply(requestPacket);
+        replyBytes += replyPacket.getPayloadSize();
+        return replyPacket;
+    }
+
+    PacketBuffer sendRequestAndGetReply(const PacketBuffer& requestPacket)
+    {
+        std::this_thread::sleep_for(latency);
+        return processRequestAndGetReply(requestPacket);
+    }
+
+    std::future<PacketBuffer> sendAsyncRequest(PacketBuffer& requestPacket)
+    {
+        auto packet = std::make_shared<PacketBuffer>(std::move(requestPacket));
+        return std::async(std::launch::async,
+                          [this, packet]
+                          {
+                              std::this_thread::sleep_for(latency);
+                              return processRequestAndGetReply(*packet);
+                          });
+    }
+
+    void sendNoReplyRequest(const PacketBuffer& requestPacket)
+    {
+        std::scoped_lock lock(serverSync);
+        server->processNoReplyRequest(requestPacket);
+    }
+
+    DevicePtr serverDevice;
+    ConfigServerRevisionTrackerPtr revisionTracker;
+    std::unique_ptr<ConfigProtocolServer> server;
+    std::unique_ptr<ConfigProtocolClient<ConfigClientDeviceImpl>> client;
+    std::mutex serverSync;
+};
+
+std::string getChannelPropertyName(size_t channel)
+{
+    return "Channel" + std::to_string(channel) + "Gain";
+}
+
+}
+
+enum class ChannelConfigurationMode
+{
+    Sequential,
+    Batch,
+    Pipelined
+};
+
+// Sets a property of each of 64 channels with one request per property, within a single "Batch" request, or as
+// pipelined requests to a server that does not support batches
+static void BM_ConfigProtocolChannelConfiguration(benchmark::State& state)
+{
+    constexpr size_t channelCount = 64;
+    const auto mode = static_cast<ChannelConfigurationMode>(state.range(0));
+    const auto roundTrip = std::chrono::microseconds(state.range(1));
+
+    const auto serverDevice = test_utils::createTestDevice();
+    for (size_t i = 0; i < channelCount; ++i)
+        serverDevice.addProperty(IntProperty(getChannelPropertyName(i), 0));
+
+    ConfigProtocolLoopback loopback(serverDevice);
+    loopback.connect(mode == ChannelConfigurationMode::Pipelined ? 24 : GetLatestConfigProtocolVersion(),
+                     mode == ChannelConfigurationMode::Pipelined);
+    loopback.latency = roundTrip;
+
+    const auto clientComm = loopback.getClientComm();
+
+    Int value = 0;
+    for (auto _ : state)
+    {
+        ++value;
+        if (mode == ChannelConfigurationMode::Sequential)
+        {
+            for (size_t i = 0; i < channelCount; ++i)
+                clientComm->setPropertyValue("//root", getChannelPropertyName(i), value);
+        }
+        else
+        {
+            ConfigProtocolBatch batch;
+            for (size_t i = 0; i < channelCount; ++i)
+                batch.setPropertyValue("//root", getChannelPropertyName(i), value);
+            benchmark::DoNotOptimize(clientComm->executeBatch(batch));
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * channelCount));
+}
+BENCHMARK(BM_ConfigProtocolChannelConfiguration)
+    ->ArgNames({"mode", "round_trip_us"})
+    ->ArgsProduct({{0, 1, 2}, {100, 1000}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Connects to a device with 200 mock child devices. Protocol version 25 transfers the device tree as JSON, later
+// versions negotiate the binary serializer.
+static void BM_ConfigProtocolConnect(benchmark::State& state)
+{
+    const bool binary = state.range(0) != 0;
+
+    const auto serverDevice = benchmarks::createDeviceTree(200);
+
+    ConfigProtocolLoopback loopback(serverDevice);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(loopback.connect(binary ? GetLatestConfigProtocolVersion() : 25));
+}
+BENCHMARK(BM_ConfigProtocolConnect)
+    ->ArgName("binary")
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond);
+
+enum class ReconnectMode
+{
+    Full,
+    DeltaNoChanges,
+    DeltaOneChange
+};
+
+// Reconnects to a device with 400 mock child devices (a few tens of components each). Without a revision tracker
+// the whole tree is transferred again; with one, only the subtrees changed while disconnected are.
+static void BM_ConfigProtocolReconnect(benchmark::State& state)
+{
+    const auto mode = static_cast<ReconnectMode>(state.range(0));
+
+    const auto serverDevice = benchmarks::createDeviceTree(400);
+    const auto changedComponent = serverDevice.findComponent("IO/AI/Ch");
+
+    ConfigServerRevisionTrackerPtr revisionTracker;
+    if (mode != ReconnectMode::Full)
+        revisionTracker = std::make_shared<ConfigServerRevisionTracker>(serverDevice.getContext(), serverDevice.getGlobalId());
+
+    ConfigProtocolLoopback loopback(serverDevice, revisionTracker);
+    loopback.connect();
+
+    // the first reconnect with a new tracker is a full one
+    loopback.disconnect();
+    loopback.reconnect(revisionTracker);
+
+    Int changeCount = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        loopback.disconnect();
+        if (mode == ReconnectMode::DeltaOneChange)
+            changedComponent.setPropertyValue("StrProp", String(std::to_string(++changeCount)));
+        loopback.replyBytes = 0;
+        state.ResumeTiming();
+
+        loopback.reconnect(revisionTracker);
+    }
+
+    state.counters["components"] = static_cast<double>(serverDevice.getItems(search::Recursive(search::Any())).getCount());
+    state.counters["reply_bytes"] = static_cast<double>(loopback.replyBytes);
+}
+BENCHMARK(BM_ConfigProtocolReconnect)
+    ->ArgName("mode")
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(2)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,123 @@
+#include "benchmark_common.h"
+#include <basic_csv_recorder_module/csv_writer.h>
+#include <basic_csv_recorder_module/module_dll.h>
+#include <coretypes/filesystem.h>
+#include <opendaq/function_block_ptr.h>
+#include <opendaq/input_port_config.h>
+#include <opendaq/module_ptr.h>
+#include <opendaq/recorder_ptr.h>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace daq;
+using namespace daq::benchmarks;
+
+// Writes one million domain and value lines with the basic recorder's CSV writer. The writer is flushed after every
+// 1000 lines, as the recorder does after each packet, or only when its buffer is full.
+static void BM_CsvWriter(benchmark::State& state)
+{
+    constexpr std::int64_t lineCount = 1'000'000;
+    constexpr std::int64_t packetSize = 1000;
+    const bool flushPerPacket = state.range(0) != 0;
+
+    const fs::path file = fs::current_path() / "benchmark_csv_writer" / "values.csv";
+
+    SizeT fileBytes = 0;
+    for (auto _ : state)
+    {
+        {
+            basic_csv_recorder_module::CsvWriter writer(file);
+            for (std::int64_t i = 0; i < lineCount; ++i)
+            {
+                writer.write(i, static_cast<double>(i) * 0.001 - 0.13);
+                if (flushPerPacket && (i + 1) % packetSize == 0)
+                    writer.flush();
+            }
+        }
+
+        state.PauseTiming();
+        fileBytes = fs::file_size(file);
+        state.ResumeTiming();
+    }
+
+    fs::remove_all(file.parent_path());
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * fileBytes));
+    state.counters["file_bytes"] = static_cast<double>(fileBytes);
+}
+BENCHMARK(BM_CsvWriter)->ArgName("flush_per_packet")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// Records 20 blocks of 10000 samples of 10 signals with the multi CSV recorder, formatting the rows of each block on
+// the given number of threads
+static void BM_MultiCsvRecorderFormatThreads(benchmark::State& state)
+{
+    constexpr SizeT signalCount = 10;
+    constexpr SizeT sampleCount = 10000;
+    constexpr SizeT blockCount = 20;
+    const auto formatThreads = static_cast<Int>(state.range(0));
+
+    const fs::path dir = fs::current_path() / "benchmark_multi_csv_recorder";
+    const auto context = createBenchmarkContext();
+
+    ModulePtr module;
+    createBasicCsvRecorderModule(&module, context);
+
+    auto config = module.getAvailableFunctionBlockTypes().get("MultiCsvRecorder").createDefaultConfig();
+    config.setPropertyValue("ReaderNotificationMode", static_cast<Int>(PacketReadyNotification::SameThread));
+    const auto fb = module.createFunctionBlock("MultiCsvRecorder", nullptr, "fb", config);
+    fb.setPropertyValue("Directory", dir.string());
+    fb.setPropertyValue("FileTimestampEnabled", false);
+    fb.setPropertyValue("FormatThreads", formatThreads);
+
+    const auto domainSignal = SignalWithDescriptor(context, createDomainDescriptor(), nullptr, "domain");
+    std::vector<SignalConfigPtr> signals;
+    for (SizeT i = 0; i < signalCount; ++i)
+    {
+        signals.push_back(SignalWithDescriptor(context, createValueDescriptor(), nullptr, "signal" + std::to_string(i)));
+        signals.back().setDomainSignal(domainSignal);
+        fb.getInputPorts()[i].connect(signals.back());
+    }
+
+    SizeT fileBytes = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        fs::remove_all(dir);
+        state.ResumeTiming();
+
+        fb.asPtr<IRecorder>().startRecording();
+        for (SizeT block = 0; block < blockCount; ++block)
+        {
+            const auto domainPacket = DataPacket(domainSignal.getDescriptor(), sampleCount, static_cast<Int>(block * sampleCount));
+            domainSignal.sendPacket(domainPacket);
+            for (SizeT i = 0; i < signalCount; ++i)
+            {
+                const auto packet = DataPacketWithDomain(domainPacket, signals[i].getDescriptor(), sampleCount);
+                const auto data = static_cast<double*>(packet.getRawData());
+                for (SizeT j = 0; j < sampleCount; ++j)
+                    data[j] = static_cast<double>(i + j) - 0.13;
+                signals[i].sendPacket(packet);
+            }
+        }
+        fb.asPtr<IRecorder>().stopRecording();
+
+        state.PauseTiming();
+        fileBytes = fs::file_size(dir / "output.csv");
+        state.ResumeTiming();
+    }
+
+    context.getScheduler().stop();
+    fs::remove_all(dir);
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * fileBytes));
+    state.counters["file_bytes"] = static_cast<double>(fileBytes);
+}
+BENCHMARK(BM_MultiCsvRecorderFormatThreads)
+    ->ArgName("format_threads")
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
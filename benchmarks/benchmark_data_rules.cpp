@@ -0,0 +1,91 @@
+#include "benchmark_common.h"
+#include <opendaq/data_rule_calc_private.h>
+#include <opendaq/scaling_calc_private.h>
+#include <opendaq/scaling_factory.h>
+#include <benchmark/benchmark.h>
+#include <numeric>
+#include <vector>
+
+using namespace daq;
+using namespace daq::benchmarks;
+
+// Calculators write into preallocated output buffers so that only the calculation is measured
+
+static void BM_LinearDataRule(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    const auto descriptor = createDomainDescriptor();
+    const auto calc = descriptor.asPtr<IDataRuleCalcPrivate>(true);
+
+    std::vector<Int> output(sampleCount);
+    void* outputPtr = output.data();
+    const NumberPtr offset = 1000;
+
+    for (auto _ : state)
+    {
+        calc->calculateRule(offset, sampleCount, nullptr, 0, &outputPtr);
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * sampleCount));
+}
+BENCHMARK(BM_LinearDataRule)->RangeMultiplier(16)->Range(16, 1 << 16);
+
+template <typename TRaw, SampleType RawType>
+static void BM_LinearScaling(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    const auto descriptor = createValueDescriptor(RawType, LinearScaling(0.5, 10, RawType, ScaledSampleType::Float64));
+    const auto calc = descriptor.asPtr<IScalingCalcPrivate>(true);
+
+    std::vector<TRaw> input(sampleCount);
+    std::iota(input.begin(), input.end(), TRaw{0});
+    std::vector<double> output(sampleCount);
+    void* outputPtr = output.data();
+
+    for (auto _ : state)
+    {
+        calc->scaleData(input.data(), sampleCount, &outputPtr);
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * sampleCount));
+}
+BENCHMARK_TEMPLATE(BM_LinearScaling, int16_t, SampleType::Int16)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(BM_LinearScaling, int32_t, SampleType::Int32)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(BM_LinearScaling, double, SampleType::Float64)->RangeMultiplier(16)->Range(16, 1 << 16);
+
+// getData on a fresh packet, including the allocation of the scaled buffer
+static void BM_ScaledPacketGetData(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    const auto descriptor = createValueDescriptor(SampleType::Int32, LinearScaling(0.5, 10, SampleType::Int32, ScaledSampleType::Float64));
+
+    for (auto _ : state)
+    {
+        const auto packet = DataPacket(descriptor, sampleCount);
+        benchmark::DoNotOptimize(packet.getData());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * sampleCount));
+}
+BENCHMARK(BM_ScaledPacketGetData)->RangeMultiplier(16)->Range(16, 1 << 16);
+
+static void BM_LinearDomainPacketGetData(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    const auto descriptor = createDomainDescriptor();
+
+    Int offset = 0;
+    for (auto _ : state)
+    {
+        const auto packet = DataPacket(descriptor, sampleCount, offset);
+        benchmark::DoNotOptimize(packet.getData());
+        offset += static_cast<Int>(sampleCount);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * sampleCount));
+}
+BENCHMARK(BM_LinearDomainPacketGetData)->RangeMultiplier(16)->Range(16, 1 << 16);
@@ -0,0 +1,39 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/folder_config_ptr.h>
+#include <opendaq/mock/advanced_components_setup_utils.h>
+#include <opendaq/mock/mock_physical_device.h>
+
+namespace daq::benchmarks
+{
+
+// Builds a device tree with the given number of mock child devices, each with its own channels, signals and properties
+inline DevicePtr createDeviceTree(size_t childDeviceCount)
+{
+    auto device = test_utils::createTestDevice();
+    const FolderConfigPtr devicesFolder = device.getItem("Dev");
+    for (size_t i = 0; i < childDeviceCount; ++i)
+    {
+        const auto localId = String("mock_phys_dev_" + std::to_string(i));
+        devicesFolder.addItem(MockPhysicalDevice_Create(device.getContext(), devicesFolder, localId, nullptr));
+    }
+
+    return device;
+}
+
+}
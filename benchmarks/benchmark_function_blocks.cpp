@@ -0,0 +1,182 @@
+#include "benchmark_common.h"
+#include <opendaq/function_block_type_ptr.h>
+#include <opendaq/module_ptr.h>
+#include <opendaq/reader_factory.h>
+#include <opendaq/type_manager_factory.h>
+#include <ref_fb_module/module_dll.h>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace daq;
+using namespace daq::benchmarks;
+
+// Feeds reference function blocks with explicit value packets and drains their output with a packet reader.
+// Each iteration sends one input packet and waits until the function block has produced its output.
+
+class RefFunctionBlockFixture
+{
+public:
+    explicit RefFunctionBlockFixture(const std::string& functionBlockId,
+                                     SampleType sampleType = SampleType::Float32,
+                                     const std::function<void(const PropertyObjectPtr&)>& configure = nullptr)
+    {
+        const auto logger = Logger(nullptr, LogLevel::Error);
+        context = Context(Scheduler(logger), logger, TypeManager(), nullptr, nullptr);
+
+        createRefFBModule(&module, context);
+
+        const auto domainDescriptor = DataDescriptorBuilder()
+                                          .setSampleType(SampleType::Int64)
+                                          .setRule(LinearDataRule(1, 0))
+                                          .setTickResolution(Ratio(1, 1000))
+                                          .setUnit(Unit("s", -1, "seconds", "time"))
+                                          .setOrigin("1970-01-01T00:00:00")
+                                          .build();
+        domainSignal = SignalWithDescriptor(context, domainDescriptor, nullptr, "DomainSignal");
+
+        const auto dataDescriptor = DataDescriptorBuilder().setSampleType(sampleType).setRule(ExplicitDataRule()).build();
+        dataSignal = SignalWithDescriptor(context, dataDescriptor, nullptr, "Signal");
+        dataSignal.setDomainSignal(domainSignal);
+
+        PropertyObjectPtr config;
+        if (configure)
+        {
+            config = module.getAvailableFunctionBlockTypes().get(functionBlockId).createDefaultConfig();
+            configure(config);
+        }
+
+        fb = module.createFunctionBlock(functionBlockId, nullptr, "FB", config);
+    }
+
+    ~RefFunctionBlockFixture()
+    {
+        context.getScheduler().stop();
+    }
+
+    // Connects the input signal and reads the output signal with the given local ID, or the first output signal
+    void connect(const std::string& outputLocalId = "")
+    {
+        fb.getInputPorts()[0].connect(dataSignal);
+
+        SignalPtr output = fb.getSignals()[0];
+        for (const auto& signal : fb.getSignals())
+            if (signal.getLocalId() == outputLocalId)
+                output = signal;
+        reader = PacketReader(output);
+    }
+
+    template <typename T>
+    void send(const std::vector<T>& samples, Int offset)
+    {
+        const auto domainPacket = DataPacket(domainSignal.getDescriptor(), samples.size(), offset);
+        const auto dataPacket = DataPacketWithDomain(domainPacket, dataSignal.getDescriptor(), samples.size());
+        std::memcpy(dataPacket.getRawData(), samples.data(), samples.size() * sizeof(T));
+
+        domainSignal.sendPacket(domainPacket);
+        dataSignal.sendPacket(dataPacket);
+    }
+
+    // Returns false if the function block did not produce `sampleCount` output samples in time
+    bool receive(SizeT sampleCount)
+    {
+        SizeT received = 0;
+        for (int spins = 0; received < sampleCount && spins < 1000000; ++spins)
+        {
+            const auto packet = reader.read();
+            if (!packet.assigned())
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            if (packet.getType() == PacketType::Data)
+                received += packet.asPtr<IDataPacket>().getSampleCount();
+        }
+        return received >= sampleCount;
+    }
+
+    ContextPtr context;
+    ModulePtr module;
+    FunctionBlockPtr fb;
+    SignalConfigPtr domainSignal;
+    SignalConfigPtr dataSignal;
+    PacketReaderPtr reader;
+};
+
+static std::vector<float> createSineSamples(SizeT sampleCount, SizeT period)
+{
+    const double pi = std::acos(-1.0);
+    std::vector<float> samples(sampleCount);
+    for (SizeT i = 0; i < sampleCount; i++)
+        samples[i] = static_cast<float>(std::sin(2.0 * pi * static_cast<double>(i % period) / static_cast<double>(period)));
+    return samples;
+}
+
+static void BM_FFTThroughput(benchmark::State& state)
+{
+    constexpr SizeT samplesPerPacket = 100000;
+    const auto blockSize = static_cast<SizeT>(state.range(0));
+    const SizeT blocksPerPacket = samplesPerPacket / blockSize;
+
+    RefFunctionBlockFixture fixture("RefFBModuleFFT");
+    fixture.fb.setPropertyValue("BlockSize", static_cast<Int>(blockSize / 2));
+    fixture.connect();
+
+    const auto samples = createSineSamples(blocksPerPacket * blockSize, blockSize / 8);
+
+    Int offset = 0;
+    for (auto _ : state)
+    {
+        fixture.send(samples, offset);
+        offset += static_cast<Int>(samples.size());
+
+        if (!fixture.receive(blocksPerPacket))
+        {
+            state.SkipWithError("FFT function block did not produce all blocks");
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * blocksPerPacket));
+    state.counters["blocks_per_second"] = benchmark::Counter(static_cast<double>(state.iterations() * blocksPerPacket), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_FFTThroughput)->ArgName("block_size")->Arg(64)->Arg(256)->Arg(1024)->Arg(2048)->Arg(8192)->UseRealTime();
+
+// The statistics function block runs on the sending thread, so its output is ready when sendPacket returns
+static void BM_StatisticsThroughput(benchmark::State& state)
+{
+    constexpr SizeT samplesPerPacket = 100000;
+    const auto overlap = static_cast<Int>(state.range(0));
+
+    const auto configure = [](const PropertyObjectPtr& config)
+    {
+        config.setPropertyValue("UseMultiThreadedScheduler", false);
+        config.setPropertyValue("ExtendedStatistics", true);
+    };
+
+    RefFunctionBlockFixture fixture("RefFBModuleStatistics", SampleType::Float64, configure);
+    fixture.fb.setPropertyValue("BlockSize", 1024);
+    fixture.fb.setPropertyValue("Overlap", overlap);
+    fixture.connect("avg");
+
+    std::vector<double> samples(samplesPerPacket);
+    for (SizeT i = 0; i < samples.size(); i++)
+        samples[i] = std::sin(0.01 * static_cast<double>(i));
+
+    Int offset = 0;
+    for (auto _ : state)
+    {
+        fixture.send(samples, offset);
+        offset += static_cast<Int>(samples.size());
+
+        const auto packets = fixture.reader.readAll();
+        benchmark::DoNotOptimize(packets);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * samplesPerPacket));
+}
+BENCHMARK(BM_StatisticsThroughput)->ArgName("overlap_percent")->Arg(0)->Arg(75);
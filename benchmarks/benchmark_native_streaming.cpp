@@ -0,0 +1,352 @@
+#include <opendaq/opendaq.h>
+#include <native_streaming_client_module/module_dll.h>
+#include <native_streaming_server_module/module_dll.h>
+#include <ref_device_module/module_dll.h>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <ctime>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace daq;
+
+// Streams the first reference device channel over a native streaming connection on the loopback interface.
+// The reference device generates samples in real time, so the result shows whether the client keeps up with
+// the configured sample rate and how long it waits for each block.
+
+static InstancePtr createServerInstance(double sampleRate)
+{
+    const auto logger = Logger(nullptr, LogLevel::Error);
+    const auto context = Context(Scheduler(logger), logger, TypeManager(), ModuleManager("[[none]]"), nullptr);
+    auto instance = InstanceCustom(context, "local");
+
+    ModulePtr refDeviceModule;
+    createRefDeviceModule(&refDeviceModule, instance.getContext());
+    instance.getModuleManager().addModule(refDeviceModule);
+
+    ModulePtr serverModule;
+    createNativeStreamingServerModule(&serverModule, instance.getContext());
+    instance.getModuleManager().addModule(serverModule);
+
+    const auto device = instance.addDevice("daqref://device1");
+    device.setPropertyValue("GlobalSampleRate", sampleRate);
+    instance.addServer("OpenDAQNativeStreaming", nullptr);
+
+    return instance;
+}
+
+static InstancePtr createClientInstance()
+{
+    const auto logger = Logger(nullptr, LogLevel::Error);
+    const auto context = Context(Scheduler(logger), logger, TypeManager(), ModuleManager("[[none]]"), nullptr);
+    auto instance = InstanceCustom(context, "client");
+
+    ModulePtr clientModule;
+    createNativeStreamingClientModule(&clientModule, instance.getContext());
+    instance.getModuleManager().addModule(clientModule);
+
+    instance.addDevice("daq.ns://127.0.0.1/");
+    return instance;
+}
+
+static void BM_NativeStreamingLoopback(benchmark::State& state)
+{
+    constexpr SizeT timeoutMs = 5000;
+    const auto sampleRate = static_cast<double>(state.range(0));
+    const auto blockSize = std::max<SizeT>(static_cast<SizeT>(sampleRate / 100), 1);
+
+    const auto server = createServerInstance(sampleRate);
+    const auto client = createClientInstance();
+
+    const auto signal = client.getSignalsRecursive(search::LocalId("AI0"))[0];
+    const auto reader = StreamReader<double, Int>(signal, ReadTimeoutType::All);
+
+    std::vector<double> values(blockSize);
+    std::vector<Int> domain(blockSize);
+
+    // the first reads return the descriptor events and any samples buffered during the subscription
+    for (int i = 0; i < 2; ++i)
+    {
+        SizeT count = blockSize;
+        reader.readWithDomain(values.data(), domain.data(), &count, timeoutMs);
+    }
+
+    SizeT samples = 0;
+    for (auto _ : state)
+    {
+        SizeT count = blockSize;
+        const auto status = reader.readWithDomain(values.data(), domain.data(), &count, timeoutMs);
+        if (status.getReadStatus() == ReadStatus::Ok && count < blockSize)
+        {
+            state.SkipWithError("Read timed out");
+            break;
+        }
+
+        samples += count;
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(samples));
+    state.SetBytesProcessed(static_cast<int64_t>(samples * (sizeof(double) + sizeof(Int))));
+}
+BENCHMARK(BM_NativeStreamingLoopback)
+    ->Arg(1000)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->MinTime(2.0);
+
+// Streams 1000 low-rate signals (one packet per second each) alongside a 10 Hz probe signal, with the server
+// reading signal data either by polling or event-driven. Each iteration waits for one probe packet on the client.
+// Reports the server-to-client latency percentiles of the probe packets and the process CPU time used while streaming.
+static void BM_NativeStreamingReadMode(benchmark::State& state)
+{
+    using namespace std::chrono;
+    using TimePoints = std::unordered_map<Int, steady_clock::time_point>;
+
+    constexpr SizeT lowRateSignalCount = 1000;
+    const bool eventDriven = state.range(0) != 0;
+
+    const auto serverLogger = Logger(nullptr, LogLevel::Error);
+    const auto serverContext = Context(Scheduler(serverLogger), serverLogger, TypeManager(), ModuleManager("[[none]]"), nullptr);
+    const auto server = InstanceCustom(serverContext, "local");
+    {
+        ModulePtr refDeviceModule;
+        createRefDeviceModule(&refDeviceModule, server.getContext());
+        server.getModuleManager().addModule(refDeviceModule);
+
+        ModulePtr serverModule;
+        createNativeStreamingServerModule(&serverModule, server.getContext());
+        server.getModuleManager().addModule(serverModule);
+
+        const auto lowRateDevice = server.addDevice("daqref://device0");
+        lowRateDevice.setPropertyValue("NumberOfChannels", lowRateSignalCount);
+        lowRateDevice.setPropertyValue("GlobalSampleRate", 1.0);
+        lowRateDevice.setPropertyValue("AcquisitionLoopTime", 1000);
+
+        const auto probeDevice = server.addDevice("daqref://device1");
+        probeDevice.setPropertyValue("NumberOfChannels", 1);
+        probeDevice.setPropertyValue("GlobalSampleRate", 10.0);
+        probeDevice.setPropertyValue("AcquisitionLoopTime", 100);
+
+        const auto config = server.getAvailableServerTypes().get("OpenDAQNativeStreaming").createDefaultConfig();
+        config.setPropertyValue("StreamingDataEventDriven", eventDriven);
+        server.addServer("OpenDAQNativeStreaming", config);
+    }
+
+    const auto clientLogger = Logger(nullptr, LogLevel::Error);
+    const auto clientContext = Context(Scheduler(clientLogger), clientLogger, TypeManager(), ModuleManager("[[none]]"), nullptr);
+    const auto client = InstanceCustom(clientContext, "client");
+    ModulePtr clientModule;
+    createNativeStreamingClientModule(&clientModule, client.getContext());
+    client.getModuleManager().addModule(clientModule);
+    const auto clientDevice = client.addDevice("daq.nd://127.0.0.1");
+
+    std::vector<PacketReaderPtr> lowRateReaders;
+    for (const auto& signal : clientDevice.getDevices(search::LocalId("RefDev0"))[0].getSignals(search::Recursive(search::Visible())))
+        lowRateReaders.push_back(PacketReader(signal));
+
+    const auto clientSignal = clientDevice.getDevices(search::LocalId("RefDev1"))[0].getSignals(search::Recursive(search::LocalId("AI0")))[0];
+    const auto serverSignal = server.getDevices(search::LocalId("RefDev1"))[0].getSignals(search::Recursive(search::LocalId("AI0")))[0];
+
+    // Packets are matched by their domain offset, as the server reader also sees packets sent before the client subscribed
+    std::mutex sync;
+    std::condition_variable received;
+    TimePoints serverTimes;
+    TimePoints clientTimes;
+    std::vector<double> latencies;
+
+    const auto recordDataPackets = [&sync](const PacketReaderPtr& reader, TimePoints& times)
+    {
+        const auto now = steady_clock::now();
+        for (const auto& packet : reader.readAll())
+        {
+            if (packet.getType() != PacketType::Data)
+                continue;
+
+            const auto domainPacket = packet.asPtr<IDataPacket>(true).getDomainPacket();
+            if (domainPacket.assigned() && domainPacket.getOffset().assigned())
+            {
+                std::scoped_lock lock(sync);
+                times.emplace(domainPacket.getOffset().getIntValue(), now);
+            }
+        }
+    };
+
+    const auto serverReader = PacketReader(serverSignal);
+    serverReader.setOnDataAvailable([&] { recordDataPackets(serverReader, serverTimes); });
+    const auto clientReader = PacketReader(clientSignal);
+    clientReader.setOnDataAvailable([&]
+    {
+        recordDataPackets(clientReader, clientTimes);
+        received.notify_one();
+    });
+
+    // Let the subscriptions settle
+    std::this_thread::sleep_for(seconds(2));
+    {
+        std::scoped_lock lock(sync);
+        clientTimes.clear();
+    }
+
+    const auto cpuStart = std::clock();
+    const auto wallStart = steady_clock::now();
+
+    for (auto _ : state)
+    {
+        std::unique_lock lock(sync);
+        if (!received.wait_for(lock, seconds(5), [&clientTimes] { return !clientTimes.empty(); }))
+        {
+            state.SkipWithError("Probe packet not received");
+            break;
+        }
+
+        for (const auto& [offset, clientTime] : clientTimes)
+        {
+            if (const auto it = serverTimes.find(offset); it != serverTimes.end())
+                latencies.push_back(duration<double, std::micro>(clientTime - it->second).count());
+        }
+        clientTimes.clear();
+    }
+
+    const double cpuSeconds = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+    const double wallSeconds = duration<double>(steady_clock::now() - wallStart).count();
+
+    serverReader.setOnDataAvailable(nullptr);
+    clientReader.setOnDataAvailable(nullptr);
+
+    if (!latencies.empty())
+    {
+        std::sort(latencies.begin(), latencies.end());
+        state.counters["p50_us"] = latencies[latencies.size() / 2];
+        state.counters["p99_us"] = latencies[latencies.size() * 99 / 100];
+        state.counters["max_us"] = latencies.back();
+    }
+    state.counters["cpu_percent"] = 100.0 * cpuSeconds / wallSeconds;
+}
+BENCHMARK(BM_NativeStreamingReadMode)
+    ->ArgName("event_driven")
+    ->Arg(0)
+    ->Arg(1)
+    ->Iterations(100)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Connects to a server with 2500 reference channels (5000 signals) and waits until every signal has received its
+// descriptor changed event packet, with JSON or binary event packet encoding.
+static void BM_NativeStreamingConnectManySignals(benchmark::State& state)
+{
+    using namespace std::chrono;
+
+    constexpr SizeT channelCount = 2500;
+    const bool binaryEventEncoding = state.range(0) != 0;
+
+    const auto serverLogger = Logger(nullptr, LogLevel::Error);
+    const auto serverContext = Context(Scheduler(serverLogger), serverLogger, TypeManager(), ModuleManager("[[none]]"), nullptr);
+    const auto server = InstanceCustom(serverContext, "local");
+    {
+        ModulePtr refDeviceModule;
+        createRefDeviceModule(&refDeviceModule, server.getContext());
+        server.getModuleManager().addModule(refDeviceModule);
+
+        ModulePtr serverModule;
+        createNativeStreamingServerModule(&serverModule, server.getContext());
+        server.getModuleManager().addModule(serverModule);
+
+        const auto refDevice = server.addDevice("daqref://device0");
+        refDevice.setPropertyValue("NumberOfChannels", channelCount);
+        refDevice.setPropertyValue("GlobalSampleRate", 1.0);
+        refDevice.setPropertyValue("AcquisitionLoopTime", 1000);
+        server.addServer("OpenDAQNativeStreaming", nullptr);
+    }
+
+    const auto clientLogger = Logger(nullptr, LogLevel::Error);
+    const auto clientContext = Context(Scheduler(clientLogger), clientLogger, TypeManager(), ModuleManager("[[none]]"), nullptr);
+    const auto client = InstanceCustom(clientContext, "client");
+    ModulePtr clientModule;
+    createNativeStreamingClientModule(&clientModule, client.getContext());
+    client.getModuleManager().addModule(clientModule);
+
+    const auto config = client.createDefaultAddDeviceConfig();
+    const PropertyObjectPtr deviceConfig = config.getPropertyValue("Device");
+    const PropertyObjectPtr streamingDeviceConfig = deviceConfig.getPropertyValue("OpenDAQNativeStreaming");
+    const PropertyObjectPtr transportLayerConfig = streamingDeviceConfig.getPropertyValue("TransportLayerConfig");
+    transportLayerConfig.setPropertyValue("EventPacketEncoding", binaryEventEncoding ? 1 : 0);
+
+    SizeT signalCount = 0;
+    for (auto _ : state)
+    {
+        const auto start = steady_clock::now();
+        const auto clientDevice = client.addDevice("daq.ns://127.0.0.1", config);
+        const auto signals = clientDevice.getSignals(search::Recursive(search::Any()));
+
+        std::vector<PacketReaderPtr> readers;
+        readers.reserve(signals.getCount());
+        for (const auto& signal : signals)
+            readers.push_back(PacketReader(signal));
+
+        // the first packet of each reader is the descriptor changed event packet
+        const auto isDescribed = [](const PacketReaderPtr& reader) { return reader.getAvailableCount() > 0; };
+        while (!std::all_of(readers.begin(), readers.end(), isDescribed))
+        {
+            if (steady_clock::now() - start > seconds(120))
+            {
+                state.SkipWithError("Descriptors not received");
+                break;
+            }
+            std::this_thread::sleep_for(milliseconds(1));
+        }
+
+        signalCount = readers.size();
+
+        state.PauseTiming();
+        readers.clear();
+        client.removeDevice(clientDevice);
+        state.ResumeTiming();
+    }
+
+    state.counters["signals"] = static_cast<double>(signalCount);
+}
+BENCHMARK(BM_NativeStreamingConnectManySignals)
+    ->ArgName("binary")
+    ->Arg(0)
+    ->Arg(1)
+    ->Iterations(3)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Reads a root device property of a native config client. Properties without read handlers are served from the
+// mirrored client object; properties with read handlers are read from the server on each call.
+static void BM_NativeConfigPropertyRead(benchmark::State& state)
+{
+    const bool onRead = state.range(0) != 0;
+
+    const auto server = createServerInstance(1000.0);
+    server.addProperty(IntProperty("PolledValue", 0));
+    if (onRead)
+        server.getRootDevice().getOnPropertyValueRead("PolledValue") += [](PropertyObjectPtr&, PropertyValueEventArgsPtr&) {};
+
+    const auto clientLogger = Logger(nullptr, LogLevel::Error);
+    const auto clientContext = Context(Scheduler(clientLogger), clientLogger, TypeManager(), ModuleManager("[[none]]"), nullptr);
+    const auto client = InstanceCustom(clientContext, "client");
+    ModulePtr clientModule;
+    createNativeStreamingClientModule(&clientModule, client.getContext());
+    client.getModuleManager().addModule(clientModule);
+    const auto clientDevice = client.addDevice("daq.nd://127.0.0.1");
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(clientDevice.getPropertyValue("PolledValue"));
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_NativeConfigPropertyRead)
+    ->ArgName("on_read")
+    ->Arg(0)
+    ->Arg(1)
+    ->Iterations(10000)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
@@ -0,0 +1,155 @@
+#include "benchmark_common.h"
+#include <packet_streaming/packet_streaming_client.h>
+#include <packet_streaming/packet_streaming_server.h>
+#include <opendaq/range_factory.h>
+#include <opendaq/reference_domain_info_factory.h>
+#include <opendaq/scaling_factory.h>
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace daq;
+using namespace daq::benchmarks;
+using namespace daq::packet_streaming;
+
+namespace
+{
+
+// Copies a server packet buffer into a buffer owned by the receiving side, as a transport would
+PacketBufferPtr transmit(const PacketBufferPtr& packetBuffer)
+{
+    auto header = static_cast<GenericPacketHeader*>(std::malloc(packetBuffer->packetHeader->size));
+    std::memcpy(header, packetBuffer->packetHeader, packetBuffer->packetHeader->size);
+
+    void* payload = nullptr;
+    if (packetBuffer->packetHeader->payloadSize > 0)
+    {
+        payload = std::malloc(packetBuffer->packetHeader->payloadSize);
+        std::memcpy(payload, packetBuffer->payload, packetBuffer->packetHeader->payloadSize);
+    }
+
+    return std::make_shared<PacketBuffer>(
+        header,
+        payload,
+        [header, payload]
+        {
+            std::free(header);
+            std::free(payload);
+        },
+        false);
+}
+
+DataDescriptorPtr createFullValueDescriptor(const std::string& name)
+{
+    return DataDescriptorBuilder()
+        .setName(name)
+        .setSampleType(SampleType::Float64)
+        .setUnit(Unit("V", 1, "volt", "voltage"))
+        .setValueRange(Range(-10, 10))
+        .setPostScaling(LinearScaling(0.5, 1.0, SampleType::Int32, ScaledSampleType::Float64))
+        .setMetadata(Dict<IString, IString>({{"key", "value"}}))
+        .build();
+}
+
+DataDescriptorPtr createFullDomainDescriptor()
+{
+    return DataDescriptorBuilder()
+        .setSampleType(SampleType::Int64)
+        .setRule(LinearDataRule(10, 0))
+        .setTickResolution(Ratio(1, 1000000))
+        .setUnit(Unit("s", -1, "second", "time"))
+        .setOrigin("1970-01-01T00:00:00")
+        .setReferenceDomainInfo(ReferenceDomainInfoBuilder()
+                                    .setReferenceDomainId("Domain")
+                                    .setReferenceDomainOffset(100)
+                                    .setReferenceTimeProtocol(TimeProtocol::Gps)
+                                    .build())
+        .build();
+}
+
+}
+
+// Encodes, transmits and decodes descriptor changed event packets, as sent for each signal when a client connects
+static void BM_EventPacketEncoding(benchmark::State& state)
+{
+    constexpr size_t signalCount = 5000;
+    const bool binary = state.range(0) != 0;
+
+    std::vector<PacketPtr> eventPackets;
+    eventPackets.reserve(signalCount);
+    const auto domainDescriptor = createFullDomainDescriptor();
+    for (size_t i = 0; i < signalCount; ++i)
+        eventPackets.push_back(DataDescriptorChangedEventPacket(createFullValueDescriptor("AI" + std::to_string(i)), domainDescriptor));
+
+    PacketStreamingServer server(PACKET_ZERO_PAYLOAD_SIZE, PACKET_RELEASE_THRESHOLD_DEFAULT, false, 0, binary);
+    PacketStreamingClient client;
+
+    size_t i = 0;
+    size_t payloadBytes = 0;
+    for (auto _ : state)
+    {
+        server.addDaqPacket(static_cast<uint32_t>(i), eventPackets[i]);
+        const auto packetBuffer = server.getNextPacketBuffer();
+        payloadBytes += packetBuffer->packetHeader->payloadSize;
+
+        client.addPacketBuffer(transmit(packetBuffer));
+        benchmark::DoNotOptimize(std::get<1>(client.getNextDaqPacket()).getObject());
+
+        i = (i + 1) % signalCount;
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.counters["payload_bytes"] = benchmark::Counter(static_cast<double>(payloadBytes), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_EventPacketEncoding)->ArgName("binary")->Arg(0)->Arg(1);
+
+// Encodes, transmits and decodes value/domain packet pairs of a high-rate channel with small packets,
+// using full or compact data packet headers
+static void BM_DataPacketHeaderEncoding(benchmark::State& state)
+{
+    constexpr size_t sampleCount = 4;
+    const bool compact = state.range(0) != 0;
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
+    const auto domainDescriptor =
+        DataDescriptorBuilder().setSampleType(SampleType::Int64).setRule(LinearDataRule(1, 0)).setTickResolution(Ratio(1, 1000000)).build();
+
+    PacketStreamingServer server(PACKET_ZERO_PAYLOAD_SIZE, PACKET_RELEASE_THRESHOLD_DEFAULT, false, 0, false, compact);
+    PacketStreamingClient client;
+
+    server.addDaqPacket(1, DataDescriptorChangedEventPacket(valueDescriptor, domainDescriptor));
+    server.addDaqPacket(2, DataDescriptorChangedEventPacket(domainDescriptor, nullptr));
+    while (const auto packetBuffer = server.getNextPacketBuffer())
+        client.addPacketBuffer(transmit(packetBuffer));
+    while (std::get<1>(client.getNextDaqPacket()).assigned())
+        ;
+
+    size_t i = 0;
+    size_t headerBytes = 0;
+    size_t payloadBytes = 0;
+    for (auto _ : state)
+    {
+        auto domainPacket = DataPacket(domainDescriptor, sampleCount, static_cast<Int>(i++ * sampleCount));
+        auto valuePacket = DataPacketWithDomain(domainPacket, valueDescriptor, sampleCount);
+
+        server.addDaqPacket(2, std::move(domainPacket));
+        server.addDaqPacket(1, std::move(valuePacket));
+        server.checkAndSendReleasePacket(false);
+
+        while (const auto packetBuffer = server.getNextPacketBuffer())
+        {
+            headerBytes += packetBuffer->packetHeader->size;
+            payloadBytes += packetBuffer->packetHeader->payloadSize;
+            client.addPacketBuffer(transmit(packetBuffer));
+        }
+
+        while (std::get<1>(client.getNextDaqPacket()).assigned())
+            ;
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.counters["header_bytes"] = benchmark::Counter(static_cast<double>(headerBytes), benchmark::Counter::kAvgIterations);
+    state.counters["wire_bytes"] = benchmark::Counter(static_cast<double>(headerBytes + payloadBytes), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_DataPacketHeaderEncoding)->ArgName("compact")->Arg(0)->Arg(1);
@@ -0,0 +1,122 @@
+#include "benchmark_common.h"
+#include <opendaq/malloc_allocator_factory.h>
+#include <opendaq/packet_buffer_factory.h>
+#include <opendaq/pool_allocator_factory.h>
+#ifdef OPENDAQ_MIMALLOC_SUPPORT
+#include <opendaq/mimalloc_allocator_factory.h>
+#endif
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace daq;
+using namespace daq::benchmarks;
+
+static void BM_DataPacket(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    const auto descriptor = createValueDescriptor();
+
+    for (auto _ : state)
+    {
+        auto packet = DataPacket(descriptor, sampleCount);
+        benchmark::DoNotOptimize(packet.getRawData());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * sampleCount));
+}
+BENCHMARK(BM_DataPacket)->RangeMultiplier(16)->Range(1, 1 << 16);
+
+static void BM_DataPacketWithDomain(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    const auto valueDescriptor = createValueDescriptor();
+    const auto domainDescriptor = createDomainDescriptor();
+
+    Int offset = 0;
+    for (auto _ : state)
+    {
+        const auto domainPacket = DataPacket(domainDescriptor, sampleCount, offset);
+        auto packet = DataPacketWithDomain(domainPacket, valueDescriptor, sampleCount);
+        benchmark::DoNotOptimize(packet.getObject());
+        offset += static_cast<Int>(sampleCount);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * sampleCount));
+}
+BENCHMARK(BM_DataPacketWithDomain)->RangeMultiplier(16)->Range(1, 1 << 16);
+
+static void BM_PacketBufferCreatePacket(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    const auto valueDescriptor = createValueDescriptor();
+    const auto domainPacket = DataPacket(createDomainDescriptor(), sampleCount, 0);
+
+    // room for a few packets in flight, each is released before the next one is created
+    const auto buffer = PacketBuffer(PacketBufferBuilder().setSizeInBytes(sampleCount * sizeof(double) * 4));
+
+    for (auto _ : state)
+    {
+        auto packet = buffer.createPacket(sampleCount, valueDescriptor, domainPacket);
+        benchmark::DoNotOptimize(packet.getObject());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * sampleCount));
+}
+BENCHMARK(BM_PacketBufferCreatePacket)->RangeMultiplier(16)->Range(1, 1 << 16);
+
+enum class PacketAllocator
+{
+    Default,
+    Malloc,
+    Pool,
+    MiMalloc
+};
+
+// Keeps a few packets in flight, like a signal whose packets are still queued in connections
+// when the next ones are created
+static void BM_DataPacketWithAllocator(benchmark::State& state)
+{
+    constexpr size_t inFlight = 16;
+    const auto kind = static_cast<PacketAllocator>(state.range(0));
+    const auto sampleCount = static_cast<SizeT>(state.range(1));
+    const auto descriptor = createValueDescriptor();
+
+    AllocatorPtr allocator;
+    PoolAllocatorPtr pool;
+    switch (kind)
+    {
+        case PacketAllocator::Default:
+            break;
+        case PacketAllocator::Malloc:
+            allocator = MallocAllocator();
+            break;
+        case PacketAllocator::Pool:
+            pool = PoolAllocator();
+            allocator = pool;
+            break;
+        case PacketAllocator::MiMalloc:
+#ifdef OPENDAQ_MIMALLOC_SUPPORT
+            allocator = MiMallocAllocator();
+            break;
+#else
+            state.SkipWithError("mimalloc support is not enabled");
+            return;
+#endif
+    }
+
+    std::vector<DataPacketPtr> packets(inFlight);
+    size_t slot = 0;
+    for (auto _ : state)
+    {
+        packets[slot] = allocator.assigned() ? DataPacketWithAllocator(nullptr, descriptor, sampleCount, allocator)
+                                             : DataPacket(descriptor, sampleCount);
+        benchmark::DoNotOptimize(packets[slot].getRawData());
+        slot = (slot + 1) % inFlight;
+    }
+    packets.clear();
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    if (pool.assigned())
+        state.counters["pool_hits"] = benchmark::Counter(static_cast<double>(pool.getHitCount()), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_DataPacketWithAllocator)->ArgNames({"allocator", "samples"})->ArgsProduct({{0, 1, 2, 3}, {64, 1024, 16384}});
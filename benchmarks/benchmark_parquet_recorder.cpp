@@ -0,0 +1,72 @@
+#include "benchmark_common.h"
+#include <coretypes/filesystem.h>
+#include <opendaq/function_block_ptr.h>
+#include <opendaq/module_ptr.h>
+#include <opendaq/recorder_ptr.h>
+#include <parquet_recorder_module/module_dll.h>
+#include <benchmark/benchmark.h>
+#include <numeric>
+
+using namespace daq;
+using namespace daq::benchmarks;
+
+// Records one second of a 1 MS/s channel, sent in packets of 1000 samples, from the first sent packet until the
+// recorder is destroyed and the file is complete. A row group size of 0 writes a row group per packet.
+static void BM_ParquetRecorderSustainedWrite(benchmark::State& state)
+{
+    constexpr Int sampleCount = 1'000'000;
+    constexpr Int packetSize = 1000;
+    const auto rowGroupSize = static_cast<Int>(state.range(0));
+
+    const fs::path dir = fs::current_path() / "benchmark_parquet_recorder";
+    const auto context = createBenchmarkContext();
+    const auto signal = createSignalWithDomain(context, "signal");
+
+    ModulePtr module;
+    createParquetRecorderModule(&module, context);
+
+    SizeT fileBytes = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        fs::remove_all(dir);
+        fs::create_directories(dir);
+
+        auto fb = module.createFunctionBlock("ParquetRecorder", nullptr, "fb");
+        fb.getInputPorts()[0].connect(signal);
+        fb.setPropertyValue("Path", dir.string());
+        fb.setPropertyValue("RowGroupSize", rowGroupSize);
+        fb.asPtr<IRecorder>().startRecording();
+        state.ResumeTiming();
+
+        for (Int offset = 0; offset < sampleCount; offset += packetSize)
+        {
+            const auto packet = createPacketWithDomain(signal, packetSize, offset);
+            const auto data = static_cast<Float*>(packet.getRawData());
+            std::iota(data, data + packetSize, static_cast<Float>(offset));
+            signal.sendPacket(packet);
+        }
+
+        fb.asPtr<IRecorder>().stopRecording();
+        fb.release();
+
+        state.PauseTiming();
+        fileBytes = 0;
+        for (const auto& item : fs::directory_iterator(dir))
+            fileBytes += fs::file_size(item.path());
+        state.ResumeTiming();
+    }
+
+    context.getScheduler().stop();
+    fs::remove_all(dir);
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * sampleCount));
+    state.counters["file_bytes"] = static_cast<double>(fileBytes);
+}
+BENCHMARK(BM_ParquetRecorderSustainedWrite)
+    ->ArgName("row_group_size")
+    ->Arg(0)
+    ->Arg(65536)
+    ->Arg(1048576)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,241 @@
+#include <coreobjects/eval_value_factory.h>
+#include <coreobjects/property_factory.h>
+#include <coreobjects/property_object_class_factory.h>
+#include <coreobjects/property_object_factory.h>
+#include <coreobjects/property_object_internal_ptr.h>
+#include <coretypes/type_manager_factory.h>
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace daq;
+
+// Reads every property of an object with 200 integer properties. Names passed as new strings are compared by value;
+// names taken from the properties are interned and hit the pointer equality fast path.
+static void BM_PropertyLookup(benchmark::State& state)
+{
+    constexpr size_t propertyCount = 200;
+    const bool internedNames = state.range(0) != 0;
+
+    const auto obj = PropertyObject();
+    std::vector<std::string> names;
+    for (size_t i = 0; i < propertyCount; ++i)
+    {
+        names.push_back("Property" + std::to_string(i));
+        obj.addProperty(IntProperty(names.back(), 0));
+        obj.setPropertyValue(names.back(), static_cast<Int>(i));
+    }
+
+    std::vector<StringPtr> propertyNames;
+    for (const auto& prop : obj.getAllProperties())
+        propertyNames.push_back(prop.getName());
+
+    for (auto _ : state)
+    {
+        Int sum = 0;
+        for (size_t i = 0; i < propertyCount; ++i)
+            sum += static_cast<Int>(obj.getPropertyValue(internedNames ? propertyNames[i] : String(names[i])));
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * propertyCount));
+}
+BENCHMARK(BM_PropertyLookup)->ArgName("interned_names")->Arg(0)->Arg(1);
+
+enum class ExpressionWriteMode
+{
+    None,
+    OtherObject,
+    ReferencedProperty
+};
+
+// Reads the value, maximum value and visibility of 10000 properties defined by expressions referencing two other
+// properties. Between reads, nothing is written, a property of another object is written, or the referenced
+// maximum is written, which recalculates every expression.
+static void BM_ExpressionProperties(benchmark::State& state)
+{
+    constexpr size_t propertyCount = 10000;
+    const auto mode = static_cast<ExpressionWriteMode>(state.range(0));
+
+    const auto obj = PropertyObject();
+    obj.addProperty(IntProperty("Max", 100));
+    obj.addProperty(BoolProperty("Visible", true));
+
+    const auto otherObj = PropertyObject();
+    otherObj.addProperty(IntProperty("Max", 100));
+
+    std::vector<StringPtr> names;
+    for (size_t i = 0; i < propertyCount; ++i)
+    {
+        names.push_back(String("Property" + std::to_string(i)));
+        obj.addProperty(IntPropertyBuilder(names.back(), EvalValue("$Max / 2"))
+                            .setMaxValue(EvalValue("$Max"))
+                            .setVisible(EvalValue("$Visible"))
+                            .build());
+    }
+
+    Int max = 100;
+    for (auto _ : state)
+    {
+        if (mode == ExpressionWriteMode::OtherObject)
+            otherObj.setPropertyValue("Max", ++max);
+        else if (mode == ExpressionWriteMode::ReferencedProperty)
+            obj.setPropertyValue("Max", ++max);
+
+        Int sum = 0;
+        for (const auto& name : names)
+        {
+            const auto prop = obj.getProperty(name);
+            sum += static_cast<Int>(obj.getPropertyValue(name)) + static_cast<Int>(prop.getMaxValue());
+            sum += prop.getVisible() ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * propertyCount));
+}
+BENCHMARK(BM_ExpressionProperties)->ArgName("write_mode")->Arg(0)->Arg(1)->Arg(2)->Unit(benchmark::kMillisecond);
+
+enum class ManyObjectsOperation
+{
+    Create,
+    Write,
+    Read,
+    Destroy
+};
+
+// Creates, writes, reads or destroys 10000 objects of a class derived from a class with a dozen properties of
+// different types. Only the selected operation is timed.
+static void BM_ManyPropertyObjects(benchmark::State& state)
+{
+    constexpr size_t objectCount = 10000;
+    const auto operation = static_cast<ManyObjectsOperation>(state.range(0));
+
+    const auto typeManager = TypeManager();
+    typeManager.addType(PropertyObjectClassBuilder(typeManager, "Base")
+                            .addProperty(FloatPropertyBuilder("FloatReadOnly", 1.0).setReadOnly(true).build())
+                            .addProperty(FloatProperty("Float", 1.0))
+                            .addProperty(ListProperty("List", List<Int>(1, 2, 3, 4)))
+                            .addProperty(ObjectProperty("Object", PropertyObject()))
+                            .addProperty(ReferenceProperty("IntReference", EvalValue("%TwoHopReference")))
+                            .addProperty(ReferenceProperty("TwoHopReference", EvalValue("%Referenced")))
+                            .addProperty(SelectionProperty("Selection", List<IString>("a", "b", "c"), 0))
+                            .addProperty(DictProperty("Dict", Dict<IInteger, IString>({{0, "a"}, {1, "b"}})))
+                            .addProperty(IntProperty("Referenced", 10))
+                            .addProperty(StringProperty("String", "Orange"))
+                            .build());
+    typeManager.addType(
+        PropertyObjectClassBuilder(typeManager, "Derived").setParentName("Base").addProperty(IntProperty("Additional", 1)).build());
+
+    std::vector<PropertyObjectPtr> objects;
+    objects.reserve(objectCount);
+
+    const auto createObjects = [&]
+    {
+        for (size_t i = 0; i < objectCount; ++i)
+            objects.push_back(PropertyObject(typeManager, "Derived"));
+    };
+
+    if (operation != ManyObjectsOperation::Create)
+        createObjects();
+
+    for (auto _ : state)
+    {
+        switch (operation)
+        {
+            case ManyObjectsOperation::Create:
+                createObjects();
+                state.PauseTiming();
+                objects.clear();
+                state.ResumeTiming();
+                break;
+            case ManyObjectsOperation::Write:
+                for (size_t i = 0; i < objectCount; ++i)
+                {
+                    objects[i].setPropertyValue("Float", static_cast<Float>(i));
+                    objects[i].setPropertyValue("Additional", static_cast<Int>(i));
+                }
+                break;
+            case ManyObjectsOperation::Read:
+            {
+                Float sum = 0;
+                for (size_t i = 0; i < objectCount; ++i)
+                {
+                    sum += static_cast<Float>(objects[i].getPropertyValue("Float"));
+                    sum += static_cast<Int>(objects[i].getPropertyValue("Additional"));
+                    sum += static_cast<Int>(objects[i].getPropertyValue("IntReference"));
+                }
+                benchmark::DoNotOptimize(sum);
+                break;
+            }
+            case ManyObjectsOperation::Destroy:
+                objects.clear();
+                state.PauseTiming();
+                createObjects();
+                state.ResumeTiming();
+                break;
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * objectCount));
+}
+BENCHMARK(BM_ManyPropertyObjects)->ArgName("operation")->Arg(0)->Arg(1)->Arg(2)->Arg(3)->Unit(benchmark::kMillisecond);
+
+// Reads a property of one object from 4 threads, with the object's concurrent read mode disabled or enabled, while
+// another thread writes a different property of the object every 100 us or not at all
+static void BM_ConcurrentPropertyReads(benchmark::State& state)
+{
+    static PropertyObjectPtr obj;
+    static std::atomic<bool> stopWriter;
+    static std::atomic<size_t> writes;
+    static std::thread writer;
+
+    const bool concurrentReads = state.range(0) != 0;
+    const bool withWriter = state.range(1) != 0;
+
+    if (state.thread_index() == 0)
+    {
+        obj = PropertyObject();
+        obj.addProperty(IntProperty("Value", 0));
+        obj.addProperty(FloatProperty("Other", 0.0));
+        obj.setPropertyValue("Value", 1);
+        obj.asPtr<IPropertyObjectInternal>().setConcurrentReadsEnabled(concurrentReads);
+
+        stopWriter = false;
+        writes = 0;
+        if (withWriter)
+        {
+            writer = std::thread([]
+            {
+                while (!stopWriter)
+                {
+                    obj.setPropertyValue("Other", static_cast<Float>(writes++));
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                }
+            });
+        }
+    }
+
+    const StringPtr name = "Value";
+    for (auto _ : state)
+        benchmark::DoNotOptimize(obj.getPropertyValue(name));
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+    if (state.thread_index() == 0)
+    {
+        stopWriter = true;
+        if (writer.joinable())
+            writer.join();
+        state.counters["writes"] = static_cast<double>(writes);
+        obj.release();
+    }
+}
+BENCHMARK(BM_ConcurrentPropertyReads)
+    ->ArgNames({"concurrent_reads", "writer"})
+    ->ArgsProduct({{0, 1}, {0, 1}})
+    ->Threads(4)
+    ->UseRealTime();
@@ -0,0 +1,366 @@
+#include "benchmark_common.h"
+#include <opendaq/reader_factory.h>
+#include <opendaq/reader_utils.h>
+#include <opendaq/sample_type_traits.h>
+#include <opendaq/scaling_factory.h>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+using namespace daq;
+using namespace daq::benchmarks;
+
+// Each iteration sends one packet and reads all of its samples back, so packet creation is part of the measurement.
+// Compare against BM_DataPacketWithDomain to get the reader's share.
+
+template <typename TReader>
+static void skipDescriptorEvent(const TReader& reader, void* values, void* domain)
+{
+    SizeT count = 0;
+    reader.readWithDomain(values, domain, &count);
+}
+
+static void BM_StreamReader(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    const auto context = createBenchmarkContext();
+    const auto signal = createSignalWithDomain(context, "sig");
+    const auto reader = StreamReader<double, Int>(signal);
+
+    std::vector<double> values(sampleCount);
+    std::vector<Int> domain(sampleCount);
+    skipDescriptorEvent(reader, values.data(), domain.data());
+
+    Int offset = 0;
+    for (auto _ : state)
+    {
+        signal.sendPacket(createPacketWithDomain(signal, sampleCount, offset));
+        offset += static_cast<Int>(sampleCount);
+
+        SizeT count = sampleCount;
+        reader.readWithDomain(values.data(), domain.data(), &count);
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * sampleCount));
+    context.getScheduler().stop();
+}
+BENCHMARK(BM_StreamReader)->RangeMultiplier(16)->Range(16, 1 << 16);
+
+static void BM_BlockReader(benchmark::State& state)
+{
+    constexpr SizeT blockSize = 16;
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    const auto context = createBenchmarkContext();
+    const auto signal = createSignalWithDomain(context, "sig");
+    const auto reader = BlockReader<double, Int>(signal, blockSize);
+
+    std::vector<double> values(sampleCount);
+    std::vector<Int> domain(sampleCount);
+    skipDescriptorEvent(reader, values.data(), domain.data());
+
+    Int offset = 0;
+    for (auto _ : state)
+    {
+        signal.sendPacket(createPacketWithDomain(signal, sampleCount, offset));
+        offset += static_cast<Int>(sampleCount);
+
+        SizeT count = sampleCount / blockSize;
+        reader.readWithDomain(values.data(), domain.data(), &count);
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * sampleCount));
+    context.getScheduler().stop();
+}
+BENCHMARK(BM_BlockReader)->RangeMultiplier(16)->Range(16, 1 << 16);
+
+static void BM_TailReader(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    const auto context = createBenchmarkContext();
+    const auto signal = createSignalWithDomain(context, "sig");
+    const auto reader = TailReader<double, Int>(signal, sampleCount);
+
+    std::vector<double> values(sampleCount);
+    std::vector<Int> domain(sampleCount);
+    skipDescriptorEvent(reader, values.data(), domain.data());
+
+    Int offset = 0;
+    for (auto _ : state)
+    {
+        signal.sendPacket(createPacketWithDomain(signal, sampleCount, offset));
+        offset += static_cast<Int>(sampleCount);
+
+        SizeT count = sampleCount;
+        reader.readWithDomain(values.data(), domain.data(), &count);
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * sampleCount));
+    context.getScheduler().stop();
+}
+BENCHMARK(BM_TailReader)->RangeMultiplier(16)->Range(16, 1 << 16);
+
+// Refreshes a 10 s history at 1 MS/s after every 1000 packets of 1000 samples, as a display would. Compares the
+// packet history, which converts every cached packet on each read, with the sample buffer, which converts samples as
+// they arrive. The receive and refresh shares of an iteration are reported as counters.
+static void BM_TailReaderRefresh(benchmark::State& state)
+{
+    constexpr SizeT historySize = 10'000'000;
+    constexpr SizeT packetSamples = 1'000;
+    constexpr SizeT refreshInterval = 1'000;
+    const bool useSampleBuffer = state.range(0) != 0;
+
+    const auto context = createBenchmarkContext();
+    const auto signal = createSignalWithDomain(context, "sig", createValueDescriptor(SampleType::Int32));
+    const auto reader = TailReaderBuilder()
+                            .setSignal(signal)
+                            .setHistorySize(historySize)
+                            .setValueReadType(SampleType::Float64)
+                            .setDomainReadType(SampleType::Int64)
+                            .setSkipEvents(true)
+                            .setUseSampleBuffer(useSampleBuffer)
+                            .build();
+
+    std::vector<double> values(historySize);
+
+    Int offset = 0;
+    const auto sendPackets = [&](SizeT packetCount)
+    {
+        for (SizeT i = 0; i < packetCount; ++i)
+        {
+            const auto packet = createPacketWithDomain(signal, packetSamples, offset);
+            std::memset(packet.getRawData(), 0, packet.getRawDataSize());
+            signal.sendPacket(packet);
+            offset += static_cast<Int>(packetSamples);
+        }
+    };
+
+    // fill the history
+    sendPackets(historySize / packetSamples);
+
+    std::chrono::nanoseconds receiveTime{0};
+    std::chrono::nanoseconds refreshTime{0};
+    for (auto _ : state)
+    {
+        auto start = std::chrono::steady_clock::now();
+        sendPackets(refreshInterval);
+        receiveTime += std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        SizeT count = historySize;
+        reader.read(values.data(), &count);
+        benchmark::DoNotOptimize(count);
+        refreshTime += std::chrono::steady_clock::now() - start;
+    }
+
+    const auto iterations = static_cast<double>(state.iterations());
+    state.counters["receive_ms"] = std::chrono::duration<double, std::milli>(receiveTime).count() / iterations;
+    state.counters["refresh_ms"] = std::chrono::duration<double, std::milli>(refreshTime).count() / iterations;
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * refreshInterval * packetSamples));
+    context.getScheduler().stop();
+}
+BENCHMARK(BM_TailReaderRefresh)->ArgName("sample_buffer")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_PacketReader(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    const auto context = createBenchmarkContext();
+    const auto signal = createSignalWithDomain(context, "sig");
+    const auto reader = PacketReader(signal);
+    reader.readAll();
+
+    Int offset = 0;
+    for (auto _ : state)
+    {
+        signal.sendPacket(createPacketWithDomain(signal, sampleCount, offset));
+        offset += static_cast<Int>(sampleCount);
+
+        benchmark::DoNotOptimize(reader.read().getObject());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * sampleCount));
+    context.getScheduler().stop();
+}
+BENCHMARK(BM_PacketReader)->RangeMultiplier(16)->Range(16, 1 << 16);
+
+static void BM_MultiReader(benchmark::State& state)
+{
+    const auto signalCount = static_cast<size_t>(state.range(0));
+    const auto sampleCount = static_cast<SizeT>(state.range(1));
+    const auto context = createBenchmarkContext();
+
+    std::vector<SignalConfigPtr> signals;
+    auto signalList = List<ISignal>();
+    for (size_t i = 0; i < signalCount; ++i)
+    {
+        signals.push_back(createSignalWithDomain(context, "sig" + std::to_string(i)));
+        signalList.pushBack(signals.back());
+    }
+
+    const auto reader = MultiReader<double, Int>(signalList);
+
+    std::vector<std::vector<double>> values(signalCount, std::vector<double>(sampleCount));
+    std::vector<std::vector<Int>> domain(signalCount, std::vector<Int>(sampleCount));
+    std::vector<void*> valuePointers;
+    std::vector<void*> domainPointers;
+    for (size_t i = 0; i < signalCount; ++i)
+    {
+        valuePointers.push_back(values[i].data());
+        domainPointers.push_back(domain[i].data());
+    }
+
+    skipDescriptorEvent(reader, valuePointers.data(), domainPointers.data());
+
+    Int offset = 0;
+    for (auto _ : state)
+    {
+        for (const auto& signal : signals)
+            signal.sendPacket(createPacketWithDomain(signal, sampleCount, offset));
+        offset += static_cast<Int>(sampleCount);
+
+        SizeT count = sampleCount;
+        reader.readWithDomain(valuePointers.data(), domainPointers.data(), &count);
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * sampleCount * signalCount));
+    context.getScheduler().stop();
+}
+BENCHMARK(BM_MultiReader)->ArgsProduct({{2, 8}, {16, 1024, 1 << 16}});
+
+// Looks up the first sample at or after a start halfway through an explicit-domain packet, as the multi reader does
+// when it synchronizes signals. Compares the bisection used for single-value domains with a linear scan.
+static void BM_ExplicitDomainStartSearch(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    const bool bisect = state.range(1) != 0;
+
+    const auto descriptor = DataDescriptorBuilder()
+                                .setSampleType(SampleType::Int64)
+                                .setRule(ExplicitDataRule())
+                                .setTickResolution(Ratio(1, 1000000))
+                                .setOrigin("1970-01-01T00:00:00Z")
+                                .build();
+    const auto packet = DataPacket(descriptor, sampleCount);
+    auto* domainValues = static_cast<Int*>(packet.getRawData());
+    for (SizeT i = 0; i < sampleCount; ++i)
+        domainValues[i] = static_cast<Int>(i * 10);
+
+    const Int start = static_cast<Int>(sampleCount * 5) + 1;
+    const auto isAtOrAfterStart = [start](const Int& value) { return value >= start; };
+
+    for (auto _ : state)
+    {
+        const auto* values = static_cast<const Int*>(packet.getData());
+        SizeT index;
+        if (bisect)
+            index = reader::findDomainValueAtOrAfter(values, sampleCount, 1, isAtOrAfterStart);
+        else
+            index = static_cast<SizeT>(std::find_if(values, values + sampleCount, isAtOrAfterStart) - values);
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_ExplicitDomainStartSearch)->ArgNames({"samples", "bisect"})->ArgsProduct({{1 << 10, 1 << 20}, {0, 1}});
+
+// Reads packets of TFrom samples as TTo, measuring the sample type conversion of the typed reader.
+// The same packet is sent in each iteration, so packet creation is not part of the measurement.
+template <typename TFrom, typename TTo>
+static void BM_StreamReaderConversion(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    const auto context = createBenchmarkContext();
+    const auto signal = createSignalWithDomain(context, "sig", createValueDescriptor(SampleTypeFromType<TFrom>::SampleType));
+    const auto reader = StreamReader<TTo, Int>(signal);
+
+    std::vector<TTo> values(sampleCount);
+    std::vector<Int> domain(sampleCount);
+    skipDescriptorEvent(reader, values.data(), domain.data());
+
+    const auto packet = createPacketWithDomain(signal, sampleCount, 0);
+    std::memset(packet.getRawData(), 0, packet.getRawDataSize());
+
+    for (auto _ : state)
+    {
+        signal.sendPacket(packet);
+
+        SizeT count = sampleCount;
+        reader.read(values.data(), &count);
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * sampleCount));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * sampleCount * (sizeof(TFrom) + sizeof(TTo))));
+    context.getScheduler().stop();
+}
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, int8_t, double)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, uint8_t, double)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, int16_t, double)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, uint16_t, double)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, int32_t, double)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, uint32_t, double)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, int64_t, double)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, uint64_t, double)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, float, double)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, int8_t, float)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, uint8_t, float)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, int16_t, float)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, uint16_t, float)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, int32_t, float)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, double, float)->Arg(1 << 16);
+// scalar reference pairs
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, uint32_t, float)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, int16_t, int32_t)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_StreamReaderConversion, double, int32_t)->Arg(1 << 16);
+
+// Reads linearly scaled TRaw packets as double. Packets cache their scaled data, so each iteration creates a fresh
+// packet outside the timed region. Compares DataPacket::getData plus a copy with the reader scaling straight into
+// the output buffer.
+template <typename TRaw>
+static void BM_StreamReaderScaledRead(benchmark::State& state)
+{
+    constexpr auto rawType = SampleTypeFromType<TRaw>::SampleType;
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    const bool direct = state.range(1) != 0;
+    const auto context = createBenchmarkContext();
+    const auto signal =
+        createSignalWithDomain(context, "sig", createValueDescriptor(SampleType::Float64, LinearScaling(0.001, -1, rawType, ScaledSampleType::Float64)));
+    const auto reader = StreamReader<double, Int>(signal);
+
+    std::vector<double> values(sampleCount);
+    std::vector<Int> domain(sampleCount);
+    skipDescriptorEvent(reader, values.data(), domain.data());
+
+    Int offset = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        const auto packet = createPacketWithDomain(signal, sampleCount, offset);
+        std::memset(packet.getRawData(), 0, packet.getRawDataSize());
+        offset += static_cast<Int>(sampleCount);
+        if (direct)
+            signal.sendPacket(packet);
+        state.ResumeTiming();
+
+        if (direct)
+        {
+            SizeT count = sampleCount;
+            reader.read(values.data(), &count);
+            benchmark::DoNotOptimize(count);
+        }
+        else
+        {
+            const auto* scaled = static_cast<const double*>(packet.getData());
+            std::copy_n(scaled, sampleCount, values.data());
+            benchmark::DoNotOptimize(values.data());
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * sampleCount));
+    context.getScheduler().stop();
+}
+BENCHMARK_TEMPLATE(BM_StreamReaderScaledRead, int16_t)->ArgNames({"samples", "direct"})->ArgsProduct({{1 << 16}, {0, 1}});
+BENCHMARK_TEMPLATE(BM_StreamReaderScaledRead, int32_t)->ArgNames({"samples", "direct"})->ArgsProduct({{1 << 16}, {0, 1}});
@@ -0,0 +1,105 @@
+#include <opendaq/logger_factory.h>
+#include <opendaq/scheduler_factory.h>
+#include <opendaq/scheduler_internal.h>
+#include <coretypes/stringobject_factory.h>
+#include <opendaq/work_factory.h>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+using namespace daq;
+
+using Clock = std::chrono::steady_clock;
+
+// Schedules empty work items from one thread, with and without execution domain statistics
+static void BM_ScheduleWork(benchmark::State& state)
+{
+    const bool statistics = state.range(0) != 0;
+    const auto scheduler = Scheduler(Logger(nullptr, LogLevel::Error), 1);
+    scheduler.setExecutionDomainStatisticsEnabled(statistics);
+
+    const auto work = Work([] {});
+    for (auto _ : state)
+        scheduler.scheduleWork(work);
+
+    scheduler.waitAll();
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    scheduler.stop();
+}
+BENCHMARK(BM_ScheduleWork)->ArgName("statistics")->Arg(0)->Arg(1);
+
+// Measures the time until critical work starts while the default pool is flooded with 200 us busy work items.
+// The critical work runs on the default pool or on a dedicated high-priority execution domain, scheduled through
+// the domain handle input ports use. Each iteration schedules one item and waits for it to start.
+static void BM_SchedulerDomainLatencyUnderLoad(benchmark::State& state)
+{
+    const bool useDomain = state.range(0) != 0;
+    const SizeT workers = std::max(std::thread::hardware_concurrency(), 2u);
+
+    const auto scheduler = Scheduler(Logger(nullptr, LogLevel::Error), workers);
+    ObjectPtr<IExecutionDomain> domain;
+    if (useDomain)
+    {
+        scheduler.addExecutionDomain("Critical", 1, ExecutionPriority::High, nullptr);
+        scheduler.asPtr<ISchedulerInternal>()->getExecutionDomain(String("Critical"), &domain);
+    }
+
+    const auto busyWork = Work([]
+    {
+        const auto end = Clock::now() + std::chrono::microseconds(200);
+        while (Clock::now() < end)
+        {
+        }
+    });
+
+    std::atomic<bool> loaded{true};
+    std::thread loadThread([&]
+    {
+        while (loaded)
+        {
+            for (SizeT i = 0; i < workers * 4; ++i)
+                scheduler.scheduleWork(busyWork);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    std::vector<double> latencies;
+    for (auto _ : state)
+    {
+        std::promise<Clock::time_point> started;
+        const auto work = Work([&] { started.set_value(Clock::now()); });
+
+        const auto scheduled = Clock::now();
+        if (domain.assigned())
+            domain->scheduleWork(work);
+        else
+            scheduler.scheduleWork(work);
+
+        const std::chrono::duration<double, std::micro> latency = started.get_future().get() - scheduled;
+        latencies.push_back(latency.count());
+    }
+
+    loaded = false;
+    loadThread.join();
+    scheduler.waitAll();
+    scheduler.stop();
+
+    if (latencies.empty())
+        return;
+
+    std::sort(latencies.begin(), latencies.end());
+    state.counters["p50_us"] = latencies[latencies.size() / 2];
+    state.counters["p99_us"] = latencies[latencies.size() * 99 / 100];
+    state.counters["max_us"] = latencies.back();
+}
+BENCHMARK(BM_SchedulerDomainLatencyUnderLoad)
+    ->ArgName("critical_domain")
+    ->Arg(0)
+    ->Arg(1)
+    ->Iterations(2000)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
@@ -0,0 +1,67 @@
+#include "benchmark_common.h"
+#include "benchmark_device_tree.h"
+#include <coretypes/binary_deserializer_factory.h>
+#include <coretypes/binary_serializer_factory.h>
+#include <coretypes/json_deserializer_factory.h>
+#include <coretypes/json_serializer_factory.h>
+#include <opendaq/component_deserialize_context_factory.h>
+#include <opendaq/search_filter_factory.h>
+#include <benchmark/benchmark.h>
+
+using namespace daq;
+using namespace daq::benchmarks;
+
+static StringPtr serializeDevice(const DevicePtr& device, bool binary)
+{
+    const auto serializer = binary ? BinarySerializer() : JsonSerializer();
+    device.serialize(serializer);
+    return serializer.getOutput();
+}
+
+static void BM_SerializeDeviceTree(benchmark::State& state)
+{
+    const auto device = createDeviceTree(static_cast<size_t>(state.range(0)));
+    const bool binary = state.range(1) != 0;
+    const auto componentCount = device.getItems(search::Recursive(search::Any())).getCount();
+
+    SizeT bytes = 0;
+    for (auto _ : state)
+        bytes = serializeDevice(device, binary).getLength();
+
+    state.counters["components"] = static_cast<double>(componentCount);
+    state.counters["serialized_bytes"] = static_cast<double>(bytes);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+}
+BENCHMARK(BM_SerializeDeviceTree)
+    ->ArgNames({"child_devices", "binary"})
+    ->ArgsProduct({{0, 10, 100, 200}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_DeserializeDeviceTree(benchmark::State& state)
+{
+    const auto device = createDeviceTree(static_cast<size_t>(state.range(0)));
+    const bool binary = state.range(1) != 0;
+    const auto serialized = serializeDevice(device, binary);
+    const auto deserializer = binary ? BinaryDeserializer() : JsonDeserializer();
+
+    for (auto _ : state)
+    {
+        try
+        {
+            const auto deserializeContext = ComponentDeserializeContext(device.getContext(), nullptr, nullptr, "root_dev");
+            const DevicePtr deserialized = deserializer.deserialize(serialized, deserializeContext, nullptr);
+            benchmark::DoNotOptimize(deserialized.getObject());
+        }
+        catch (const DaqException& e)
+        {
+            state.SkipWithError(e.what());
+            break;
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * serialized.getLength()));
+}
+BENCHMARK(BM_DeserializeDeviceTree)
+    ->ArgNames({"child_devices", "binary"})
+    ->ArgsProduct({{0, 10, 100, 200}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
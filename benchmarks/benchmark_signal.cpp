@@ -0,0 +1,297 @@
+#include "benchmark_common.h"
+#include <opendaq/input_port_factory.h>
+#include <opendaq/input_port_notifications_ptr.h>
+#include <coretypes/intfs.h>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace daq;
+using namespace daq::benchmarks;
+
+// Sends one packet to N connected input ports and drains their connections
+static void BM_SignalFanOut(benchmark::State& state)
+{
+    const auto connectionCount = static_cast<size_t>(state.range(0));
+    const auto context = createBenchmarkContext();
+    const auto signal = createSignalWithDomain(context, "sig");
+
+    std::vector<ConnectionPtr> connections;
+    std::vector<InputPortConfigPtr> ports;
+    for (size_t i = 0; i < connectionCount; ++i)
+    {
+        auto port = InputPort(context, nullptr, "ip" + std::to_string(i));
+        port.connect(signal);
+        connections.push_back(port.getConnection());
+        ports.push_back(std::move(port));
+    }
+
+    for (const auto& connection : connections)
+        connection.dequeueAll();
+
+    const auto packet = createPacketWithDomain(signal, 1000, 0);
+    for (auto _ : state)
+    {
+        signal.sendPacket(packet);
+        for (const auto& connection : connections)
+            benchmark::DoNotOptimize(connection.dequeue().getObject());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * connectionCount));
+    context.getScheduler().stop();
+}
+BENCHMARK(BM_SignalFanOut)->RangeMultiplier(4)->Range(1, 256);
+
+// Sends a list of packets at once, exercising the batched enqueue path
+static void BM_SignalFanOutBatch(benchmark::State& state)
+{
+    constexpr size_t batchSize = 16;
+    const auto connectionCount = static_cast<size_t>(state.range(0));
+    const auto context = createBenchmarkContext();
+    const auto signal = createSignalWithDomain(context, "sig");
+
+    std::vector<ConnectionPtr> connections;
+    std::vector<InputPortConfigPtr> ports;
+    for (size_t i = 0; i < connectionCount; ++i)
+    {
+        auto port = InputPort(context, nullptr, "ip" + std::to_string(i));
+        port.connect(signal);
+        connections.push_back(port.getConnection());
+        ports.push_back(std::move(port));
+    }
+
+    for (const auto& connection : connections)
+        connection.dequeueAll();
+
+    auto packets = List<IPacket>();
+    for (size_t i = 0; i < batchSize; ++i)
+        packets.pushBack(createPacketWithDomain(signal, 1000, static_cast<Int>(i * 1000)));
+
+    for (auto _ : state)
+    {
+        signal.sendPackets(packets);
+        for (const auto& connection : connections)
+            benchmark::DoNotOptimize(connection.dequeueAll().getObject());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * connectionCount * batchSize));
+    context.getScheduler().stop();
+}
+BENCHMARK(BM_SignalFanOutBatch)->RangeMultiplier(4)->Range(1, 256);
+
+namespace
+{
+
+// Connects an input port with the given packet queue mode to a signal and drains the initial descriptor packet
+struct PacketQueueFixture
+{
+    PacketQueueFixture(PacketQueueMode mode, SizeT capacity, SampleType sampleType)
+        : context(createBenchmarkContext())
+        , signal(SignalWithDescriptor(context, createValueDescriptor(sampleType), nullptr, "sig"))
+        , port(InputPort(context, nullptr, "ip"))
+    {
+        port.setPacketQueueMode(mode);
+        port.setPacketQueueCapacity(capacity);
+        port.connect(signal);
+        connection = port.getConnection();
+        connection.dequeueAll();
+    }
+
+    ~PacketQueueFixture()
+    {
+        context.getScheduler().stop();
+    }
+
+    ContextPtr context;
+    SignalConfigPtr signal;
+    InputPortConfigPtr port;
+    ConnectionPtr connection;
+};
+
+}
+
+// Transfers packets from a producer thread to a busy-polling consumer thread as fast as possible.
+// The producer waits while the queue is full, so no packets are dropped.
+static void BM_PacketQueueThroughput(benchmark::State& state)
+{
+    constexpr SizeT capacity = 1024;
+    const auto mode = static_cast<PacketQueueMode>(state.range(0));
+    PacketQueueFixture fixture(mode, capacity, SampleType::Float64);
+
+    const auto packet = DataPacket(fixture.signal.getDescriptor(), 1);
+    std::atomic<bool> running{true};
+    std::thread producer([&]
+    {
+        while (running.load(std::memory_order_relaxed))
+        {
+            if (fixture.connection.getPacketCount() < capacity)
+                fixture.signal.sendPacket(packet);
+        }
+    });
+
+    for (auto _ : state)
+    {
+        while (!fixture.connection.dequeue().assigned())
+            ;
+    }
+
+    running = false;
+    producer.join();
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_PacketQueueThroughput)
+    ->ArgName("mode")
+    ->Arg(static_cast<int64_t>(PacketQueueMode::Locked))
+    ->Arg(static_cast<int64_t>(PacketQueueMode::LockFreeSpsc))
+    ->UseRealTime();
+
+// Sends one packet every 2 us from a producer thread and reports the enqueue-to-dequeue latency percentiles
+static void BM_PacketQueueLatency(benchmark::State& state)
+{
+    using Clock = std::chrono::steady_clock;
+    constexpr auto interval = std::chrono::microseconds(2);
+
+    const auto mode = static_cast<PacketQueueMode>(state.range(0));
+    PacketQueueFixture fixture(mode, 1024, SampleType::Int64);
+
+    std::atomic<bool> running{true};
+    std::thread producer([&]
+    {
+        auto next = Clock::now();
+        while (running.load(std::memory_order_relaxed))
+        {
+            next += interval;
+            while (Clock::now() < next)
+                ;
+
+            auto packet = DataPacket(fixture.signal.getDescriptor(), 1);
+            *static_cast<int64_t*>(packet.getRawData()) = Clock::now().time_since_epoch().count();
+            fixture.signal.sendPacket(packet);
+        }
+    });
+
+    std::vector<double> latencies;
+    latencies.reserve(1000000);
+    for (auto _ : state)
+    {
+        PacketPtr packet;
+        while (!(packet = fixture.connection.dequeue()).assigned())
+            ;
+
+        const auto rawData = packet.asPtr<IDataPacket>(true).getRawData();
+        const auto sent = Clock::time_point(Clock::duration(*static_cast<int64_t*>(rawData)));
+        latencies.push_back(std::chrono::duration<double, std::micro>(Clock::now() - sent).count());
+    }
+
+    running = false;
+    producer.join();
+
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&latencies](size_t perMille) { return latencies[latencies.size() * perMille / 1000]; };
+    state.counters["p50_us"] = percentile(500);
+    state.counters["p99_us"] = percentile(990);
+    state.counters["p999_us"] = percentile(999);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_PacketQueueLatency)
+    ->ArgName("mode")
+    ->Arg(static_cast<int64_t>(PacketQueueMode::Locked))
+    ->Arg(static_cast<int64_t>(PacketQueueMode::LockFreeSpsc))
+    ->UseRealTime();
+
+namespace
+{
+
+// Drains the connection of the notifying input port and counts the calls
+class DrainingListener : public ImplementationOf<IInputPortNotifications>
+{
+public:
+    ErrCode INTERFACE_FUNC acceptsSignal(IInputPort* port, ISignal* signal, Bool* accept) override
+    {
+        *accept = True;
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC connected(IInputPort* port) override
+    {
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC disconnected(IInputPort* port) override
+    {
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC packetReceived(IInputPort* port) override
+    {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        const auto connection = InputPortPtr::Borrow(port).getConnection();
+        if (connection.assigned())
+            while (connection.dequeue().assigned())
+                ;
+        return OPENDAQ_SUCCESS;
+    }
+
+    std::atomic<size_t> calls{0};
+};
+
+}
+
+// Sends packets round-robin to 200 input ports notified on the scheduler, with one task per packet or with
+// coalesced notifications, and reports the scheduled tasks and listener calls per packet
+static void BM_InputPortSchedulerNotification(benchmark::State& state)
+{
+    constexpr size_t portCount = 200;
+    constexpr size_t packetsPerIteration = 2000;
+    const auto method = static_cast<PacketReadyNotification>(state.range(0));
+
+    const auto logger = Logger(nullptr, LogLevel::Error);
+    const auto context = Context(Scheduler(logger), logger, nullptr, nullptr, nullptr);
+    const auto scheduler = context.getScheduler();
+    scheduler.setExecutionDomainStatisticsEnabled(true);
+
+    const auto descriptor = createValueDescriptor();
+    const InputPortNotificationsPtr listener = createWithImplementation<IInputPortNotifications, DrainingListener>();
+    auto& listenerImpl = *static_cast<DrainingListener*>(listener.getObject());
+
+    std::vector<SignalConfigPtr> signals;
+    std::vector<InputPortConfigPtr> ports;
+    for (size_t i = 0; i < portCount; ++i)
+    {
+        signals.push_back(SignalWithDescriptor(context, descriptor, nullptr, "sig" + std::to_string(i)));
+        ports.push_back(InputPort(context, nullptr, "ip" + std::to_string(i)));
+        ports.back().setListener(listener);
+        ports.back().setNotificationMethod(method);
+        ports.back().connect(signals.back());
+    }
+    scheduler.waitAll();
+
+    const Int tasksBefore = scheduler.getExecutionDomainStatistics("Default").get("CompletedCount");
+    const size_t callsBefore = listenerImpl.calls;
+
+    const auto packet = DataPacket(descriptor, 1);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < packetsPerIteration; ++i)
+            signals[i % portCount].sendPacket(packet);
+        scheduler.waitAll();
+    }
+
+    const Int tasks = scheduler.getExecutionDomainStatistics("Default").get("CompletedCount");
+    const auto packets = static_cast<double>(state.iterations() * packetsPerIteration);
+    state.counters["tasks_per_packet"] = static_cast<double>(tasks - tasksBefore) / packets;
+    state.counters["listener_calls_per_packet"] = static_cast<double>(listenerImpl.calls - callsBefore) / packets;
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * packetsPerIteration));
+
+    for (const auto& port : ports)
+        port.disconnect();
+    scheduler.stop();
+}
+BENCHMARK(BM_InputPortSchedulerNotification)
+    ->ArgName("method")
+    ->Arg(static_cast<int64_t>(PacketReadyNotification::Scheduler))
+    ->Arg(static_cast<int64_t>(PacketReadyNotification::SchedulerCoalesced))
+    ->UseRealTime();
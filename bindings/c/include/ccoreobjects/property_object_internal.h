@@ -67,6 +67,10 @@ extern "C"
     daqErrCode EXPORTED daqPropertyObjectInternal_getLockingStrategy(daqPropertyObjectInternal* self, daqLockingStrategy* strategy);
     daqErrCode EXPORTED daqPropertyObjectInternal_getMutex(daqPropertyObjectInternal* self, daqMutex** mutex);
     daqErrCode EXPORTED daqPropertyObjectInternal_getMutexOwner(daqPropertyObjectInternal* self, daqPropertyObjectInternal** owner);
+    daqErrCode EXPORTED daqPropertyObjectInternal_setConcurrentReadsEnabled(daqPropertyObjectInternal* self, daqBool enabled);
+    daqErrCode EXPORTED daqPropertyObjectInternal_getConcurrentReadsEnabled(daqPropertyObjectInternal* self, daqBool* enabled);
+    daqErrCode EXPORTED daqPropertyObjectInternal_getValueRevision(daqPropertyObjectInternal* self, daqUInt* revision);
+    daqErrCode EXPORTED daqPropertyObjectInternal_incrementValueRevision(daqPropertyObjectInternal* self);
 
 #ifdef __cplusplus
 }
@@ -57,6 +57,8 @@ extern "C"
     daqErrCode EXPORTED daqTailReaderBuilder_getHistorySize(daqTailReaderBuilder* self, daqSizeT* historySize);
     daqErrCode EXPORTED daqTailReaderBuilder_setSkipEvents(daqTailReaderBuilder* self, daqBool skipEvents);
     daqErrCode EXPORTED daqTailReaderBuilder_getSkipEvents(daqTailReaderBuilder* self, daqBool* skipEvents);
+    daqErrCode EXPORTED daqTailReaderBuilder_setUseSampleBuffer(daqTailReaderBuilder* self, daqBool useSampleBuffer);
+    daqErrCode EXPORTED daqTailReaderBuilder_getUseSampleBuffer(daqTailReaderBuilder* self, daqBool* useSampleBuffer);
     daqErrCode EXPORTED daqTailReaderBuilder_createTailReaderBuilder(daqTailReaderBuilder** obj);
 
 #ifdef __cplusplus
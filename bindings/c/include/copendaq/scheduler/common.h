@@ -21,6 +21,13 @@ extern "C"
 {
 #endif
 
+    typedef enum daqExecutionPriority
+    {
+        daqExecutionPriorityNormal = 0,  ///< Default OS priority.
+        daqExecutionPriorityLow,         ///< Below normal priority, for background work.
+        daqExecutionPriorityHigh         ///< Above normal priority. May require elevated privileges.
+    } daqExecutionPriority;
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -40,6 +40,9 @@ extern "C"
     typedef struct daqWork daqWork;
     typedef struct daqTaskGraph daqTaskGraph;
     typedef struct daqLogger daqLogger;
+    typedef struct daqString daqString;
+    typedef struct daqList daqList;
+    typedef struct daqDict daqDict;
 
     EXPORTED extern const daqIntfID DAQ_SCHEDULER_INTF_ID;
     void EXPORTED daqScheduler_getInterfaceId(daqIntfID* intfId);
@@ -55,6 +58,12 @@ extern "C"
     daqErrCode EXPORTED daqScheduler_stopMainLoop(daqScheduler* self);
     daqErrCode EXPORTED daqScheduler_runMainLoopIteration(daqScheduler* self);
     daqErrCode EXPORTED daqScheduler_scheduleWorkOnMainLoop(daqScheduler* self, daqWork* work);
+    daqErrCode EXPORTED daqScheduler_addExecutionDomain(daqScheduler* self, daqString* name, daqSizeT numWorkers, daqExecutionPriority priority, daqList* cpuCores);
+    daqErrCode EXPORTED daqScheduler_scheduleWorkOnDomain(daqScheduler* self, daqString* domain, daqWork* work);
+    daqErrCode EXPORTED daqScheduler_getExecutionDomainNames(daqScheduler* self, daqList** names);
+    daqErrCode EXPORTED daqScheduler_getExecutionDomainStatistics(daqScheduler* self, daqString* domain, daqDict** statistics);
+    daqErrCode EXPORTED daqScheduler_setExecutionDomainStatisticsEnabled(daqScheduler* self, daqBool enabled);
+    daqErrCode EXPORTED daqScheduler_getExecutionDomainStatisticsEnabled(daqScheduler* self, daqBool* enabled);
     daqErrCode EXPORTED daqScheduler_createScheduler(daqScheduler** obj, daqLogger* logger, daqSizeT numWorkers);
     daqErrCode EXPORTED daqScheduler_createSchedulerWithMainLoop(daqScheduler** obj, daqLogger* logger, daqSizeT numWorkers, daqBool useMainLoop);
 
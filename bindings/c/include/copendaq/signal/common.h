@@ -45,10 +45,18 @@ extern "C"
         daqPacketReadyNotificationNone,                   ///< Ignore the notification.
         daqPacketReadyNotificationSameThread,             ///< Call the listener in the same thread the notification was received.
         daqPacketReadyNotificationScheduler,              ///< Call the listener asynchronously or in another thread.
-        daqPacketReadyNotificationSchedulerQueueWasEmpty  ///< Call the listener asynchronously or in another thread only if connection packet
-                                                       ///< queue was empty
+        daqPacketReadyNotificationSchedulerQueueWasEmpty,  ///< Call the listener asynchronously or in another thread only if connection packet
+                                                           ///< queue was empty
+        daqPacketReadyNotificationSchedulerCoalesced       ///< Call the listener asynchronously or in another thread, with at most one
+                                                           ///< pending call per input port
     } daqPacketReadyNotification;
 
+    typedef enum daqPacketQueueMode
+    {
+        daqPacketQueueModeLocked = 0,  ///< Unbounded queue guarded by a mutex. Safe for any number of producers and consumers.
+        daqPacketQueueModeLockFreeSpsc  ///< Bounded lock-free ring queue. Requires a single producer and a single consumer thread.
+    } daqPacketQueueMode;
+
     typedef enum daqPacketType
     {
         daqPacketTypeNone = 0,  ///< Undefined packet type
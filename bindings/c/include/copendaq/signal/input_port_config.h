@@ -54,6 +54,12 @@ extern "C"
     daqErrCode EXPORTED daqInputPortConfig_getGapCheckingEnabled(daqInputPortConfig* self, daqBool* gapCheckingEnabled);
     daqErrCode EXPORTED daqInputPortConfig_notifyPacketEnqueuedWithScheduler(daqInputPortConfig* self);
     daqErrCode EXPORTED daqInputPortConfig_getListener(daqInputPortConfig* self, daqInputPortNotifications** port);
+    daqErrCode EXPORTED daqInputPortConfig_setPacketQueueMode(daqInputPortConfig* self, daqPacketQueueMode mode);
+    daqErrCode EXPORTED daqInputPortConfig_getPacketQueueMode(daqInputPortConfig* self, daqPacketQueueMode* mode);
+    daqErrCode EXPORTED daqInputPortConfig_setPacketQueueCapacity(daqInputPortConfig* self, daqSizeT capacity);
+    daqErrCode EXPORTED daqInputPortConfig_getPacketQueueCapacity(daqInputPortConfig* self, daqSizeT* capacity);
+    daqErrCode EXPORTED daqInputPortConfig_setSchedulerDomain(daqInputPortConfig* self, daqString* domain);
+    daqErrCode EXPORTED daqInputPortConfig_getSchedulerDomain(daqInputPortConfig* self, daqString** domain);
     daqErrCode EXPORTED daqInputPortConfig_createInputPort(daqInputPortConfig** obj, daqContext* context, daqComponent* parent, daqString* localId, daqBool gapChecking);
 
 #ifdef __cplusplus
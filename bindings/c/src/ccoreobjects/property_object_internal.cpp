@@ -131,3 +131,23 @@ daqErrCode daqPropertyObjectInternal_getMutexOwner(daqPropertyObjectInternal* se
 {
     return reinterpret_cast<daq::IPropertyObjectInternal*>(self)->getMutexOwner(reinterpret_cast<daq::IPropertyObjectInternal**>(owner));
 }
+
+daqErrCode daqPropertyObjectInternal_setConcurrentReadsEnabled(daqPropertyObjectInternal* self, daqBool enabled)
+{
+    return reinterpret_cast<daq::IPropertyObjectInternal*>(self)->setConcurrentReadsEnabled(enabled);
+}
+
+daqErrCode daqPropertyObjectInternal_getConcurrentReadsEnabled(daqPropertyObjectInternal* self, daqBool* enabled)
+{
+    return reinterpret_cast<daq::IPropertyObjectInternal*>(self)->getConcurrentReadsEnabled(enabled);
+}
+
+daqErrCode daqPropertyObjectInternal_getValueRevision(daqPropertyObjectInternal* self, daqUInt* revision)
+{
+    return reinterpret_cast<daq::IPropertyObjectInternal*>(self)->getValueRevision(revision);
+}
+
+daqErrCode daqPropertyObjectInternal_incrementValueRevision(daqPropertyObjectInternal* self)
+{
+    return reinterpret_cast<daq::IPropertyObjectInternal*>(self)->incrementValueRevision();
+}
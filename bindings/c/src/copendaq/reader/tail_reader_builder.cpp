@@ -97,6 +97,16 @@ daqErrCode daqTailReaderBuilder_getSkipEvents(daqTailReaderBuilder* self, daqBoo
     return reinterpret_cast<daq::ITailReaderBuilder*>(self)->getSkipEvents(skipEvents);
 }
 
+daqErrCode daqTailReaderBuilder_setUseSampleBuffer(daqTailReaderBuilder* self, daqBool useSampleBuffer)
+{
+    return reinterpret_cast<daq::ITailReaderBuilder*>(self)->setUseSampleBuffer(useSampleBuffer);
+}
+
+daqErrCode daqTailReaderBuilder_getUseSampleBuffer(daqTailReaderBuilder* self, daqBool* useSampleBuffer)
+{
+    return reinterpret_cast<daq::ITailReaderBuilder*>(self)->getUseSampleBuffer(useSampleBuffer);
+}
+
 daqErrCode daqTailReaderBuilder_createTailReaderBuilder(daqTailReaderBuilder** obj)
 {
     daq::ITailReaderBuilder* ptr = nullptr;
@@ -77,6 +77,36 @@ daqErrCode daqScheduler_scheduleWorkOnMainLoop(daqScheduler* self, daqWork* work
     return reinterpret_cast<daq::IScheduler*>(self)->scheduleWorkOnMainLoop(reinterpret_cast<daq::IWork*>(work));
 }
 
+daqErrCode daqScheduler_addExecutionDomain(daqScheduler* self, daqString* name, daqSizeT numWorkers, daqExecutionPriority priority, daqList* cpuCores)
+{
+    return reinterpret_cast<daq::IScheduler*>(self)->addExecutionDomain(reinterpret_cast<daq::IString*>(name), numWorkers, static_cast<daq::ExecutionPriority>(priority), reinterpret_cast<daq::IList*>(cpuCores));
+}
+
+daqErrCode daqScheduler_scheduleWorkOnDomain(daqScheduler* self, daqString* domain, daqWork* work)
+{
+    return reinterpret_cast<daq::IScheduler*>(self)->scheduleWorkOnDomain(reinterpret_cast<daq::IString*>(domain), reinterpret_cast<daq::IWork*>(work));
+}
+
+daqErrCode daqScheduler_getExecutionDomainNames(daqScheduler* self, daqList** names)
+{
+    return reinterpret_cast<daq::IScheduler*>(self)->getExecutionDomainNames(reinterpret_cast<daq::IList**>(names));
+}
+
+daqErrCode daqScheduler_getExecutionDomainStatistics(daqScheduler* self, daqString* domain, daqDict** statistics)
+{
+    return reinterpret_cast<daq::IScheduler*>(self)->getExecutionDomainStatistics(reinterpret_cast<daq::IString*>(domain), reinterpret_cast<daq::IDict**>(statistics));
+}
+
+daqErrCode daqScheduler_setExecutionDomainStatisticsEnabled(daqScheduler* self, daqBool enabled)
+{
+    return reinterpret_cast<daq::IScheduler*>(self)->setExecutionDomainStatisticsEnabled(enabled);
+}
+
+daqErrCode daqScheduler_getExecutionDomainStatisticsEnabled(daqScheduler* self, daqBool* enabled)
+{
+    return reinterpret_cast<daq::IScheduler*>(self)->getExecutionDomainStatisticsEnabled(enabled);
+}
+
 daqErrCode daqScheduler_createScheduler(daqScheduler** obj, daqLogger* logger, daqSizeT numWorkers)
 {
     daq::IScheduler* ptr = nullptr;
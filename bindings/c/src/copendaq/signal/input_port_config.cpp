@@ -77,6 +77,36 @@ daqErrCode daqInputPortConfig_getListener(daqInputPortConfig* self, daqInputPort
     return reinterpret_cast<daq::IInputPortConfig*>(self)->getListener(reinterpret_cast<daq::IInputPortNotifications**>(port));
 }
 
+daqErrCode daqInputPortConfig_setPacketQueueMode(daqInputPortConfig* self, daqPacketQueueMode mode)
+{
+    return reinterpret_cast<daq::IInputPortConfig*>(self)->setPacketQueueMode(static_cast<daq::PacketQueueMode>(mode));
+}
+
+daqErrCode daqInputPortConfig_getPacketQueueMode(daqInputPortConfig* self, daqPacketQueueMode* mode)
+{
+    return reinterpret_cast<daq::IInputPortConfig*>(self)->getPacketQueueMode(reinterpret_cast<daq::PacketQueueMode*>(mode));
+}
+
+daqErrCode daqInputPortConfig_setPacketQueueCapacity(daqInputPortConfig* self, daqSizeT capacity)
+{
+    return reinterpret_cast<daq::IInputPortConfig*>(self)->setPacketQueueCapacity(capacity);
+}
+
+daqErrCode daqInputPortConfig_getPacketQueueCapacity(daqInputPortConfig* self, daqSizeT* capacity)
+{
+    return reinterpret_cast<daq::IInputPortConfig*>(self)->getPacketQueueCapacity(capacity);
+}
+
+daqErrCode daqInputPortConfig_setSchedulerDomain(daqInputPortConfig* self, daqString* domain)
+{
+    return reinterpret_cast<daq::IInputPortConfig*>(self)->setSchedulerDomain(reinterpret_cast<daq::IString*>(domain));
+}
+
+daqErrCode daqInputPortConfig_getSchedulerDomain(daqInputPortConfig* self, daqString** domain)
+{
+    return reinterpret_cast<daq::IInputPortConfig*>(self)->getSchedulerDomain(reinterpret_cast<daq::IString**>(domain));
+}
+
 daqErrCode daqInputPortConfig_createInputPort(daqInputPortConfig** obj, daqContext* context, daqComponent* parent, daqString* localId, daqBool gapChecking)
 {
     daq::IInputPortConfig* ptr = nullptr;
@@ -0,0 +1,154 @@
+#!/usr/bin/env python
+
+"""
+Compares the throughput of the stream reader's NumPy read methods.
+
+`read` and `read_with_domain` allocate new arrays for every call, while `read_into` and
+`read_with_domain_into` fill arrays allocated once by the caller. The signal has the layout of a
+reference device analog input: Float64 values with an Int64 linear-rule domain. The packets of each
+repetition are sent before the reads are timed, so only the reads are measured.
+
+Run it from the directory that contains the built `opendaq` Python module. Each result is printed
+as one JSON object per line.
+"""
+
+import argparse
+import json
+import time
+
+import numpy as np
+import opendaq
+
+
+class ReferenceSignal:
+
+    def __init__(self, samples_per_packet):
+        ctx = opendaq.NullContext()
+        self.samples_per_packet = samples_per_packet
+        self.offset = 0
+
+        self.time_signal = opendaq.Signal(ctx, None, "time", None)
+        self.value_signal = opendaq.Signal(ctx, None, "value", None)
+        self.value_signal.domain_signal = self.time_signal
+
+        time_desc_builder = opendaq.DataDescriptorBuilder()
+        time_desc_builder.tick_resolution = opendaq.Ratio(1, 1000000)
+        time_desc_builder.unit = opendaq.Unit(-1, "s", "second", "time")
+        time_desc_builder.sample_type = opendaq.SampleType.Int64
+        time_desc_builder.rule = opendaq.LinearDataRule(1, 0)
+        self.time_desc = time_desc_builder.build()
+        self.time_signal.descriptor = self.time_desc
+
+        value_desc_builder = opendaq.DataDescriptorBuilder()
+        value_desc_builder.sample_type = opendaq.SampleType.Float64
+        self.value_desc = value_desc_builder.build()
+        self.value_signal.descriptor = self.value_desc
+
+        self.samples = np.sin(np.arange(samples_per_packet, dtype=np.float64) * 0.01)
+
+    def send_packets(self, packet_count):
+        for _ in range(packet_count):
+            time_packet = opendaq.DataPacket(self.time_desc, self.samples_per_packet, self.offset)
+            self.time_signal.send_packet(time_packet)
+
+            value_packet = opendaq.DataPacketWithDomain(time_packet, self.value_desc, self.samples_per_packet, 0)
+            np.copyto(np.frombuffer(value_packet.raw_data, dtype=np.float64), self.samples)
+            self.value_signal.send_packet(value_packet)
+
+            self.offset += self.samples_per_packet
+
+
+def read(reader, block_size):
+    total = 0
+    while True:
+        count = len(reader.read(block_size))
+        if count == 0:
+            return total
+        total += count
+
+
+def read_into(reader, block_size):
+    values = np.empty(block_size, dtype=np.float64)
+    total = 0
+    while True:
+        count = reader.read_into(values)
+        if count == 0:
+            return total
+        total += count
+
+
+def read_with_domain(reader, block_size):
+    total = 0
+    while True:
+        values, _ = reader.read_with_domain(block_size)
+        if len(values) == 0:
+            return total
+        total += len(values)
+
+
+def read_with_domain_into(reader, block_size):
+    values = np.empty(block_size, dtype=np.float64)
+    domain = np.empty(block_size, dtype=np.int64)
+    total = 0
+    while True:
+        count = reader.read_with_domain_into(values, domain)
+        if count == 0:
+            return total
+        total += count
+
+
+METHODS = {
+    "read": read,
+    "read_into": read_into,
+    "read_with_domain": read_with_domain,
+    "read_with_domain_into": read_with_domain_into,
+}
+
+
+def run(method, samples_per_packet, packet_count, block_size, repetitions):
+    signal = ReferenceSignal(samples_per_packet)
+    reader = opendaq.StreamReader(signal.value_signal)
+    reader.read(0)
+
+    expected = samples_per_packet * packet_count
+    seconds = []
+    for _ in range(repetitions):
+        signal.send_packets(packet_count)
+
+        start = time.perf_counter()
+        total = METHODS[method](reader, block_size)
+        seconds.append(time.perf_counter() - start)
+
+        if total != expected:
+            raise RuntimeError(f"{method} read {total} samples, expected {expected}")
+
+    best = min(seconds)
+    return {
+        "name": method,
+        "samples_per_packet": samples_per_packet,
+        "block_size": block_size,
+        "samples": expected,
+        "repetitions": repetitions,
+        "min_seconds": best,
+        "median_seconds": float(np.median(seconds)),
+        "samples_per_second": expected / best,
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--samples-per-packet", type=int, default=1000)
+    parser.add_argument("--packets", type=int, default=1000)
+    parser.add_argument("--block-sizes", type=int, nargs="+", default=[100, 1000, 10000])
+    parser.add_argument("--repetitions", type=int, default=5)
+    parser.add_argument("--methods", nargs="+", choices=sorted(METHODS), default=list(METHODS))
+    args = parser.parse_args()
+
+    for block_size in args.block_sizes:
+        for method in args.methods:
+            result = run(method, args.samples_per_packet, args.packets, block_size, args.repetitions)
+            print(json.dumps(result), flush=True)
+
+
+if __name__ == "__main__":
+    main()
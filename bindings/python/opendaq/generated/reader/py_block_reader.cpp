@@ -87,6 +87,31 @@ void defineIBlockReader(pybind11::module_ m, PyDaqIntf<daq::IBlockReader, daq::I
         "Copies at maximum the next `count` blocks of unread samples and clock-stamps to the `dataBlocks` and `domainBlocks` buffers."
         "The amount actually read is returned through the `count` parameter.");
 
+    cls.def(
+        "read_into",
+        [](daq::IBlockReader* object, const py::array& values, const size_t timeoutMs, bool returnStatus)
+        {
+            return PyTypedReader::readValuesInto(daq::BlockReaderPtr::Borrow(object), values, timeoutMs, returnStatus);
+        },
+        py::arg("values").noconvert(),
+        py::arg("timeout_ms") = 0,
+        py::arg("return_status") = false,
+        "Reads at maximum as many blocks as fit into the `values` NumPy array, of shape (count, block_size) or (count * block_size,), "
+        "directly into it. The array must be writeable, C-contiguous and of the value read type. Returns the amount of blocks read.");
+
+    cls.def(
+        "read_with_domain_into",
+        [](daq::IBlockReader* object, const py::array& values, const py::array& domain, const size_t timeoutMs, bool returnStatus)
+        {
+            return PyTypedReader::readValuesWithDomainInto(daq::BlockReaderPtr::Borrow(object), values, domain, timeoutMs, returnStatus);
+        },
+        py::arg("values").noconvert(),
+        py::arg("domain").noconvert(),
+        py::arg("timeout_ms") = 0,
+        py::arg("return_status") = false,
+        "Reads at maximum as many blocks as fit into the `values` NumPy array directly into the `values` and `domain` arrays. Returns "
+        "the amount of blocks read.");
+
     cls.def_property_readonly(
         "block_size",
         [](daq::IBlockReader* object)
@@ -61,6 +61,22 @@ void defineIMultiReader(pybind11::module_ m, PyDaqIntf<daq::IMultiReader, daq::I
         },
         py::arg("count"), py::arg("timeout_ms") = 0, py::arg("return_status") = false,
         "Copies at maximum the next `count` unread samples and clock-stamps to the `samples` and `domain` buffers. The amount actually read is returned through the `count` parameter.");
+    cls.def("read_into",
+        [](daq::IMultiReader *object, const py::array& values, const size_t timeoutMs, bool returnStatus)
+        {
+            const auto objectPtr = daq::MultiReaderPtr::Borrow(object);
+            return PyTypedReader::readValuesInto(objectPtr, values, timeoutMs, returnStatus);
+        },
+        py::arg("values").noconvert(), py::arg("timeout_ms") = 0, py::arg("return_status") = false,
+        "Reads at maximum `values.shape[1]` unread samples of each signal directly into the rows of the `values` NumPy array of shape (signal_count, count). The array must be writeable, C-contiguous and of the value read type. Returns the amount of samples read.");
+    cls.def("read_with_domain_into",
+        [](daq::IMultiReader *object, const py::array& values, const py::array& domain, const size_t timeoutMs, bool returnStatus)
+        {
+            const auto objectPtr = daq::MultiReaderPtr::Borrow(object);
+            return PyTypedReader::readValuesWithDomainInto(objectPtr, values, domain, timeoutMs, returnStatus);
+        },
+        py::arg("values").noconvert(), py::arg("domain").noconvert(), py::arg("timeout_ms") = 0, py::arg("return_status") = false,
+        "Reads at maximum `values.shape[1]` unread samples and domain values of each signal directly into the rows of the `values` and `domain` NumPy arrays. Returns the amount of samples read.");
     cls.def("skip_samples",
         [](daq::IMultiReader *object, size_t count, bool returnStatus)
         {
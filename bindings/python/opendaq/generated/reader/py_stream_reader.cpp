@@ -78,6 +78,29 @@ void defineIStreamReader(pybind11::module_ m, PyDaqIntf<daq::IStreamReader, daq:
         py::arg("return_status") = false,
         "Copies at maximum the next `count` unread samples and clock-stamps to the `values` and `stamps` buffers. The amount actually read "
         "is returned through the `count` parameter.");
+    cls.def(
+        "read_into",
+        [](daq::IStreamReader* object, const py::array& values, const size_t timeoutMs, bool returnStatus)
+        {
+            return PyTypedReader::readValuesInto(daq::StreamReaderPtr::Borrow(object), values, timeoutMs, returnStatus);
+        },
+        py::arg("values").noconvert(),
+        py::arg("timeout_ms") = 0,
+        py::arg("return_status") = false,
+        "Reads at maximum `len(values)` unread samples directly into the `values` NumPy array, which must be writeable, C-contiguous "
+        "and of the value read type. Returns the amount of samples read.");
+    cls.def(
+        "read_with_domain_into",
+        [](daq::IStreamReader* object, const py::array& values, const py::array& domain, const size_t timeoutMs, bool returnStatus)
+        {
+            return PyTypedReader::readValuesWithDomainInto(daq::StreamReaderPtr::Borrow(object), values, domain, timeoutMs, returnStatus);
+        },
+        py::arg("values").noconvert(),
+        py::arg("domain").noconvert(),
+        py::arg("timeout_ms") = 0,
+        py::arg("return_status") = false,
+        "Reads at maximum `len(values)` unread samples and domain values directly into the `values` and `domain` NumPy arrays. Returns "
+        "the amount of samples read.");
     cls.def(
         "skip_samples",
         [](daq::IStreamReader* object, size_t count, bool returnStatus)
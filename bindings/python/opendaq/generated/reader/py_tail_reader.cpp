@@ -75,6 +75,29 @@ void defineITailReader(pybind11::module_ m, PyDaqIntf<daq::ITailReader, daq::ISa
         py::arg("return_status") = false,
         "Copies at maximum the next `count` unread samples and clock-stamps to the `values` and `stamps` buffers. The amount actually read "
         "is returned through the `count` parameter.");
+    cls.def(
+        "read_into",
+        [](daq::ITailReader* object, const py::array& values, bool returnStatus)
+        {
+            const auto objectPtr = daq::TailReaderPtr::Borrow(object);
+            return PyTypedReader::readValuesInto(objectPtr, values, 0, returnStatus);
+        },
+        py::arg("values").noconvert(),
+        py::arg("return_status") = false,
+        "Reads at maximum the last `len(values)` samples directly into the `values` NumPy array, which must be writeable, C-contiguous "
+        "and of the value read type. Returns the amount of samples read.");
+    cls.def(
+        "read_with_domain_into",
+        [](daq::ITailReader* object, const py::array& values, const py::array& domain, bool returnStatus)
+        {
+            const auto objectPtr = daq::TailReaderPtr::Borrow(object);
+            return PyTypedReader::readValuesWithDomainInto(objectPtr, values, domain, 0, returnStatus);
+        },
+        py::arg("values").noconvert(),
+        py::arg("domain").noconvert(),
+        py::arg("return_status") = false,
+        "Reads at maximum the last `len(values)` samples and domain values directly into the `values` and `domain` NumPy arrays. "
+        "Returns the amount of samples read.");
     cls.def_property_readonly(
         "history_size",
         [](daq::ITailReader* object)
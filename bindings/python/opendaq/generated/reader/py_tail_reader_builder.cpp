@@ -150,4 +150,18 @@ void defineITailReaderBuilder(pybind11::module_ m, PyDaqIntf<daq::ITailReaderBui
             objectPtr.setSkipEvents(skipEvents);
         },
         "Gets the skip events / Sets the skip events");
+    cls.def_property("use_sample_buffer",
+        [](daq::ITailReaderBuilder *object)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::TailReaderBuilderPtr::Borrow(object);
+            return objectPtr.getUseSampleBuffer();
+        },
+        [](daq::ITailReaderBuilder *object, const bool useSampleBuffer)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::TailReaderBuilderPtr::Borrow(object);
+            objectPtr.setUseSampleBuffer(useSampleBuffer);
+        },
+        "Gets whether the reader keeps its history in a preallocated sample buffer / Sets whether the reader keeps its history in a preallocated sample buffer");
 }
@@ -33,6 +33,11 @@
 
 PyDaqIntf<daq::IScheduler, daq::IBaseObject> declareIScheduler(pybind11::module_ m)
 {
+    py::enum_<daq::ExecutionPriority>(m, "ExecutionPriority")
+        .value("Normal", daq::ExecutionPriority::Normal)
+        .value("Low", daq::ExecutionPriority::Low)
+        .value("High", daq::ExecutionPriority::High);
+
     return wrapInterface<daq::IScheduler, daq::IBaseObject>(m, "IScheduler");
 }
 
@@ -136,4 +141,54 @@ void defineIScheduler(pybind11::module_ m, PyDaqIntf<daq::IScheduler, daq::IBase
         },
         py::arg("work"),
         "Schedules a task to be executed by the main loop.");
+    cls.def("add_execution_domain",
+        [](daq::IScheduler *object, std::variant<daq::IString*, py::str, daq::IEvalValue*>& name, const size_t numWorkers, daq::ExecutionPriority priority, std::variant<daq::IList*, py::list, daq::IEvalValue*>& cpuCores)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::SchedulerPtr::Borrow(object);
+            objectPtr.addExecutionDomain(getVariantValue<daq::IString*>(name), numWorkers, priority, getVariantValue<daq::IList*>(cpuCores));
+        },
+        py::arg("name"), py::arg("num_workers"), py::arg("priority"), py::arg("cpu_cores"),
+        "Adds a named execution domain with its own worker threads and work queues.");
+    cls.def("schedule_work_on_domain",
+        [](daq::IScheduler *object, std::variant<daq::IString*, py::str, daq::IEvalValue*>& domain, daq::IWork* work)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::SchedulerPtr::Borrow(object);
+            objectPtr.scheduleWorkOnDomain(getVariantValue<daq::IString*>(domain), work);
+        },
+        py::arg("domain"), py::arg("work"),
+        "Schedules the specified work callback to run on the worker threads of an execution domain. The call does not block.");
+    cls.def_property_readonly("execution_domain_names",
+        [](daq::IScheduler *object)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::SchedulerPtr::Borrow(object);
+            return objectPtr.getExecutionDomainNames().detach();
+        },
+        py::return_value_policy::take_ownership,
+        "Gets the names of the execution domains, including the \"Default\" domain of the thread-pool.");
+    cls.def("get_execution_domain_statistics",
+        [](daq::IScheduler *object, std::variant<daq::IString*, py::str, daq::IEvalValue*>& domain)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::SchedulerPtr::Borrow(object);
+            return objectPtr.getExecutionDomainStatistics(getVariantValue<daq::IString*>(domain)).detach();
+        },
+        py::arg("domain"),
+        "Gets the work queue statistics of an execution domain.");
+    cls.def_property("execution_domain_statistics_enabled",
+        [](daq::IScheduler *object)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::SchedulerPtr::Borrow(object);
+            return objectPtr.getExecutionDomainStatisticsEnabled();
+        },
+        [](daq::IScheduler *object, const bool enabled)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::SchedulerPtr::Borrow(object);
+            objectPtr.setExecutionDomainStatisticsEnabled(enabled);
+        },
+        "Gets whether execution domain statistics are collected. / Enables or disables the collection of execution domain statistics. Disabled by default.");
 }
@@ -31,6 +31,7 @@
 #include "py_core_types/py_converter.h"
 #include "py_core_objects/py_variant_extractor.h"
 #include "py_opendaq/py_packet_buffer.h"
+#include "py_opendaq/py_data_packet_array.h"
 
 PyDaqIntf<daq::IDataPacket, daq::IPacket> declareIDataPacket(pybind11::module_ m)
 {
@@ -94,6 +95,18 @@ void defineIDataPacket(pybind11::module_ m, PyDaqIntf<daq::IDataPacket, daq::IPa
         },
         py::return_value_policy::take_ownership,
         "Gets a pointer to the raw packet data. `nullptr` if the signal's data rule is implicit.");
+    cls.def_property_readonly("data_array",
+        [](daq::IDataPacket *object)
+        {
+            return PyDataPacketArray::data(daq::DataPacketPtr::Borrow(object));
+        },
+        "Gets the calculated/scaled data as a read-only NumPy array of shape (sample_count, *dimensions) without copying it. The array keeps the packet alive.");
+    cls.def_property_readonly("raw_data_array",
+        [](daq::IDataPacket *object)
+        {
+            return PyDataPacketArray::rawData(daq::DataPacketPtr::Borrow(object));
+        },
+        "Gets the raw packet data as a read-only NumPy array of shape (sample_count, *dimensions) without copying it. The array keeps the packet alive. Empty if the signal's data rule is implicit.");
     cls.def_property_readonly("data_size",
         [](daq::IDataPacket *object)
         {
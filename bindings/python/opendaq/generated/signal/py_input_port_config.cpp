@@ -38,8 +38,13 @@ PyDaqIntf<daq::IInputPortConfig, daq::IInputPort> declareIInputPortConfig(pybind
         .value("SameThread", daq::PacketReadyNotification::SameThread)
         .value("Scheduler", daq::PacketReadyNotification::Scheduler)
         .value("SchedulerQueueWasEmpty", daq::PacketReadyNotification::SchedulerQueueWasEmpty)
+        .value("SchedulerCoalesced", daq::PacketReadyNotification::SchedulerCoalesced)
         .value("Unspecified", daq::PacketReadyNotification::Unspecified);
 
+    py::enum_<daq::PacketQueueMode>(m, "PacketQueueMode")
+        .value("Locked", daq::PacketQueueMode::Locked)
+        .value("LockFreeSpsc", daq::PacketQueueMode::LockFreeSpsc);
+
     return wrapInterface<daq::IInputPortConfig, daq::IInputPort>(m, "IInputPortConfig");
 }
 
@@ -132,4 +137,49 @@ void defineIInputPortConfig(pybind11::module_ m, PyDaqIntf<daq::IInputPortConfig
             objectPtr.notifyPacketEnqueuedWithScheduler();
         },
         "Gets called when a packet was enqueued in a connection.");
+    cls.def_property("packet_queue_mode",
+        [](daq::IInputPortConfig *object)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::InputPortConfigPtr::Borrow(object);
+            return objectPtr.getPacketQueueMode();
+        },
+        [](daq::IInputPortConfig *object, daq::PacketQueueMode mode)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::InputPortConfigPtr::Borrow(object);
+            objectPtr.setPacketQueueMode(mode);
+        },
+        "Gets the type of packet queue used by connections of the input port. / Sets the type of packet queue used by connections of the input port.");
+    cls.def_property("packet_queue_capacity",
+        [](daq::IInputPortConfig *object)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::InputPortConfigPtr::Borrow(object);
+            return objectPtr.getPacketQueueCapacity();
+        },
+        [](daq::IInputPortConfig *object, const size_t capacity)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::InputPortConfigPtr::Borrow(object);
+            objectPtr.setPacketQueueCapacity(capacity);
+        },
+        "Gets the maximum number of packets held by a bounded packet queue. / Sets the maximum number of packets held by a bounded packet queue.");
+    cls.def_property("scheduler_domain",
+        [](daq::IInputPortConfig *object) -> std::optional<std::string>
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::InputPortConfigPtr::Borrow(object);
+            const auto domain = objectPtr.getSchedulerDomain();
+            if (!domain.assigned())
+                return std::nullopt;
+            return domain.toStdString();
+        },
+        [](daq::IInputPortConfig *object, std::optional<std::variant<daq::IString*, py::str, daq::IEvalValue*>>& domain)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::InputPortConfigPtr::Borrow(object);
+            objectPtr.setSchedulerDomain(domain.has_value() ? getVariantValue<daq::IString*>(domain.value()) : nullptr);
+        },
+        "Gets the scheduler execution domain on which packet-ready notifications are processed. / Sets the scheduler execution domain on which packet-ready notifications are processed.");
 }
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "opendaq/data_packet_ptr.h"
+#include "opendaq/scaling_ptr.h"
+#include "py_opendaq/py_typed_reader.h"
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+struct PyDataPacketArray
+{
+    // Wraps the raw packet memory, typed by the descriptor's sample type
+    static inline py::array rawData(const daq::DataPacketPtr& packet)
+    {
+        const auto descriptor = packet.getDataDescriptor();
+        void* data;
+        {
+            py::gil_scoped_release release;
+            data = packet.getRawData();
+        }
+        return toReadOnlyArray(packet, data, descriptor.getSampleType());
+    }
+
+    // Wraps the calculated/scaled packet data, typed by the scaling output type if post scaling is set
+    static inline py::array data(const daq::DataPacketPtr& packet)
+    {
+        const auto descriptor = packet.getDataDescriptor();
+        auto sampleType = descriptor.getSampleType();
+        if (const auto scaling = descriptor.getPostScaling(); scaling.assigned())
+            sampleType = scaling.getOutputSampleType() == daq::ScaledSampleType::Float32 ? daq::SampleType::Float32 : daq::SampleType::Float64;
+
+        void* data;
+        {
+            py::gil_scoped_release release;
+            data = packet.getData();
+        }
+        return toReadOnlyArray(packet, data, sampleType);
+    }
+
+private:
+    // The array does not copy the data. It holds a reference to the packet, which keeps the memory valid for as long as the
+    // array or any view of it is alive. The array is read-only as packets are shared between all connections of a signal.
+    static inline py::array toReadOnlyArray(const daq::DataPacketPtr& packet, void* data, daq::SampleType sampleType)
+    {
+        const auto descriptor = packet.getDataDescriptor();
+
+        py::dtype dtype;
+        if (sampleType == daq::SampleType::Struct)
+            dtype = py::dtype::from_args(PyTypedReader::parseDataDescriptor(descriptor));
+        else
+            dtype = py::dtype(PyTypedReader::sampleTypeToNpyType(sampleType));
+
+        // one axis for the samples, followed by one for each dimension of a sample
+        py::array::ShapeContainer shape{data ? packet.getSampleCount() : 0};
+        if (const auto dimensions = descriptor.getDimensions(); dimensions.assigned())
+        {
+            for (const auto& dimension : dimensions)
+                shape->push_back(dimension.getSize());
+        }
+
+        if (!data)
+            return py::array(dtype, shape);
+
+        auto owner = py::capsule(new daq::DataPacketPtr(packet),
+                                 [](void* ptr) { delete static_cast<daq::DataPacketPtr*>(ptr); });
+
+        py::array array(dtype, shape, data, owner);
+        py::detail::array_proxy(array.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+        return array;
+    }
+};
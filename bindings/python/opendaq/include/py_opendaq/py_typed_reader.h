@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <tuple>
 #include <type_traits>
@@ -202,6 +203,127 @@ struct PyTypedReader
         checkSampleType(domainType);
     }
 
+    /*!
+     * @brief Reads samples into a caller-supplied NumPy array without allocating an intermediate buffer.
+     *
+     * The array must be writeable, C-contiguous and match the value read type. Its shape determines how many
+     * samples are read: `(count,)` for stream and tail readers, `(count, block_size)` or `(count * block_size,)`
+     * for block readers (count in blocks) and `(signal_count, count)` for multi readers. Signals with a dimension
+     * have as many values per sample as the dimension size, which is added as the last axis, e.g. `(count, size)`.
+     * @returns The number of samples (blocks for block readers) read, and the status when @p returnStatus is set.
+     */
+    template <typename ReaderType>
+    static inline SizeReaderStatusVariant<ReaderType> readValuesInto(const ReaderType& reader,
+                                                                     const py::array& values,
+                                                                     size_t timeoutMs,
+                                                                     bool returnStatus)
+    {
+        return readInto(reader, values, nullptr, timeoutMs, returnStatus);
+    }
+
+    /*!
+     * @brief Reads samples and their domain values into caller-supplied NumPy arrays.
+     *
+     * Both arrays must have the same shape, following the rules of `readValuesInto`. The domain array must match
+     * the domain read type.
+     */
+    template <typename ReaderType>
+    static inline SizeReaderStatusVariant<ReaderType> readValuesWithDomainInto(const ReaderType& reader,
+                                                                               const py::array& values,
+                                                                               const py::array& domain,
+                                                                               size_t timeoutMs,
+                                                                               bool returnStatus)
+    {
+        return readInto(reader, values, &domain, timeoutMs, returnStatus);
+    }
+
+    static py::list parseDataDescriptor(const daq::DataDescriptorPtr& dataDesc)
+    {
+        py::list dtype;
+        if (dataDesc.assigned())
+        {
+            for (const auto& fieldDescriptor : dataDesc.getStructFields())
+            {
+                auto name = py::str(fieldDescriptor.getName());
+                auto fieldFormatList = py::list();  // for structs
+                auto fieldFormat = py::dtype();     // for non-structs
+
+                if (fieldDescriptor.getSampleType() == daq::SampleType::Struct)
+                    fieldFormatList = parseDataDescriptor(fieldDescriptor);
+                else
+                    fieldFormat = py::dtype(sampleTypeToNpyType(fieldDescriptor.getSampleType()));
+
+                // fill dimensions
+                auto dimensions = fieldDescriptor.getDimensions();
+                auto dimTuple = py::tuple(dimensions.assigned() ? dimensions.getCount() : 0);
+                if (dimensions.assigned() && !dimensions.empty())
+                {
+                    for (size_t i = 0; i < dimensions.getCount(); ++i)
+                    {
+                        dimTuple[i] = dimensions[i].getSize();
+                    }
+                }
+
+                // assign dtype
+                if (fieldFormatList.empty())
+                {
+                    if (dimTuple.empty())
+                        dtype.append(py::make_tuple(name, fieldFormat));
+                    else
+                        dtype.append(py::make_tuple(name, fieldFormat, dimTuple));
+                }
+                else
+                {
+                    if (dimTuple.empty())
+                        dtype.append(py::make_tuple(name, fieldFormatList));
+                    else
+                        dtype.append(py::make_tuple(name, fieldFormatList, dimTuple));
+                }
+            }
+        }
+        return dtype;
+    }
+
+    static inline unsigned sampleTypeToNpyType(daq::SampleType sampleType)
+    {
+        switch (sampleType)
+        {
+            case daq::SampleType::Float32:
+                return py::detail::npy_api::NPY_FLOAT_;
+            case daq::SampleType::Float64:
+                return py::detail::npy_api::NPY_DOUBLE_;
+            case daq::SampleType::UInt8:
+                return py::detail::npy_api::NPY_UINT8_;
+            case daq::SampleType::Int8:
+                return py::detail::npy_api::NPY_INT8_;
+            case daq::SampleType::UInt16:
+                return py::detail::npy_api::NPY_UINT16_;
+            case daq::SampleType::Int16:
+                return py::detail::npy_api::NPY_INT16_;
+            case daq::SampleType::UInt32:
+                return py::detail::npy_api::NPY_UINT32_;
+            case daq::SampleType::Int32:
+                return py::detail::npy_api::NPY_INT32_;
+            case daq::SampleType::UInt64:
+                return py::detail::npy_api::NPY_UINT64_;
+            case daq::SampleType::Int64:
+                return py::detail::npy_api::NPY_INT64_;
+            case daq::SampleType::ComplexFloat32:
+                return py::detail::npy_api::NPY_CFLOAT_;
+            case daq::SampleType::ComplexFloat64:
+                return py::detail::npy_api::NPY_CDOUBLE_;
+            case daq::SampleType::String:
+                return py::detail::npy_api::NPY_STRING_;
+            case daq::SampleType::Struct:
+                return py::detail::npy_api::NPY_VOID_;
+            case daq::SampleType::Undefined:
+            case daq::SampleType::RangeInt64:
+            case daq::SampleType::Binary:
+            default:
+                DAQ_THROW_EXCEPTION(daq::InvalidParameterException, "Invalid sample type");
+        }
+    }
+
 private:
     template <typename ValueType, typename ReaderType>
     static inline SampleTypeDomainTypeReaderStatusVariant<ReaderType> readWithDomain(
@@ -318,36 +440,44 @@ private:
             blockSize = readerConfig.getInputPorts().getCount();
         }
 
+        const size_t valuesPerSample = isSampleTypeStruct ? 1 : getValuesPerSample(reader);
+        sampleSize *= valuesPerSample;
+
         using StatusType = typename daq::ReaderStatusType<ReaderType>::Type;
         using SampleType = typename SampleTypeToBufferType<ValueType>::Type;
 
+        // samples are read straight into the memory of the returned array; the GIL is only released for the read itself
+        py::gil_scoped_acquire acquire;
         StatusType status;
-        std::vector<SampleType> values(count * blockSize * sampleSize);
-        if constexpr (ReaderHasReadWithTimeout<ReaderType>::value)
+        py::array values = allocateArray<SampleType>(count * blockSize * sampleSize);
+        auto* valuesData = static_cast<SampleType*>(values.mutable_data());
         {
-            if constexpr (isMultiReader)
+            py::gil_scoped_release release;
+            if constexpr (ReaderHasReadWithTimeout<ReaderType>::value)
             {
-                std::vector<void*> ptrs(blockSize);
-                for (size_t i = 0; i < blockSize; i++)
+                if constexpr (isMultiReader)
+                {
+                    std::vector<void*> ptrs(blockSize);
+                    for (size_t i = 0; i < blockSize; i++)
+                    {
+                        ptrs[i] = valuesData + i * count * sampleSize;
+                    }
+                    reader->read(ptrs.data(), &count, timeoutMs, &status);
+                }
+                else
                 {
-                    ptrs[i] = values.data() + i * count * sampleSize;
+                    reader->read(valuesData, &count, timeoutMs, &status);
                 }
-                reader->read(ptrs.data(), &count, timeoutMs, &status);
             }
             else
             {
-                reader->read(values.data(), &count, timeoutMs, &status);
+                reader->read(valuesData, &count, &status);
             }
         }
-        else
-        {
-            reader->read(values.data(), &count, &status);
-        }
 
         // update descriptors if changed
         assignDescriptorsFromStatus(reader, status);
 
-        py::gil_scoped_acquire acquire;
         py::array::ShapeContainer shape;
         if (blockSize > 1)
         {
@@ -366,9 +496,10 @@ private:
         py::array::StridesContainer strides;
         if (blockSize > 1 && isMultiReader)
         {
-            const size_t valueSize = isSampleTypeStruct ? sampleSize : sizeof(SampleType);
+            const size_t valueSize = isSampleTypeStruct ? sampleSize : sizeof(SampleType) * valuesPerSample;
             strides = {valueSize * initialCount, valueSize};
         }
+        addValuesAxis(shape, strides, valuesPerSample, sizeof(SampleType));
 
         py::dtype dtype{};
         if constexpr (isSampleTypeStruct)
@@ -376,9 +507,9 @@ private:
             dtype = py::dtype::from_args(parseDataDescriptor(dataDescriptor));
         }
 
-        return returnStatus ? SampleTypeReaderStatusVariant<ReaderType>{std::make_tuple(toPyArray(std::move(values), shape, strides, dtype),
+        return returnStatus ? SampleTypeReaderStatusVariant<ReaderType>{std::make_tuple(arrayView(values, shape, strides, dtype),
                                                                                         status.detach())}
-                            : SampleTypeReaderStatusVariant<ReaderType>{toPyArray(std::move(values), shape, strides, dtype)};
+                            : SampleTypeReaderStatusVariant<ReaderType>{arrayView(values, shape, strides, dtype)};
     }
 
     template <typename ValueType, typename DomainType, typename ReaderType>
@@ -423,38 +554,48 @@ private:
             blockSize = readerConfig.getInputPorts().getCount();
         }
 
+        const size_t valuesPerSample = isValueSampleTypeStruct ? 1 : getValuesPerSample(reader);
+        sampleSize *= valuesPerSample;
+
         using StatusType = typename daq::ReaderStatusType<ReaderType>::Type;
         using ValueSampleType = typename SampleTypeToBufferType<ValueType>::Type;
         using DomainSampleType = typename SampleTypeToBufferType<DomainType>::Type;
+
+        // samples are read straight into the memory of the returned arrays; the GIL is only released for the read itself
+        py::gil_scoped_acquire acquire;
         StatusType status;
-        std::vector<ValueSampleType> values(count * blockSize * sampleSize);
-        std::vector<DomainSampleType> domain(count * blockSize);
-        if constexpr (ReaderHasReadWithTimeout<ReaderType>::value)
+        py::array values = allocateArray<ValueSampleType>(count * blockSize * sampleSize);
+        py::array domain = allocateArray<DomainSampleType>(count * blockSize);
+        auto* valuesData = static_cast<ValueSampleType*>(values.mutable_data());
+        auto* domainData = static_cast<DomainSampleType*>(domain.mutable_data());
         {
-            if constexpr (isMultiReader)
+            py::gil_scoped_release release;
+            if constexpr (ReaderHasReadWithTimeout<ReaderType>::value)
             {
-                std::vector<void*> valuesPtrs(blockSize), domainPtrs(blockSize);
-                for (size_t i = 0; i < blockSize; i++)
+                if constexpr (isMultiReader)
+                {
+                    std::vector<void*> valuesPtrs(blockSize), domainPtrs(blockSize);
+                    for (size_t i = 0; i < blockSize; i++)
+                    {
+                        valuesPtrs[i] = valuesData + i * count * sampleSize;
+                        domainPtrs[i] = domainData + i * count;
+                    }
+                    reader->readWithDomain(valuesPtrs.data(), domainPtrs.data(), &count, timeoutMs, &status);
+                }
+                else
                 {
-                    valuesPtrs[i] = values.data() + i * count * sampleSize;
-                    domainPtrs[i] = domain.data() + i * count;
+                    reader->readWithDomain(valuesData, domainData, &count, timeoutMs, &status);
                 }
-                reader->readWithDomain(valuesPtrs.data(), domainPtrs.data(), &count, timeoutMs, &status);
             }
             else
             {
-                reader->readWithDomain(values.data(), domain.data(), &count, timeoutMs, &status);
+                reader->readWithDomain(valuesData, domainData, &count, &status);
             }
         }
-        else
-        {
-            reader->readWithDomain(values.data(), domain.data(), &count, &status);
-        }
 
         // update descriptors if changed
         assignDescriptorsFromStatus(reader, status);
 
-        py::gil_scoped_acquire acquire;
         py::array::ShapeContainer shape;
         if (blockSize > 1)
         {
@@ -474,12 +615,16 @@ private:
         py::array::StridesContainer domainStrides;
         if (blockSize > 1 && isMultiReader)
         {
-            const size_t valueSize = isValueSampleTypeStruct ? sampleSize : sizeof(ValueSampleType);
+            const size_t valueSize = isValueSampleTypeStruct ? sampleSize : sizeof(ValueSampleType) * valuesPerSample;
             const size_t domainSize = sizeof(DomainSampleType);
             valuesStrides = {valueSize * initialCount, valueSize};
             domainStrides = {domainSize * initialCount, domainSize};
         }
 
+        // the domain has one value per sample
+        py::array::ShapeContainer valuesShape = shape;
+        addValuesAxis(valuesShape, valuesStrides, valuesPerSample, sizeof(ValueSampleType));
+
         py::dtype dtype{};
         if constexpr (isValueSampleTypeStruct)
         {
@@ -490,18 +635,20 @@ private:
         if constexpr (std::is_same_v<DomainType, std::chrono::system_clock::time_point>)
         {
             domainDtype = py::dtype("datetime64[ns]");
-            std::transform(domain.begin(),
-                           domain.end(),
-                           domain.begin(),
-                           [](int64_t timestamp)
-                           {
-                               const auto t = std::chrono::system_clock::time_point(std::chrono::system_clock::duration(timestamp));
-                               return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
-                           });
+            auto* timestamps = reinterpret_cast<int64_t*>(domainData);
+            if constexpr (isMultiReader)
+            {
+                for (size_t i = 0; i < blockSize; i++)
+                    toNanoseconds(timestamps + i * initialCount, count);
+            }
+            else
+            {
+                toNanoseconds(timestamps, count * blockSize);
+            }
         }
 
-        auto valuesArray = toPyArray(std::move(values), shape, valuesStrides, dtype);
-        auto domainArray = toPyArray(std::move(domain), shape, domainStrides, domainDtype);
+        auto valuesArray = arrayView(values, valuesShape, valuesStrides, dtype);
+        auto domainArray = arrayView(domain, shape, domainStrides, domainDtype);
 
         return returnStatus
                    ? SampleTypeDomainTypeReaderStatusVariant<ReaderType>{std::make_tuple(
@@ -509,68 +656,273 @@ private:
                    : SampleTypeDomainTypeReaderStatusVariant<ReaderType>{std::make_tuple(std::move(valuesArray), std::move(domainArray))};
     }
 
+    template <typename SampleType>
+    static inline py::array allocateArray(size_t size)
+    {
+        // not initialized, the reader overwrites the part that is returned
+        return py::array(py::dtype::of<SampleType>(), {size});
+    }
+
+    // Returns a view of the first samples of an array allocated for a read; the view keeps the array alive
+    static inline py::array arrayView(const py::array& array,
+                                      const py::array::ShapeContainer& shape,
+                                      const py::array::StridesContainer& strides,
+                                      const py::dtype& dtype)
+    {
+        const py::dtype dt = dtype ? dtype : array.dtype();
+        if (strides->empty())
+            return py::array(dt, shape, array.data(), array);
+        return py::array(dt, shape, strides, array.data(), array);
+    }
+
+    // Adds the axis of the values of each sample to the shape of a read, for signals with more than one value per sample
+    static inline void addValuesAxis(py::array::ShapeContainer& shape,
+                                     py::array::StridesContainer& strides,
+                                     size_t valuesPerSample,
+                                     size_t valueSize)
+    {
+        if (valuesPerSample <= 1)
+            return;
+
+        shape->push_back(valuesPerSample);
+        if (!strides->empty())
+            strides->push_back(valueSize);
+    }
+
+    // Returns the number of values in each sample, which the readers take from the size of a one-dimensional
+    // sample descriptor
+    static inline size_t getValuesPerSample(const daq::DataDescriptorPtr& descriptor)
+    {
+        if (!descriptor.assigned())
+            return 1;
+
+        const auto dimensions = descriptor.getDimensions();
+        if (dimensions.assigned() && dimensions.getCount() == 1)
+            return std::max<size_t>(dimensions[0].getSize(), 1);
+        return 1;
+    }
+
     template <typename ReaderType>
-    static inline typename daq::ReaderStatusType<ReaderType>::Type readZeroValues(const ReaderType& reader, [[maybe_unused]] size_t timeoutMs)
+    static inline size_t getValuesPerSample(const ReaderType& reader)
     {
-        using StatusType = typename daq::ReaderStatusType<ReaderType>::Type;
-        StatusType status;
-        size_t tmpCount = 0;
-        if constexpr (ReaderHasReadWithTimeout<ReaderType>::value)
+        daq::ReaderConfigPtr readerConfig = reader.template asPtrOrNull<daq::IReaderConfig>();
+
+        if constexpr (std::is_base_of_v<daq::MultiReaderPtr, ReaderType>)
         {
-            reader->read(nullptr, &tmpCount, timeoutMs, &status);
+            // each signal is read into a row of the same length
+            size_t valuesPerSample = 0;
+            for (const auto& port : readerConfig.getInputPorts())
+            {
+                const auto signal = port.getSignal();
+                const size_t signalValuesPerSample = getValuesPerSample(signal.assigned() ? signal.getDescriptor() : nullptr);
+                if (valuesPerSample != 0 && signalValuesPerSample != valuesPerSample)
+                    DAQ_THROW_EXCEPTION(daq::NotSupportedException, "Multi reader signals must have the same number of values per sample");
+                valuesPerSample = signalValuesPerSample;
+            }
+            return std::max<size_t>(valuesPerSample, 1);
         }
         else
         {
-            reader->read(nullptr, &tmpCount, &status);
+            // the descriptor a reader is created with is not reported by a descriptor changed event
+            auto descriptor = getDescriptor<ReaderType>(reader, VALUE_DATA_DESCRIPTOR_ATTRIBUTE);
+            if (!descriptor.assigned() && readerConfig.assigned())
+            {
+                const auto ports = readerConfig.getInputPorts();
+                if (ports.assigned() && ports.getCount() > 0)
+                {
+                    const daq::InputPortPtr port = ports[0];
+                    if (const auto signal = port.getSignal(); signal.assigned())
+                        descriptor = signal.getDescriptor();
+                }
+            }
+            return getValuesPerSample(descriptor);
         }
-        return status;
     }
 
-    static py::list parseDataDescriptor(const daq::DataDescriptorPtr& dataDesc)
+    static inline void toNanoseconds(int64_t* timestamps, size_t count)
     {
-        py::list dtype;
-        if (dataDesc.assigned())
+        std::transform(timestamps,
+                       timestamps + count,
+                       timestamps,
+                       [](int64_t timestamp)
+                       {
+                           const auto t = std::chrono::system_clock::time_point(std::chrono::system_clock::duration(timestamp));
+                           return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+                       });
+    }
+
+    template <typename ReaderType>
+    static inline SizeReaderStatusVariant<ReaderType> readInto(
+        const ReaderType& reader, const py::array& values, const py::array* domain, size_t timeoutMs, bool returnStatus)
+    {
+        constexpr const bool isMultiReader = std::is_base_of_v<daq::MultiReaderPtr, ReaderType>;
+        using StatusType = typename daq::ReaderStatusType<ReaderType>::Type;
+
+        py::dtype valueDtype;
+        py::dtype domainDtype;
+        if (!getReadDtype(reader, false, valueDtype) || (domain && !getReadDtype(reader, true, domainDtype)))
         {
-            for (const auto& fieldDescriptor : dataDesc.getStructFields())
-            {
-                auto name = py::str(fieldDescriptor.getName());
-                auto fieldFormatList = py::list();  // for structs
-                auto fieldFormat = py::dtype();     // for non-structs
+            // the read types are resolved by the descriptor changed event
+            auto status = readZeroValues(reader, timeoutMs);
+            assignDescriptorsFromStatus(reader, status);
+            return returnStatus ? SizeReaderStatusVariant<ReaderType>{std::make_tuple(daq::SizeT{0}, status.detach())}
+                                : SizeReaderStatusVariant<ReaderType>{daq::SizeT{0}};
+        }
 
-                if (fieldDescriptor.getSampleType() == daq::SampleType::Struct)
-                    fieldFormatList = parseDataDescriptor(fieldDescriptor);
-                else
-                    fieldFormat = py::dtype(sampleTypeToNpyType(fieldDescriptor.getSampleType()));
+        size_t blockSize = 1;
+        if constexpr (std::is_base_of_v<daq::BlockReaderPtr, ReaderType>)
+        {
+            reader->getBlockSize(&blockSize);
+        }
+        if constexpr (isMultiReader)
+        {
+            daq::ReaderConfigPtr readerConfig = reader.template asPtr<daq::IReaderConfig>();
+            blockSize = readerConfig.getInputPorts().getCount();
+        }
 
-                // fill dimensions
-                auto dimensions = fieldDescriptor.getDimensions();
-                auto dimTuple = py::tuple(dimensions.assigned() ? dimensions.getCount() : 0);
-                if (dimensions.assigned() && !dimensions.empty())
-                {
-                    for (size_t i = 0; i < dimensions.getCount(); ++i)
-                    {
-                        dimTuple[i] = dimensions[i].getSize();
-                    }
-                }
+        // struct dtypes describe a whole sample
+        const size_t valuesPerSample = valueDtype.kind() == 'V' ? 1 : getValuesPerSample(reader);
 
-                // assign dtype
-                if (fieldFormatList.empty())
-                {
-                    if (dimTuple.empty())
-                        dtype.append(py::make_tuple(name, fieldFormat));
-                    else
-                        dtype.append(py::make_tuple(name, fieldFormat, dimTuple));
-                }
+        checkArray(values, valueDtype, "values");
+        size_t count = getArrayReadCount(values, blockSize, isMultiReader, valuesPerSample);
+        if (domain)
+        {
+            checkArray(*domain, domainDtype, "domain");
+            if (getArrayReadCount(*domain, blockSize, isMultiReader, 1) != count)
+                DAQ_THROW_EXCEPTION(daq::InvalidParameterException, "The values and domain arrays must hold the same number of samples");
+        }
+
+        // the arrays were checked to be writeable
+        auto* valuesData = static_cast<uint8_t*>(const_cast<void*>(values.data()));
+        auto* domainData = domain ? static_cast<uint8_t*>(const_cast<void*>(domain->data())) : nullptr;
+
+        void* valuesBuffer = valuesData;
+        void* domainBuffer = domainData;
+
+        // multi readers take one buffer per signal, one row of the array each
+        std::vector<void*> valuesPtrs, domainPtrs;
+        if constexpr (isMultiReader)
+        {
+            for (size_t i = 0; i < blockSize; i++)
+            {
+                valuesPtrs.push_back(valuesData + i * values.strides(0));
+                if (domain)
+                    domainPtrs.push_back(domainData + i * domain->strides(0));
+            }
+            valuesBuffer = valuesPtrs.data();
+            domainBuffer = domain ? domainPtrs.data() : nullptr;
+        }
+
+        StatusType status;
+        {
+            py::gil_scoped_release release;
+            if constexpr (ReaderHasReadWithTimeout<ReaderType>::value)
+            {
+                if (domain)
+                    reader->readWithDomain(valuesBuffer, domainBuffer, &count, timeoutMs, &status);
                 else
-                {
-                    if (dimTuple.empty())
-                        dtype.append(py::make_tuple(name, fieldFormatList));
-                    else
-                        dtype.append(py::make_tuple(name, fieldFormatList, dimTuple));
-                }
+                    reader->read(valuesBuffer, &count, timeoutMs, &status);
+            }
+            else
+            {
+                if (domain)
+                    reader->readWithDomain(valuesBuffer, domainBuffer, &count, &status);
+                else
+                    reader->read(valuesBuffer, &count, &status);
             }
         }
-        return dtype;
+
+        // update descriptors if changed
+        assignDescriptorsFromStatus(reader, status);
+
+        return returnStatus ? SizeReaderStatusVariant<ReaderType>{std::make_tuple(count, status.detach())}
+                            : SizeReaderStatusVariant<ReaderType>{count};
+    }
+
+    // Returns false if the read type is not known until the descriptor changed event is read
+    template <typename ReaderType>
+    static inline bool getReadDtype(const ReaderType& reader, bool domain, py::dtype& dtype)
+    {
+        daq::SampleType sampleType = daq::SampleType::Undefined;
+        if (domain)
+            reader->getDomainReadType(&sampleType);
+        else
+            reader->getValueReadType(&sampleType);
+
+        if (sampleType == daq::SampleType::Undefined)
+            return false;
+
+        if (sampleType == daq::SampleType::Struct)
+        {
+            const auto descriptor = getDescriptor<ReaderType>(reader, domain ? DOMAIN_DATA_DESCRIPTOR_ATTRIBUTE : VALUE_DATA_DESCRIPTOR_ATTRIBUTE);
+            if (!descriptor.assigned())
+                return false;
+            dtype = py::dtype::from_args(parseDataDescriptor(descriptor));
+            return true;
+        }
+
+        checkSampleType(sampleType);
+        dtype = py::dtype(sampleTypeToNpyType(sampleType));
+        return true;
+    }
+
+    static inline void checkArray(const py::array& array, const py::dtype& dtype, const char* name)
+    {
+        if (array.dtype().kind() != dtype.kind() || array.itemsize() != dtype.itemsize())
+            DAQ_THROW_EXCEPTION(daq::InvalidParameterException,
+                                std::string("The ") + name + " array dtype does not match the reader's read type");
+        if (!(array.flags() & py::array::c_style))
+            DAQ_THROW_EXCEPTION(daq::InvalidParameterException, std::string("The ") + name + " array must be C-contiguous");
+        if (!array.writeable())
+            DAQ_THROW_EXCEPTION(daq::InvalidParameterException, std::string("The ") + name + " array must be writeable");
+    }
+
+    // Returns the number of samples (blocks for block readers) an array holds; signals with more than one value per
+    // sample take an additional last axis of that size
+    static inline size_t getArrayReadCount(const py::array& array, size_t blockSize, bool isMultiReader, size_t valuesPerSample)
+    {
+        const bool hasValuesAxis = valuesPerSample > 1;
+        if (hasValuesAxis && (array.ndim() < 2 || static_cast<size_t>(array.shape(array.ndim() - 1)) != valuesPerSample))
+            DAQ_THROW_EXCEPTION(daq::InvalidParameterException,
+                                "The last axis of the array must have the size of the signal dimension (" + std::to_string(valuesPerSample) + ")");
+
+        const auto sampleAxes = static_cast<size_t>(array.ndim()) - (hasValuesAxis ? 1 : 0);
+        const size_t sampleCount = static_cast<size_t>(array.size()) / valuesPerSample;
+
+        if (isMultiReader)
+        {
+            if (sampleAxes != 2 || static_cast<size_t>(array.shape(0)) != blockSize)
+                DAQ_THROW_EXCEPTION(daq::InvalidParameterException, "Multi reader arrays must have the shape (signal_count, count)");
+            return array.shape(1);
+        }
+
+        if (blockSize > 1)
+        {
+            if (sampleAxes > 2 || sampleCount % blockSize != 0)
+                DAQ_THROW_EXCEPTION(daq::InvalidParameterException, "Block reader arrays must hold a whole number of blocks");
+            return sampleCount / blockSize;
+        }
+
+        if (sampleAxes != 1)
+            DAQ_THROW_EXCEPTION(daq::InvalidParameterException, "Reader arrays must be one-dimensional");
+        return sampleCount;
+    }
+
+    template <typename ReaderType>
+    static inline typename daq::ReaderStatusType<ReaderType>::Type readZeroValues(const ReaderType& reader, [[maybe_unused]] size_t timeoutMs)
+    {
+        using StatusType = typename daq::ReaderStatusType<ReaderType>::Type;
+        StatusType status;
+        size_t tmpCount = 0;
+        if constexpr (ReaderHasReadWithTimeout<ReaderType>::value)
+        {
+            reader->read(nullptr, &tmpCount, timeoutMs, &status);
+        }
+        else
+        {
+            reader->read(nullptr, &tmpCount, &status);
+        }
+        return status;
     }
 
     static inline void checkSampleType(daq::SampleType type)
@@ -664,44 +1016,4 @@ private:
         }
         return {valueDescriptor, domainDescriptor};
     }
-
-    static inline unsigned sampleTypeToNpyType(daq::SampleType sampleType)
-    {
-        switch (sampleType)
-        {
-            case daq::SampleType::Float32:
-                return py::detail::npy_api::NPY_FLOAT_;
-            case daq::SampleType::Float64:
-                return py::detail::npy_api::NPY_DOUBLE_;
-            case daq::SampleType::UInt8:
-                return py::detail::npy_api::NPY_UINT8_;
-            case daq::SampleType::Int8:
-                return py::detail::npy_api::NPY_INT8_;
-            case daq::SampleType::UInt16:
-                return py::detail::npy_api::NPY_UINT16_;
-            case daq::SampleType::Int16:
-                return py::detail::npy_api::NPY_INT16_;
-            case daq::SampleType::UInt32:
-                return py::detail::npy_api::NPY_UINT32_;
-            case daq::SampleType::Int32:
-                return py::detail::npy_api::NPY_INT32_;
-            case daq::SampleType::UInt64:
-                return py::detail::npy_api::NPY_UINT64_;
-            case daq::SampleType::Int64:
-                return py::detail::npy_api::NPY_INT64_;
-            case daq::SampleType::ComplexFloat32:
-                return py::detail::npy_api::NPY_CFLOAT_;
-            case daq::SampleType::ComplexFloat64:
-                return py::detail::npy_api::NPY_CDOUBLE_;
-            case daq::SampleType::String:
-                return py::detail::npy_api::NPY_STRING_;
-            case daq::SampleType::Struct:
-                return py::detail::npy_api::NPY_VOID_;
-            case daq::SampleType::Undefined:
-            case daq::SampleType::RangeInt64:
-            case daq::SampleType::Binary:
-            default:
-                DAQ_THROW_EXCEPTION(daq::InvalidParameterException, "Invalid sample type");
-        }
-    }
 };
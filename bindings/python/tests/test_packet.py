@@ -49,5 +49,122 @@ class TestPacket(opendaq_test.TestCase):
         self.assertTrue(np.array_equal(values, test_scaled_data))
         self.assertTrue(np.array_equal(time, np.arange(10, dtype=np.int64)))
 
+    def test_packet_data_array(self):
+        ctx = opendaq.NullContext()
+        desc_builder = opendaq.DataDescriptorBuilder()
+        desc_builder.sample_type = opendaq.SampleType.Float64
+        desc = desc_builder.build()
+
+        packet = opendaq.DataPacket(desc, 10, 0)
+        np.copyto(np.frombuffer(packet.raw_data, dtype=np.float64), np.arange(10, dtype=np.float64))
+
+        data = packet.data_array
+        self.assertEqual(data.dtype, np.float64)
+        self.assertEqual(data.shape, (10,))
+        self.assertFalse(data.flags.writeable)
+        self.assertTrue(np.array_equal(data, np.arange(10, dtype=np.float64)))
+        self.assertTrue(np.array_equal(packet.raw_data_array, data))
+
+        # the view keeps the packet alive
+        del packet
+        self.assertTrue(np.array_equal(data, np.arange(10, dtype=np.float64)))
+
+    def test_read_into(self):
+        mock = opendaq.MockSignal()
+        reader = opendaq.StreamReader(mock.signal)
+        reader.read(0)
+
+        mock.add_data(np.arange(10))
+
+        values = np.zeros(20, dtype=np.float64)
+        count = reader.read_into(values)
+        self.assertEqual(count, 10)
+        self.assertTrue(np.array_equal(values[:count], np.arange(10)))
+
+    def test_read_with_domain_into(self):
+        mock = opendaq.MockSignal()
+        reader = opendaq.StreamReader(mock.signal)
+        reader.read(0)
+
+        mock.add_data(np.arange(10))
+
+        values = np.empty(10, dtype=np.float64)
+        domain = np.empty(10, dtype=np.int64)
+        count, status = reader.read_with_domain_into(values, domain, return_status=True)
+        self.assertEqual(count, 10)
+        self.assertEqual(status.read_status, opendaq.ReadStatus.Ok)
+        self.assertTrue(np.array_equal(values, np.arange(10)))
+
+    def test_read_into_invalid_array(self):
+        mock = opendaq.MockSignal()
+        reader = opendaq.StreamReader(mock.signal)
+        reader.read(0)
+
+        mock.add_data(np.arange(10))
+
+        with self.assertRaises(RuntimeError):
+            reader.read_into(np.empty(10, dtype=np.int32))
+        with self.assertRaises(RuntimeError):
+            reader.read_into(np.empty(20, dtype=np.float64)[::2])
+
+    def test_read_into_dimension(self):
+        ctx = opendaq.NullContext()
+
+        time_signal = opendaq.Signal(ctx, None, "time", None)
+        value_signal = opendaq.Signal(ctx, None, "value", None)
+        value_signal.domain_signal = time_signal
+
+        time_desc_builder = opendaq.DataDescriptorBuilder()
+        time_desc_builder.tick_resolution = opendaq.Ratio(1, 1000)
+        time_desc_builder.unit = opendaq.Unit(-1, "s", "second", "time")
+        time_desc_builder.sample_type = opendaq.SampleType.Int64
+        time_desc_builder.rule = opendaq.LinearDataRule(1, 0)
+        time_desc = time_desc_builder.build()
+        time_signal.descriptor = time_desc
+
+        # each sample holds 4 values
+        value_desc_builder = opendaq.DataDescriptorBuilder()
+        value_desc_builder.sample_type = opendaq.SampleType.Float64
+        value_desc_builder.dimensions = [opendaq.Dimension(opendaq.LinearDimensionRule(1, 0, 4), None, "Index")]
+        value_desc = value_desc_builder.build()
+        value_signal.descriptor = value_desc
+
+        reader = opendaq.StreamReader(value_signal)
+
+        def send(offset):
+            time_packet = opendaq.DataPacket(time_desc, 5, offset)
+            time_signal.send_packet(time_packet)
+            value_packet = opendaq.DataPacketWithDomain(time_packet, value_desc, 5, 0)
+            np.copyto(np.frombuffer(value_packet.raw_data, dtype=np.float64), np.arange(20, dtype=np.float64))
+            value_signal.send_packet(value_packet)
+
+        expected = np.arange(20, dtype=np.float64).reshape(5, 4)
+
+        send(0)
+        values = np.empty((5, 4), dtype=np.float64)
+        self.assertEqual(reader.read_into(values), 5)
+        self.assertTrue(np.array_equal(values, expected))
+
+        send(5)
+        values, domain = reader.read_with_domain(5)
+        self.assertEqual(values.shape, (5, 4))
+        self.assertEqual(domain.shape, (5,))
+        self.assertTrue(np.array_equal(values, expected))
+        self.assertTrue(np.array_equal(domain, np.arange(5, 10, dtype=np.int64)))
+
+        send(10)
+        values = np.empty((5, 4), dtype=np.float64)
+        domain = np.empty(5, dtype=np.int64)
+        self.assertEqual(reader.read_with_domain_into(values, domain), 5)
+        self.assertTrue(np.array_equal(values, expected))
+        self.assertTrue(np.array_equal(domain, np.arange(10, 15, dtype=np.int64)))
+
+        # the last axis must match the dimension size
+        send(15)
+        with self.assertRaises(RuntimeError):
+            reader.read_into(np.empty((5, 3), dtype=np.float64))
+        with self.assertRaises(RuntimeError):
+            reader.read_into(np.empty(20, dtype=np.float64))
+
 if __name__ == '__main__':
     unittest.main()
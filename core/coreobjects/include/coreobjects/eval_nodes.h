@@ -38,7 +38,9 @@ enum class RefType
     PropertyNames
 };
 
-using GetReferenceEvent = std::function<BaseObjectPtr(std::string, RefType, int, std::string&, bool)>;
+class RefNode;
+
+using GetReferenceEvent = std::function<BaseObjectPtr(const RefNode& node, bool lock)>;
 
 class BaseNode
 {
@@ -65,9 +67,13 @@ class RefNode : public BaseNode
 public:
     BaseObjectPtr refObject;
     std::string refStr;
-    std::string postRef;
     int argIndex;
 
+    // Bound when the node is created: the referenced property name with the ":Value"-style suffix removed,
+    // and the reference type the suffix selects. The name is interned, so property lookups compare pointers.
+    StringPtr boundName;
+    RefType boundRefType;
+
     GetReferenceEvent onResolveReference;
 
     RefNode(std::string refStr, RefType refType);
@@ -79,10 +85,14 @@ public:
     std::unique_ptr<BaseNode> clone(GetReferenceEvent refCall) override;
 
     void useAsArgument(RefNode* node);
+    RefType getRefType() const;
 
 protected:
     RefType refType;
     ResolveStatus resolveStatus;
+
+private:
+    void bind();
 };
 
 class PropFuncNode : public BaseNode
@@ -15,6 +15,9 @@
  */
 
 #pragma once
+#include <array>
+#include <cstdint>
+#include <memory>
 #include <unordered_set>
 #include <coretypes/coretypes.h>
 #include <coreobjects/eval_value.h>
@@ -28,6 +31,50 @@ BEGIN_NAMESPACE_OPENDAQ
 
 struct ISerializedObject;
 
+// Parsed expression, shared by all eval values with the same expression text and by their clones. The node tree
+// is only used as a template; each eval value evaluates its own copy, bound to its owner.
+struct CompiledEvalValue
+{
+    std::unique_ptr<BaseNode> node;
+    std::unordered_set<std::string> propertyReferences;
+    ErrCode parseErrCode;
+    std::string parseErrMessage;
+};
+
+// Result of an eval value, calculated for `owner` at the given value revision of the owner and the process-wide
+// property value revision. Results are immutable and replaced as a whole.
+struct EvalValueResult
+{
+    IPropertyObject* owner;
+    UInt ownerRevision;
+    uint64_t revision;
+    BaseObjectPtr result;
+};
+
+// Last results of an eval value and its clones, one slot per owner hash. A default value of a property class is
+// cloned for every object that reads it, so the results of different owners must not replace each other. Owners
+// that map to the same slot do. Slots are read and replaced with atomic shared pointer operations, so evaluating
+// does not lock.
+struct EvalValueResultCache
+{
+    static constexpr int SlotBits = 4;
+    static constexpr size_t SlotCount = size_t{1} << SlotBits;
+
+    std::array<std::shared_ptr<const EvalValueResult>, SlotCount> slots;
+
+    static size_t getSlotIndex(const IPropertyObject* owner)
+    {
+        // Fibonacci hashing; the low bits of object addresses are mostly zero
+        const auto address = static_cast<uint64_t>(reinterpret_cast<std::uintptr_t>(owner));
+        return static_cast<size_t>((address * 11400714819323198485ull) >> (64 - SlotBits));
+    }
+
+    std::shared_ptr<const EvalValueResult>& getSlot(const IPropertyObject* owner)
+    {
+        return slots[getSlotIndex(owner)];
+    }
+};
+
 class EvalValueImpl : public ImplementationOf<IEvalValue, IOwnable, ICoreType, IInteger_Helper, ISerializable, IFloat_Helper,
                                               IBoolean_Helper, IString_Helper, IConvertible, IList, INumber, IProperty_Helper, 
                                               IUnit_Helper, IStruct_Helper, IDict>
@@ -170,10 +217,12 @@ public:
 
 private:
     StringPtr eval;
+    std::shared_ptr<const CompiledEvalValue> compiled;
+    std::shared_ptr<EvalValueResultCache> resultCache;
     std::unique_ptr<BaseNode> node;
-    std::unique_ptr<std::unordered_set<std::string>> propertyReferences;
     ListPtr<IBaseObject> arguments;
     WeakRefPtr<IPropertyObject> owner;
+    IPropertyObject* ownerObject;
     StringPtr ownerRefStr;
     ResolveStatus resolveStatus;
     ErrCode parseErrCode;
@@ -183,10 +232,13 @@ private:
     bool useFunctionResolver;
     FunctionPtr func;
 
-    BaseObjectPtr getReference(const std::string& str, RefType refType, int argIndex, std::string& postRef, bool lock) const;
+    BaseObjectPtr getReference(const RefNode& refNode, bool lock) const;
     int resolveReferences(bool lock);
 
     ErrCode checkParseAndResolve(bool lock);
+    ErrCode evaluate(bool lock, BaseObjectPtr& result);
+    bool isResultCacheable() const;
+    bool getResultRevisions(UInt& ownerRevision, uint64_t& revision) const;
 
     template <typename T>
     inline ErrCode getValueInternal(T& value);
@@ -196,7 +248,7 @@ private:
 
     BaseObjectPtr calc();
     void checkForEvalValue(BaseObjectPtr& prop) const;
-    BaseObjectPtr getReferenceFromPrefix(const PropertyObjectPtr& propObject, const std::string& str, RefType refType, bool lock) const;
+    BaseObjectPtr getReferenceFromPrefix(const PropertyObjectPtr& propObject, const StringPtr& name, RefType refType, bool lock) const;
 
 protected:
     void internalDispose(bool disposing) override;
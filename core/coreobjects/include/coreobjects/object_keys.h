@@ -69,11 +69,22 @@ struct StringEqualTo
     {
         assert(a != nullptr && b != nullptr);
 
+        // interned strings with equal values are the same object
+        if (a.getObject() == b.getObject())
+            return true;
+
+        SizeT aLength;
+        a->getLength(&aLength);
+        SizeT bLength;
+        b->getLength(&bLength);
+        if (aLength != bLength)
+            return false;
+
         ConstCharPtr aChPtr;
         a->getCharPtr(&aChPtr);
         ConstCharPtr bChPtr;
         b->getCharPtr(&bChPtr);
-        return strcmp(aChPtr, bChPtr) == 0;
+        return memcmp(aChPtr, bChPtr, aLength) == 0;
     };
 };
 
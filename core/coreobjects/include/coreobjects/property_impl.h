@@ -25,6 +25,7 @@
 #include <coreobjects/property_internal_ptr.h>
 #include <coreobjects/property_object_factory.h>
 #include <coreobjects/property_object_internal_ptr.h>
+#include <coreobjects/property_object_utils.h>
 #include <coreobjects/property_object_ptr.h>
 #include <coreobjects/property_ptr.h>
 #include <coreobjects/serialization_utils.h>
@@ -86,7 +87,7 @@ public:
     explicit PropertyImpl(const StringPtr& name)
         : PropertyImpl()
     {
-        this->name = name;
+        this->name = name.assigned() ? InternedString(name) : name;
     }
 
     explicit PropertyImpl(IPropertyBuilder* propertyBuilder)
@@ -94,6 +95,8 @@ public:
         const auto propertyBuilderPtr = PropertyBuilderPtr::Borrow(propertyBuilder);
         this->valueType = propertyBuilderPtr.getValueType();
         this->name = propertyBuilderPtr.getName();
+        if (this->name.assigned())
+            this->name = InternedString(this->name);
         this->description = propertyBuilderPtr.getDescription();
         this->unit = propertyBuilderPtr.getUnit();
         this->minValue = propertyBuilderPtr.getMinValue();
@@ -881,6 +884,18 @@ public:
     ErrCode INTERFACE_FUNC overrideDefaultValue(IBaseObject* newDefaultValue)  override
     {
         defaultValue = newDefaultValue;
+
+        // properties without an owner, such as those of object classes, can provide the defaults of many objects
+        if (const auto ownerPtr = getOwner(); ownerPtr.assigned())
+        {
+            if (const auto ownerInternal = ownerPtr.asPtrOrNull<IPropertyObjectInternal>(true); ownerInternal.assigned())
+                ownerInternal->incrementValueRevision();
+        }
+        else
+        {
+            daqIncrementPropertyValueRevision();
+        }
+
         if (const auto freezable = defaultValue.asPtrOrNull<IFreezable>(true); freezable.assigned())
             OPENDAQ_RETURN_IF_FAILED(freezable->freeze());
         return OPENDAQ_SUCCESS;
@@ -24,6 +24,7 @@
 #include <coretypes/type_manager_ptr.h>
 #include <coreobjects/object_keys.h>
 #include <tsl/ordered_map.h>
+#include <memory>
 #include <vector>
 
 BEGIN_NAMESPACE_OPENDAQ
@@ -56,13 +57,22 @@ public:
     static ErrCode Deserialize(ISerializedObject* serialized, IBaseObject* context, IFunction* factoryCallback, IBaseObject** obj);
 
 private:
+    // Properties of all parent classes, resolved once and reused until a type manager changes
+    struct InheritedProperties
+    {
+        uint64_t typeManagerRevision;
+        PropertyOrderedMap props;
+    };
+
     StringPtr name;
     StringPtr parent;
     PropertyOrderedMap props;
     std::vector<StringPtr> customOrder;
     WeakRefPtr<ITypeManager> manager;
+    std::shared_ptr<const InheritedProperties> inheritedProps;
 
     ErrCode getManager(TypeManagerPtr& managerPtr) const;
+    std::shared_ptr<const InheritedProperties> getInheritedPropertiesLookup();
     ErrCode getWithNormalOrder(Bool includeInherited, IList** list);
     ErrCode getWithCustomOrder(Bool includeInherited, IList** list);
     ErrCode getInheritedProperties(ListPtr<IProperty>& properties) const;
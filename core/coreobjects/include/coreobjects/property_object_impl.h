@@ -35,6 +35,7 @@
 #include <coreobjects/property_object_protected_ptr.h>
 #include <coreobjects/property_object_ptr.h>
 #include <coreobjects/property_ptr.h>
+#include <coreobjects/property_slot_table.h>
 #include <coreobjects/property_value_event_args_factory.h>
 #include <coreobjects/object_lock_guard_ptr.h>
 #include <coretypes/cloneable.h>
@@ -44,9 +45,12 @@
 #include <coretypes/updatable.h>
 #include <coretypes/validation.h>
 #include <tsl/ordered_map.h>
+#include <atomic>
 #include <cmath>
 #include <limits>
 #include <map>
+#include <memory>
+#include <optional>
 #include <utility>
 #include <coretypes/recursive_search_ptr.h>
 #include <coreobjects/property_object_core.h>
@@ -142,6 +146,10 @@ public:
     virtual ErrCode INTERFACE_FUNC getLockingStrategy(LockingStrategy* strategy) override;
     virtual ErrCode INTERFACE_FUNC getMutex(IMutex** mutex) override;
     virtual ErrCode INTERFACE_FUNC getMutexOwner(IPropertyObjectInternal** owner) override;
+    virtual ErrCode INTERFACE_FUNC setConcurrentReadsEnabled(Bool enabled) override;
+    virtual ErrCode INTERFACE_FUNC getConcurrentReadsEnabled(Bool* enabled) override;
+    virtual ErrCode INTERFACE_FUNC getValueRevision(UInt* revision) override;
+    virtual ErrCode INTERFACE_FUNC incrementValueRevision() override;
 
     // IUpdatable
     virtual ErrCode INTERFACE_FUNC updateInternal(ISerializedObject* obj, IBaseObject* context) override;
@@ -177,28 +185,24 @@ public:
     
     using PropertyValueEventEmitter = EventEmitter<PropertyObjectPtr, PropertyValueEventArgsPtr>;
     using EndUpdateEventEmitter = EventEmitter<PropertyObjectPtr, EndUpdateEventArgsPtr>;
+    using PropertyValueEventEmitters = PropertySlotTable<PropertyValueEventEmitter>;
+    using PropertyValues = PropertySlotTable<BaseObjectPtr>;
 
     struct CloneParameters
     {
-        const std::unordered_map<StringPtr, PropertyValueEventEmitter>& valueWriteEvents;
-        const std::unordered_map<StringPtr, PropertyValueEventEmitter>& valueReadEvents;
+        const PropertyValueEventEmitters& valueWriteEvents;
+        const PropertyValueEventEmitters& valueReadEvents;
+        const std::optional<PropertyValueEventEmitter>& anyValueWriteEvent;
+        const std::optional<PropertyValueEventEmitter>& anyValueReadEvent;
         const EndUpdateEventEmitter& endUpdateEvent;
         const ProcedurePtr& triggerCoreEvent;
         const PropertyOrderedMap& localProperties;
-        const std::unordered_map<StringPtr, BaseObjectPtr, StringHash, StringEqualTo>& propValues;
+        const PropertyValues& propValues;
         const std::vector<StringPtr>& customOrder;
         const PermissionManagerPtr& permissionManager;
     };
 
     void configureClonedMembers(const CloneParameters& parameters);
-    void configureClonedMembers(const std::unordered_map<StringPtr, PropertyValueEventEmitter>& valueWriteEvents,
-                                const std::unordered_map<StringPtr, PropertyValueEventEmitter>& valueReadEvents,
-                                const EndUpdateEventEmitter& endUpdateEvent,
-                                const ProcedurePtr& triggerCoreEvent,
-                                const PropertyOrderedMap& localProperties,
-                                const std::unordered_map<StringPtr, BaseObjectPtr, StringHash, StringEqualTo>& propValues,
-                                const std::vector<StringPtr>& customOrder,
-                                const PermissionManagerPtr& permissionManager);
       
     // TODO: Make remove friend classes once private methods are properly exposed in protected scope.
     template <typename TInterface, typename... TInterfaces>
@@ -320,19 +324,34 @@ private:
     StringPtr className;
     PropertyObjectClassPtr objectClass;
     
-    const std::string AnyReadEventName = "DAQ_AnyReadEvent";
-    const std::string AnyWriteEventName = "DAQ_AnyWriteEvent";
-
-    std::unordered_map<StringPtr, PropertyValueEventEmitter> valueWriteEvents;
-    std::unordered_map<StringPtr, PropertyValueEventEmitter> valueReadEvents;
+    // Emitters are created on first request; most objects never have value event handlers
+    PropertyValueEventEmitters valueWriteEvents;
+    PropertyValueEventEmitters valueReadEvents;
+    std::optional<PropertyValueEventEmitter> anyValueWriteEvent;
+    std::optional<PropertyValueEventEmitter> anyValueReadEvent;
     EndUpdateEventEmitter endUpdateEvent;
     ProcedurePtr triggerCoreEvent;
 
     PropertyUpdateStack updatePropertyStack;
 
-    std::unordered_map<StringPtr, BaseObjectPtr, StringHash, StringEqualTo> propValues;
+    PropertyValues propValues;
     PropertyOrderedMap localProperties;
 
+    // Values published for reads that do not lock the mutex. The snapshot is immutable; it is replaced
+    // under the lock when a value is added and discarded whenever the values or properties change.
+    struct ReadSnapshotEntry
+    {
+        BaseObjectPtr value;
+        EventPtr<PropertyObjectPtr, PropertyValueEventArgsPtr> classReadEvent;
+    };
+
+    using ReadSnapshot = PropertySlotTable<ReadSnapshotEntry>;
+
+    std::atomic<bool> concurrentReadsEnabled;
+    std::atomic<bool> hasValueReadEvents;
+    std::atomic<UInt> valueRevision;
+    std::shared_ptr<const ReadSnapshot> readSnapshot;
+
     WeakRefPtr<IPropertyObject> owner;
     int updateCount;
     UpdatingActions updatingPropsAndValues;
@@ -378,6 +397,12 @@ private:
     PropertyPtr getUnboundPropertyOrNull(const StringPtr& name) const;
 
     bool shouldWriteLocalValue(const StringPtr& name, const BaseObjectPtr& value) const;
+
+    // Invalidates cached eval value results and the concurrent read snapshot
+    void propertyValuesChanged();
+    bool readFromSnapshot(IString* propertyName, IBaseObject** value) const;
+    void addToReadSnapshot(IString* propertyName, IBaseObject* value);
+
     // Adds the value to the local list of values (`propValues`)
     bool writeLocalValue(const StringPtr& name, const BaseObjectPtr& value, bool forceWrite = false);
 
@@ -472,6 +497,9 @@ GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::GenericPropertyObjec
     , lockingStrategy(LockingStrategy::OwnLock)
     , className(nullptr)
     , objectClass(nullptr)
+    , concurrentReadsEnabled(false)
+    , hasValueReadEvents(false)
+    , valueRevision(daqGetInitialPropertyValueRevision())
     , updateCount(0)
     , path("")
     , frozen(false)
@@ -483,11 +511,6 @@ GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::GenericPropertyObjec
     setLockOwner(owner);
     this->permissionManager = PermissionManager();
     this->permissionManager.setPermissions(object_utils::UnrestrictedPermissions);
-
-    PropertyValueEventEmitter readEmitter;
-    PropertyValueEventEmitter writeEmitter;
-    valueReadEvents.emplace(AnyReadEventName, readEmitter);
-    valueWriteEvents.emplace(AnyWriteEventName, writeEmitter);
 }
 
 template <typename PropObjInterface, typename... Interfaces>
@@ -556,6 +579,8 @@ typename GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::CloneParame
     return CloneParameters{
         valueWriteEvents,
         valueReadEvents,
+        anyValueWriteEvent,
+        anyValueReadEvent,
         endUpdateEvent,
         triggerCoreEvent,
         localProperties,
@@ -590,6 +615,7 @@ void GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::internalDispose
         }
     }
     propValues.clear();
+    propertyValuesChanged();
 
     owner.release();
     className.release();
@@ -710,12 +736,16 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::callProperty
     if (!updatePropertyStack.registerPropertyUpdating(name, newValue))
         return OPENDAQ_IGNORED;
 
+    // the value being written is returned by reads until the write completes
+    propertyValuesChanged();
+
     const bool isBaseStackLevel = updatePropertyStack.isBaseStackLevel(name);
     if (isBaseStackLevel)
     {
         if (newValue.assigned() && !shouldWriteLocalValue(name, newValue))
         {
             updatePropertyStack.unregisterPropertyUpdating(name);
+            propertyValuesChanged();
             return OPENDAQ_IGNORED;
         }
     }
@@ -742,18 +772,21 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::callProperty
             propEvent(objPtr, args);
     }
 
-    if (valueWriteEvents.find(name) != valueWriteEvents.end())
+    if (const auto it = valueWriteEvents.find(name); it != valueWriteEvents.end())
     {
-        if (valueWriteEvents[name].hasListeners())
-            errCode = daqTry([&] { valueWriteEvents[name](objPtr, args); });
+        const PropertyValueEventEmitter writeEvent = it->second;
+        if (writeEvent.hasListeners())
+            errCode = daqTry([&] { writeEvent(objPtr, args); });
     }
 
-    if (valueWriteEvents[AnyWriteEventName].hasListeners())
+    if (anyValueWriteEvent.has_value() && anyValueWriteEvent->hasListeners())
     {
-        valueWriteEvents[AnyWriteEventName](objPtr, args);
+        const PropertyValueEventEmitter writeEvent = *anyValueWriteEvent;
+        writeEvent(objPtr, args);
     }
 
     bool shouldUpdate = updatePropertyStack.unregisterPropertyUpdating(name);
+    propertyValuesChanged();
     // If the event execution failed, forward the error code
     OPENDAQ_RETURN_IF_FAILED(errCode);
 
@@ -784,27 +817,33 @@ BaseObjectPtr GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::callPr
 
     auto args = PropertyValueEventArgs(prop, readValue, readValue, PropertyEventType::Read, False);
 
+    // read event handlers can return a different value on each read
     if (!localProperties.count(prop.getName()))
     {
         const PropertyValueEventEmitter propEvent{prop.asPtr<IPropertyInternal>().getClassOnPropertyValueRead()};
         if (propEvent.hasListeners())
         {
+            incrementValueRevision();
             propEvent(objPtr, args);
         }
     }
 
     const auto name = prop.getName();
-    if (valueReadEvents.find(name) != valueReadEvents.end())
+    if (const auto it = valueReadEvents.find(name); it != valueReadEvents.end())
     {
-        if (valueReadEvents[name].hasListeners())
+        const PropertyValueEventEmitter readEvent = it->second;
+        if (readEvent.hasListeners())
         {
-            valueReadEvents[name](objPtr, args);
+            incrementValueRevision();
+            readEvent(objPtr, args);
         }
     }
 
-    if (valueReadEvents[AnyReadEventName].hasListeners())
+    if (anyValueReadEvent.has_value() && anyValueReadEvent->hasListeners())
     {
-        valueReadEvents[AnyReadEventName](objPtr, args);
+        const PropertyValueEventEmitter readEvent = *anyValueReadEvent;
+        incrementValueRevision();
+        readEvent(objPtr, args);
     }
 
     return args.getValue();
@@ -1272,7 +1311,7 @@ bool GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::writeLocalValue
     }
     else if (forceWrite)
     {
-        propValues.emplace(name, value);
+        propValues.emplace(InternedString(name), value);
     }
     else
     {
@@ -1286,14 +1325,89 @@ bool GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::writeLocalValue
         }
 
         if (shouldWrite)
-            propValues.emplace(name, value);
+            propValues.emplace(InternedString(name), value);
         else
             return false;
     }
 
+    propertyValuesChanged();
+    return true;
+}
+
+template <class PropObjInterface, class... Interfaces>
+void GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::propertyValuesChanged()
+{
+    incrementValueRevision();
+
+    if (concurrentReadsEnabled)
+        std::atomic_store(&readSnapshot, std::shared_ptr<const ReadSnapshot>());
+}
+
+template <class PropObjInterface, class... Interfaces>
+bool GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::readFromSnapshot(IString* propertyName, IBaseObject** value) const
+{
+    if (!concurrentReadsEnabled || hasValueReadEvents || propertyName == nullptr || value == nullptr)
+        return false;
+
+    const auto snapshot = std::atomic_load(&readSnapshot);
+    if (!snapshot)
+        return false;
+
+    const auto it = snapshot->find(StringPtr::Borrow(propertyName));
+    if (it == snapshot->end())
+        return false;
+
+    // class property read event handlers can be added at any time
+    const auto& classReadEvent = it->second.classReadEvent;
+    if (classReadEvent.assigned() && classReadEvent.hasListeners())
+        return false;
+
+    *value = it->second.value.addRefAndReturn();
     return true;
 }
 
+template <class PropObjInterface, class... Interfaces>
+void GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::addToReadSnapshot(IString* propertyName, IBaseObject* value)
+{
+    if (!concurrentReadsEnabled || hasValueReadEvents || value == nullptr)
+        return;
+
+    const auto name = StringPtr::Borrow(propertyName);
+    if (isChildProperty(name) || strchr(name.getCharPtr(), '[') != nullptr)
+        return;
+
+    // only values returned as stored are published; defaults, cloned lists and dictionaries, values being written
+    // and eval values are read under the lock
+    const auto it = propValues.find(name);
+    if (it == propValues.end() || it->second.getObject() != value || it->second.template supportsInterface<IEvalValue>())
+        return;
+
+    BaseObjectPtr updatingValue;
+    if (updatePropertyStack.getPropertyValue(name, updatingValue))
+        return;
+
+    const auto prop = getUnboundPropertyOrNull(name);
+    if (!prop.assigned())
+        return;
+
+    const auto propInternal = prop.template asPtr<IPropertyInternal>(true);
+    if (propInternal.getReferencedPropertyUnresolved().assigned())
+        return;
+
+    ReadSnapshotEntry entry{it->second, {}};
+    if (!localProperties.count(name))
+    {
+        entry.classReadEvent = propInternal.getClassOnPropertyValueRead();
+        if (entry.classReadEvent.hasListeners())
+            return;
+    }
+
+    const auto snapshot = std::atomic_load(&readSnapshot);
+    auto updated = snapshot ? std::make_shared<ReadSnapshot>(*snapshot) : std::make_shared<ReadSnapshot>();
+    updated->emplace(it->first, std::move(entry));
+    std::atomic_store(&readSnapshot, std::shared_ptr<const ReadSnapshot>(std::move(updated)));
+}
+
 template <class PropObjInterface, class... Interfaces>
 void GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::setOwnerToPropertyValue(const BaseObjectPtr& value)
 {
@@ -1534,7 +1648,7 @@ ConstCharPtr GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::getProp
 
     if (first == nullptr)
     {
-        propName = String(propNameData);
+        propName = name;
     }
     else
     {
@@ -1646,8 +1760,15 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::getPropertyA
 template <class PropObjInterface, class... Interfaces>
 ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::getPropertyValue(IString* propertyName, IBaseObject** value)
 {
+    if (readFromSnapshot(propertyName, value))
+        return OPENDAQ_SUCCESS;
+
     auto lock = getRecursiveConfigLock2();
-    return getPropertyValueNoLock(propertyName, value);
+    const ErrCode errCode = getPropertyValueNoLock(propertyName, value);
+    if (OPENDAQ_SUCCEEDED(errCode))
+        addToReadSnapshot(propertyName, *value);
+
+    return errCode;
 }
 
 template <typename PropObjInterface, typename ... Interfaces>
@@ -1801,56 +1922,44 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::clearProtect
 template <typename PropObjInterface, typename ... Interfaces>
 void GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::configureClonedMembers(const CloneParameters& parameters)
 {
-    configureClonedMembers(parameters.valueWriteEvents,
-                           parameters.valueReadEvents,
-                           parameters.endUpdateEvent,
-                           parameters.triggerCoreEvent,
-                           parameters.localProperties,
-                           parameters.propValues,
-                           parameters.customOrder,
-                           parameters.permissionManager);
-}
-
-template <typename PropObjInterface, typename... Interfaces>
-void GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::configureClonedMembers(
-    const std::unordered_map<StringPtr, PropertyValueEventEmitter>& valueWriteEvents,
-    const std::unordered_map<StringPtr, PropertyValueEventEmitter>& valueReadEvents,
-    const EndUpdateEventEmitter& endUpdateEvent,
-    const ProcedurePtr& triggerCoreEvent,
-    const PropertyOrderedMap& localProperties,
-    const std::unordered_map<StringPtr, BaseObjectPtr, StringHash, StringEqualTo>& propValues,
-    const std::vector<StringPtr>& customOrder,
-    const PermissionManagerPtr& permissionManager)
-{
-    this->valueWriteEvents.clear();
-    for (const auto& [name, srcEmitter] : valueWriteEvents)
+    const auto cloneEmitter = [](const PropertyValueEventEmitter& srcEmitter)
     {
         BaseObjectPtr cloned;
         srcEmitter.template asPtr<ICloneable>(true)->clone(&cloned);
-        this->valueWriteEvents.emplace(name, cloned);
-    }
-        
+        return PropertyValueEventEmitter(cloned);
+    };
+
+    this->valueWriteEvents.clear();
+    for (const auto& [name, srcEmitter] : parameters.valueWriteEvents)
+        this->valueWriteEvents.emplace(name, cloneEmitter(srcEmitter));
+
     this->valueReadEvents.clear();
-    for (const auto& [name, srcEmitter] : valueReadEvents)
-    {
-        BaseObjectPtr cloned;
-        srcEmitter.template asPtr<ICloneable>(true)->clone(&cloned);
-        this->valueReadEvents.emplace(name, cloned);
-    }
+    for (const auto& [name, srcEmitter] : parameters.valueReadEvents)
+        this->valueReadEvents.emplace(name, cloneEmitter(srcEmitter));
+
+    this->anyValueWriteEvent.reset();
+    if (parameters.anyValueWriteEvent.has_value())
+        this->anyValueWriteEvent = cloneEmitter(*parameters.anyValueWriteEvent);
+
+    this->anyValueReadEvent.reset();
+    if (parameters.anyValueReadEvent.has_value())
+        this->anyValueReadEvent = cloneEmitter(*parameters.anyValueReadEvent);
+
+    this->hasValueReadEvents = !this->valueReadEvents.empty() || this->anyValueReadEvent.has_value();
 
     BaseObjectPtr cloned;
-    endUpdateEvent.template asPtr<ICloneable>(true)->clone(&cloned);
+    parameters.endUpdateEvent.template asPtr<ICloneable>(true)->clone(&cloned);
 
     this->endUpdateEvent = cloned;
-    this->triggerCoreEvent = triggerCoreEvent;
-    this->localProperties = localProperties;
-    this->customOrder = customOrder;
+    this->triggerCoreEvent = parameters.triggerCoreEvent;
+    this->localProperties = parameters.localProperties;
+    this->customOrder = parameters.customOrder;
 
     BaseObjectPtr permissionManagerClone;
-    permissionManager.template asPtr<ICloneable>()->clone(&permissionManagerClone);
+    parameters.permissionManager.template asPtr<ICloneable>()->clone(&permissionManagerClone);
     this->permissionManager = permissionManagerClone;
 
-    for (const auto& val : propValues)
+    for (const auto& val : parameters.propValues)
     {
         const auto ct = val.second.getCoreType();
         if (ct == ctList || ct == ctDict)
@@ -1890,6 +1999,8 @@ void GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::configureCloned
             this->propValues.insert(val);
         }
     }
+
+    propertyValuesChanged();
 }
 
 template <typename PropObjInterface, typename... Interfaces>
@@ -2122,8 +2233,8 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::clearPropert
                 
                 if (!newVal.assigned())
                 {
-                    auto it = propValues.find(prop.getName());
-                    propValues.erase(it);
+                    propValues.erase(prop.getName());
+                    propertyValuesChanged();
                 }
 
                 if (!isUpdating)
@@ -2306,11 +2417,14 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::addProperty(
         if (!res.second)
             return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_ALREADYEXISTS, fmt::format(R"(Property "{}" already exists.)", propName));
 
+        propertyValuesChanged();
+
         auto readEvent = propPtr.asPtr<IPropertyInternal>().getClassOnPropertyValueRead();
         if (readEvent.getListenerCount())
         {
+            hasValueReadEvents = true;
             PropertyValueEventEmitter emitter;
-            valueReadEvents.emplace(propName, emitter);
+            valueReadEvents.emplace(InternedString(propName), emitter);
             for (const auto& listener : readEvent.getListeners())
                 emitter.addHandler(listener);
         }
@@ -2319,7 +2433,7 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::addProperty(
         if (writeEvent.getListenerCount())
         {
             PropertyValueEventEmitter emitter;
-            valueWriteEvents.emplace(propName, emitter);
+            valueWriteEvents.emplace(InternedString(propName), emitter);
             for (const auto& listener : writeEvent.getListeners())
                 emitter.addHandler(listener);
         }
@@ -2369,6 +2483,8 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::removeProper
         propValues.erase(propertyName);
     }
 
+    propertyValuesChanged();
+
     triggerCoreEventInternal(CoreEventArgsPropertyRemoved(objPtr, propertyName, path));
 
     return OPENDAQ_SUCCESS;
@@ -2544,7 +2660,7 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::getOnPropert
     if (prop.getReferencedPropertyUnresolved().assigned())
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALID_OPERATION, fmt::format(R"(getOnPropertyValueWrite is not allowed for the reference properties "{}")", name));
 
-    auto [it, _] = valueWriteEvents.try_emplace(name);
+    auto [it, _] = valueWriteEvents.try_emplace(InternedString(name));
     *event = it->second.addRefAndReturn();
     return OPENDAQ_SUCCESS;
 }
@@ -2585,7 +2701,8 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::getOnPropert
     if (prop.getReferencedPropertyUnresolved().assigned())
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALID_OPERATION, fmt::format(R"(getOnPropertyValueRead is not allowed for the reference properties "{}")", name));
 
-    auto [it, _] = valueReadEvents.try_emplace(name);
+    hasValueReadEvents = true;
+    auto [it, _] = valueReadEvents.try_emplace(InternedString(name));
     *event = it->second.addRefAndReturn();
     return OPENDAQ_SUCCESS;
 }
@@ -2595,7 +2712,10 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::getOnAnyProp
 {
     OPENDAQ_PARAM_NOT_NULL(event);
     
-    *event = valueWriteEvents[AnyWriteEventName].addRefAndReturn();
+    if (!anyValueWriteEvent.has_value())
+        anyValueWriteEvent.emplace();
+
+    *event = anyValueWriteEvent->addRefAndReturn();
     return OPENDAQ_SUCCESS;
 }
 
@@ -2604,7 +2724,11 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::getOnAnyProp
 {
     OPENDAQ_PARAM_NOT_NULL(event);
     
-    *event = valueReadEvents[AnyReadEventName].addRefAndReturn();
+    hasValueReadEvents = true;
+    if (!anyValueReadEvent.has_value())
+        anyValueReadEvent.emplace();
+
+    *event = anyValueReadEvent->addRefAndReturn();
     return OPENDAQ_SUCCESS;
 }
 
@@ -3020,14 +3144,7 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::clone(IPrope
     const ErrCode errCode = daqTry([this, &obj, &cloned]()
     {
         auto implPtr = static_cast<PropertyObjectImpl*>(obj.getObject());
-        implPtr->configureClonedMembers(valueWriteEvents,
-                                        valueReadEvents,
-                                        endUpdateEvent,
-                                        triggerCoreEvent,
-                                        localProperties,
-                                        propValues,
-                                        customOrder,
-                                        permissionManager);
+        implPtr->configureClonedMembers(getCloneParameters());
 
         *cloned = obj.detach();
         return OPENDAQ_SUCCESS;
@@ -3122,6 +3239,48 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::getMutex(IMu
     return OPENDAQ_SUCCESS;
 }
 
+template <typename PropObjInterface, typename ... Interfaces>
+ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::setConcurrentReadsEnabled(Bool enabled)
+{
+    auto lock = getRecursiveConfigLock2();
+
+    concurrentReadsEnabled = enabled;
+    std::atomic_store(&readSnapshot, std::shared_ptr<const ReadSnapshot>());
+    return OPENDAQ_SUCCESS;
+}
+
+template <typename PropObjInterface, typename ... Interfaces>
+ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::getConcurrentReadsEnabled(Bool* enabled)
+{
+    OPENDAQ_PARAM_NOT_NULL(enabled);
+
+    *enabled = concurrentReadsEnabled;
+    return OPENDAQ_SUCCESS;
+}
+
+template <typename PropObjInterface, typename ... Interfaces>
+ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::getValueRevision(UInt* revision)
+{
+    OPENDAQ_PARAM_NOT_NULL(revision);
+
+    *revision = valueRevision.load(std::memory_order_acquire);
+    return OPENDAQ_SUCCESS;
+}
+
+template <typename PropObjInterface, typename ... Interfaces>
+ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::incrementValueRevision()
+{
+    valueRevision.fetch_add(1, std::memory_order_acq_rel);
+
+    // the values of a nested object are part of its owner's values
+    const auto ownerPtr = getPropertyObjectParent();
+    const auto ownerInternal = ownerPtr.template asPtrOrNull<IPropertyObjectInternal>(true);
+    if (ownerInternal.assigned())
+        return ownerInternal->incrementValueRevision();
+
+    return OPENDAQ_SUCCESS;
+}
+
 template <typename PropObjInterface, typename ... Interfaces>
 ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::getMutexOwner(IPropertyObjectInternal** owner)
 {
@@ -90,6 +90,37 @@ DECLARE_OPENDAQ_INTERFACE(IPropertyObjectInternal, IBaseObject)
      * strategy is not `OwnLock`, returns the closest ancestor with the `OwnLock` strategy.
      */
     virtual ErrCode INTERFACE_FUNC getMutexOwner(IPropertyObjectInternal** owner) = 0;
+
+    /*!
+     * @brief Enables or disables concurrent reads of property values.
+     * @param enabled If True, `getPropertyValue` can return values without locking the object's mutex.
+     *
+     * When enabled, values that are stored on the object and read through `getPropertyValue` are published
+     * to an immutable snapshot. Further reads of those values are served from the snapshot without waiting for
+     * writers, the acquisition loop or other readers. Any change of the object's values or properties discards
+     * the snapshot. Default, list, dictionary and reference property values, as well as values of objects with
+     * object-level read event handlers, are always read under the lock.
+     */
+    virtual ErrCode INTERFACE_FUNC setConcurrentReadsEnabled(Bool enabled) = 0;
+    /*!
+     * @brief Checks whether concurrent reads of property values are enabled.
+     * @param[out] enabled True if concurrent reads are enabled; False otherwise.
+     */
+    virtual ErrCode INTERFACE_FUNC getConcurrentReadsEnabled(Bool* enabled) = 0;
+
+    /*!
+     * @brief Gets the revision of the object's property values.
+     * @param[out] revision The revision.
+     *
+     * The revision changes whenever a value or property of the object, or of a property object nested in it,
+     * changes and whenever a value read event of the object is triggered. Results calculated from the object's
+     * values at the same revision are still valid. Each object starts at a different revision.
+     */
+    virtual ErrCode INTERFACE_FUNC getValueRevision(UInt* revision) = 0;
+    /*!
+     * @brief Changes the value revision of the object and of the objects it is nested in.
+     */
+    virtual ErrCode INTERFACE_FUNC incrementValueRevision() = 0;
 };
 
 /*!@}*/
@@ -35,6 +35,30 @@ namespace object_utils
     }();
 }
 
+// Property value revision
+
+/*!
+ * @brief Gets the process-wide revision of property values that are not tied to a single property object.
+ *
+ * Property objects keep their own value revision (see `IPropertyObjectInternal::getValueRevision`). The process-wide
+ * revision is only incremented on rare changes that can affect many objects, such as overriding the default value of
+ * a property without an owner. Eval value results are valid while both revisions are unchanged.
+ */
+extern "C"
+uint64_t PUBLIC_EXPORT daqGetPropertyValueRevision();
+
+extern "C"
+void PUBLIC_EXPORT daqIncrementPropertyValueRevision();
+
+/*!
+ * @brief Gets the value revision a new property object starts at.
+ *
+ * Each call returns a different starting point, so a result cached for one object is not valid for another object
+ * allocated at the same address.
+ */
+extern "C"
+uint64_t PUBLIC_EXPORT daqGetInitialPropertyValueRevision();
+
 // RecursiveConfigLockGuard
 
 class RecursiveConfigLockGuard : public std::enable_shared_from_this<RecursiveConfigLockGuard>
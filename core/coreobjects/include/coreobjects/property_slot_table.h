@@ -0,0 +1,214 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <coreobjects/object_keys.h>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief Compact name-keyed storage used by property objects for their values and event emitters.
+ *
+ * Entries are kept in a contiguous array of slots. Most property objects hold only a few entries, which are
+ * found by a linear scan comparing the interned name pointers first and the string contents second. Once the
+ * number of slots exceeds `IndexThreshold`, a hash index from names to slot positions is built as a front end.
+ *
+ * Erasing an entry moves the last slot into its place, so iteration order is not preserved and iterators
+ * pointing at the erased or the last slot are invalidated.
+ */
+template <typename TValue>
+class PropertySlotTable
+{
+public:
+    using value_type = std::pair<StringPtr, TValue>;
+    using iterator = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    static constexpr size_t IndexThreshold = 16;
+
+    PropertySlotTable() = default;
+
+    PropertySlotTable(const PropertySlotTable& other)
+        : slots(other.slots)
+    {
+        rebuildIndex();
+    }
+
+    PropertySlotTable(PropertySlotTable&& other) noexcept = default;
+
+    PropertySlotTable& operator=(const PropertySlotTable& other)
+    {
+        if (this != &other)
+        {
+            slots = other.slots;
+            rebuildIndex();
+        }
+        return *this;
+    }
+
+    PropertySlotTable& operator=(PropertySlotTable&& other) noexcept = default;
+
+    iterator begin() { return slots.begin(); }
+    iterator end() { return slots.end(); }
+    const_iterator begin() const { return slots.cbegin(); }
+    const_iterator end() const { return slots.cend(); }
+    const_iterator cbegin() const { return slots.cbegin(); }
+    const_iterator cend() const { return slots.cend(); }
+
+    size_t size() const
+    {
+        return slots.size();
+    }
+
+    bool empty() const
+    {
+        return slots.empty();
+    }
+
+    iterator find(const StringPtr& name)
+    {
+        return slots.begin() + findSlot(name);
+    }
+
+    const_iterator find(const StringPtr& name) const
+    {
+        return slots.cbegin() + findSlot(name);
+    }
+
+    size_t count(const StringPtr& name) const
+    {
+        return findSlot(name) != slots.size() ? 1 : 0;
+    }
+
+    // Does nothing if an entry with the same name already exists
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(const StringPtr& name, Args&&... args)
+    {
+        const size_t slot = findSlot(name);
+        if (slot != slots.size())
+            return {slots.begin() + slot, false};
+
+        slots.emplace_back(std::piecewise_construct, std::forward_as_tuple(name), std::forward_as_tuple(std::forward<Args>(args)...));
+        addToIndex(slots.size() - 1);
+        return {slots.end() - 1, true};
+    }
+
+    std::pair<iterator, bool> try_emplace(const StringPtr& name)
+    {
+        return emplace(name);
+    }
+
+    template <typename TPair>
+    std::pair<iterator, bool> insert(TPair&& pair)
+    {
+        return emplace(std::forward<TPair>(pair).first, std::forward<TPair>(pair).second);
+    }
+
+    void erase(const_iterator it)
+    {
+        const size_t slot = it - slots.cbegin();
+        const size_t last = slots.size() - 1;
+
+        if (index)
+            index->erase(slots[slot].first);
+
+        if (slot != last)
+        {
+            slots[slot] = std::move(slots[last]);
+            if (index)
+                (*index)[slots[slot].first] = slot;
+        }
+
+        slots.pop_back();
+    }
+
+    size_t erase(const StringPtr& name)
+    {
+        const size_t slot = findSlot(name);
+        if (slot == slots.size())
+            return 0;
+
+        erase(slots.cbegin() + slot);
+        return 1;
+    }
+
+    void clear()
+    {
+        slots.clear();
+        index.reset();
+    }
+
+private:
+    using SlotIndex = std::unordered_map<StringPtr, size_t, StringHash, StringEqualTo>;
+
+    std::vector<value_type> slots;
+    std::unique_ptr<SlotIndex> index;
+
+    size_t findSlot(const StringPtr& name) const
+    {
+        if (index)
+        {
+            const auto it = index->find(name);
+            return it != index->end() ? it->second : slots.size();
+        }
+
+        const IString* namePtr = name.getObject();
+        for (size_t i = 0; i < slots.size(); ++i)
+        {
+            if (slots[i].first.getObject() == namePtr)
+                return i;
+        }
+
+        const StringEqualTo equalTo;
+        for (size_t i = 0; i < slots.size(); ++i)
+        {
+            if (equalTo(slots[i].first, name))
+                return i;
+        }
+
+        return slots.size();
+    }
+
+    void addToIndex(size_t slot)
+    {
+        if (index)
+            index->emplace(slots[slot].first, slot);
+        else if (slots.size() > IndexThreshold)
+            rebuildIndex();
+    }
+
+    void rebuildIndex()
+    {
+        if (slots.size() <= IndexThreshold)
+        {
+            index.reset();
+            return;
+        }
+
+        index = std::make_unique<SlotIndex>();
+        index->reserve(slots.size());
+        for (size_t i = 0; i < slots.size(); ++i)
+            index->emplace(slots[i].first, i);
+    }
+};
+
+END_NAMESPACE_OPENDAQ
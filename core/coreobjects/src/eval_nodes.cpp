@@ -1,5 +1,6 @@
 #include <coreobjects/eval_nodes.h>
 #include <bitset>
+#include <cstring>
 #include <memory>
 #include <utility>
 #include <coreobjects/unit_factory.h>
@@ -24,12 +25,27 @@ int BaseNode::resolveReference(bool /*lock*/)
 }
 
 // -------- RefNode ----------
+namespace
+{
+
+bool equalsIgnoreCase(const char* a, const char* b)
+{
+#if defined(_WIN32)
+    return _stricmp(a, b) == 0;
+#else
+    return strcasecmp(a, b) == 0;
+#endif
+}
+
+}
+
 RefNode::RefNode(std::string refStr, RefType refType)
     : refStr(std::move(refStr))
     , argIndex(-1)
     , refType(refType)
     , resolveStatus(ResolveStatus::Unresolved)
 {
+    bind();
 }
 
 RefNode::RefNode(int argIndex)
@@ -37,6 +53,7 @@ RefNode::RefNode(int argIndex)
     , refType(RefType::Argument)
     , resolveStatus(ResolveStatus::Unresolved)
 {
+    bind();
 }
 
 RefNode::RefNode(std::string refStr, int argIndex, RefType refType)
@@ -45,6 +62,42 @@ RefNode::RefNode(std::string refStr, int argIndex, RefType refType)
     , refType(refType)
     , resolveStatus(ResolveStatus::Unresolved)
 {
+    bind();
+}
+
+void RefNode::bind()
+{
+    boundRefType = refType;
+
+    if (refType == RefType::Func)
+    {
+        boundName = String(refStr);
+        return;
+    }
+
+    // argument references are looked up on the argument objects as written
+    const auto pos = refStr.find(':');
+    if (argIndex > -1 || pos == std::string::npos)
+    {
+        boundName = InternedString(refStr);
+        return;
+    }
+
+    const std::string postRef = refStr.substr(pos + 1);
+    if (equalsIgnoreCase("value", postRef.c_str()))
+        boundRefType = RefType::Value;
+    else if (equalsIgnoreCase("selectedvalue", postRef.c_str()))
+        boundRefType = RefType::SelectedValue;
+    else if (equalsIgnoreCase("propertynames", postRef.c_str()))
+        boundRefType = RefType::PropertyNames;
+    else
+    {
+        // unknown suffixes never resolve
+        boundName = nullptr;
+        return;
+    }
+
+    boundName = InternedString(refStr.substr(0, pos));
 }
 
 BaseObjectPtr RefNode::getResult()
@@ -63,7 +116,7 @@ int RefNode::resolveReference(bool lock)
 
     try
     {
-        refObject = onResolveReference(refStr, refType, argIndex, postRef, lock);
+        refObject = onResolveReference(*this, lock);
         if (refObject.assigned())
         {
             resolveStatus = ResolveStatus::Resolved;
@@ -82,8 +135,11 @@ int RefNode::resolveReference(bool lock)
 
 std::unique_ptr<BaseNode> RefNode::clone(GetReferenceEvent refCall)
 {
-    auto node = std::make_unique<RefNode>(refStr, argIndex, refType);
-    node->onResolveReference = refCall;
+    // copies the bound name and type instead of binding them again
+    auto node = std::make_unique<RefNode>(*this);
+    node->refObject = nullptr;
+    node->resolveStatus = ResolveStatus::Unresolved;
+    node->onResolveReference = std::move(refCall);
     return node;
 }
 
@@ -91,6 +147,12 @@ void RefNode::useAsArgument(RefNode* node)
 {
     this->refStr = node->refStr;
     this->refType = node->refType;
+    bind();
+}
+
+RefType RefNode::getRefType() const
+{
+    return refType;
 }
 
 // -------- PropFuncNode ----------
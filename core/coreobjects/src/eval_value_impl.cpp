@@ -3,13 +3,95 @@
 #include <functional>
 #include <coreobjects/eval_value_ptr.h>
 #include <coreobjects/property_object_internal_ptr.h>
+#include <coreobjects/property_object_utils.h>
+#include <coreobjects/unit.h>
 #include <coretypes/dict_ptr.h>
+#include <unordered_map>
 
 BEGIN_NAMESPACE_OPENDAQ
 
+namespace
+{
+
+// Eval values with the same expression text share the parsed node tree, so each expression is parsed once.
+class EvalValueParseCache
+{
+public:
+    std::shared_ptr<const CompiledEvalValue> get(const std::string& eval, bool useFunctionResolver)
+    {
+        auto& compiledValues = useFunctionResolver ? functionResolverValues : values;
+
+        std::scoped_lock lock(sync);
+        if (const auto it = compiledValues.find(eval); it != compiledValues.end())
+            return it->second;
+
+        // bounds the cache when expressions are generated at runtime
+        if (compiledValues.size() >= MaxCachedValues)
+            compiledValues.clear();
+
+        auto compiledValue = compile(eval, useFunctionResolver);
+        compiledValues.emplace(eval, compiledValue);
+        return compiledValue;
+    }
+
+private:
+    static constexpr size_t MaxCachedValues = 4096;
+
+    static std::shared_ptr<const CompiledEvalValue> compile(const std::string& eval, bool useFunctionResolver)
+    {
+        ParseParams params{nullptr, nullptr, useFunctionResolver, nullptr};
+
+        // the cached node trees are shared by all eval values and are not reported as leaks
+        daqDisableObjectTracking();
+        const bool parsed = parseEvalValue(eval, &params);
+        daqEnableObjectTracking();
+
+        auto compiledValue = std::make_shared<CompiledEvalValue>();
+        compiledValue->node = std::move(params.node);
+        if (params.propertyReferences)
+            compiledValue->propertyReferences = std::move(*params.propertyReferences);
+        compiledValue->parseErrCode = parsed ? OPENDAQ_SUCCESS : OPENDAQ_ERR_PARSEFAILED;
+        if (!parsed)
+            compiledValue->parseErrMessage = params.errMessage;
+
+        return compiledValue;
+    }
+
+    std::mutex sync;
+    std::unordered_map<std::string, std::shared_ptr<const CompiledEvalValue>> values;
+    std::unordered_map<std::string, std::shared_ptr<const CompiledEvalValue>> functionResolverValues;
+};
+
+EvalValueParseCache& getParseCache()
+{
+    static EvalValueParseCache cache;
+    return cache;
+}
+
+// only results that cannot be modified by the caller are shared
+bool isImmutableResult(const BaseObjectPtr& result)
+{
+    switch (result.getCoreType())
+    {
+        case ctBool:
+        case ctInt:
+        case ctFloat:
+        case ctString:
+        case ctRatio:
+            return true;
+        case ctObject:
+            return result.supportsInterface<IUnit>();
+        default:
+            return false;
+    }
+}
+
+}
+
 EvalValueImpl::EvalValueImpl(IString* eval)
     : eval(eval)
     , node(nullptr)
+    , ownerObject(nullptr)
     , resolveStatus(ResolveStatus::Unresolved)
     , parseErrCode(OPENDAQ_SUCCESS)
     , calculated(false)
@@ -21,6 +103,7 @@ EvalValueImpl::EvalValueImpl(IString* eval)
 EvalValueImpl::EvalValueImpl(IString* eval, IFunction* func)
     : eval(eval)
     , node(nullptr)
+    , ownerObject(nullptr)
     , resolveStatus(ResolveStatus::Unresolved)
     , parseErrCode(OPENDAQ_SUCCESS)
     , calculated(false)
@@ -34,6 +117,7 @@ EvalValueImpl::EvalValueImpl(IString* eval, ListPtr<IBaseObject> arguments)
     : eval(eval)
     , node(nullptr)
     , arguments(std::move(arguments))
+    , ownerObject(nullptr)
     , resolveStatus(ResolveStatus::Unresolved)
     , parseErrCode(OPENDAQ_SUCCESS)
     , calculated(false)
@@ -51,87 +135,58 @@ void EvalValueImpl::internalDispose(bool disposing)
     }
 }
 
+// Clones share the parsed expression and the result cache; the node tree is copied when first evaluated.
 EvalValueImpl::EvalValueImpl(const EvalValueImpl& ev, IPropertyObject* owner)
     : eval(ev.eval)
+    , compiled(ev.compiled)
+    , resultCache(ev.resultCache)
+    , ownerObject(owner)
     , resolveStatus(ResolveStatus::Unresolved)
     , parseErrCode(ev.parseErrCode)
+    , parseErrMessage(ev.parseErrMessage)
     , calculated(false)
     , useFunctionResolver(false)
 {
-    using namespace std::placeholders;
-
     this->owner = owner;
-    node = ev.node->clone([this](const std::string& str, RefType refType, int argIndex, std::string& postRef, bool lock)
-    {
-        return getReference(str, refType, argIndex, postRef, lock);
-    });
-
-    std::unordered_set<std::string> refs;
-    for (auto ref : *ev.propertyReferences)
-        refs.insert(ref);
-    propertyReferences = std::make_unique<std::unordered_set<std::string>>(std::move(refs));
 }
 
 EvalValueImpl::EvalValueImpl(const EvalValueImpl& ev, IPropertyObject* owner, IFunction* func)
     : eval(ev.eval)
+    , compiled(ev.compiled)
+    , resultCache(ev.resultCache)
+    , ownerObject(owner)
     , resolveStatus(ResolveStatus::Unresolved)
     , parseErrCode(ev.parseErrCode)
+    , parseErrMessage(ev.parseErrMessage)
     , calculated(false)
     , useFunctionResolver(true)
     , func(func)
 {
-    using namespace std::placeholders;
-
     this->owner = owner;
-    node = ev.node->clone([this](const std::string& str, RefType refType, int argIndex, std::string& postRef, bool lock)
-    {
-        return getReference(str, refType, argIndex, postRef, lock);
-    });
-
-    std::unordered_set<std::string> refs;
-    for (auto ref : *ev.propertyReferences)
-        refs.insert(ref);
-    propertyReferences = std::make_unique<std::unordered_set<std::string>>(std::move(refs));
 }
 
 void EvalValueImpl::onCreate()
 {
-    using namespace std::placeholders;
-
-    ParseParams params{
-        nullptr,
-        nullptr,
-        useFunctionResolver,
-        [this](const std::string& str, RefType refType, int argIndex, std::string& postRef, bool lock)
-        {
-            return getReference(str, refType, argIndex, postRef, lock);
-        }
-    };
-
     ConstCharPtr s;
     parseErrCode = eval->getCharPtr(&s);
     if (OPENDAQ_FAILED(parseErrCode))
         return;
 
-    bool parsed = parseEvalValue(s, &params);
+    compiled = getParseCache().get(s, useFunctionResolver);
+    resultCache = std::make_shared<EvalValueResultCache>();
     resolveStatus = ResolveStatus::Unresolved;
 
-    node = std::move(params.node);
-    propertyReferences = std::move(params.propertyReferences);
-
-    parseErrCode = parsed ? OPENDAQ_SUCCESS : OPENDAQ_ERR_PARSEFAILED;
-    if (!parsed)
-        parseErrMessage = params.errMessage;
+    parseErrCode = compiled->parseErrCode;
+    parseErrMessage = compiled->parseErrMessage;
 }
 
 ErrCode EvalValueImpl::setOwner(IPropertyObject* value)
 {
     owner = value;
+    ownerObject = value;
     return OPENDAQ_SUCCESS;
 }
 
-// OPENDAQ_TODO: refactor getReference
-
 void EvalValueImpl::checkForEvalValue(BaseObjectPtr& prop) const
 {
     EvalValuePtr e = prop.asPtrOrNull<IEvalValue>(true);
@@ -139,28 +194,28 @@ void EvalValueImpl::checkForEvalValue(BaseObjectPtr& prop) const
         prop = e.cloneWithOwner(owner.getRef());
 }
 
-BaseObjectPtr EvalValueImpl::getReferenceFromPrefix(const PropertyObjectPtr& propObject, const std::string& str, RefType refType, bool lock) const
+BaseObjectPtr EvalValueImpl::getReferenceFromPrefix(const PropertyObjectPtr& propObject, const StringPtr& name, RefType refType, bool lock) const
 {
     BaseObjectPtr value;
 
     if (refType == RefType::Property)
     {
-        value = propObject.getProperty(str);
+        value = propObject.getProperty(name);
     }
     else if (refType == RefType::Value)
     {
-        value = lock ? propObject.getPropertyValue(str) : propObject.asPtr<IPropertyObjectInternal>().getPropertyValueNoLock(str);
+        value = lock ? propObject.getPropertyValue(name) : propObject.asPtr<IPropertyObjectInternal>().getPropertyValueNoLock(name);
         checkForEvalValue(value);
     }
     else if (refType == RefType::SelectedValue)
     {
-        value = lock ? propObject.getPropertySelectionValue(str) : propObject.asPtr<IPropertyObjectInternal>().getPropertySelectionValueNoLock(str);
+        value = lock ? propObject.getPropertySelectionValue(name) : propObject.asPtr<IPropertyObjectInternal>().getPropertySelectionValueNoLock(name);
         checkForEvalValue(value);
     }
     else if (refType == RefType::PropertyNames)
     {
         auto propNames = List<IString>();
-        const PropertyObjectPtr child = lock ? propObject.getPropertyValue(str) : propObject.asPtr<IPropertyObjectInternal>().getPropertyValueNoLock(str);
+        const PropertyObjectPtr child = lock ? propObject.getPropertyValue(name) : propObject.asPtr<IPropertyObjectInternal>().getPropertyValueNoLock(name);
         for (const auto& prop : child.getAllProperties())
         {
             propNames.pushBack(prop.getName());
@@ -171,8 +226,9 @@ BaseObjectPtr EvalValueImpl::getReferenceFromPrefix(const PropertyObjectPtr& pro
     return value;
 }
 
-BaseObjectPtr EvalValueImpl::getReference(const std::string& str, RefType refType, int argIndex, std::string& postRef, bool lock) const
+BaseObjectPtr EvalValueImpl::getReference(const RefNode& refNode, bool lock) const
 {
+    const int argIndex = refNode.argIndex;
     if (argIndex > -1)
     {
         if (!arguments.assigned() || argIndex > int(arguments.getCount()))
@@ -180,52 +236,18 @@ BaseObjectPtr EvalValueImpl::getReference(const std::string& str, RefType refTyp
             return nullptr;
         }
 
-        return getReferenceFromPrefix(arguments[argIndex], str, refType, lock);
+        return getReferenceFromPrefix(arguments[argIndex], refNode.boundName, refNode.boundRefType, lock);
     }
 
-    if (refType == RefType::Func)
-        return func.call(String(str));
+    if (refNode.getRefType() == RefType::Func)
+        return func.call(refNode.boundName);
 
-    if (!owner.assigned())
+    // references with an unknown suffix are not bound
+    if (!owner.assigned() || !refNode.boundName.assigned())
         return nullptr;
 
-    auto pos = str.find(':');
-
     PropertyObjectPtr ownerRef = owner.getRef();
-    if (pos == std::string::npos)
-        return getReferenceFromPrefix(ownerRef, str, refType, lock);
-
-    std::string prefix = str.substr(0, pos);
-    postRef = str.substr(pos + 1, std::wstring::npos);
-#if defined(_WIN32)
-    if (_stricmp("value", postRef.c_str()) == 0)
-#else
-    if (strcasecmp("value", postRef.c_str()) == 0)
-#endif
-        return getReferenceFromPrefix(ownerRef, prefix, RefType::Value, lock);
-#if defined(_WIN32)
-    if (_stricmp("selectedvalue", postRef.c_str()) == 0)
-#else
-    if (strcasecmp("selectedvalue", postRef.c_str()) == 0)
-#endif
-        return getReferenceFromPrefix(ownerRef, prefix, RefType::SelectedValue, lock);
-#if defined(_WIN32)
-    if (_stricmp("propertynames", postRef.c_str()) == 0)
-#else
-    if (strcasecmp("propertynames", postRef.c_str()) == 0)
-#endif
-        return getReferenceFromPrefix(ownerRef, prefix, RefType::PropertyNames, lock);
-    return nullptr;
-
-    /*
-    #if defined(_WIN32)
-    if (_wcsicmp(L"clear", postRef.c_str()) == 0)
-    #else
-    if (wcscasecmp(L"clear", postRef.c_str()) == 0)
-    #endif
-    return owner.getPropertyValue(prefix);
-
-    throw std::invalid_argument("Invalid reference");*/
+    return getReferenceFromPrefix(ownerRef, refNode.boundName, refNode.boundRefType, lock);
 }
 
 int EvalValueImpl::resolveReferences(bool lock)
@@ -245,6 +267,15 @@ int EvalValueImpl::resolveReferences(bool lock)
 ErrCode EvalValueImpl::checkParseAndResolve(bool lock)
 {
     OPENDAQ_RETURN_IF_FAILED(parseErrCode);
+
+    if (!node)
+    {
+        node = compiled->node->clone([this](const RefNode& refNode, bool lockOwner)
+        {
+            return getReference(refNode, lockOwner);
+        });
+    }
+
     int r = resolveReferences(lock);
     if (r != 0)
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_RESOLVEFAILED);
@@ -252,16 +283,82 @@ ErrCode EvalValueImpl::checkParseAndResolve(bool lock)
     return OPENDAQ_SUCCESS;
 }
 
+bool EvalValueImpl::isResultCacheable() const
+{
+    // function and argument references can change without a property value changing
+    return resultCache != nullptr && !useFunctionResolver && !arguments.assigned();
+}
+
+bool EvalValueImpl::getResultRevisions(UInt& ownerRevision, uint64_t& revision) const
+{
+    revision = daqGetPropertyValueRevision();
+    ownerRevision = 0;
+    if (!owner.assigned())
+        return true;
+
+    // the owner's revision also changes when a value of one of its child objects changes
+    const PropertyObjectPtr ownerPtr = owner.getRef();
+    if (!ownerPtr.assigned())
+        return false;
+
+    const auto ownerInternal = ownerPtr.asPtrOrNull<IPropertyObjectInternal>(true);
+    return ownerInternal.assigned() && OPENDAQ_SUCCEEDED(ownerInternal->getValueRevision(&ownerRevision));
+}
+
+ErrCode EvalValueImpl::evaluate(bool lock, BaseObjectPtr& result)
+{
+    UInt ownerRevision = 0;
+    uint64_t revision = 0;
+    const bool cacheable = isResultCacheable() && getResultRevisions(ownerRevision, revision);
+
+    if (cacheable)
+    {
+        const auto last = std::atomic_load(&resultCache->getSlot(ownerObject));
+        if (last && last->owner == ownerObject && last->ownerRevision == ownerRevision && last->revision == revision)
+        {
+            result = last->result;
+            return OPENDAQ_SUCCESS;
+        }
+    }
+
+    ErrCode err = checkParseAndResolve(lock);
+    OPENDAQ_RETURN_IF_FAILED(err);
+
+    try
+    {
+        result = calc();
+    }
+    catch (...)
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_CALCFAILED);
+    }
+
+    // the result is not kept if a referenced value changed or a value read event was triggered while evaluating
+    if (cacheable && result.assigned() && isImmutableResult(result))
+    {
+        UInt ownerRevisionAfter;
+        uint64_t revisionAfter;
+        if (getResultRevisions(ownerRevisionAfter, revisionAfter) && ownerRevisionAfter == ownerRevision && revisionAfter == revision)
+        {
+            std::atomic_store(&resultCache->getSlot(ownerObject),
+                              std::make_shared<const EvalValueResult>(EvalValueResult{ownerObject, ownerRevision, revision, result}));
+        }
+    }
+
+    return OPENDAQ_SUCCESS;
+}
+
 ErrCode EvalValueImpl::getCoreType(CoreType* coreType)
 {
     OPENDAQ_PARAM_NOT_NULL(coreType);
 
-    ErrCode err = checkParseAndResolve(false);
+    BaseObjectPtr result;
+    ErrCode err = evaluate(false, result);
     OPENDAQ_RETURN_IF_FAILED(err);
 
     try
     {
-        *coreType = calc().getCoreType();
+        *coreType = result.getCoreType();
         return OPENDAQ_SUCCESS;
     }
     catch (...)
@@ -288,36 +385,24 @@ ErrCode EvalValueImpl::getResult(IBaseObject** obj)
 {
     OPENDAQ_PARAM_NOT_NULL(obj);
 
-    ErrCode err = checkParseAndResolve(true);
+    BaseObjectPtr result;
+    ErrCode err = evaluate(true, result);
     OPENDAQ_RETURN_IF_FAILED(err);
 
-    try
-    {
-        *obj = calc().addRefAndReturn();
-        return OPENDAQ_SUCCESS;
-    }
-    catch (...)
-    {
-        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_CALCFAILED);
-    };
+    *obj = result.addRefAndReturn();
+    return OPENDAQ_SUCCESS;
 }
 
 ErrCode EvalValueImpl::getResultNoLock(IBaseObject** obj)
 {
     OPENDAQ_PARAM_NOT_NULL(obj);
 
-    ErrCode err = checkParseAndResolve(false);
+    BaseObjectPtr result;
+    ErrCode err = evaluate(false, result);
     OPENDAQ_RETURN_IF_FAILED(err);
 
-    try
-    {
-        *obj = calc().addRefAndReturn();
-        return OPENDAQ_SUCCESS;
-    }
-    catch (...)
-    {
-        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_CALCFAILED);
-    };
+    *obj = result.addRefAndReturn();
+    return OPENDAQ_SUCCESS;
 }
 
 template <typename T>
@@ -391,12 +476,13 @@ ErrCode EvalValueImpl::StringObject_GetLength(SizeT* size)
 template <typename T>
 ErrCode EvalValueImpl::getValueInternal(T& value)
 {
-    auto err = checkParseAndResolve(false);
+    BaseObjectPtr result;
+    auto err = evaluate(false, result);
     OPENDAQ_RETURN_IF_FAILED(err);
 
     try
     {
-        value = static_cast<T>(calc());
+        value = static_cast<T>(result);
         return OPENDAQ_SUCCESS;
     }
     catch (...)
@@ -969,8 +1055,7 @@ ErrCode EvalValueImpl::cloneWithOwner(IPropertyObject* newOwner, IEvalValue** cl
     OPENDAQ_PARAM_NOT_NULL(clonedValue);
     OPENDAQ_PARAM_NOT_NULL(newOwner);
 
-    // OPENDAQ_TODO: properly handle error when parse failed
-    assert(node != nullptr);
+    assert(compiled != nullptr);
 
     EvalValueImpl* newEvalValue;
     if (useFunctionResolver && func.assigned())
@@ -1004,13 +1089,10 @@ ErrCode EvalValueImpl::getPropertyReferences(IList** propertyReferences)
     if (OPENDAQ_FAILED(parseErrCode))
         return DAQ_MAKE_ERROR_INFO(parseErrCode, parseErrMessage);
 
-    if (this->propertyReferences)
-    {
-        auto list = List<IString>();
-        for (const auto& el : *this->propertyReferences)
-            list.pushBack(el);
-        *propertyReferences = list.detach();
-    }
+    auto list = List<IString>();
+    for (const auto& el : compiled->propertyReferences)
+        list.pushBack(el);
+    *propertyReferences = list.detach();
     return OPENDAQ_SUCCESS;
 }
 
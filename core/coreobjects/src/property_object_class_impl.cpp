@@ -50,6 +50,19 @@ ErrCode PropertyObjectClassImpl::getProperty(IString* propertyName, IProperty**
     {
         if (parent.assigned())
         {
+            if (const auto inherited = getInheritedPropertiesLookup())
+            {
+                const auto inheritedRes = inherited->props.find(propertyName);
+                if (inheritedRes != inherited->props.cend())
+                {
+                    *property = inheritedRes.value().addRefAndReturn();
+                    return OPENDAQ_SUCCESS;
+                }
+
+                StringPtr str = propertyName;
+                return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOTFOUND, fmt::format(R"(Property with name {} not found.)", str));
+            }
+
             TypeManagerPtr managerPtr;
             ErrCode err = getManager(managerPtr);
             OPENDAQ_RETURN_IF_FAILED(err);
@@ -83,6 +96,12 @@ ErrCode PropertyObjectClassImpl::hasProperty(IString* propertyName, Bool* hasPro
     {
         if (parent.assigned())
         {
+            if (const auto inherited = getInheritedPropertiesLookup())
+            {
+                *hasProperty = inherited->props.find(propertyName) != inherited->props.cend();
+                return OPENDAQ_SUCCESS;
+            }
+
             TypeManagerPtr managerPtr;
             ErrCode err = getManager(managerPtr);
             OPENDAQ_RETURN_IF_FAILED(err);
@@ -106,6 +125,34 @@ ErrCode PropertyObjectClassImpl::hasProperty(IString* propertyName, Bool* hasPro
     return OPENDAQ_SUCCESS;
 }
 
+std::shared_ptr<const PropertyObjectClassImpl::InheritedProperties> PropertyObjectClassImpl::getInheritedPropertiesLookup()
+{
+    const uint64_t revision = daqGetTypeManagerRevision();
+
+    auto inherited = std::atomic_load(&inheritedProps);
+    if (inherited && inherited->typeManagerRevision == revision)
+        return inherited;
+
+    // Falls back to resolving the parents on each lookup while they cannot be resolved, so that the errors are reported
+    ListPtr<IProperty> properties;
+    const ErrCode errCode = getInheritedProperties(properties);
+    if (OPENDAQ_FAILED(errCode))
+    {
+        daqClearErrorInfo();
+        return nullptr;
+    }
+
+    auto resolved = std::make_shared<InheritedProperties>();
+    resolved->typeManagerRevision = revision;
+    resolved->props.reserve(properties.getCount());
+    for (const auto& prop : properties)
+        resolved->props.insert_or_assign(prop.getName(), prop);
+
+    inherited = std::move(resolved);
+    std::atomic_store(&inheritedProps, inherited);
+    return inherited;
+}
+
 ErrCode PropertyObjectClassImpl::getInheritedProperties(ListPtr<IProperty>& properties) const
 {
     if (parent.assigned())
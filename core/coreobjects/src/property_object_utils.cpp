@@ -1,5 +1,28 @@
 #include <coreobjects/property_object_utils.h>
+#include <atomic>
 
 BEGIN_NAMESPACE_OPENDAQ
 
+static std::atomic<uint64_t> propertyValueRevision{0};
+static std::atomic<uint64_t> initialPropertyValueRevision{0};
+
+extern "C"
+uint64_t PUBLIC_EXPORT daqGetPropertyValueRevision()
+{
+    return propertyValueRevision.load(std::memory_order_acquire);
+}
+
+extern "C"
+void PUBLIC_EXPORT daqIncrementPropertyValueRevision()
+{
+    propertyValueRevision.fetch_add(1, std::memory_order_acq_rel);
+}
+
+extern "C"
+uint64_t PUBLIC_EXPORT daqGetInitialPropertyValueRevision()
+{
+    // objects are far apart, so that one object's revision does not reach another's starting point
+    return initialPropertyValueRevision.fetch_add(1, std::memory_order_relaxed) << 32;
+}
+
 END_NAMESPACE_OPENDAQ
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <testutils/testutils.h>
 #include <coreobjects/coreobjects.h>
+#include <coreobjects/eval_value_impl.h>
 
 using namespace daq;
 
@@ -604,3 +605,170 @@ TEST_F(EvalValueTest, UnitPartial)
     ASSERT_EQ(unit2.getQuantity(), "");
     ASSERT_EQ(unit3.getId(), -1);
 }
+
+TEST_F(EvalValueTest, CachedResultInvalidatedOnWrite)
+{
+    auto propObj = PropertyObject();
+    propObj.addProperty(IntProperty("A", 1));
+
+    const auto eval = EvalValue("$A + 1").cloneWithOwner(propObj);
+    ASSERT_EQ(eval.getResult(), 2);
+    ASSERT_EQ(eval.getResult(), 2);
+
+    propObj.setPropertyValue("A", 5);
+    ASSERT_EQ(eval.getResult(), 6);
+
+    propObj.clearPropertyValue("A");
+    ASSERT_EQ(eval.getResult(), 2);
+}
+
+TEST_F(EvalValueTest, CachedResultPerOwner)
+{
+    auto propObj1 = PropertyObject();
+    propObj1.addProperty(IntProperty("A", 1));
+    auto propObj2 = PropertyObject();
+    propObj2.addProperty(IntProperty("A", 2));
+
+    const auto eval = EvalValue("$A * 10");
+    const auto eval1 = eval.cloneWithOwner(propObj1);
+    const auto eval2 = eval.cloneWithOwner(propObj2);
+
+    ASSERT_EQ(eval1.getResult(), 10);
+    ASSERT_EQ(eval2.getResult(), 20);
+    ASSERT_EQ(eval1.getResult(), 10);
+    ASSERT_EQ(eval.cloneWithOwner(propObj2).getResult(), 20);
+}
+
+TEST_F(EvalValueTest, CachedResultPerOwnerReadInTurn)
+{
+    const auto getSlotIndex = [](const PropertyObjectPtr& owner)
+    {
+        return EvalValueResultCache::getSlotIndex(owner.getObject());
+    };
+
+    auto propObj1 = PropertyObject();
+    propObj1.addProperty(IntProperty("A", 1));
+
+    // owners mapped to the same slot replace each other's result; candidates are kept alive so that each one
+    // gets a new address
+    std::vector<PropertyObjectPtr> candidates;
+    PropertyObjectPtr propObj2;
+    while (!propObj2.assigned())
+    {
+        auto candidate = PropertyObject();
+        if (getSlotIndex(candidate) != getSlotIndex(propObj1))
+            propObj2 = candidate;
+        candidates.push_back(candidate);
+    }
+    propObj2.addProperty(IntProperty("A", 2));
+
+    // a default value is cloned for each read, as when the same class default is read from several objects
+    const auto eval = EvalValue("$A * 1.5");
+    const auto first1 = eval.cloneWithOwner(propObj1).getResult();
+    const auto first2 = eval.cloneWithOwner(propObj2).getResult();
+    ASSERT_EQ(first1, 1.5);
+    ASSERT_EQ(first2, 3.0);
+
+    // cached results are returned as the same object
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_EQ(eval.cloneWithOwner(propObj1).getResult().getObject(), first1.getObject());
+        ASSERT_EQ(eval.cloneWithOwner(propObj2).getResult().getObject(), first2.getObject());
+    }
+}
+
+TEST_F(EvalValueTest, CachedResultNotUsedWithReadEvents)
+{
+    auto propObj = PropertyObject();
+    propObj.addProperty(IntProperty("A", 1));
+
+    Int readCount = 0;
+    propObj.getOnPropertyValueRead("A") += [&readCount](PropertyObjectPtr&, PropertyValueEventArgsPtr& args)
+    {
+        args.setValue(++readCount);
+    };
+
+    const auto eval = EvalValue("$A").cloneWithOwner(propObj);
+    ASSERT_EQ(eval.getResult(), 1);
+    ASSERT_EQ(eval.getResult(), 2);
+}
+
+TEST_F(EvalValueTest, CachedResultMetadata)
+{
+    auto propObj = PropertyObject();
+    propObj.addProperty(IntProperty("Max", 10));
+    propObj.addProperty(IntPropertyBuilder("Value", 0).setMaxValue(EvalValue("$Max * 2")).build());
+
+    ASSERT_EQ(propObj.getProperty("Value").getMaxValue(), 20);
+
+    propObj.setPropertyValue("Max", 20);
+    ASSERT_EQ(propObj.getProperty("Value").getMaxValue(), 40);
+
+    propObj.removeProperty("Max");
+    ASSERT_ANY_THROW(propObj.getProperty("Value").getMaxValue());
+}
+
+TEST_F(EvalValueTest, SameExpressionDifferentInstances)
+{
+    auto propObj = PropertyObject();
+    propObj.addProperty(IntProperty("A", 3));
+
+    const auto eval1 = EvalValue("$A + %A:Value").cloneWithOwner(propObj);
+    const auto eval2 = EvalValue("$A + %A:Value").cloneWithOwner(propObj);
+
+    ASSERT_EQ(eval1.getResult(), 6);
+    ASSERT_EQ(eval2.getResult(), 6);
+    ASSERT_EQ(eval1.getPropertyReferences(), eval2.getPropertyReferences());
+}
+
+TEST_F(EvalValueTest, CachedParseError)
+{
+    ASSERT_THROW_MSG(EvalValue("1+1+b"), ParseFailedException, "invalid identifier");
+    ASSERT_THROW_MSG(EvalValue("1+1+b"), ParseFailedException, "invalid identifier");
+}
+
+TEST_F(EvalValueTest, CachedResultInvalidatedOnChildObjectWrite)
+{
+    auto child = PropertyObject();
+    child.addProperty(IntProperty("A", 1));
+
+    auto propObj = PropertyObject();
+    propObj.addProperty(ObjectProperty("Child", child));
+
+    const auto eval = EvalValue("$Child.A + 1").cloneWithOwner(propObj);
+    ASSERT_EQ(eval.getResult(), 2);
+
+    propObj.setPropertyValue("Child.A", 5);
+    ASSERT_EQ(eval.getResult(), 6);
+}
+
+TEST_F(EvalValueTest, CachedResultNotInvalidatedByOtherObjects)
+{
+    auto propObj = PropertyObject();
+    propObj.addProperty(IntProperty("A", 1));
+    auto otherObj = PropertyObject();
+    otherObj.addProperty(IntProperty("A", 1));
+
+    const PropertyObjectInternalPtr propObjInternal = propObj;
+    const UInt revision = propObjInternal.getValueRevision();
+
+    const auto eval = EvalValue("$A + 1").cloneWithOwner(propObj);
+    ASSERT_EQ(eval.getResult(), 2);
+
+    otherObj.setPropertyValue("A", 5);
+    ASSERT_EQ(propObjInternal.getValueRevision(), revision);
+    ASSERT_EQ(eval.getResult(), 2);
+}
+
+TEST_F(EvalValueTest, DefaultValueOverrideInvalidatesOwnerResults)
+{
+    auto propObj = PropertyObject();
+    propObj.addProperty(IntProperty("A", 1));
+
+    const PropertyObjectInternalPtr propObjInternal = propObj;
+    const UInt revision = propObjInternal.getValueRevision();
+
+    const auto prop = propObj.getProperty("A");
+    prop.asPtr<IPropertyInternal>().overrideDefaultValue(5);
+    ASSERT_NE(propObjInternal.getValueRevision(), revision);
+}
@@ -2892,4 +2892,111 @@ TEST_F(PropertyObjectTest, ClearPropertyValuesNestedMixedTypes)
     ASSERT_EQ(root.getPropertyValue("child1.Bool"), False);
     ASSERT_EQ(root.getPropertyValue("child2.Int"), 2);
     ASSERT_EQ(root.getPropertyValue("child2.Str"), "b");
-}
\ No newline at end of file
+}
+
+TEST_F(PropertyObjectTest, ManyPropertyValues)
+{
+    constexpr Int propertyCount = 40;
+
+    const auto obj = PropertyObject();
+    for (Int i = 0; i < propertyCount; ++i)
+    {
+        obj.addProperty(IntProperty("Property" + std::to_string(i), -1));
+        obj.setPropertyValue("Property" + std::to_string(i), i);
+    }
+
+    for (Int i = 0; i < propertyCount; i += 2)
+        obj.clearPropertyValue("Property" + std::to_string(i));
+
+    obj.removeProperty("Property1");
+
+    for (Int i = 2; i < propertyCount; ++i)
+        ASSERT_EQ(obj.getPropertyValue("Property" + std::to_string(i)), i % 2 == 0 ? -1 : i);
+    ASSERT_FALSE(obj.hasProperty("Property1"));
+
+    const PropertyObjectPtr cloned = obj.asPtr<IPropertyObjectInternal>().clone();
+    for (Int i = 3; i < propertyCount; i += 2)
+        ASSERT_EQ(cloned.getPropertyValue("Property" + std::to_string(i)), i);
+}
+
+TEST_F(PropertyObjectTest, AnyValueEventsCloned)
+{
+    auto obj = PropertyObject();
+    obj.addProperty(IntProperty("Value", 0));
+
+    int writeCount = 0;
+    obj.getOnAnyPropertyValueWrite() += [&writeCount](PropertyObjectPtr&, PropertyValueEventArgsPtr&) { ++writeCount; };
+
+    const PropertyObjectPtr cloned = obj.asPtr<IPropertyObjectInternal>().clone();
+    obj.setPropertyValue("Value", 1);
+    cloned.setPropertyValue("Value", 2);
+
+    ASSERT_EQ(writeCount, 2);
+}
+
+TEST_F(PropertyObjectTest, ConcurrentReads)
+{
+    auto obj = PropertyObject();
+    obj.addProperty(IntProperty("Value", 0));
+    obj.addProperty(StringProperty("Str", "default"));
+
+    const auto objInternal = obj.asPtr<IPropertyObjectInternal>();
+    ASSERT_FALSE(objInternal.getConcurrentReadsEnabled());
+    objInternal.setConcurrentReadsEnabled(true);
+    ASSERT_TRUE(objInternal.getConcurrentReadsEnabled());
+
+    ASSERT_EQ(obj.getPropertyValue("Value"), 0);
+    obj.setPropertyValue("Value", 1);
+    obj.setPropertyValue("Str", "value");
+    ASSERT_EQ(obj.getPropertyValue("Value"), 1);
+    ASSERT_EQ(obj.getPropertyValue("Value"), 1);
+    ASSERT_EQ(obj.getPropertyValue("Str"), "value");
+
+    obj.setPropertyValue("Value", 2);
+    ASSERT_EQ(obj.getPropertyValue("Value"), 2);
+    ASSERT_EQ(obj.getPropertyValue("Str"), "value");
+
+    obj.clearPropertyValue("Value");
+    ASSERT_EQ(obj.getPropertyValue("Value"), 0);
+
+    obj.removeProperty("Str");
+    ASSERT_THROW(obj.getPropertyValue("Str"), NotFoundException);
+
+    objInternal.setConcurrentReadsEnabled(false);
+    obj.setPropertyValue("Value", 3);
+    ASSERT_EQ(obj.getPropertyValue("Value"), 3);
+}
+
+TEST_F(PropertyObjectTest, ConcurrentReadsReadEventAddedLater)
+{
+    auto obj = PropertyObject();
+    obj.addProperty(IntProperty("Value", 0));
+    obj.asPtr<IPropertyObjectInternal>().setConcurrentReadsEnabled(true);
+
+    obj.setPropertyValue("Value", 1);
+    ASSERT_EQ(obj.getPropertyValue("Value"), 1);
+    ASSERT_EQ(obj.getPropertyValue("Value"), 1);
+
+    obj.getOnPropertyValueRead("Value") += [](PropertyObjectPtr&, PropertyValueEventArgsPtr& args) { args.setValue(5); };
+    ASSERT_EQ(obj.getPropertyValue("Value"), 5);
+}
+
+TEST_F(PropertyObjectTest, ConcurrentReadsClassReadEventAddedLater)
+{
+    const auto propClass = PropertyObjectClassBuilder("ReadEventClass").addProperty(IntProperty("Value", 0)).build();
+    objManager.addType(propClass);
+
+    auto obj = PropertyObject(objManager, "ReadEventClass");
+    obj.asPtr<IPropertyObjectInternal>().setConcurrentReadsEnabled(true);
+
+    obj.setPropertyValue("Value", 1);
+    ASSERT_EQ(obj.getPropertyValue("Value"), 1);
+    ASSERT_EQ(obj.getPropertyValue("Value"), 1);
+
+    int readCount = 0;
+    propClass.getProperty("Value").getOnPropertyValueRead() +=
+        [&readCount](PropertyObjectPtr&, PropertyValueEventArgsPtr&) { ++readCount; };
+
+    ASSERT_EQ(obj.getPropertyValue("Value"), 1);
+    ASSERT_EQ(readCount, 1);
+}
@@ -213,3 +213,28 @@ TEST_F(PropertyObjectClassTest, DeserializeWithParent)
 
     ASSERT_EQ(str, newStr);
 }
+
+TEST_F(PropertyObjectClassTest, InheritedProperties)
+{
+    const auto manager = TypeManager();
+    manager.addType(PropertyObjectClassBuilder(manager, "Parent").addProperty(IntProperty("ParentProp", 1)).build());
+
+    const auto childClass = PropertyObjectClassBuilder(manager, "Child")
+                                .setParentName("Parent")
+                                .addProperty(IntProperty("ChildProp", 2))
+                                .build();
+    manager.addType(childClass);
+
+    ASSERT_EQ(childClass.getProperty("ParentProp").getDefaultValue(), 1);
+    ASSERT_EQ(childClass.getProperty("ChildProp").getDefaultValue(), 2);
+    ASSERT_TRUE(childClass.hasProperty("ParentProp"));
+    ASSERT_FALSE(childClass.hasProperty("Missing"));
+    ASSERT_THROW(childClass.getProperty("Missing"), NotFoundException);
+
+    // the resolved parent properties are dropped when the parent type is replaced
+    manager.removeType("Parent");
+    manager.addType(PropertyObjectClassBuilder(manager, "Parent").addProperty(IntProperty("OtherProp", 3)).build());
+
+    ASSERT_FALSE(childClass.hasProperty("ParentProp"));
+    ASSERT_EQ(childClass.getProperty("OtherProp").getDefaultValue(), 3);
+}
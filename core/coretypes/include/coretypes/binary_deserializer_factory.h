@@ -0,0 +1,41 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/common.h>
+#include <coretypes/binary_deserializer.h>
+#include <coretypes/binary_serializer.h>
+#include <coretypes/deserializer_ptr.h>
+#include <coretypes/string_ptr.h>
+#include <cstring>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+inline DeserializerPtr BinaryDeserializer()
+{
+    return DeserializerPtr(BinaryDeserializer_Create());
+}
+
+/*!
+ * @brief Checks whether the serialized string was produced by a binary serializer.
+ */
+inline bool IsBinarySerialized(const StringPtr& serialized)
+{
+    return serialized.assigned() && serialized.getLength() >= binary_serialization::MagicSize &&
+           std::memcmp(serialized.getCharPtr(), binary_serialization::Magic, binary_serialization::MagicSize) == 0;
+}
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/intfs.h>
+#include <coretypes/deserializer.h>
+#include <coretypes/updatable.h>
+#include <coretypes/binary_serializer_impl.h>
+#include <coretypes/string_ptr.h>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+struct BinaryValue
+{
+    binary_serialization::Tag tag = binary_serialization::Tag::Null;
+    Int intValue = 0;
+    Float floatValue = 0.0;
+    std::string_view string;
+
+    // list elements or object member values; member names are stored at the same index in memberNames
+    std::vector<BinaryValue> items;
+    std::vector<std::string_view> memberNames;
+
+    const BinaryValue* findMember(std::string_view name) const;
+};
+
+/*
+ * Parsed binary input. Values reference the bytes of the source string, which is kept alive
+ * for as long as any serialized object or list created from the document exists.
+ */
+struct BinaryDocument
+{
+    StringPtr source;
+    BinaryValue root;
+
+    static ErrCode Parse(IString* serialized, std::shared_ptr<BinaryDocument>& document);
+};
+
+using BinaryDocumentPtr = std::shared_ptr<const BinaryDocument>;
+
+class BinaryDeserializerImpl : public ImplementationOf<IDeserializer>
+{
+public:
+    ErrCode INTERFACE_FUNC deserialize(IString* serialized, IBaseObject* context, IFunction* factoryCallback, IBaseObject** object) override;
+    ErrCode INTERFACE_FUNC update(IUpdatable* updatable, IString* serialized, IBaseObject* config) override;
+    ErrCode INTERFACE_FUNC callCustomProc(IProcedure* customDeserialize, IString* serialized) override;
+
+    ErrCode INTERFACE_FUNC toString(CharPtr* str) override;
+
+    static CoreType GetCoreType(const BinaryValue& value) noexcept;
+    static ErrCode Deserialize(const BinaryDocumentPtr& document,
+                               const BinaryValue& value,
+                               IBaseObject* context,
+                               IFunction* factoryCallback,
+                               IBaseObject** object);
+
+private:
+    static ErrCode DeserializeTagged(const BinaryDocumentPtr& document,
+                                     const BinaryValue& value,
+                                     IBaseObject* context,
+                                     IFunction* factoryCallback,
+                                     IBaseObject** object);
+    static ErrCode DeserializeList(const BinaryDocumentPtr& document,
+                                   const BinaryValue& value,
+                                   IBaseObject* context,
+                                   IFunction* factoryCallback,
+                                   IBaseObject** object);
+    static ErrCode ParseRootObject(IString* serialized, ISerializedObject** serializedObject);
+};
+
+END_NAMESPACE_OPENDAQ
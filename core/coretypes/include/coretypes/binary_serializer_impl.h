@@ -0,0 +1,117 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/serializer.h>
+#include <coretypes/binary_serializer.h>
+#include <coretypes/intfs.h>
+#include <coretypes/baseobject_factory.h>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*
+ * Binary serialization format
+ *
+ * The output starts with a 4-byte magic followed by a single value. Each value begins with a one byte tag:
+ *
+ *   Null, False, True
+ *   Int            zig-zag encoded variable length integer
+ *   Float          8-byte IEEE 754 double, little endian
+ *   String         variable length byte count followed by the UTF-8 bytes
+ *   List           values up to the matching End tag
+ *   Object         key-value pairs up to the matching End tag
+ *   TaggedObject   type id string followed by key-value pairs up to the matching End tag
+ *
+ * Keys and type ids are interned: the first occurrence is written as a NewString (byte count + bytes)
+ * and assigned the next index, later occurrences are written as a StringRef holding that index.
+ * A tagged object is read back as a plain object with its type id stored under the "__type" key,
+ * matching the layout produced by the JSON serializer.
+ */
+namespace binary_serialization
+{
+    enum class Tag : uint8_t
+    {
+        Null = 0x00,
+        False = 0x01,
+        True = 0x02,
+        Int = 0x03,
+        Float = 0x04,
+        String = 0x05,
+        List = 0x06,
+        Object = 0x07,
+        TaggedObject = 0x08,
+        End = 0x09,
+        NewString = 0x0A,
+        StringRef = 0x0B
+    };
+}
+
+class BinarySerializerImpl : public ImplementationOf<ISerializer>
+{
+public:
+    BinarySerializerImpl();
+    explicit BinarySerializerImpl(Int version);
+
+    ErrCode INTERFACE_FUNC startTaggedObject(ISerializable* serializable) override;
+    ErrCode INTERFACE_FUNC startObject() override;
+    ErrCode INTERFACE_FUNC endObject() override;
+
+    ErrCode INTERFACE_FUNC startList() override;
+    ErrCode INTERFACE_FUNC endList() override;
+
+    ErrCode INTERFACE_FUNC getOutput(IString** output) override;
+
+    ErrCode INTERFACE_FUNC keyStr(IString* name) override;
+    ErrCode INTERFACE_FUNC key(ConstCharPtr string) override;
+    ErrCode INTERFACE_FUNC keyRaw(ConstCharPtr string, SizeT length) override;
+
+    ErrCode INTERFACE_FUNC writeInt(Int integer) override;
+    ErrCode INTERFACE_FUNC writeBool(Bool boolean) override;
+    ErrCode INTERFACE_FUNC writeFloat(Float real) override;
+    ErrCode INTERFACE_FUNC writeString(ConstCharPtr string, SizeT length) override;
+    ErrCode INTERFACE_FUNC writeNull() override;
+
+    ErrCode INTERFACE_FUNC reset() override;
+
+    ErrCode INTERFACE_FUNC isComplete(Bool* complete) override;
+
+    ErrCode INTERFACE_FUNC getUser(IBaseObject** user) override;
+    ErrCode INTERFACE_FUNC setUser(IBaseObject* user) override;
+
+    ErrCode INTERFACE_FUNC getVersion(Int* version) override;
+
+    ErrCode INTERFACE_FUNC toString(CharPtr* str) override;
+
+private:
+    void writeTag(binary_serialization::Tag tag);
+    void writeVarUInt(uint64_t value);
+    void writeInternedString(std::string_view string);
+    void startValue();
+
+    std::string buffer;
+    std::deque<std::string> internedStrings;
+    std::unordered_map<std::string_view, uint64_t> internedIndices;
+    size_t depth;
+    bool rootWritten;
+    BaseObjectPtr userContext;
+    Int version;
+};
+
+END_NAMESPACE_OPENDAQ
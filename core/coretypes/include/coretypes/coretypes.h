@@ -62,6 +62,8 @@
 #include <coretypes/serialized_object_ptr.h>
 #include <coretypes/json_serializer_factory.h>
 #include <coretypes/json_deserializer_factory.h>
+#include <coretypes/binary_serializer_factory.h>
+#include <coretypes/binary_deserializer_factory.h>
 
 #include <coretypes/objectptr.h>
 #include <coretypes/listobject_factory.h>
@@ -44,7 +44,18 @@ BEGIN_NAMESPACE_OPENDAQ
  *
  * // Creates a new String object. Returns error code if not successful.
  * ErrCode createStringN(IString** obj, ConstCharPtr data, SizeT length)
+ *
+ * // Gets the interned String object with the given value. Throws exception if not successful.
+ * IString* InternedString_Create(ConstCharPtr data, SizeT length)
+ *
+ * // Gets the interned String object with the given value. Returns error code if not successful.
+ * ErrCode createInternedString(IString** obj, ConstCharPtr data, SizeT length)
  * @endcode
+ *
+ * Interned strings with equal values are the same object, so they can be compared by pointer, and their
+ * hash code is calculated only once. Interned strings are never released; use them only for a bounded set
+ * of values, such as property names. The interning table itself is bounded: values longer than 256 characters,
+ * and new values once the table holds 65536 strings, are returned as regular String objects.
  */
 DECLARE_OPENDAQ_INTERFACE(IString, IBaseObject)
 {
@@ -81,4 +92,13 @@ OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC(
     SizeT, length
 )
 
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC(
+    LIBRARY_FACTORY,
+    InternedString,
+    IString,
+    createInternedString,
+    ConstCharPtr, str,
+    SizeT, length
+)
+
 END_NAMESPACE_OPENDAQ
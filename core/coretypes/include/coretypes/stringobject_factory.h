@@ -37,6 +37,27 @@ inline StringPtr String(const std::string& str)
     return obj;
 }
 
+/*!
+ * @brief Gets the interned string with the given value.
+ *
+ * Interned strings with equal values share the same object and are never released.
+ */
+inline StringPtr InternedString(ConstCharPtr str, SizeT length)
+{
+    StringPtr obj(InternedString_Create(str, length));
+    return obj;
+}
+
+inline StringPtr InternedString(const std::string& str)
+{
+    return InternedString(str.data(), str.size());
+}
+
+inline StringPtr InternedString(const StringPtr& str)
+{
+    return InternedString(str.getCharPtr(), str.getLength());
+}
+
 inline StringPtr operator""_daq(const char* str)
 {
     return String(str);
@@ -29,6 +29,7 @@ class StringImpl : public ImplementationOf<IString, IConvertible, ICoreType, ICo
 public:
     StringImpl(ConstCharPtr str);
     StringImpl(ConstCharPtr data, SizeT length);
+    StringImpl(ConstCharPtr data, SizeT length, bool interned);
 
     ~StringImpl() override;
 
@@ -56,11 +57,27 @@ public:
     ErrCode INTERFACE_FUNC serialize(ISerializer* serializer) override;
     ErrCode INTERFACE_FUNC getSerializeId(ConstCharPtr* id) const override;
 
+    bool isInterned() const;
+
 private:
-    char* str;
+    // strings shorter than this are stored within the object, without a separate allocation
+    static constexpr SizeT InlineCapacity = 24;
+
+    void calculateHashCode();
+    char* data();
+    const char* data() const;
+
+    // the heap pointer shares storage with the inline characters; a null string is stored as a null heap pointer
+    union
+    {
+        char* heapStr;
+        char inlineStr[InlineCapacity];
+    };
     SizeT hashCode;
-    bool hashCalculated;
     SizeT length;
+    bool isInline;
+    bool hashCalculated;
+    bool interned;
 };
 
 END_NAMESPACE_OPENDAQ
@@ -89,5 +89,14 @@ DECLARE_OPENDAQ_INTERFACE(ITypeManager, IBaseObject)
 
 OPENDAQ_DECLARE_CLASS_FACTORY(LIBRARY_FACTORY, TypeManager)
 
+/*!
+ * @brief Gets the process-wide revision of Type managers.
+ *
+ * The revision is incremented whenever a Type is added to or removed from any Type manager. Values derived
+ * from the Types of a manager (eg. the flattened properties of a Property object class and its parents) remain
+ * valid while the revision does not change.
+ */
+extern "C"
+uint64_t PUBLIC_EXPORT daqGetTypeManagerRevision();
 
 END_NAMESPACE_OPENDAQ
@@ -0,0 +1,470 @@
+#include <coretypes/binary_deserializer_impl.h>
+#include <coretypes/coretypes.h>
+#include <coretypes/binary_serialized_object.h>
+#include <coretypes/binary_serialized_list.h>
+#include <coretypes/updatable.h>
+#include <coretypes/ctutils.h>
+#include <cstring>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+using namespace binary_serialization;
+
+namespace
+{
+
+class BinaryReader
+{
+public:
+    // guards the parser against stack exhaustion on malicious or corrupted input
+    static constexpr size_t MaxDepth = 1024;
+
+    BinaryReader(const char* data, size_t length)
+        : pos(reinterpret_cast<const uint8_t*>(data))
+        , end(pos + length)
+    {
+    }
+
+    bool readValue(BinaryValue& value, size_t depth)
+    {
+        if (depth > MaxDepth || pos == end)
+            return false;
+
+        const auto tag = static_cast<Tag>(*pos++);
+        value.tag = tag;
+
+        switch (tag)
+        {
+            case Tag::Null:
+            case Tag::False:
+            case Tag::True:
+                return true;
+            case Tag::Int:
+            {
+                uint64_t encoded;
+                if (!readVarUInt(encoded))
+                    return false;
+                value.intValue = static_cast<Int>((encoded >> 1) ^ (~(encoded & 1) + 1));
+                return true;
+            }
+            case Tag::Float:
+            {
+                if (static_cast<size_t>(end - pos) < sizeof(uint64_t))
+                    return false;
+
+                uint64_t bits = 0;
+                for (size_t i = 0; i < sizeof(bits); ++i)
+                    bits |= static_cast<uint64_t>(*pos++) << (i * 8);
+                std::memcpy(&value.floatValue, &bits, sizeof(bits));
+                return true;
+            }
+            case Tag::String:
+                return readBytes(value.string);
+            case Tag::List:
+                while (!atEnd())
+                {
+                    if (!readValue(value.items.emplace_back(), depth + 1))
+                        return false;
+                }
+                return skipEnd();
+            case Tag::TaggedObject:
+            {
+                value.tag = Tag::Object;
+
+                std::string_view typeId;
+                if (!readInternedString(typeId))
+                    return false;
+
+                value.memberNames.emplace_back("__type");
+                auto& typeValue = value.items.emplace_back();
+                typeValue.tag = Tag::String;
+                typeValue.string = typeId;
+
+                return readMembers(value, depth);
+            }
+            case Tag::Object:
+                return readMembers(value, depth);
+            default:
+                return false;
+        }
+    }
+
+    bool isFinished() const
+    {
+        return pos == end;
+    }
+
+private:
+    bool readMembers(BinaryValue& value, size_t depth)
+    {
+        while (!atEnd())
+        {
+            if (!readInternedString(value.memberNames.emplace_back()))
+                return false;
+            if (!readValue(value.items.emplace_back(), depth + 1))
+                return false;
+        }
+        return skipEnd();
+    }
+
+    bool atEnd() const
+    {
+        return pos == end || static_cast<Tag>(*pos) == Tag::End;
+    }
+
+    bool skipEnd()
+    {
+        if (pos == end)
+            return false;
+
+        ++pos;
+        return true;
+    }
+
+    bool readVarUInt(uint64_t& value)
+    {
+        value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7)
+        {
+            if (pos == end)
+                return false;
+
+            const uint8_t byte = *pos++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+        return false;
+    }
+
+    bool readBytes(std::string_view& bytes)
+    {
+        uint64_t length;
+        if (!readVarUInt(length) || length > static_cast<uint64_t>(end - pos))
+            return false;
+
+        bytes = std::string_view(reinterpret_cast<const char*>(pos), static_cast<size_t>(length));
+        pos += length;
+        return true;
+    }
+
+    bool readInternedString(std::string_view& string)
+    {
+        if (pos == end)
+            return false;
+
+        const auto tag = static_cast<Tag>(*pos++);
+        if (tag == Tag::NewString)
+        {
+            if (!readBytes(string))
+                return false;
+
+            internedStrings.push_back(string);
+            return true;
+        }
+
+        if (tag == Tag::StringRef)
+        {
+            uint64_t index;
+            if (!readVarUInt(index) || index >= internedStrings.size())
+                return false;
+
+            string = internedStrings[static_cast<size_t>(index)];
+            return true;
+        }
+
+        return false;
+    }
+
+    const uint8_t* pos;
+    const uint8_t* end;
+    std::vector<std::string_view> internedStrings;
+};
+
+}
+
+const BinaryValue* BinaryValue::findMember(std::string_view name) const
+{
+    for (size_t i = 0; i < memberNames.size(); ++i)
+    {
+        if (memberNames[i] == name)
+            return &items[i];
+    }
+    return nullptr;
+}
+
+// static
+ErrCode BinaryDocument::Parse(IString* serialized, std::shared_ptr<BinaryDocument>& document)
+{
+    OPENDAQ_PARAM_NOT_NULL(serialized);
+
+    SizeT length;
+    ErrCode errCode = serialized->getLength(&length);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    ConstCharPtr ptr;
+    errCode = serialized->getCharPtr(&ptr);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    if (ptr == nullptr || length < MagicSize || std::memcmp(ptr, Magic, MagicSize) != 0)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_DESERIALIZE_PARSE_ERROR);
+
+    try
+    {
+        document = std::make_shared<BinaryDocument>();
+        document->source = serialized;
+
+        BinaryReader reader(ptr + MagicSize, length - MagicSize);
+        if (!reader.readValue(document->root, 0) || !reader.isFinished())
+            return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_DESERIALIZE_PARSE_ERROR);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOMEMORY);
+    }
+
+    return OPENDAQ_SUCCESS;
+}
+
+// static
+ErrCode BinaryDeserializerImpl::DeserializeTagged(const BinaryDocumentPtr& document,
+                                                  const BinaryValue& value,
+                                                  IBaseObject* context,
+                                                  IFunction* factoryCallback,
+                                                  IBaseObject** object)
+{
+    const auto typeValue = value.findMember("__type");
+    if (typeValue == nullptr)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_DESERIALIZE_NO_TYPE);
+
+    if (typeValue->tag != Tag::String)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_DESERIALIZE_UNKNOWN_TYPE);
+
+    std::string typeId(typeValue->string);
+
+    SerializedObjectPtr serObj;
+    auto errCode = createObject<ISerializedObject, BinarySerializedObject>(&serObj, document, &value);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    bool constructedFromCallbackFactory = false;
+
+    errCode = daqTry([&factoryCallback, &typeId, &object, &context, &serObj, &constructedFromCallbackFactory]
+    {
+        const auto factoryCallbackPtr = FunctionPtr::Borrow(factoryCallback);
+        if (factoryCallbackPtr.assigned())
+        {
+            *object = factoryCallbackPtr.call(String(typeId), serObj, context, factoryCallback).detach();
+            constructedFromCallbackFactory = *object != nullptr;
+        }
+
+        return OPENDAQ_SUCCESS;
+    });
+
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    if (!constructedFromCallbackFactory)
+    {
+        daqDeserializerFactory factory{};
+        errCode = daqGetSerializerFactory(typeId.data(), &factory);
+        OPENDAQ_RETURN_IF_FAILED(errCode);
+
+        errCode = factory(serObj, context, factoryCallback, object);
+        OPENDAQ_RETURN_IF_FAILED(errCode);
+    }
+
+    return OPENDAQ_SUCCESS;
+}
+
+// static
+ErrCode BinaryDeserializerImpl::DeserializeList(const BinaryDocumentPtr& document,
+                                                const BinaryValue& value,
+                                                IBaseObject* context,
+                                                IFunction* factoryCallback,
+                                                IBaseObject** object)
+{
+    IList* list;
+    ErrCode errCode = createList(&list);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    for (const auto& element : value.items)
+    {
+        IBaseObject* elementObj = nullptr;
+        errCode = Deserialize(document, element, context, factoryCallback, &elementObj);
+        if (OPENDAQ_FAILED(errCode))
+        {
+            list->releaseRef();
+            return errCode;
+        }
+
+        errCode = list->moveBack(elementObj);
+        if (OPENDAQ_FAILED(errCode))
+        {
+            list->releaseRef();
+            return errCode;
+        }
+    }
+    *object = list;
+
+    return OPENDAQ_SUCCESS;
+}
+
+// static
+ErrCode BinaryDeserializerImpl::Deserialize(const BinaryDocumentPtr& document,
+                                            const BinaryValue& value,
+                                            IBaseObject* context,
+                                            IFunction* factoryCallback,
+                                            IBaseObject** object)
+{
+    ErrCode errCode = OPENDAQ_SUCCESS;
+
+    switch (value.tag)
+    {
+        case Tag::Null:
+            *object = nullptr;
+            break;
+        case Tag::Object:
+            errCode = DeserializeTagged(document, value, context, factoryCallback, object);
+            break;
+        case Tag::String:
+        {
+            IString* string;
+            errCode = createStringN(&string, value.string.data(), value.string.size());
+            *object = string;
+            break;
+        }
+        case Tag::Int:
+        {
+            IInteger* integer;
+            errCode = createInteger(&integer, value.intValue);
+            *object = integer;
+            break;
+        }
+        case Tag::Float:
+        {
+            IFloat* floating;
+            errCode = createFloat(&floating, value.floatValue);
+            *object = floating;
+            break;
+        }
+        case Tag::List:
+            errCode = DeserializeList(document, value, context, factoryCallback, object);
+            break;
+        case Tag::False:
+        case Tag::True:
+        {
+            IBoolean* boolean;
+            errCode = createBoolean(&boolean, value.tag == Tag::True);
+            *object = boolean;
+            break;
+        }
+        default:
+            *object = nullptr;
+            return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_DESERIALIZE_UNKNOWN_TYPE);
+    }
+    return errCode;
+}
+
+ErrCode BinaryDeserializerImpl::deserialize(IString* serialized, IBaseObject* context, IFunction* factoryCallback, IBaseObject** object)
+{
+    OPENDAQ_PARAM_NOT_NULL(serialized);
+    OPENDAQ_PARAM_NOT_NULL(object);
+
+    std::shared_ptr<BinaryDocument> document;
+    const ErrCode errCode = BinaryDocument::Parse(serialized, document);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    return Deserialize(document, document->root, context, factoryCallback, object);
+}
+
+// static
+ErrCode BinaryDeserializerImpl::ParseRootObject(IString* serialized, ISerializedObject** serializedObject)
+{
+    std::shared_ptr<BinaryDocument> document;
+    const ErrCode errCode = BinaryDocument::Parse(serialized, document);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    if (document->root.tag != Tag::Object)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
+
+    return createObject<ISerializedObject, BinarySerializedObject>(serializedObject, document, &document->root, true);
+}
+
+ErrCode BinaryDeserializerImpl::update(IUpdatable* updatable, IString* serialized, IBaseObject* config)
+{
+    OPENDAQ_PARAM_NOT_NULL(updatable);
+    OPENDAQ_PARAM_NOT_NULL(serialized);
+
+    SerializedObjectPtr serObj;
+    const ErrCode errCode = ParseRootObject(serialized, &serObj);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    return updatable->update(serObj, config);
+}
+
+ErrCode BinaryDeserializerImpl::callCustomProc(IProcedure* customDeserialize, IString* serialized)
+{
+    OPENDAQ_PARAM_NOT_NULL(customDeserialize);
+    OPENDAQ_PARAM_NOT_NULL(serialized);
+
+    SerializedObjectPtr serObj;
+    ErrCode errCode = ParseRootObject(serialized, &serObj);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    const ProcedurePtr proc = ProcedurePtr::Borrow(customDeserialize);
+    errCode = daqTry([&]
+    {
+        proc(serObj);
+        return OPENDAQ_SUCCESS;
+    });
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+    return errCode;
+}
+
+ErrCode BinaryDeserializerImpl::toString(CharPtr* str)
+{
+    OPENDAQ_PARAM_NOT_NULL(str);
+
+    return daqDuplicateCharPtr("BinaryDeserializer", str);
+}
+
+CoreType BinaryDeserializerImpl::GetCoreType(const BinaryValue& value) noexcept
+{
+    switch (value.tag)
+    {
+        case Tag::Null:
+        case Tag::Object:
+            return ctObject;
+        case Tag::False:
+        case Tag::True:
+            return ctBool;
+        case Tag::List:
+            return ctList;
+        case Tag::String:
+            return ctString;
+        case Tag::Int:
+            return ctInt;
+        case Tag::Float:
+            return ctFloat;
+        default:
+            return ctUndefined;
+    }
+}
+
+// createBinaryDeserializer
+extern "C"
+ErrCode PUBLIC_EXPORT createBinaryDeserializer(IDeserializer** binaryDeserializer)
+{
+    OPENDAQ_PARAM_NOT_NULL(binaryDeserializer);
+
+    IDeserializer* object = new(std::nothrow) BinaryDeserializerImpl();
+
+    if (!object)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOMEMORY);
+
+    object->addRef();
+
+    *binaryDeserializer = object;
+    return OPENDAQ_SUCCESS;
+}
+
+END_NAMESPACE_OPENDAQ
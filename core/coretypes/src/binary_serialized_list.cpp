@@ -0,0 +1,205 @@
+#include <coretypes/binary_serialized_list.h>
+#include <coretypes/binary_serialized_object.h>
+#include <coretypes/coretypes.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+using namespace binary_serialization;
+
+BinarySerializedList::BinarySerializedList(BinaryDocumentPtr document, const BinaryValue* list)
+    : document(std::move(document))
+    , array(list->items)
+    , index(0)
+{
+}
+
+ErrCode BinarySerializedList::readSerializedList(ISerializedList** list)
+{
+    OPENDAQ_PARAM_NOT_NULL(list);
+
+    if (index >= array.size())
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_OUTOFRANGE);
+    }
+
+    if (array[index].tag != Tag::List)
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
+    }
+
+    return createObject<ISerializedList, BinarySerializedList>(list, document, &array[index++]);
+}
+
+ErrCode BinarySerializedList::readList(IBaseObject* context, IFunction* factoryCallback, IList** list)
+{
+    OPENDAQ_PARAM_NOT_NULL(list);
+
+    if (index >= array.size())
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_OUTOFRANGE);
+    }
+
+    const auto& value = array[index];
+    if (value.tag == Tag::List)
+    {
+        ++index;
+        return BinaryDeserializerImpl::Deserialize(document, value, context, factoryCallback, reinterpret_cast<IBaseObject**>(list));
+    }
+
+    if (value.tag == Tag::Null)
+    {
+        *list = nullptr;
+        return OPENDAQ_SUCCESS;
+    }
+
+    return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
+}
+
+ErrCode BinarySerializedList::readSerializedObject(ISerializedObject** plainObj)
+{
+    OPENDAQ_PARAM_NOT_NULL(plainObj);
+
+    if (index >= array.size())
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_OUTOFRANGE);
+    }
+
+    const auto& value = array[index];
+    if (value.tag == Tag::Object)
+    {
+        ++index;
+        return createObject<ISerializedObject, BinarySerializedObject>(plainObj, document, &value);
+    }
+
+    if (value.tag == Tag::Null)
+    {
+        *plainObj = nullptr;
+        return OPENDAQ_SUCCESS;
+    }
+
+    return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
+}
+
+ErrCode BinarySerializedList::readObject(IBaseObject* context, IFunction* factoryCallback, IBaseObject** obj)
+{
+    OPENDAQ_PARAM_NOT_NULL(obj);
+
+    if (index >= array.size())
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_OUTOFRANGE);
+    }
+
+    return BinaryDeserializerImpl::Deserialize(document, array[index++], context, factoryCallback, obj);
+}
+
+ErrCode BinarySerializedList::readString(IString** obj)
+{
+    OPENDAQ_PARAM_NOT_NULL(obj);
+
+    if (index >= array.size())
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_OUTOFRANGE);
+    }
+
+    const auto& value = array[index];
+    if (value.tag == Tag::String)
+    {
+        ++index;
+        return createStringN(obj, value.string.data(), value.string.size());
+    }
+
+    if (value.tag == Tag::Null)
+    {
+        *obj = nullptr;
+        return OPENDAQ_SUCCESS;
+    }
+
+    return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
+}
+
+ErrCode BinarySerializedList::readBool(Bool* obj)
+{
+    OPENDAQ_PARAM_NOT_NULL(obj);
+
+    if (index >= array.size())
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_OUTOFRANGE);
+    }
+
+    const auto tag = array[index].tag;
+    if (tag == Tag::True || tag == Tag::False)
+    {
+        *obj = tag == Tag::True;
+        ++index;
+        return OPENDAQ_SUCCESS;
+    }
+
+    return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
+}
+
+ErrCode BinarySerializedList::readInt(Int* obj)
+{
+    OPENDAQ_PARAM_NOT_NULL(obj);
+
+    if (index >= array.size())
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_OUTOFRANGE);
+    }
+
+    if (array[index].tag == Tag::Int)
+    {
+        *obj = array[index++].intValue;
+        return OPENDAQ_SUCCESS;
+    }
+
+    return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
+}
+
+ErrCode BinarySerializedList::readFloat(Float* obj)
+{
+    OPENDAQ_PARAM_NOT_NULL(obj);
+
+    if (index >= array.size())
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_OUTOFRANGE);
+    }
+
+    if (array[index].tag == Tag::Float)
+    {
+        *obj = array[index++].floatValue;
+        return OPENDAQ_SUCCESS;
+    }
+
+    return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
+}
+
+ErrCode BinarySerializedList::getCount(SizeT* size)
+{
+    OPENDAQ_PARAM_NOT_NULL(size);
+
+    *size = array.size();
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedList::getCurrentItemType(CoreType* size)
+{
+    OPENDAQ_PARAM_NOT_NULL(size);
+
+    if (index >= array.size())
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_OUTOFRANGE);
+    }
+
+    *size = BinaryDeserializerImpl::GetCoreType(array[index]);
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedList::toString(CharPtr* str)
+{
+    OPENDAQ_PARAM_NOT_NULL(str);
+
+    return daqDuplicateCharPtr("BinarySerializedList", str);
+}
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,265 @@
+#include <coretypes/binary_serialized_object.h>
+#include <coretypes/coretypes.h>
+#include <coretypes/binary_serialized_list.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+using namespace binary_serialization;
+
+namespace
+{
+
+std::string_view toStringView(IString* key)
+{
+    ConstCharPtr str = nullptr;
+    SizeT length = 0;
+    key->getCharPtr(&str);
+    key->getLength(&length);
+
+    return str == nullptr ? std::string_view() : std::string_view(str, length);
+}
+
+void writeJson(const BinaryValue& value, rapidjson::Writer<rapidjson::StringBuffer>& writer)
+{
+    switch (value.tag)
+    {
+        case Tag::Null:
+            writer.Null();
+            break;
+        case Tag::False:
+            writer.Bool(false);
+            break;
+        case Tag::True:
+            writer.Bool(true);
+            break;
+        case Tag::Int:
+            writer.Int64(value.intValue);
+            break;
+        case Tag::Float:
+            writer.Double(value.floatValue);
+            break;
+        case Tag::String:
+            writer.String(value.string.data(), static_cast<rapidjson::SizeType>(value.string.size()));
+            break;
+        case Tag::List:
+            writer.StartArray();
+            for (const auto& item : value.items)
+                writeJson(item, writer);
+            writer.EndArray();
+            break;
+        case Tag::Object:
+            writer.StartObject();
+            for (size_t i = 0; i < value.items.size(); ++i)
+            {
+                writer.Key(value.memberNames[i].data(), static_cast<rapidjson::SizeType>(value.memberNames[i].size()));
+                writeJson(value.items[i], writer);
+            }
+            writer.EndObject();
+            break;
+        default:
+            break;
+    }
+}
+
+}
+
+BinarySerializedObject::BinarySerializedObject(BinaryDocumentPtr document, const BinaryValue* obj, bool isRoot)
+    : document(std::move(document))
+    , object(*obj)
+    , root(isRoot)
+{
+}
+
+ErrCode BinarySerializedObject::findMember(IString* key, const BinaryValue** value) const
+{
+    OPENDAQ_PARAM_NOT_NULL(key);
+
+    *value = object.findMember(toStringView(key));
+    if (*value == nullptr)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOTFOUND);
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedObject::readSerializedObject(IString* key, ISerializedObject** plainObj)
+{
+    OPENDAQ_PARAM_NOT_NULL(plainObj);
+
+    const BinaryValue* value;
+    ErrCode errCode = findMember(key, &value);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    if (value->tag != Tag::Object)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
+
+    return createObject<ISerializedObject, BinarySerializedObject>(plainObj, document, value);
+}
+
+ErrCode BinarySerializedObject::readSerializedList(IString* key, ISerializedList** list)
+{
+    OPENDAQ_PARAM_NOT_NULL(list);
+
+    const BinaryValue* value;
+    ErrCode errCode = findMember(key, &value);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    if (value->tag != Tag::List)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
+
+    return createObject<ISerializedList, BinarySerializedList>(list, document, value);
+}
+
+ErrCode BinarySerializedObject::readList(IString* key, IBaseObject* context, IFunction* factoryCallback, IList** list)
+{
+    OPENDAQ_PARAM_NOT_NULL(list);
+
+    const BinaryValue* value;
+    ErrCode errCode = findMember(key, &value);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    if (value->tag != Tag::List)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
+
+    return BinaryDeserializerImpl::Deserialize(document, *value, context, factoryCallback, reinterpret_cast<IBaseObject**>(list));
+}
+
+ErrCode BinarySerializedObject::readObject(IString* key, IBaseObject* context, IFunction* factoryCallback, IBaseObject** obj)
+{
+    OPENDAQ_PARAM_NOT_NULL(obj);
+
+    const BinaryValue* value;
+    ErrCode errCode = findMember(key, &value);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    return BinaryDeserializerImpl::Deserialize(document, *value, context, factoryCallback, obj);
+}
+
+ErrCode BinarySerializedObject::readString(IString* key, IString** string)
+{
+    OPENDAQ_PARAM_NOT_NULL(string);
+
+    const BinaryValue* value;
+    ErrCode errCode = findMember(key, &value);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    if (value->tag != Tag::String)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
+
+    return createStringN(string, value->string.data(), value->string.size());
+}
+
+ErrCode BinarySerializedObject::readBool(IString* key, Bool* boolean)
+{
+    OPENDAQ_PARAM_NOT_NULL(boolean);
+
+    const BinaryValue* value;
+    ErrCode errCode = findMember(key, &value);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    if (value->tag != Tag::True && value->tag != Tag::False)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
+
+    *boolean = value->tag == Tag::True;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedObject::readInt(IString* key, Int* integer)
+{
+    OPENDAQ_PARAM_NOT_NULL(integer);
+
+    const BinaryValue* value;
+    ErrCode errCode = findMember(key, &value);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    if (value->tag != Tag::Int)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
+
+    *integer = value->intValue;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedObject::readFloat(IString* key, Float* real)
+{
+    OPENDAQ_PARAM_NOT_NULL(real);
+
+    const BinaryValue* value;
+    ErrCode errCode = findMember(key, &value);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    if (value->tag != Tag::Float)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDTYPE);
+
+    *real = value->floatValue;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedObject::hasKey(IString* key, Bool* hasKey)
+{
+    OPENDAQ_PARAM_NOT_NULL(key);
+    OPENDAQ_PARAM_NOT_NULL(hasKey);
+
+    *hasKey = object.findMember(toStringView(key)) != nullptr;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedObject::getKeys(IList** list)
+{
+    OPENDAQ_PARAM_NOT_NULL(list);
+
+    ErrCode errCode = createList(list);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    for (const auto& name : object.memberNames)
+    {
+        IString* key;
+        errCode = createStringN(&key, name.data(), name.size());
+        OPENDAQ_RETURN_IF_FAILED(errCode);
+
+        errCode = (*list)->moveBack(key);
+        OPENDAQ_RETURN_IF_FAILED(errCode);
+    }
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedObject::getType(IString* key, CoreType* type)
+{
+    OPENDAQ_PARAM_NOT_NULL(type);
+
+    const BinaryValue* value;
+    ErrCode errCode = findMember(key, &value);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    *type = BinaryDeserializerImpl::GetCoreType(*value);
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedObject::isRoot(Bool* isRoot)
+{
+    OPENDAQ_PARAM_NOT_NULL(isRoot);
+
+    *isRoot = root;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializedObject::toJson(IString** jsonString)
+{
+    OPENDAQ_PARAM_NOT_NULL(jsonString);
+
+    rapidjson::StringBuffer sb;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+    writeJson(object, writer);
+
+    return createStringN(jsonString, sb.GetString(), sb.GetSize());
+}
+
+ErrCode BinarySerializedObject::toString(CharPtr* str)
+{
+    OPENDAQ_PARAM_NOT_NULL(str);
+
+    return daqDuplicateCharPtr("BinarySerializedObject", str);
+}
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,299 @@
+#include <coretypes/binary_serializer_impl.h>
+#include <coretypes/stringobject_factory.h>
+#include <cstring>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+using namespace binary_serialization;
+
+BinarySerializerImpl::BinarySerializerImpl()
+    : BinarySerializerImpl(3)
+{
+}
+
+BinarySerializerImpl::BinarySerializerImpl(Int version)
+    : depth(0)
+    , rootWritten(false)
+    , version(version)
+{
+    buffer.append(Magic, MagicSize);
+}
+
+void BinarySerializerImpl::writeTag(Tag tag)
+{
+    buffer.push_back(static_cast<char>(tag));
+}
+
+void BinarySerializerImpl::writeVarUInt(uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        buffer.push_back(static_cast<char>(static_cast<uint8_t>(value) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<char>(value));
+}
+
+void BinarySerializerImpl::writeInternedString(std::string_view string)
+{
+    const auto it = internedIndices.find(string);
+    if (it != internedIndices.end())
+    {
+        writeTag(Tag::StringRef);
+        writeVarUInt(it->second);
+        return;
+    }
+
+    writeTag(Tag::NewString);
+    writeVarUInt(string.size());
+    buffer.append(string.data(), string.size());
+
+    const auto& interned = internedStrings.emplace_back(string);
+    internedIndices.emplace(interned, internedIndices.size());
+}
+
+void BinarySerializerImpl::startValue()
+{
+    if (depth == 0)
+        rootWritten = true;
+}
+
+ErrCode BinarySerializerImpl::startTaggedObject(ISerializable* serializable)
+{
+    OPENDAQ_PARAM_NOT_NULL(serializable);
+
+    ConstCharPtr id;
+    ErrCode errCode = serializable->getSerializeId(&id);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    startValue();
+    writeTag(Tag::TaggedObject);
+    writeInternedString(id);
+    ++depth;
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::startObject()
+{
+    startValue();
+    writeTag(Tag::Object);
+    ++depth;
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::endObject()
+{
+    if (depth == 0)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE);
+
+    writeTag(Tag::End);
+    --depth;
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::startList()
+{
+    startValue();
+    writeTag(Tag::List);
+    ++depth;
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::endList()
+{
+    if (depth == 0)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE);
+
+    writeTag(Tag::End);
+    --depth;
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::keyRaw(ConstCharPtr string, SizeT length)
+{
+    OPENDAQ_PARAM_NOT_NULL(string);
+
+    if (length == 0)
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER);
+    }
+
+    writeInternedString(std::string_view(string, length));
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::key(ConstCharPtr string)
+{
+    OPENDAQ_PARAM_NOT_NULL(string);
+
+    return keyRaw(string, std::strlen(string));
+}
+
+ErrCode BinarySerializerImpl::keyStr(IString* name)
+{
+    OPENDAQ_PARAM_NOT_NULL(name);
+
+    ConstCharPtr str;
+    ErrCode errCode = name->getCharPtr(&str);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    SizeT length;
+    errCode = name->getLength(&length);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    return keyRaw(str, length);
+}
+
+ErrCode BinarySerializerImpl::writeInt(Int integer)
+{
+    startValue();
+    writeTag(Tag::Int);
+
+    // zig-zag encoding keeps small negative numbers short
+    const auto value = static_cast<uint64_t>(integer);
+    writeVarUInt((value << 1) ^ (integer < 0 ? ~uint64_t(0) : uint64_t(0)));
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::writeBool(Bool boolean)
+{
+    startValue();
+    writeTag(boolean ? Tag::True : Tag::False);
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::writeFloat(Float real)
+{
+    startValue();
+    writeTag(Tag::Float);
+
+    uint64_t bits;
+    std::memcpy(&bits, &real, sizeof(bits));
+    for (size_t i = 0; i < sizeof(bits); ++i)
+        buffer.push_back(static_cast<char>(bits >> (i * 8)));
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::writeString(ConstCharPtr string, SizeT length)
+{
+    if (length != 0)
+        OPENDAQ_PARAM_NOT_NULL(string);
+
+    startValue();
+    writeTag(Tag::String);
+    writeVarUInt(length);
+    if (length != 0)
+        buffer.append(string, length);
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::writeNull()
+{
+    startValue();
+    writeTag(Tag::Null);
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::reset()
+{
+    buffer.clear();
+    buffer.append(Magic, MagicSize);
+    internedIndices.clear();
+    internedStrings.clear();
+    depth = 0;
+    rootWritten = false;
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::isComplete(Bool* complete)
+{
+    OPENDAQ_PARAM_NOT_NULL(complete);
+
+    *complete = rootWritten && depth == 0;
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::getUser(IBaseObject** user)
+{
+    OPENDAQ_PARAM_NOT_NULL(user);
+
+    *user = this->userContext.addRefAndReturn();
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::setUser(IBaseObject* user)
+{
+    this->userContext = user;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::getVersion(Int* version)
+{
+    OPENDAQ_PARAM_NOT_NULL(version);
+
+    *version = this->version;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode BinarySerializerImpl::getOutput(IString** output)
+{
+    OPENDAQ_PARAM_NOT_NULL(output);
+
+    return createStringN(output, buffer.data(), buffer.size());
+}
+
+ErrCode BinarySerializerImpl::toString(CharPtr* str)
+{
+    OPENDAQ_PARAM_NOT_NULL(str);
+
+    return daqDuplicateCharPtr("BinarySerializer", str);
+}
+
+// createBinarySerializer
+extern "C"
+ErrCode PUBLIC_EXPORT createBinarySerializer(ISerializer** binarySerializer)
+{
+    OPENDAQ_PARAM_NOT_NULL(binarySerializer);
+
+    ISerializer* object = new(std::nothrow) BinarySerializerImpl();
+    if (!object)
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOMEMORY);
+    }
+
+    object->addRef();
+    *binarySerializer = object;
+    return OPENDAQ_SUCCESS;
+}
+
+// createBinarySerializerWithVersion
+extern "C"
+ErrCode PUBLIC_EXPORT createBinarySerializerWithVersion(ISerializer** binarySerializer, Int version)
+{
+    OPENDAQ_PARAM_NOT_NULL(binarySerializer);
+
+    ISerializer* object = new(std::nothrow) BinarySerializerImpl(version);
+    if (!object)
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOMEMORY);
+    }
+
+    object->addRef();
+    *binarySerializer = object;
+    return OPENDAQ_SUCCESS;
+}
+
+END_NAMESPACE_OPENDAQ
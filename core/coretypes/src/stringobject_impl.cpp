@@ -2,26 +2,42 @@
 #include <coretypes/errors.h>
 #include <coretypes/impl.h>
 #include <cstring>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
 
 BEGIN_NAMESPACE_OPENDAQ
 
 StringImpl::StringImpl(ConstCharPtr data, SizeT length)
-    : hashCode(0)
-    , hashCalculated(false)
+    : StringImpl(data, length, false)
+{
+}
+
+StringImpl::StringImpl(ConstCharPtr data, SizeT length, bool interned)
+    : heapStr(nullptr)
+    , hashCode(0)
     , length(length)
+    , isInline(data != nullptr && length < InlineCapacity)
+    , hashCalculated(false)
+    , interned(interned)
 {
     if (data == nullptr)
     {
-        this->str = nullptr;
         this->length = 0;
     }
     else
     {
-        this->str = new char[length + 1];
+        if (!isInline)
+            heapStr = new char[length + 1];
 
-        memcpy(this->str, data, length);
-        this->str[length] = '\0';
+        char* str = this->data();
+        memcpy(str, data, length);
+        str[length] = '\0';
     }
+
+    // interned strings are used as keys, so the hash code is calculated up front
+    if (interned)
+        calculateHashCode();
 }
 
 StringImpl::StringImpl(ConstCharPtr str)
@@ -31,36 +47,52 @@ StringImpl::StringImpl(ConstCharPtr str)
 
 StringImpl::~StringImpl()
 {
-    if (str != nullptr)
+    if (!isInline)
+        delete[] heapStr;
+}
+
+char* StringImpl::data()
+{
+    return isInline ? inlineStr : heapStr;
+}
+
+const char* StringImpl::data() const
+{
+    return isInline ? inlineStr : heapStr;
+}
+
+bool StringImpl::isInterned() const
+{
+    return interned;
+}
+
+void StringImpl::calculateHashCode()
+{
+    const char* str = data();
+    uint32_t h = 0, high;
+
+    for (SizeT i = 0; i < length; ++i)
     {
-        delete[] str;
-        str = nullptr;
+        h = (h << 4) + str[i];
+        if ((high = h & 0xF0000000))
+            h ^= high >> 24;
+        h &= ~high;
     }
+
+    hashCode = h;
+    hashCalculated = true;
 }
 
 ErrCode StringImpl::getHashCode(SizeT* hashCode)
 {
-    if (str == nullptr)
+    if (data() == nullptr)
     {
         *hashCode = 0;
         return OPENDAQ_SUCCESS;
     }
 
     if (!hashCalculated)
-    {
-        uint32_t h = 0, high;
-        char* s = str;
-
-        while (*s)
-        {
-            h = (h << 4) + *s++;
-            if ((high = h & 0xF0000000))
-                h ^= high >> 24;
-            h &= ~high;
-        }
-        this->hashCode = h;
-        hashCalculated = true;
-    }
+        calculateHashCode();
 
     *hashCode = this->hashCode;
     return OPENDAQ_SUCCESS;
@@ -84,6 +116,13 @@ ErrCode StringImpl::equals(IBaseObject* other, Bool* equal) const
 
     if (OPENDAQ_SUCCEEDED(other->borrowInterface(IString::Id, reinterpret_cast<void**>(&otherString))))
     {
+        // interned strings and copies of the same smart pointer
+        if (otherString == static_cast<const IString*>(this))
+        {
+            *equal = true;
+            return OPENDAQ_SUCCESS;
+        }
+
         SizeT otherLength;
         auto err = otherString->getLength(&otherLength);
         OPENDAQ_RETURN_IF_FAILED(err);
@@ -97,13 +136,14 @@ ErrCode StringImpl::equals(IBaseObject* other, Bool* equal) const
         err = otherString->getCharPtr(&otherValue);
         OPENDAQ_RETURN_IF_FAILED(err);
 
+        const char* str = data();
         if (otherValue == nullptr)
         {
             *equal = str == nullptr;
         }
         else
         {
-            *equal = strcmp(str, otherValue) == 0;
+            *equal = str != nullptr && memcmp(str, otherValue, length) == 0;
         }
     }
 
@@ -112,7 +152,7 @@ ErrCode StringImpl::equals(IBaseObject* other, Bool* equal) const
 
 ErrCode StringImpl::getCharPtr(ConstCharPtr* value)
 {
-    *value = str;
+    *value = data();
     return OPENDAQ_SUCCESS;
 }
 
@@ -126,14 +166,14 @@ ErrCode StringImpl::toString(CharPtr* str)
 {
     OPENDAQ_PARAM_NOT_NULL(str);
 
-    return daqDuplicateCharPtr(this->str, str);
+    return daqDuplicateCharPtr(data(), str);
 }
 
 ErrCode StringImpl::toFloat(Float* val)
 {
     try
     {
-        *val = std::stod(std::string(str));
+        *val = std::stod(std::string(data()));
         return OPENDAQ_SUCCESS;
     }
     catch (const std::exception& e)
@@ -146,7 +186,7 @@ ErrCode StringImpl::toInt(Int* val)
 {
     try
     {
-        *val = std::stoll(std::string(str));
+        *val = std::stoll(std::string(data()));
         return OPENDAQ_SUCCESS;
     }
     catch (const std::exception& e)
@@ -160,15 +200,15 @@ ErrCode StringImpl::toBool(Bool* val)
     if (length == 0)
         *val = False;
 #if defined(_WIN32)
-    else if (_stricmp("True", str) == 0)
+    else if (_stricmp("True", data()) == 0)
 #else
-    else if (strcasecmp("True", str) == 0)
+    else if (strcasecmp("True", data()) == 0)
 #endif
         *val = True;
 #if defined(_WIN32)
-    else if (_stricmp("False", str) == 0)
+    else if (_stricmp("False", data()) == 0)
 #else
-    else if (strcasecmp("False", str) == 0)
+    else if (strcasecmp("False", data()) == 0)
 #endif
         *val = False;
     else
@@ -216,7 +256,7 @@ ErrCode StringImpl::compareTo(IBaseObject* obj)
         OPENDAQ_RETURN_IF_FAILED(err);
     }
 
-    int r = strcmp(str, otherValue);
+    int r = strcmp(data(), otherValue);
     if (r > 0)
         err = OPENDAQ_GREATER;
     else if (r < 0)
@@ -241,11 +281,101 @@ ErrCode StringImpl::serialize(ISerializer* serializer)
     ErrCode errCode = getLength(&length);
     OPENDAQ_RETURN_IF_FAILED(errCode);
 
-    serializer->writeString(str, length);
+    serializer->writeString(data(), length);
 
     return OPENDAQ_SUCCESS;
 }
 
+namespace
+{
+
+// Interned strings are never released; the table is allocated once and never destroyed, so interned strings
+// stay valid during static destruction of other libraries.
+//
+// Property names also come from remote devices and deserialized objects, so the table is bounded. Long values and
+// values requested once the table is full get a regular, non-interned string; lookups with them take the slower
+// string comparison path but remain correct.
+class StringInternTable
+{
+public:
+    static constexpr SizeT MaxLength = 256;
+    static constexpr SizeT MaxCount = 65536;
+
+    IString* intern(ConstCharPtr data, SizeT length)
+    {
+        if (length > MaxLength)
+            return createNotInterned(data, length);
+
+        const std::string_view value(data, length);
+
+        {
+            std::shared_lock lock(sync);
+            if (const auto it = strings.find(value); it != strings.end())
+                return addRefAndReturn(it->second);
+        }
+
+        std::unique_lock lock(sync);
+        if (const auto it = strings.find(value); it != strings.end())
+            return addRefAndReturn(it->second);
+
+        if (strings.size() >= MaxCount)
+        {
+            lock.unlock();
+            return createNotInterned(data, length);
+        }
+
+        IString* str = new StringImpl(data, length, true);
+        str->addRef();
+
+        // interned strings outlive the objects using them and are not reported as leaks
+#ifndef NDEBUG
+        daqUntrackObject(str);
+#endif
+
+        ConstCharPtr internedData;
+        str->getCharPtr(&internedData);
+        strings.emplace(std::string_view(internedData, length), str);
+
+        return addRefAndReturn(str);
+    }
+
+private:
+    static IString* createNotInterned(ConstCharPtr data, SizeT length)
+    {
+        return addRefAndReturn(new StringImpl(data, length));
+    }
+
+    static IString* addRefAndReturn(IString* str)
+    {
+        str->addRef();
+        return str;
+    }
+
+    std::shared_mutex sync;
+    std::unordered_map<std::string_view, IString*> strings;
+};
+
+StringInternTable& getStringInternTable()
+{
+    static auto* table = new StringInternTable();
+    return *table;
+}
+
+}
+
+extern "C"
+ErrCode PUBLIC_EXPORT createInternedString(IString** obj, ConstCharPtr str, SizeT length)
+{
+    OPENDAQ_PARAM_NOT_NULL(obj);
+    OPENDAQ_PARAM_NOT_NULL(str);
+
+    return daqTry([&]
+    {
+        *obj = getStringInternTable().intern(str, length);
+        return OPENDAQ_SUCCESS;
+    });
+}
+
 OPENDAQ_DEFINE_CLASS_FACTORY(LIBRARY_FACTORY, String, ConstCharPtr, str)
 OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC_OBJ(
     LIBRARY_FACTORY, StringImpl, IString, createStringN,
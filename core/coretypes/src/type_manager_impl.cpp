@@ -5,10 +5,13 @@
 #include <coretypes/type_ptr.h>
 #include <cctype>
 #include <algorithm>
+#include <atomic>
 #include <coretypes/coretype_utils.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
+static std::atomic<uint64_t> typeManagerRevision{0};
+
 TypeManagerImpl::TypeManagerImpl()
     : types(Dict<IString, IType>())
     , reservedTypeNames({"argumentinfo",
@@ -57,6 +60,7 @@ ErrCode TypeManagerImpl::addType(IType* type)
 
         const ErrCode err = types->set(typeName, typePtr);
         OPENDAQ_RETURN_IF_FAILED(err);
+        typeManagerRevision.fetch_add(1, std::memory_order_acq_rel);
     }
 
     const ErrCode errCode = daqTry([&]
@@ -82,6 +86,7 @@ ErrCode TypeManagerImpl::removeType(IString* name)
         BaseObjectPtr obj;
         const ErrCode err = types->remove(name, &obj);
         OPENDAQ_RETURN_IF_FAILED(err);
+        typeManagerRevision.fetch_add(1, std::memory_order_acq_rel);
     }
 
     const ErrCode errCode = daqTry([&]
@@ -200,4 +205,10 @@ ErrCode TypeManagerImpl::Deserialize(ISerializedObject* ser, IBaseObject* /*cont
 
 OPENDAQ_DEFINE_CLASS_FACTORY(LIBRARY_FACTORY, TypeManager)
 
+extern "C"
+uint64_t PUBLIC_EXPORT daqGetTypeManagerRevision()
+{
+    return typeManagerRevision.load(std::memory_order_acquire);
+}
+
 END_NAMESPACE_OPENDAQ
@@ -0,0 +1,246 @@
+#include <testutils/testutils.h>
+#include <limits>
+#include <cmath>
+#include <coretypes/coretypes.h>
+
+using namespace daq;
+
+class BinarySerializerTest : public testing::Test
+{
+protected:
+    BaseObjectPtr roundTrip(const BaseObjectPtr& object) const
+    {
+        const auto serializer = BinarySerializer();
+        object.serialize(serializer);
+
+        const StringPtr serialized = serializer.getOutput();
+        return BinaryDeserializer().deserialize(serialized);
+    }
+
+    static StringPtr serialize(const SerializerPtr& serializer, const BaseObjectPtr& object)
+    {
+        object.serialize(serializer);
+        return serializer.getOutput();
+    }
+};
+
+TEST_F(BinarySerializerTest, Bool)
+{
+    ASSERT_EQ(roundTrip(True), True);
+    ASSERT_EQ(roundTrip(False), False);
+}
+
+TEST_F(BinarySerializerTest, Int)
+{
+    for (const Int value : {Int(0), Int(1), Int(-1), Int(63), Int(-64), Int(1) << 40, std::numeric_limits<Int>::min(), std::numeric_limits<Int>::max()})
+    {
+        const IntegerPtr deserialized = roundTrip(value);
+        ASSERT_EQ(deserialized, value);
+    }
+}
+
+TEST_F(BinarySerializerTest, Float)
+{
+    for (const Float value : {0.0, -1.5, std::numeric_limits<Float>::min(), std::numeric_limits<Float>::max()})
+    {
+        const FloatPtr deserialized = roundTrip(value);
+        ASSERT_EQ(deserialized, value);
+    }
+
+    const FloatPtr nan = roundTrip(std::numeric_limits<Float>::quiet_NaN());
+    ASSERT_TRUE(std::isnan(static_cast<Float>(nan)));
+}
+
+TEST_F(BinarySerializerTest, String)
+{
+    const StringPtr deserialized = roundTrip(String("Hello world"));
+    ASSERT_EQ(deserialized, "Hello world");
+
+    const StringPtr empty = roundTrip(String(""));
+    ASSERT_EQ(empty, "");
+}
+
+TEST_F(BinarySerializerTest, StringWithEmbeddedNull)
+{
+    const std::string value("a\0b", 3);
+
+    const StringPtr deserialized = roundTrip(String(value.data(), value.size()));
+    ASSERT_EQ(deserialized.getLength(), 3u);
+    ASSERT_EQ(std::string(deserialized.getCharPtr(), deserialized.getLength()), value);
+}
+
+TEST_F(BinarySerializerTest, NestedList)
+{
+    auto inner = List<IBaseObject>(1, "two", 3.0);
+    auto list = List<IBaseObject>(True, inner, List<IBaseObject>());
+
+    const ListPtr<IBaseObject> deserialized = roundTrip(list);
+    ASSERT_EQ(deserialized.getCount(), 3u);
+    ASSERT_EQ(deserialized[0], True);
+
+    const ListPtr<IBaseObject> deserializedInner = deserialized[1];
+    ASSERT_EQ(deserializedInner.getCount(), 3u);
+    ASSERT_EQ(deserializedInner[0], 1);
+    ASSERT_EQ(deserializedInner[1], "two");
+    ASSERT_EQ(deserializedInner[2], 3.0);
+
+    const ListPtr<IBaseObject> empty = deserialized[2];
+    ASSERT_EQ(empty.getCount(), 0u);
+}
+
+TEST_F(BinarySerializerTest, TaggedObjects)
+{
+    auto dict = Dict<IString, IBaseObject>();
+    dict.set("Ratio", Ratio(1, 1000));
+    dict.set("Values", List<IInteger>(1, 2, 3));
+    dict.set("Nested", Dict<IString, IBaseObject>({{"Key", "Value"}}));
+
+    const DictPtr<IString, IBaseObject> deserialized = roundTrip(dict);
+    ASSERT_EQ(deserialized.getCount(), 3u);
+    ASSERT_EQ(deserialized.get("Ratio"), Ratio(1, 1000));
+    ASSERT_EQ(deserialized.get("Values"), List<IInteger>(1, 2, 3));
+
+    const DictPtr<IString, IBaseObject> nested = deserialized.get("Nested");
+    ASSERT_EQ(nested.get("Key"), "Value");
+}
+
+TEST_F(BinarySerializerTest, KeysAreInterned)
+{
+    auto list = List<IRatio>();
+    for (Int i = 0; i < 100; ++i)
+        list.pushBack(Ratio(i + 1, 1000));
+
+    const StringPtr binary = serialize(BinarySerializer(), list);
+    const StringPtr json = serialize(JsonSerializer(), list);
+
+    ASSERT_LT(binary.getLength() * 3, json.getLength());
+
+    const std::string output(binary.getCharPtr(), binary.getLength());
+    ASSERT_EQ(output.find("den"), output.rfind("den"));
+}
+
+TEST_F(BinarySerializerTest, SameResultAsJson)
+{
+    auto dict = Dict<IString, IBaseObject>();
+    dict.set("Int", -42);
+    dict.set("Float", 0.25);
+    dict.set("Bool", True);
+    dict.set("String", "text");
+    dict.set("List", List<IBaseObject>(Ratio(1, 2), nullptr, "x"));
+
+    const auto fromBinary = BinaryDeserializer().deserialize(serialize(BinarySerializer(), dict));
+    const auto fromJson = JsonDeserializer().deserialize(serialize(JsonSerializer(), dict));
+
+    ASSERT_EQ(fromBinary, fromJson);
+}
+
+TEST_F(BinarySerializerTest, SerializedObject)
+{
+    const auto serializer = BinarySerializer();
+    serializer.startTaggedObject(Ratio(1, 2).asPtr<ISerializable>());
+    serializer.key("Int");
+    serializer.writeInt(5);
+    serializer.key("Float");
+    serializer.writeFloat(1.5);
+    serializer.key("Bool");
+    serializer.writeBool(True);
+    serializer.key("String");
+    serializer.writeString("abc");
+    serializer.key("Null");
+    serializer.writeNull();
+    serializer.key("List");
+    serializer.startList();
+    serializer.writeInt(1);
+    serializer.writeString("two");
+    serializer.startObject();
+    serializer.key("Int");
+    serializer.writeInt(3);
+    serializer.endObject();
+    serializer.endList();
+    serializer.endObject();
+    ASSERT_TRUE(serializer.isComplete());
+
+    SerializedObjectPtr serializedObject;
+    BinaryDeserializer().callCustomProc([&serializedObject](const SerializedObjectPtr& obj) { serializedObject = obj; },
+                                        serializer.getOutput());
+
+    // the serialized object keeps the parsed document alive
+    ASSERT_TRUE(serializedObject.isRoot());
+    ASSERT_EQ(serializedObject.getKeys(), List<IString>("__type", "Int", "Float", "Bool", "String", "Null", "List"));
+    ASSERT_EQ(serializedObject.readString("__type"), "Ratio");
+    ASSERT_EQ(serializedObject.readInt("Int"), 5);
+    ASSERT_EQ(serializedObject.readFloat("Float"), 1.5);
+    ASSERT_TRUE(serializedObject.readBool("Bool"));
+    ASSERT_EQ(serializedObject.readString("String"), "abc");
+    ASSERT_FALSE(serializedObject.readObject("Null").assigned());
+    ASSERT_TRUE(serializedObject.hasKey("List"));
+    ASSERT_FALSE(serializedObject.hasKey("Missing"));
+    ASSERT_EQ(serializedObject.getType("List"), ctList);
+    ASSERT_EQ(serializedObject.getType("Null"), ctObject);
+    ASSERT_THROW(serializedObject.readInt("Float"), InvalidTypeException);
+    ASSERT_THROW(serializedObject.readInt("Missing"), NotFoundException);
+
+    const auto serializedList = serializedObject.readSerializedList("List");
+    ASSERT_EQ(serializedList.getCount(), 3u);
+    ASSERT_EQ(serializedList.getCurrentItemType(), ctInt);
+    ASSERT_EQ(serializedList.readInt(), 1);
+    ASSERT_EQ(serializedList.readString(), "two");
+    ASSERT_EQ(serializedList.readSerializedObject().readInt("Int"), 3);
+    ASSERT_THROW(serializedList.readInt(), OutOfRangeException);
+
+    ASSERT_EQ(serializedObject.toJson(),
+              R"({"__type":"Ratio","Int":5,"Float":1.5,"Bool":true,"String":"abc","Null":null,"List":[1,"two",{"Int":3}]})");
+}
+
+TEST_F(BinarySerializerTest, Reset)
+{
+    const auto serializer = BinarySerializer();
+    ASSERT_FALSE(serializer.isComplete());
+
+    serializer.startList();
+    ASSERT_FALSE(serializer.isComplete());
+    serializer.writeInt(1);
+    serializer.endList();
+    ASSERT_TRUE(serializer.isComplete());
+
+    serializer.reset();
+    ASSERT_FALSE(serializer.isComplete());
+    serializer.writeString("value");
+
+    ASSERT_EQ(BinaryDeserializer().deserialize(serializer.getOutput()), "value");
+}
+
+TEST_F(BinarySerializerTest, EmptyKey)
+{
+    const auto serializer = BinarySerializer();
+    serializer.startObject();
+    ASSERT_THROW(serializer.key(""), InvalidParameterException);
+}
+
+TEST_F(BinarySerializerTest, InvalidInput)
+{
+    const auto deserializer = BinaryDeserializer();
+
+    ASSERT_THROW(deserializer.deserialize("[1, 2, 3]"), DeserializeException);
+
+    const StringPtr serialized = serialize(BinarySerializer(), List<IBaseObject>(1, "text", Ratio(1, 3)));
+    for (SizeT length = 0; length < serialized.getLength(); ++length)
+        ASSERT_THROW(deserializer.deserialize(String(serialized.getCharPtr(), length)), DeserializeException);
+
+    std::string trailing(serialized.getCharPtr(), serialized.getLength());
+    trailing.push_back('\0');
+    ASSERT_THROW(deserializer.deserialize(String(trailing.data(), trailing.size())), DeserializeException);
+}
+
+TEST_F(BinarySerializerTest, IsBinarySerialized)
+{
+    ASSERT_TRUE(IsBinarySerialized(serialize(BinarySerializer(), Int(1))));
+    ASSERT_FALSE(IsBinarySerialized(serialize(JsonSerializer(), Int(1))));
+    ASSERT_FALSE(IsBinarySerialized(nullptr));
+}
+
+TEST_F(BinarySerializerTest, Version)
+{
+    ASSERT_EQ(BinarySerializer().getVersion(), 3);
+    ASSERT_EQ(BinarySerializerWithVersion(2).getVersion(), 2);
+}
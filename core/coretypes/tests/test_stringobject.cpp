@@ -223,6 +223,77 @@ TEST_F(StringObjectTest, ImplementationName)
     ASSERT_EQ(className, "daq::StringImpl");
 }
 
+TEST_F(StringObjectTest, LongString)
+{
+    const std::string value(1000, 'x');
+    const auto str = String(value);
+
+    ASSERT_EQ(str.getLength(), value.size());
+    ASSERT_EQ(str.toStdString(), value);
+    ASSERT_EQ(str, String(value));
+    ASSERT_NE(str, String(std::string(999, 'x') + "y"));
+}
+
+TEST_F(StringObjectTest, InlineCapacityBoundary)
+{
+    for (SizeT length = 20; length < 28; ++length)
+    {
+        const std::string value(length, 'b');
+        const auto str = String(value);
+
+        ASSERT_EQ(str.getLength(), length);
+        ASSERT_EQ(str.toStdString(), value);
+        ASSERT_EQ(str, String(value));
+        ASSERT_EQ(str.getHashCode(), String(value).getHashCode());
+    }
+}
+
+TEST_F(StringObjectTest, EmbeddedNull)
+{
+    const auto str1 = String("a\0b", 3);
+    const auto str2 = String("a\0c", 3);
+
+    ASSERT_EQ(str1.getLength(), 3u);
+    ASSERT_NE(str1, str2);
+    ASSERT_EQ(str1, String("a\0b", 3));
+}
+
+TEST_F(StringObjectTest, Interned)
+{
+    const auto str1 = InternedString("InternedValue");
+    const auto str2 = InternedString(String("InternedValue"));
+    const auto str3 = InternedString(std::string(100, 'i'));
+
+    ASSERT_EQ(str1.getObject(), str2.getObject());
+    ASSERT_NE(str1.getObject(), str3.getObject());
+    ASSERT_EQ(str3.getObject(), InternedString(std::string(100, 'i')).getObject());
+
+    ASSERT_EQ(str1, String("InternedValue"));
+    ASSERT_EQ(str1.getHashCode(), String("InternedValue").getHashCode());
+    ASSERT_EQ(str3.getHashCode(), String(std::string(100, 'i')).getHashCode());
+}
+
+TEST_F(StringObjectTest, InternedLongValueNotInterned)
+{
+    const std::string value(1000, 'l');
+    const auto str1 = InternedString(value);
+    const auto str2 = InternedString(value);
+
+    ASSERT_NE(str1.getObject(), str2.getObject());
+    ASSERT_EQ(str1, str2);
+    ASSERT_EQ(str1.getHashCode(), str2.getHashCode());
+    ASSERT_EQ(str1.toStdString(), value);
+}
+
+TEST_F(StringObjectTest, InternedNotTracked)
+{
+    const auto count = daqGetTrackedObjectCount();
+    const auto str = InternedString("InternedNotTracked");
+
+    ASSERT_EQ(daqGetTrackedObjectCount(), count);
+    ASSERT_EQ(str, "InternedNotTracked");
+}
+
 static constexpr auto INTERFACE_ID = FromTemplatedTypeName("IString", "daq");
 
 TEST_F(StringObjectTest, InterfaceId)
@@ -86,6 +86,8 @@ protected:
     FunctionBlockTypePtr type;
     LoggerComponentPtr loggerComponent;
     FolderConfigPtr inputPorts;
+    // scheduler execution domain of input ports created with createAndAddInputPort; default thread-pool if not assigned
+    StringPtr inputPortSchedulerDomain;
 
     InputPortConfigPtr createAndAddInputPort(const std::string& localId,
                                              PacketReadyNotification notificationMethod,
@@ -481,6 +483,8 @@ InputPortConfigPtr FunctionBlockImpl<TInterface, Interfaces...>::createAndAddInp
     inputPort.setListener(this->template borrowPtr<InputPortNotificationsPtr>());
     inputPort.setNotificationMethod(notificationMethod);
     inputPort.setCustomData(customData);
+    if (inputPortSchedulerDomain.assigned())
+        inputPort.setSchedulerDomain(inputPortSchedulerDomain);
 
     if (permissions.assigned())
         inputPort.getPermissionManager().setPermissions(permissions);
@@ -53,7 +53,16 @@ struct MockInputPort : daq::MockGenericComponent<MockInputPort, daq::IInputPortC
 
     MOCK_METHOD(daq::ErrCode, getGapCheckingEnabled, (daq::Bool* gapCheckingEnabled), (override MOCK_CALL));
 
+    MOCK_METHOD(daq::ErrCode, setPacketQueueMode, (daq::PacketQueueMode mode), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, getPacketQueueMode, (daq::PacketQueueMode* mode), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, setPacketQueueCapacity, (daq::SizeT capacity), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, getPacketQueueCapacity, (daq::SizeT* capacity), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, setSchedulerDomain, (daq::IString* domain), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, getSchedulerDomain, (daq::IString** domain), (override MOCK_CALL));
+
     daq::Bool active = true;
+    daq::PacketQueueMode packetQueueMode = daq::PacketQueueMode::Locked;
+    daq::SizeT packetQueueCapacity = 1024;
 
     MockInputPort()
     {
@@ -64,5 +73,13 @@ struct MockInputPort : daq::MockGenericComponent<MockInputPort, daq::IInputPortC
         EXPECT_CALL(*this, getActive)
             .Times(AnyNumber())
             .WillRepeatedly(DoAll(Invoke([&](daq::Bool* active) { *active = this->active; }), Return(OPENDAQ_SUCCESS)));
+
+        EXPECT_CALL(*this, getPacketQueueMode)
+            .Times(AnyNumber())
+            .WillRepeatedly(DoAll(Invoke([&](daq::PacketQueueMode* mode) { *mode = this->packetQueueMode; }), Return(OPENDAQ_SUCCESS)));
+
+        EXPECT_CALL(*this, getPacketQueueCapacity)
+            .Times(AnyNumber())
+            .WillRepeatedly(DoAll(Invoke([&](daq::SizeT* capacity) { *capacity = this->packetQueueCapacity; }), Return(OPENDAQ_SUCCESS)));
     }
 };
@@ -41,4 +41,11 @@ struct MockScheduler : daq::ImplementationOf<daq::IScheduler>
     MOCK_METHOD(daq::ErrCode, stopMainLoop, (), (override MOCK_CALL));
     MOCK_METHOD(daq::ErrCode, runMainLoopIteration, (), (override MOCK_CALL));
     MOCK_METHOD(daq::ErrCode, scheduleWorkOnMainLoop, (daq::IWork* work), (override MOCK_CALL));
+
+    MOCK_METHOD(daq::ErrCode, addExecutionDomain, (daq::IString* name, daq::SizeT numWorkers, daq::ExecutionPriority priority, daq::IList* cpuCores), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, scheduleWorkOnDomain, (daq::IString* domain, daq::IWork* work), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, getExecutionDomainNames, (daq::IList** names), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, getExecutionDomainStatistics, (daq::IString* domain, daq::IDict** statistics), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, setExecutionDomainStatisticsEnabled, (daq::Bool enabled), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, getExecutionDomainStatisticsEnabled, (daq::Bool* enabled), (override MOCK_CALL));
 };
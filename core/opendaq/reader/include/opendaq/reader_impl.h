@@ -520,15 +520,15 @@ protected:
         return false;
     }
 
-    void* getValuePacketData(const DataPacketPtr& packet) const
+    ErrCode readValuePacketData(const DataPacketPtr& packet, SizeT offset, void** outputBuffer, SizeT count) const
     {
         switch (readMode)
         {
             case ReadMode::Unscaled:
             case ReadMode::RawValue:
-                return packet.getRawData();
+                return valueReader->readData(packet.getRawData(), offset, outputBuffer, count);
             case ReadMode::Scaled:
-                return packet.getData();
+                return valueReader->readScaledData(packet, offset, outputBuffer, count);
         }
 
         DAQ_THROW_EXCEPTION(InvalidOperationException, 
@@ -19,6 +19,7 @@
 #include <opendaq/sample_type_traits.h>
 
 #include <date/date.h>
+#include <algorithm>
 #include <chrono>
 #include <ostream>
 
@@ -159,6 +160,24 @@ namespace reader
         return static_cast<int64_t>(sampleRate);
     }
 
+    /*!
+     * @brief Returns the index of the first explicit domain value that is at or after the start, or `count` if there is none.
+     * Domain values are expected to be non-decreasing, so a domain with one value per sample is bisected. For
+     * non-monotonic values the result is a boundary where the preceding value is before the start, but not necessarily
+     * the first such boundary in the packet.
+     */
+    template <typename T, typename Predicate>
+    SizeT findDomainValueAtOrAfter(const T* values, SizeT count, SizeT valuesPerSample, Predicate isAtOrAfterStart)
+    {
+        if (valuesPerSample == 1)
+        {
+            const T* found = std::partition_point(values, values + count, [&isAtOrAfterStart](const T& value) { return !isAtOrAfterStart(value); });
+            return static_cast<SizeT>(found - values);
+        }
+
+        return static_cast<SizeT>(std::find_if(values, values + count, isAtOrAfterStart) - values);
+    }
+
     inline int setEnvironmentVariable(const std::string& variable)
     {
 #if defined(_MSC_VER)
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <coretypes/common.h>
+#include <cstdint>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace reader
+{
+    // Vectorized conversions of integer and floating point samples to floating point. The instruction set
+    // (SSE2, AVX2 or AVX-512) is selected at runtime on first use; on other architectures a scalar loop is used.
+    // The results are identical to `static_cast` of each value.
+    //
+    // 64-bit integers are only converted with vector instructions on AVX-512 DQ, which adds the 64-bit
+    // integer conversions. The other pairs use the scalar template below:
+    // - UInt32, Int64 and UInt64 to Float32: without AVX-512 the value can not be converted with a single rounding,
+    //   so the result could differ from `static_cast`;
+    // - floating point to integer: out-of-range and NaN values convert to different values than the scalar loop
+    //   gives on non-x86 builds;
+    // - integer to integer and same-type reads: compilers already vectorize the scalar loop, and same-type reads
+    //   are copied without conversion.
+
+    void convertSampleValues(const int8_t* src, double* dst, SizeT count);
+    void convertSampleValues(const uint8_t* src, double* dst, SizeT count);
+    void convertSampleValues(const int16_t* src, double* dst, SizeT count);
+    void convertSampleValues(const uint16_t* src, double* dst, SizeT count);
+    void convertSampleValues(const int32_t* src, double* dst, SizeT count);
+    void convertSampleValues(const uint32_t* src, double* dst, SizeT count);
+    void convertSampleValues(const int64_t* src, double* dst, SizeT count);
+    void convertSampleValues(const uint64_t* src, double* dst, SizeT count);
+    void convertSampleValues(const float* src, double* dst, SizeT count);
+    void convertSampleValues(const int8_t* src, float* dst, SizeT count);
+    void convertSampleValues(const uint8_t* src, float* dst, SizeT count);
+    void convertSampleValues(const int16_t* src, float* dst, SizeT count);
+    void convertSampleValues(const uint16_t* src, float* dst, SizeT count);
+    void convertSampleValues(const int32_t* src, float* dst, SizeT count);
+    void convertSampleValues(const double* src, float* dst, SizeT count);
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4244)
+#endif
+
+    // All other pairs
+    template <typename TFrom, typename TTo>
+    void convertSampleValues(const TFrom* src, TTo* dst, SizeT count)
+    {
+        for (SizeT i = 0; i < count; ++i)
+            dst[i] = static_cast<TTo>(src[i]);  // C4244 - possible data loss due to conversion
+    }
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+}
+
+END_NAMESPACE_OPENDAQ
@@ -89,7 +89,7 @@ struct SignalReader
     ErrCode readPacketData();
     ErrCode handlePacket(const PacketPtr& packet, bool& firstData);
 
-    void* getValuePacketData(const DataPacketPtr& packet) const;
+    ErrCode readValuePacketData(const DataPacketPtr& packet, SizeT offset, void** outputBuffer, SizeT count) const;
 
     bool isSynced() const;
     StringPtr getComponentGlobalId() const;
@@ -106,7 +106,7 @@ private:
     [[nodiscard]]
     bool trySetDomainSampleType(const daq::DataPacketPtr& domainPacket);
 
-    void* getValuePacketData(const DataPacketPtr& packet) const;
+    ErrCode readValuePacketData(const DataPacketPtr& packet, SizeT offset, void** outputBuffer, SizeT count) const;
     ReaderStatusPtr readPackets();
     ErrCode readPacketData();
 
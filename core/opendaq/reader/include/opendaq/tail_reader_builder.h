@@ -130,6 +130,21 @@ DECLARE_OPENDAQ_INTERFACE(ITailReaderBuilder, IBaseObject)
      * @param[out] skipEvents The skip events
      */
     virtual ErrCode INTERFACE_FUNC getSkipEvents(Bool* skipEvents) = 0;
+
+    // [returnSelf]
+    /*!
+     * @brief Sets whether the reader keeps its history in a preallocated sample buffer.
+     * @param useSampleBuffer If true, samples are converted to the read types as packets arrive and copied into a
+     * circular buffer of `historySize` samples. Packets are released immediately and a read copies at most two
+     * contiguous ranges. Requires fixed-size value and domain read types.
+     */
+    virtual ErrCode INTERFACE_FUNC setUseSampleBuffer(Bool useSampleBuffer) = 0;
+
+    /*!
+     * @brief Gets whether the reader keeps its history in a preallocated sample buffer.
+     * @param[out] useSampleBuffer True if the sample buffer is used.
+     */
+    virtual ErrCode INTERFACE_FUNC getUseSampleBuffer(Bool* useSampleBuffer) = 0;
 };
 
 OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(LIBRARY_FACTORY, TailReaderBuilder, ITailReaderBuilder)
@@ -48,6 +48,9 @@ public:
     ErrCode INTERFACE_FUNC setSkipEvents(Bool skipEvents) override;
     ErrCode INTERFACE_FUNC getSkipEvents(Bool* skipEvents) override;
 
+    ErrCode INTERFACE_FUNC setUseSampleBuffer(Bool useSampleBuffer) override;
+    ErrCode INTERFACE_FUNC getUseSampleBuffer(Bool* useSampleBuffer) override;
+
 private:
     SampleType valueReadType;
     SampleType domainReadType;
@@ -57,6 +60,7 @@ private:
     SizeT historySize;
     bool used;
     bool skipEvents;
+    bool useSampleBuffer;
 };
 
 END_NAMESPACE_OPENDAQ
\ No newline at end of file
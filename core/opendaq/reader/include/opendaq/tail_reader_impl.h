@@ -22,6 +22,7 @@
 #include <opendaq/tail_reader_builder_ptr.h>
 
 #include <deque>
+#include <vector>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -39,14 +40,16 @@ public:
                    SampleType valueReadType,
                    SampleType domainReadType,
                    ReadMode mode,
-                   Bool skipEvents = false);
+                   Bool skipEvents = false,
+                   Bool useSampleBuffer = false);
 
     TailReaderImpl(IInputPortConfig* port,
                    SizeT historySize,
                    SampleType valueReadType,
                    SampleType domainReadType,
                    ReadMode mode,
-                   Bool skipEvents = false);
+                   Bool skipEvents = false,
+                   Bool useSampleBuffer = false);
 
     TailReaderImpl(const ReaderConfigPtr& readerConfig,
                    SampleType valueReadType,
@@ -74,11 +77,35 @@ private:
     ErrCode readPacket(TailReaderInfo& info, const DataPacketPtr& packet);
     TailReaderStatusPtr readData(TailReaderInfo& info);
 
+    void resetSampleBuffer();
+    void writeToSampleBuffer(const DataPacketPtr& dataPacket);
+    TailReaderStatusPtr readFromSampleBuffer(TailReaderInfo& info);
+    NumberPtr getSampleBufferOffset(SizeT sampleIndex) const;
+
 private:
+    // Domain offset of a run of samples whose domain values follow a linear rule
+    struct SampleBufferSegment
+    {
+        SizeT firstSample;
+        Int offset;
+        Int delta;
+    };
+
     SizeT historySize;
 
     SizeT cachedSamples;
     std::deque<PacketPtr> packets;
+
+    // With the sample buffer, only event packets are kept in `packets` and the samples are stored
+    // converted in circular buffers of `historySize` samples, indexed by the number of received samples.
+    bool useSampleBuffer;
+    std::vector<uint8_t> valueBuffer;
+    std::vector<uint8_t> domainBuffer;
+    SizeT valueSampleSize{};
+    SizeT domainSampleSize{};
+    SizeT receivedSamples{};
+    SizeT firstDomainSample{};
+    std::deque<SampleBufferSegment> segments;
 };
 
 END_NAMESPACE_OPENDAQ
@@ -32,6 +32,11 @@ public:
     virtual ~Reader() = default;
 
     virtual ErrCode readData(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT count) = 0;
+
+    /*!
+     * @brief Reads the post-scaled values of the packet. By default reads the packet's scaled data buffer.
+     */
+    virtual ErrCode readScaledData(const DataPacketPtr& packet, SizeT offset, void** outputBuffer, SizeT count);
     virtual std::unique_ptr<Comparable> readStart(void* inputBuffer, SizeT offset, const ReaderDomainInfo& domainInfo) = 0;
     virtual std::unique_ptr<Comparable> readStartLinear(const DataPacketPtr& packet, SizeT offset, const ReaderDomainInfo& domainInfo) = 0;
 
@@ -49,6 +54,11 @@ public:
     [[nodiscard]] virtual bool isUndefined() const noexcept;
     [[nodiscard]] virtual SampleType getReadType() const noexcept = 0;
 
+    /*!
+     * @brief Gets the number of read type values written for each sample, the size of a one-dimensional sample descriptor.
+     */
+    [[nodiscard]] virtual SizeT getValuesPerSample() const noexcept;
+
     FunctionPtr getTransformFunction() const;
     void setTransformFunction(FunctionPtr transform);
 
@@ -122,6 +132,12 @@ public:
     using Reader::Reader;
 
     virtual ErrCode readData(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT count) override;
+
+    /*!
+     * @brief Applies linear post-scaling straight into the output buffer when the scaled sample type is
+     * the read type, skipping the packet's intermediate scaled data buffer.
+     */
+    virtual ErrCode readScaledData(const DataPacketPtr& packet, SizeT offset, void** outputBuffer, SizeT count) override;
     virtual std::unique_ptr<Comparable> readStart(void* inputBuffer, SizeT offset, const ReaderDomainInfo& domainInfo) override;
 
     virtual std::unique_ptr<Comparable> readStartLinear(const DataPacketPtr& packet,
@@ -149,6 +165,8 @@ public:
 
     virtual SampleType getReadType() const noexcept override;
 
+    virtual SizeT getValuesPerSample() const noexcept override;
+
 private:
     template <typename TDataType>
     ErrCode readValues(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT toRead) const;
@@ -174,6 +192,8 @@ private:
     SizeT valuesPerSample{1};
 
     SizeT rawSampleSize{0};
+
+    bool scaleDirectly{false};
 };
 
 std::unique_ptr<Reader> createReaderForType(SampleType readType, const FunctionPtr& transformFunction);
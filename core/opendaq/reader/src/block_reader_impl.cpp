@@ -246,8 +246,7 @@ ErrCode BlockReaderImpl::readPacketData()
     auto blockRemainingSampleCount = blockSize - info.writtenSampleCount % blockSize;
     SizeT sampleCountToRead = std::min(blockRemainingSampleCount, packetRemainingSampleCount);
 
-    auto* packetData = getValuePacketData(*info.currentDataPacketIter);
-    ErrCode errCode = valueReader->readData(packetData, info.prevSampleIndex, &info.values, sampleCountToRead);
+    ErrCode errCode = readValuePacketData(*info.currentDataPacketIter, info.prevSampleIndex, &info.values, sampleCountToRead);
     OPENDAQ_RETURN_IF_FAILED(errCode);
 
     if (info.domainValues != nullptr)
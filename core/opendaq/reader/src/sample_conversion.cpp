@@ -0,0 +1,660 @@
+#include <opendaq/sample_conversion.h>
+#include <opendaq/simd_level.h>
+
+#if defined(DAQ_SIMD_X86)
+    #include <immintrin.h>
+#endif
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace reader
+{
+
+namespace
+{
+
+template <typename TFrom, typename TTo>
+void convertScalar(const TFrom* src, TTo* dst, SizeT count)
+{
+    for (SizeT i = 0; i < count; ++i)
+        dst[i] = static_cast<TTo>(src[i]);
+}
+
+template <typename TFrom, typename TTo>
+using ConversionKernel = void (*)(const TFrom*, TTo*, SizeT);
+
+#if defined(DAQ_SIMD_X86)
+
+template <typename TFrom, typename TTo>
+ConversionKernel<TFrom, TTo> selectKernel(ConversionKernel<TFrom, TTo> sse2,
+                                          ConversionKernel<TFrom, TTo> avx2,
+                                          ConversionKernel<TFrom, TTo> avx512)
+{
+    switch (getSimdLevel())
+    {
+        case SimdLevel::Avx512:
+            return avx512;
+        case SimdLevel::Avx2:
+            return avx2;
+        default:
+            return sse2;
+    }
+}
+
+// SSE2 is part of the x86-64 baseline and needs no target attribute
+
+namespace sse2
+{
+    __m128i signExtendLow16(__m128i v)
+    {
+        return _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+    }
+
+    __m128i signExtendHigh16(__m128i v)
+    {
+        return _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+    }
+
+    // Widens 16 8-bit values to four vectors of 32-bit values
+    void widenInt8(__m128i v, __m128i (&out)[4])
+    {
+        const __m128i lo = _mm_unpacklo_epi8(v, v);
+        const __m128i hi = _mm_unpackhi_epi8(v, v);
+        out[0] = _mm_srai_epi32(_mm_unpacklo_epi16(lo, lo), 24);
+        out[1] = _mm_srai_epi32(_mm_unpackhi_epi16(lo, lo), 24);
+        out[2] = _mm_srai_epi32(_mm_unpacklo_epi16(hi, hi), 24);
+        out[3] = _mm_srai_epi32(_mm_unpackhi_epi16(hi, hi), 24);
+    }
+
+    void widenUInt8(__m128i v, __m128i (&out)[4])
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i lo = _mm_unpacklo_epi8(v, zero);
+        const __m128i hi = _mm_unpackhi_epi8(v, zero);
+        out[0] = _mm_unpacklo_epi16(lo, zero);
+        out[1] = _mm_unpackhi_epi16(lo, zero);
+        out[2] = _mm_unpacklo_epi16(hi, zero);
+        out[3] = _mm_unpackhi_epi16(hi, zero);
+    }
+
+    void storeAsDouble(__m128i v, double* dst)
+    {
+        _mm_storeu_pd(dst, _mm_cvtepi32_pd(v));
+        _mm_storeu_pd(dst + 2, _mm_cvtepi32_pd(_mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2))));
+    }
+
+    void int8ToDouble(const int8_t* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            __m128i v[4];
+            widenInt8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), v);
+            for (int j = 0; j < 4; ++j)
+                storeAsDouble(v[j], dst + i + 4 * j);
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    void uint8ToDouble(const uint8_t* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            __m128i v[4];
+            widenUInt8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), v);
+            for (int j = 0; j < 4; ++j)
+                storeAsDouble(v[j], dst + i + 4 * j);
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    void int16ToDouble(const int16_t* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            storeAsDouble(signExtendLow16(v), dst + i);
+            storeAsDouble(signExtendHigh16(v), dst + i + 4);
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    void uint16ToDouble(const uint16_t* src, double* dst, SizeT count)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            storeAsDouble(_mm_unpacklo_epi16(v, zero), dst + i);
+            storeAsDouble(_mm_unpackhi_epi16(v, zero), dst + i + 4);
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    void int32ToDouble(const int32_t* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 4 <= count; i += 4)
+            storeAsDouble(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), dst + i);
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    // Converts as a signed value biased by -2^31 and adds the bias back, which is exact in double precision
+    void uint32ToDouble(const uint32_t* src, double* dst, SizeT count)
+    {
+        const __m128i signBit = _mm_set1_epi32(INT32_MIN);
+        const __m128d bias = _mm_set1_pd(2147483648.0);
+        SizeT i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), signBit);
+            _mm_storeu_pd(dst + i, _mm_add_pd(_mm_cvtepi32_pd(v), bias));
+            _mm_storeu_pd(dst + i + 2, _mm_add_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2))), bias));
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    void floatToDouble(const float* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 v = _mm_loadu_ps(src + i);
+            _mm_storeu_pd(dst + i, _mm_cvtps_pd(v));
+            _mm_storeu_pd(dst + i + 2, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    void int8ToFloat(const int8_t* src, float* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            __m128i v[4];
+            widenInt8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), v);
+            for (int j = 0; j < 4; ++j)
+                _mm_storeu_ps(dst + i + 4 * j, _mm_cvtepi32_ps(v[j]));
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    void uint8ToFloat(const uint8_t* src, float* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            __m128i v[4];
+            widenUInt8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), v);
+            for (int j = 0; j < 4; ++j)
+                _mm_storeu_ps(dst + i + 4 * j, _mm_cvtepi32_ps(v[j]));
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    void int16ToFloat(const int16_t* src, float* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(signExtendLow16(v)));
+            _mm_storeu_ps(dst + i + 4, _mm_cvtepi32_ps(signExtendHigh16(v)));
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    void uint16ToFloat(const uint16_t* src, float* dst, SizeT count)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_unpacklo_epi16(v, zero)));
+            _mm_storeu_ps(dst + i + 4, _mm_cvtepi32_ps(_mm_unpackhi_epi16(v, zero)));
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    void int32ToFloat(const int32_t* src, float* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 4 <= count; i += 4)
+            _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    void doubleToFloat(const double* src, float* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 lo = _mm_cvtpd_ps(_mm_loadu_pd(src + i));
+            const __m128 hi = _mm_cvtpd_ps(_mm_loadu_pd(src + i + 2));
+            _mm_storeu_ps(dst + i, _mm_movelh_ps(lo, hi));
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+}
+
+namespace avx2
+{
+    DAQ_SIMD_TARGET("avx2") void int8ToDouble(const int8_t* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i v = _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+            _mm256_storeu_pd(dst + i, _mm256_cvtepi32_pd(_mm256_castsi256_si128(v)));
+            _mm256_storeu_pd(dst + i + 4, _mm256_cvtepi32_pd(_mm256_extracti128_si256(v, 1)));
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx2") void uint8ToDouble(const uint8_t* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+            _mm256_storeu_pd(dst + i, _mm256_cvtepi32_pd(_mm256_castsi256_si128(v)));
+            _mm256_storeu_pd(dst + i + 4, _mm256_cvtepi32_pd(_mm256_extracti128_si256(v, 1)));
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx2") void int16ToDouble(const int16_t* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i v = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+            _mm256_storeu_pd(dst + i, _mm256_cvtepi32_pd(_mm256_castsi256_si128(v)));
+            _mm256_storeu_pd(dst + i + 4, _mm256_cvtepi32_pd(_mm256_extracti128_si256(v, 1)));
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx2") void uint16ToDouble(const uint16_t* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i v = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+            _mm256_storeu_pd(dst + i, _mm256_cvtepi32_pd(_mm256_castsi256_si128(v)));
+            _mm256_storeu_pd(dst + i + 4, _mm256_cvtepi32_pd(_mm256_extracti128_si256(v, 1)));
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx2") void int32ToDouble(const int32_t* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 4 <= count; i += 4)
+            _mm256_storeu_pd(dst + i, _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx2") void uint32ToDouble(const uint32_t* src, double* dst, SizeT count)
+    {
+        const __m128i signBit = _mm_set1_epi32(INT32_MIN);
+        const __m256d bias = _mm256_set1_pd(2147483648.0);
+        SizeT i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), signBit);
+            _mm256_storeu_pd(dst + i, _mm256_add_pd(_mm256_cvtepi32_pd(v), bias));
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx2") void floatToDouble(const float* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 4 <= count; i += 4)
+            _mm256_storeu_pd(dst + i, _mm256_cvtps_pd(_mm_loadu_ps(src + i)));
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx2") void int8ToFloat(const int8_t* src, float* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i v = _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+            _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(v));
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx2") void uint8ToFloat(const uint8_t* src, float* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+            _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(v));
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx2") void int16ToFloat(const int16_t* src, float* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i v = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+            _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(v));
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx2") void uint16ToFloat(const uint16_t* src, float* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i v = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+            _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(v));
+        }
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx2") void int32ToFloat(const int32_t* src, float* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i))));
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx2") void doubleToFloat(const double* src, float* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 4 <= count; i += 4)
+            _mm_storeu_ps(dst + i, _mm256_cvtpd_ps(_mm256_loadu_pd(src + i)));
+        convertScalar(src + i, dst + i, count - i);
+    }
+}
+
+namespace avx512
+{
+    DAQ_SIMD_TARGET("avx512f") void int8ToDouble(const int8_t* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m512i v = _mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+            _mm512_storeu_pd(dst + i, _mm512_cvtepi32_pd(_mm512_castsi512_si256(v)));
+            _mm512_storeu_pd(dst + i + 8, _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(v, 1)));
+        }
+        avx2::int8ToDouble(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx512f") void uint8ToDouble(const uint8_t* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m512i v = _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+            _mm512_storeu_pd(dst + i, _mm512_cvtepi32_pd(_mm512_castsi512_si256(v)));
+            _mm512_storeu_pd(dst + i + 8, _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(v, 1)));
+        }
+        avx2::uint8ToDouble(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx512f") void int16ToDouble(const int16_t* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m512i v = _mm512_cvtepi16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+            _mm512_storeu_pd(dst + i, _mm512_cvtepi32_pd(_mm512_castsi512_si256(v)));
+            _mm512_storeu_pd(dst + i + 8, _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(v, 1)));
+        }
+        avx2::int16ToDouble(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx512f") void uint16ToDouble(const uint16_t* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m512i v = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+            _mm512_storeu_pd(dst + i, _mm512_cvtepi32_pd(_mm512_castsi512_si256(v)));
+            _mm512_storeu_pd(dst + i + 8, _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(v, 1)));
+        }
+        avx2::uint16ToDouble(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx512f") void int32ToDouble(const int32_t* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm512_storeu_pd(dst + i, _mm512_cvtepi32_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i))));
+        avx2::int32ToDouble(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx512f") void uint32ToDouble(const uint32_t* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm512_storeu_pd(dst + i, _mm512_cvtepu32_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i))));
+        avx2::uint32ToDouble(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx512f,avx512dq") void int64ToDouble(const int64_t* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm512_storeu_pd(dst + i, _mm512_cvtepi64_pd(_mm512_loadu_si512(src + i)));
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx512f,avx512dq") void uint64ToDouble(const uint64_t* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm512_storeu_pd(dst + i, _mm512_cvtepu64_pd(_mm512_loadu_si512(src + i)));
+        convertScalar(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx512f") void floatToDouble(const float* src, double* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm512_storeu_pd(dst + i, _mm512_cvtps_pd(_mm256_loadu_ps(src + i)));
+        avx2::floatToDouble(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx512f") void int8ToFloat(const int8_t* src, float* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 16 <= count; i += 16)
+            _mm512_storeu_ps(dst + i, _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)))));
+        avx2::int8ToFloat(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx512f") void uint8ToFloat(const uint8_t* src, float* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 16 <= count; i += 16)
+            _mm512_storeu_ps(dst + i, _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)))));
+        avx2::uint8ToFloat(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx512f") void int16ToFloat(const int16_t* src, float* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m512i v = _mm512_cvtepi16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+            _mm512_storeu_ps(dst + i, _mm512_cvtepi32_ps(v));
+        }
+        avx2::int16ToFloat(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx512f") void uint16ToFloat(const uint16_t* src, float* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m512i v = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+            _mm512_storeu_ps(dst + i, _mm512_cvtepi32_ps(v));
+        }
+        avx2::uint16ToFloat(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx512f") void int32ToFloat(const int32_t* src, float* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 16 <= count; i += 16)
+            _mm512_storeu_ps(dst + i, _mm512_cvtepi32_ps(_mm512_loadu_si512(src + i)));
+        avx2::int32ToFloat(src + i, dst + i, count - i);
+    }
+
+    DAQ_SIMD_TARGET("avx512f") void doubleToFloat(const double* src, float* dst, SizeT count)
+    {
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm256_storeu_ps(dst + i, _mm512_cvtpd_ps(_mm512_loadu_pd(src + i)));
+        avx2::doubleToFloat(src + i, dst + i, count - i);
+    }
+}
+
+// 64-bit integer conversions need AVX-512 DQ, below that the scalar loop is used
+namespace sse2
+{
+    const ConversionKernel<int64_t, double> int64ToDouble = convertScalar<int64_t, double>;
+    const ConversionKernel<uint64_t, double> uint64ToDouble = convertScalar<uint64_t, double>;
+}
+
+namespace avx2
+{
+    const ConversionKernel<int64_t, double> int64ToDouble = convertScalar<int64_t, double>;
+    const ConversionKernel<uint64_t, double> uint64ToDouble = convertScalar<uint64_t, double>;
+}
+
+#define DAQ_SELECT_KERNEL(name) selectKernel(sse2::name, avx2::name, avx512::name)
+
+#else
+
+#define DAQ_SELECT_KERNEL(name) name
+
+ConversionKernel<int8_t, double> int8ToDouble = convertScalar<int8_t, double>;
+ConversionKernel<uint8_t, double> uint8ToDouble = convertScalar<uint8_t, double>;
+ConversionKernel<int16_t, double> int16ToDouble = convertScalar<int16_t, double>;
+ConversionKernel<uint16_t, double> uint16ToDouble = convertScalar<uint16_t, double>;
+ConversionKernel<int32_t, double> int32ToDouble = convertScalar<int32_t, double>;
+ConversionKernel<uint32_t, double> uint32ToDouble = convertScalar<uint32_t, double>;
+ConversionKernel<int64_t, double> int64ToDouble = convertScalar<int64_t, double>;
+ConversionKernel<uint64_t, double> uint64ToDouble = convertScalar<uint64_t, double>;
+ConversionKernel<float, double> floatToDouble = convertScalar<float, double>;
+ConversionKernel<int8_t, float> int8ToFloat = convertScalar<int8_t, float>;
+ConversionKernel<uint8_t, float> uint8ToFloat = convertScalar<uint8_t, float>;
+ConversionKernel<int16_t, float> int16ToFloat = convertScalar<int16_t, float>;
+ConversionKernel<uint16_t, float> uint16ToFloat = convertScalar<uint16_t, float>;
+ConversionKernel<int32_t, float> int32ToFloat = convertScalar<int32_t, float>;
+ConversionKernel<double, float> doubleToFloat = convertScalar<double, float>;
+
+#endif
+
+}
+
+void convertSampleValues(const int8_t* src, double* dst, SizeT count)
+{
+    static const ConversionKernel<int8_t, double> kernel = DAQ_SELECT_KERNEL(int8ToDouble);
+    kernel(src, dst, count);
+}
+
+void convertSampleValues(const uint8_t* src, double* dst, SizeT count)
+{
+    static const ConversionKernel<uint8_t, double> kernel = DAQ_SELECT_KERNEL(uint8ToDouble);
+    kernel(src, dst, count);
+}
+
+void convertSampleValues(const int16_t* src, double* dst, SizeT count)
+{
+    static const ConversionKernel<int16_t, double> kernel = DAQ_SELECT_KERNEL(int16ToDouble);
+    kernel(src, dst, count);
+}
+
+void convertSampleValues(const uint16_t* src, double* dst, SizeT count)
+{
+    static const ConversionKernel<uint16_t, double> kernel = DAQ_SELECT_KERNEL(uint16ToDouble);
+    kernel(src, dst, count);
+}
+
+void convertSampleValues(const int32_t* src, double* dst, SizeT count)
+{
+    static const ConversionKernel<int32_t, double> kernel = DAQ_SELECT_KERNEL(int32ToDouble);
+    kernel(src, dst, count);
+}
+
+void convertSampleValues(const uint32_t* src, double* dst, SizeT count)
+{
+    static const ConversionKernel<uint32_t, double> kernel = DAQ_SELECT_KERNEL(uint32ToDouble);
+    kernel(src, dst, count);
+}
+
+void convertSampleValues(const int64_t* src, double* dst, SizeT count)
+{
+    static const ConversionKernel<int64_t, double> kernel = DAQ_SELECT_KERNEL(int64ToDouble);
+    kernel(src, dst, count);
+}
+
+void convertSampleValues(const uint64_t* src, double* dst, SizeT count)
+{
+    static const ConversionKernel<uint64_t, double> kernel = DAQ_SELECT_KERNEL(uint64ToDouble);
+    kernel(src, dst, count);
+}
+
+void convertSampleValues(const float* src, double* dst, SizeT count)
+{
+    static const ConversionKernel<float, double> kernel = DAQ_SELECT_KERNEL(floatToDouble);
+    kernel(src, dst, count);
+}
+
+void convertSampleValues(const int8_t* src, float* dst, SizeT count)
+{
+    static const ConversionKernel<int8_t, float> kernel = DAQ_SELECT_KERNEL(int8ToFloat);
+    kernel(src, dst, count);
+}
+
+void convertSampleValues(const uint8_t* src, float* dst, SizeT count)
+{
+    static const ConversionKernel<uint8_t, float> kernel = DAQ_SELECT_KERNEL(uint8ToFloat);
+    kernel(src, dst, count);
+}
+
+void convertSampleValues(const int16_t* src, float* dst, SizeT count)
+{
+    static const ConversionKernel<int16_t, float> kernel = DAQ_SELECT_KERNEL(int16ToFloat);
+    kernel(src, dst, count);
+}
+
+void convertSampleValues(const uint16_t* src, float* dst, SizeT count)
+{
+    static const ConversionKernel<uint16_t, float> kernel = DAQ_SELECT_KERNEL(uint16ToFloat);
+    kernel(src, dst, count);
+}
+
+void convertSampleValues(const int32_t* src, float* dst, SizeT count)
+{
+    static const ConversionKernel<int32_t, float> kernel = DAQ_SELECT_KERNEL(int32ToFloat);
+    kernel(src, dst, count);
+}
+
+void convertSampleValues(const double* src, float* dst, SizeT count)
+{
+    static const ConversionKernel<double, float> kernel = DAQ_SELECT_KERNEL(doubleToFloat);
+    kernel(src, dst, count);
+}
+
+}
+
+END_NAMESPACE_OPENDAQ
@@ -528,15 +528,15 @@ ErrCode SignalReader::readPackets()
     return errCode;
 }
 
-void* SignalReader::getValuePacketData(const DataPacketPtr& packet) const
+ErrCode SignalReader::readValuePacketData(const DataPacketPtr& packet, SizeT offset, void** outputBuffer, SizeT count) const
 {
     switch (readMode)
     {
         case ReadMode::RawValue:
         case ReadMode::Unscaled:
-            return packet.getRawData();
+            return valueReader->readData(packet.getRawData(), offset, outputBuffer, count);
         case ReadMode::Scaled:
-            return packet.getData();
+            return valueReader->readScaledData(packet, offset, outputBuffer, count);
     }
 
     DAQ_THROW_EXCEPTION(
@@ -567,7 +567,7 @@ ErrCode SignalReader::readPacketData()
 
     if (info.values != nullptr)
     {
-        ErrCode errCode = valueReader->readData(getValuePacketData(info.dataPacket), info.prevSampleIndex, &info.values, toRead);
+        ErrCode errCode = readValuePacketData(info.dataPacket, info.prevSampleIndex, &info.values, toRead);
         OPENDAQ_RETURN_IF_FAILED(errCode);
     }
 
@@ -437,15 +437,15 @@ bool StreamReaderImpl::trySetDomainSampleType(const daq::DataPacketPtr& domainPa
     return false;    
 }
 
-void* StreamReaderImpl::getValuePacketData(const DataPacketPtr& packet) const
+ErrCode StreamReaderImpl::readValuePacketData(const DataPacketPtr& packet, SizeT offset, void** outputBuffer, SizeT count) const
 {
     switch (readMode)
     {
         case ReadMode::RawValue:
         case ReadMode::Unscaled:
-            return packet.getRawData();
+            return valueReader->readData(packet.getRawData(), offset, outputBuffer, count);
         case ReadMode::Scaled:
-            return packet.getData();
+            return valueReader->readScaledData(packet, offset, outputBuffer, count);
     }
 
     DAQ_THROW_EXCEPTION(InvalidOperationException, "Unknown Reader read-mode of {}", static_cast<std::underlying_type_t<ReadMode>>(readMode));
@@ -458,7 +458,7 @@ ErrCode StreamReaderImpl::readPacketData()
 
     if (info.values != nullptr)
     {
-        ErrCode errCode = valueReader->readData(getValuePacketData(info.dataPacket), info.prevSampleIndex, &info.values, toRead);
+        ErrCode errCode = readValuePacketData(info.dataPacket, info.prevSampleIndex, &info.values, toRead);
         OPENDAQ_RETURN_IF_FAILED(errCode);
     }
 
@@ -16,6 +16,7 @@ TailReaderBuilderImpl::TailReaderBuilderImpl()
     , historySize(1)
     , used(false)
     , skipEvents(false)
+    , useSampleBuffer(false)
 {
 }
 
@@ -119,6 +120,18 @@ ErrCode TailReaderBuilderImpl::getSkipEvents(Bool* skipEvents)
     return OPENDAQ_SUCCESS;
 }
 
+ErrCode TailReaderBuilderImpl::setUseSampleBuffer(Bool useSampleBuffer)
+{
+    this->useSampleBuffer = useSampleBuffer;
+    return OPENDAQ_SUCCESS;
+}
+ErrCode TailReaderBuilderImpl::getUseSampleBuffer(Bool* useSampleBuffer)
+{
+    OPENDAQ_PARAM_NOT_NULL(useSampleBuffer);
+    *useSampleBuffer = this->useSampleBuffer;
+    return OPENDAQ_SUCCESS;
+}
+
 /////////////////////
 ////
 //// FACTORIES
@@ -1,20 +1,39 @@
 #include <opendaq/reader_errors.h>
 #include <opendaq/tail_reader_impl.h>
+#include <opendaq/sample_type_traits.h>
+#include <algorithm>
+#include <cstring>
 
 BEGIN_NAMESPACE_OPENDAQ
 
+namespace
+{
+
+// Size of a sample in the sample buffer; samples of a one-dimensional descriptor hold several values
+SizeT getBufferSampleSize(const Reader& reader)
+{
+    return getSampleSize(reader.getReadType()) * reader.getValuesPerSample();
+}
+
+}
+
 TailReaderImpl::TailReaderImpl(ISignal* signal,
                                SizeT historySize,
                                SampleType valueReadType,
                                SampleType domainReadType,
                                ReadMode mode,
-                               Bool skipEvents)
+                               Bool skipEvents,
+                               Bool useSampleBuffer)
     : Super(SignalPtr(signal), mode, valueReadType, domainReadType, skipEvents)
     , historySize(historySize)
     , cachedSamples(0)
+    , useSampleBuffer(useSampleBuffer)
 {
     try
     {
+        if (this->useSampleBuffer)
+            resetSampleBuffer();
+
         port.setNotificationMethod(PacketReadyNotification::SameThread);
         packetReceived(port.as<IInputPort>(true));
     }
@@ -30,13 +49,18 @@ TailReaderImpl::TailReaderImpl(IInputPortConfig* port,
                                SampleType valueReadType,
                                SampleType domainReadType,
                                ReadMode mode,
-                               Bool skipEvents)
+                               Bool skipEvents,
+                               Bool useSampleBuffer)
     : Super(InputPortConfigPtr(port), mode, valueReadType, domainReadType, skipEvents)
     , historySize(historySize)
     , cachedSamples(0)
+    , useSampleBuffer(useSampleBuffer)
 {
     try
     {
+        if (this->useSampleBuffer)
+            resetSampleBuffer();
+
         this->port.setNotificationMethod(PacketReadyNotification::Scheduler);
         if (connection.assigned())
             packetReceived(this->port.as<IInputPort>(true));
@@ -56,6 +80,7 @@ TailReaderImpl::TailReaderImpl(const ReaderConfigPtr& readerConfig,
     : Super(readerConfig, mode, valueReadType, domainReadType)
     , historySize(historySize)
     , cachedSamples(0)
+    , useSampleBuffer(false)
 {
 }
 
@@ -67,8 +92,11 @@ TailReaderImpl::TailReaderImpl(TailReaderImpl* old,
     , historySize(historySize)
     , cachedSamples(old->cachedSamples)
     , packets(old->packets)
-    
+    , useSampleBuffer(old->useSampleBuffer)
 {
+    // buffered samples are already converted to the read types of the old reader
+    if (useSampleBuffer)
+        resetSampleBuffer();
 }
 
 ErrCode TailReaderImpl::getAvailableCount(SizeT* count)
@@ -119,7 +147,7 @@ ErrCode TailReaderImpl::readPacket(TailReaderInfo& info, const DataPacketPtr& da
     auto remainingSampleCount = sampleCount - info.offset;
     SizeT toRead = std::min(info.remainingToRead, remainingSampleCount);
 
-    ErrCode errCode = valueReader->readData(getValuePacketData(dataPacket), info.offset, &info.values, toRead);
+    ErrCode errCode = readValuePacketData(dataPacket, info.offset, &info.values, toRead);
     OPENDAQ_RETURN_IF_FAILED(errCode);
 
     if (info.domainValues != nullptr)
@@ -159,6 +187,9 @@ TailReaderStatusPtr TailReaderImpl::readData(TailReaderInfo& info)
         return TailReaderStatus(nullptr, !invalid, 0, false);
     }
 
+    if (useSampleBuffer)
+        return readFromSampleBuffer(info);
+
     if (cachedSamples > info.remainingToRead)
         info.offset = cachedSamples - info.remainingToRead;
 
@@ -199,6 +230,197 @@ TailReaderStatusPtr TailReaderImpl::readData(TailReaderInfo& info)
     return TailReaderStatus(nullptr, !invalid, offset);
 }
 
+void TailReaderImpl::resetSampleBuffer()
+{
+    valueSampleSize = getBufferSampleSize(*valueReader);
+    domainSampleSize = getBufferSampleSize(*domainReader);
+
+    // read types that resolve to objects cannot be stored in the sample buffer
+    if (valueSampleSize == 0 && !valueReader->isUndefined())
+        invalid = true;
+
+    valueBuffer.resize(historySize * valueSampleSize);
+    valueBuffer.shrink_to_fit();
+
+    // allocated with the first domain packet
+    domainBuffer.clear();
+    domainBuffer.shrink_to_fit();
+
+    cachedSamples = 0;
+    receivedSamples = 0;
+    firstDomainSample = 0;
+    segments.clear();
+}
+
+namespace
+{
+
+// Copies `count` samples into a circular buffer starting at the absolute sample index `first`.
+// The read function converts `count` samples, starting `offset` samples into the packet, to `output`.
+template <typename ReadFunc>
+ErrCode writeCircular(std::vector<uint8_t>& buffer, SizeT sampleSize, SizeT capacity, SizeT first, SizeT count, ReadFunc&& readFunc)
+{
+    const SizeT position = first % capacity;
+    const SizeT firstPart = std::min(count, capacity - position);
+
+    void* output = buffer.data() + position * sampleSize;
+    const ErrCode errCode = readFunc(0, &output, firstPart);
+    if (OPENDAQ_FAILED(errCode) || firstPart == count)
+        return errCode;
+
+    output = buffer.data();
+    return readFunc(firstPart, &output, count - firstPart);
+}
+
+void readCircular(const std::vector<uint8_t>& buffer, SizeT sampleSize, SizeT capacity, SizeT first, SizeT count, void* output)
+{
+    const SizeT position = first % capacity;
+    const SizeT firstPart = std::min(count, capacity - position);
+
+    auto out = static_cast<uint8_t*>(output);
+    std::memcpy(out, buffer.data() + position * sampleSize, firstPart * sampleSize);
+    std::memcpy(out + firstPart * sampleSize, buffer.data(), (count - firstPart) * sampleSize);
+}
+
+}
+
+void TailReaderImpl::writeToSampleBuffer(const DataPacketPtr& dataPacket)
+{
+    const SizeT sampleCount = dataPacket.getSampleCount();
+    if (historySize == 0 || valueSampleSize == 0 || sampleCount == 0)
+        return;
+
+    // only the newest `historySize` samples of the packet can be kept
+    const SizeT skipped = sampleCount > historySize ? sampleCount - historySize : 0;
+    const SizeT first = receivedSamples + skipped;
+    const SizeT count = sampleCount - skipped;
+
+    ErrCode errCode = writeCircular(valueBuffer,
+                                    valueSampleSize,
+                                    historySize,
+                                    first,
+                                    count,
+                                    [&](SizeT offset, void** output, SizeT toRead)
+                                    { return readValuePacketData(dataPacket, skipped + offset, output, toRead); });
+    if (OPENDAQ_FAILED(errCode))
+    {
+        // a packet that cannot be converted breaks the continuity of the history
+        daqClearErrorInfo();
+        resetSampleBuffer();
+        return;
+    }
+
+    const auto domainPacket = dataPacket.getDomainPacket();
+    errCode = OPENDAQ_ERR_INVALIDSTATE;
+    if (domainPacket.assigned())
+    {
+        const auto writeDomain = [&]() -> ErrCode
+        {
+            if (domainSampleSize == 0)
+                return OPENDAQ_ERR_INVALIDSTATE;
+
+            domainBuffer.resize(historySize * domainSampleSize);
+            return writeCircular(domainBuffer,
+                                 domainSampleSize,
+                                 historySize,
+                                 first,
+                                 count,
+                                 [&](SizeT offset, void** output, SizeT toRead)
+                                 { return domainReader->readData(domainPacket.getData(), skipped + offset, output, toRead); });
+        };
+
+        errCode = writeDomain();
+        if (errCode == OPENDAQ_ERR_INVALIDSTATE && trySetDomainSampleType(domainPacket))
+        {
+            daqClearErrorInfo();
+
+            // samples converted to the previous domain read type are no longer valid
+            const SizeT newDomainSampleSize = getBufferSampleSize(*domainReader);
+            if (newDomainSampleSize != domainSampleSize)
+            {
+                domainSampleSize = newDomainSampleSize;
+                firstDomainSample = first;
+            }
+
+            errCode = writeDomain();
+        }
+    }
+
+    if (OPENDAQ_FAILED(errCode))
+    {
+        daqClearErrorInfo();
+        firstDomainSample = receivedSamples + sampleCount;
+    }
+
+    Int offset = 0;
+    Int delta = 0;
+    if (domainPacket.assigned() && domainPacket.getOffset().assigned())
+    {
+        offset = domainPacket.getOffset().getIntValue();
+        const auto domainRule = domainPacket.getDataDescriptor().getRule();
+        if (domainRule.assigned() && domainRule.getType() == DataRuleType::Linear)
+            delta = domainRule.getParameters().get("delta");
+    }
+
+    // contiguous packets of a linear domain extend the last segment
+    const bool contiguous = !segments.empty() && segments.back().delta == delta &&
+                            segments.back().offset + static_cast<Int>(receivedSamples - segments.back().firstSample) * delta == offset;
+    if (!contiguous)
+        segments.push_back({receivedSamples, offset, delta});
+
+    receivedSamples += sampleCount;
+    cachedSamples = std::min(receivedSamples, historySize);
+
+    const SizeT oldestSample = receivedSamples - cachedSamples;
+    while (segments.size() > 1 && segments[1].firstSample <= oldestSample)
+        segments.pop_front();
+}
+
+NumberPtr TailReaderImpl::getSampleBufferOffset(SizeT sampleIndex) const
+{
+    auto segment = std::upper_bound(segments.begin(),
+                                    segments.end(),
+                                    sampleIndex,
+                                    [](SizeT index, const SampleBufferSegment& segment) { return index < segment.firstSample; });
+    if (segment == segments.begin())
+        return NumberPtr(0);
+
+    --segment;
+    return NumberPtr(segment->offset + static_cast<Int>(sampleIndex - segment->firstSample) * segment->delta);
+}
+
+TailReaderStatusPtr TailReaderImpl::readFromSampleBuffer(TailReaderInfo& info)
+{
+    // descriptor changes were applied on arrival; events are only reported here
+    while (!packets.empty())
+    {
+        const auto eventPacket = packets.front().asPtr<IEventPacket>(true);
+        packets.pop_front();
+
+        if (!skipEvents || invalid || eventPacket.getEventId() == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED)
+            return TailReaderStatus(eventPacket, !invalid, nullptr);
+    }
+
+    SizeT available = cachedSamples;
+    if (info.domainValues != nullptr)
+    {
+        const SizeT firstSample = std::max(receivedSamples - cachedSamples, firstDomainSample);
+        available = receivedSamples > firstSample ? receivedSamples - firstSample : 0;
+    }
+
+    const SizeT count = std::min(info.remainingToRead, available);
+    if (count == 0)
+        return TailReaderStatus(nullptr, !invalid, nullptr);
+
+    const SizeT first = receivedSamples - count;
+    readCircular(valueBuffer, valueSampleSize, historySize, first, count, info.values);
+    if (info.domainValues != nullptr)
+        readCircular(domainBuffer, domainSampleSize, historySize, first, count, info.domainValues);
+
+    info.remainingToRead -= count;
+    return TailReaderStatus(nullptr, !invalid, getSampleBufferOffset(first));
+}
+
 ErrCode TailReaderImpl::read(void* values, SizeT* count, ITailReaderStatus** status)
 {
     OPENDAQ_PARAM_NOT_NULL(count);
@@ -269,6 +491,12 @@ ErrCode TailReaderImpl::packetReceived(IInputPort* port)
         {
             case PacketType::Data:
             {
+                if (useSampleBuffer)
+                {
+                    writeToSampleBuffer(packet.asPtr<IDataPacket>(true));
+                    break;
+                }
+
                 auto newPacket = packet.asPtr<IDataPacket>(true);
                 SizeT newPacketSampleCount = newPacket.getSampleCount();
                 if (cachedSamples < historySize)
@@ -311,6 +539,14 @@ ErrCode TailReaderImpl::packetReceived(IInputPort* port)
             {
                 hasEventPacket = true;
                 packets.push_back(packet);
+
+                // samples before the event are dropped on read; with the sample buffer the new
+                // descriptor is needed right away to convert the following samples
+                if (useSampleBuffer)
+                {
+                    handleDescriptorChanged(packet.asPtr<IEventPacket>(true));
+                    resetSampleBuffer();
+                }
                 break;
             }
             case PacketType::None:
@@ -401,6 +637,13 @@ daq::ErrCode PUBLIC_EXPORT createTailReaderFromBuilder(ITailReader** objTmp, ITa
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_CREATE_FAILED, "Reader cannot skip events when sample type is undefined");
     }
 
+    if (builderPtr.getUseSampleBuffer() &&
+        ((builderPtr.getValueReadType() != SampleType::Undefined && getSampleSize(builderPtr.getValueReadType()) == 0) ||
+         (builderPtr.getDomainReadType() != SampleType::Undefined && getSampleSize(builderPtr.getDomainReadType()) == 0)))
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_CREATE_FAILED, "Sample buffer requires fixed-size read types");
+    }
+
     if (auto port = builderPtr.getInputPort(); port.assigned())
     {
         return createObject<ITailReader, TailReaderImpl>(objTmp,
@@ -409,7 +652,8 @@ daq::ErrCode PUBLIC_EXPORT createTailReaderFromBuilder(ITailReader** objTmp, ITa
                                                          builderPtr.getValueReadType(),
                                                          builderPtr.getDomainReadType(),
                                                          builderPtr.getReadMode(),
-                                                         builderPtr.getSkipEvents());
+                                                         builderPtr.getSkipEvents(),
+                                                         builderPtr.getUseSampleBuffer());
     }
     else if (auto signal = builderPtr.getSignal(); signal.assigned())
     {
@@ -419,7 +663,8 @@ daq::ErrCode PUBLIC_EXPORT createTailReaderFromBuilder(ITailReader** objTmp, ITa
                                                          builderPtr.getValueReadType(),
                                                          builderPtr.getDomainReadType(),
                                                          builderPtr.getReadMode(),
-                                                         builderPtr.getSkipEvents());
+                                                         builderPtr.getSkipEvents(),
+                                                         builderPtr.getUseSampleBuffer());
     }
 
     return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_ARGUMENT_NULL, "Neither signal nor input port is not set in TailReader builder");
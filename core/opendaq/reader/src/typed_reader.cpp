@@ -5,7 +5,9 @@
 #include <opendaq/packet_factory.h>
 #include <opendaq/reader_errors.h>
 #include <opendaq/reader_utils.h>
+#include <opendaq/sample_conversion.h>
 #include <opendaq/sample_type.h>
+#include <opendaq/scaling_calc_private.h>
 #include <opendaq/signal_errors.h>
 #include <opendaq/typed_reader.h>
 
@@ -438,10 +440,10 @@ SizeT TypedReader<TReadType>::getOffsetToData(const ReaderDomainInfo& domainInfo
         // [[maybe_unused]]
         // int a = 5;
 
-        for (std::size_t i = 0; i < size * valuesPerSample; ++i)
+        const auto isAtOrAfterStart = [&domainInfo, &startValue](const TDataType& value)
         {
             // debug
-            // [[maybe_unused]] auto packetValue = dataStart[i];
+            // [[maybe_unused]] auto packetValue = value;
             // [[maybe_unused]] auto readValue = static_cast<TReadType>(packetValue);
             // [[maybe_unused]] auto adjusted = GreaterEqual<TReadType>::Adjust(readValue, domainInfo.multiplier);
             //
@@ -449,36 +451,43 @@ SizeT TypedReader<TReadType>::getOffsetToData(const ReaderDomainInfo& domainInfo
             // ss1 << toSysTime(adjusted, domainInfo.epoch, domainInfo.readResolution);
             // std::string s1 = ss1.str();
 
-            TReadType readValue = static_cast<TReadType>(dataStart[i]);  // C4244 - possible data loss due to conversion
-            if (GreaterEqual<TReadType>::Check(domainInfo.multiplier, readValue, startValue))
+            TReadType readValue = static_cast<TReadType>(value);  // C4244 - possible data loss due to conversion
+            return GreaterEqual<TReadType>::Check(domainInfo.multiplier, readValue, startValue);
+        };
+
+        const SizeT valueCount = size * valuesPerSample;
+        const SizeT index = reader::findDomainValueAtOrAfter(dataStart, valueCount, valuesPerSample, isAtOrAfterStart);
+        if (index == valueCount)
+        {
+            // debug
+            // [[maybe_unused]] auto packetValue = dataStart[size - 1];
+            // [[maybe_unused]] auto readValue = static_cast<TReadType>(packetValue);
+            // [[maybe_unused]] auto adjusted = GreaterEqual<TReadType>::Adjust(readValue, domainInfo.multiplier);
+
+            return static_cast<SizeT>(-1);
+        }
+
+        if (absoluteTimestamp)
+        {
+            TReadType readValue = static_cast<TReadType>(dataStart[index]);  // C4244 - possible data loss due to conversion
+            if constexpr (IsTemplateOf<TReadType, daq::RangeType>::value)
+            {
+                auto readValueSysTime = reader::toSysTime(readValue.start, domainInfo.epoch, domainInfo.resolution);
+                *absoluteTimestamp =
+                    readValueSysTime.time_since_epoch().count();  // adjustedValueSysTime.time_since_epoch().count();
+            }
+            else if constexpr (!IsTemplateOf<TReadType, daq::Complex_Number>::value)
+            {
+                auto readValueSysTime = reader::toSysTime(readValue, domainInfo.epoch, domainInfo.resolution);
+                *absoluteTimestamp = readValueSysTime.time_since_epoch().count();
+            }
+            else
             {
-                if (absoluteTimestamp)
-                {
-                    if constexpr (IsTemplateOf<TReadType, daq::RangeType>::value)
-                    {
-                        auto readValueSysTime = reader::toSysTime(readValue.start, domainInfo.epoch, domainInfo.resolution);
-                        *absoluteTimestamp =
-                            readValueSysTime.time_since_epoch().count();  // adjustedValueSysTime.time_since_epoch().count();
-                    }
-                    else if constexpr (!IsTemplateOf<TReadType, daq::Complex_Number>::value)
-                    {
-                        auto readValueSysTime = reader::toSysTime(readValue, domainInfo.epoch, domainInfo.resolution);
-                        *absoluteTimestamp = readValueSysTime.time_since_epoch().count();
-                    }
-                    else
-                    {
-                        DAQ_THROW_EXCEPTION(NotSupportedException);
-                    }
-                }
-                return i / valuesPerSample;
+                DAQ_THROW_EXCEPTION(NotSupportedException);
             }
         }
-        // debug
-        // [[maybe_unused]] auto packetValue = dataStart[size - 1];
-        // [[maybe_unused]] auto readValue = static_cast<TReadType>(packetValue);
-        // [[maybe_unused]] auto adjusted = GreaterEqual<TReadType>::Adjust(readValue, domainInfo.multiplier);
 
-        return static_cast<SizeT>(-1);
+        return index / valuesPerSample;
     }
     else
     {
@@ -653,13 +662,10 @@ ErrCode TypedReader<TReadType>::readValues(void* inputBuffer, SizeT offset, void
         }
         else
         {
-            for (std::size_t i = 0; i < toRead * valuesPerSample; ++i)
-            {
-                dataOut[i] = static_cast<TReadType>(dataStart[i]);  // C4244 - possible data loss due to conversion
-            }
+            reader::convertSampleValues(dataStart, dataOut, toRead * valuesPerSample);
 
             // Set the pointer to the value after the last copied one
-            *outputBuffer = &dataOut[toRead];
+            *outputBuffer = dataOut + (valuesPerSample * toRead);
         }
 
         return OPENDAQ_SUCCESS;
@@ -696,7 +702,7 @@ ErrCode TypedReader<ClockTick>::readValues<ClockRange>(void* inputBuffer, SizeT
     }
 
     // Set the pointer to the value after the last copied one
-    *outputBuffer = &dataOut[toRead];
+    *outputBuffer = dataOut + (valuesPerSample * toRead);
     return OPENDAQ_SUCCESS;
 }
 
@@ -737,6 +743,22 @@ bool TypedReader<ReadType>::handleDescriptorChanged(DataDescriptorPtr& descripto
         {
             valuesPerSample = dimensions[0].getSize();
         }
+        else
+        {
+            valuesPerSample = 1;
+        }
+
+        scaleDirectly = false;
+        if constexpr (std::is_same_v<ReadType, float> || std::is_same_v<ReadType, double>)
+        {
+            const auto referenceDomainInfo = descriptor.getReferenceDomainInfo();
+            const bool hasReferenceDomainOffset =
+                referenceDomainInfo.assigned() && referenceDomainInfo.getReferenceDomainOffset().assigned();
+
+            scaleDirectly = readMode == ReadMode::Scaled && postScaling.assigned() && postScaling.getType() == ScalingType::Linear &&
+                            dataSampleType == SampleTypeFromType<ReadType>::SampleType && valuesPerSample == 1 &&
+                            !hasReferenceDomainOffset;
+        }
 
         dataDescriptor = descriptor;
     }
@@ -744,12 +766,35 @@ bool TypedReader<ReadType>::handleDescriptorChanged(DataDescriptorPtr& descripto
     return valid;
 }
 
+template <typename ReadType>
+ErrCode TypedReader<ReadType>::readScaledData(const DataPacketPtr& packet, SizeT offset, void** outputBuffer, SizeT count)
+{
+    if (!scaleDirectly || (!ignoreTransform && transformFunction.assigned()))
+        return Reader::readScaledData(packet, offset, outputBuffer, count);
+
+    OPENDAQ_PARAM_NOT_NULL(outputBuffer);
+
+    return daqTry(
+        [&]
+        {
+            void* rawData = static_cast<uint8_t*>(packet.getRawData()) + offset * rawSampleSize;
+            packet.getDataDescriptor().asPtr<IScalingCalcPrivate>(true)->scaleData(rawData, count, outputBuffer);
+            *outputBuffer = static_cast<ReadType*>(*outputBuffer) + count;
+        });
+}
+
 template <typename ReadType>
 SampleType TypedReader<ReadType>::getReadType() const noexcept
 {
     return SampleTypeFromType<ReadType>::SampleType;
 }
 
+template <typename ReadType>
+SizeT TypedReader<ReadType>::getValuesPerSample() const noexcept
+{
+    return valuesPerSample;
+}
+
 ////
 // Reader
 ////
@@ -760,11 +805,21 @@ Reader::Reader(FunctionPtr transform)
 {
 }
 
+ErrCode Reader::readScaledData(const DataPacketPtr& packet, SizeT offset, void** outputBuffer, SizeT count)
+{
+    return readData(packet.getData(), offset, outputBuffer, count);
+}
+
 bool Reader::isUndefined() const noexcept
 {
     return false;
 }
 
+SizeT Reader::getValuesPerSample() const noexcept
+{
+    return 1;
+}
+
 FunctionPtr Reader::getTransformFunction() const
 {
     return transformFunction;
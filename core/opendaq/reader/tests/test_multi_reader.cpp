@@ -5234,3 +5234,73 @@ TEST_F(MultiReaderTest, UsedUnusedInput)
         ASSERT_TRUE(status.getValid());
     }
 }
+
+static SizeT findExplicitDomainStart(const std::vector<Int>& domainValues, Int start, SizeT valuesPerSample = 1)
+{
+    const auto isAtOrAfterStart = [start](const Int& value) { return value >= start; };
+    return reader::findDomainValueAtOrAfter(domainValues.data(), domainValues.size(), valuesPerSample, isAtOrAfterStart);
+}
+
+TEST(MultiReaderExplicitDomainTest, StartOnDomainValue)
+{
+    const std::vector<Int> domainValues{0, 10, 20, 30, 40, 50};
+
+    ASSERT_EQ(findExplicitDomainStart(domainValues, 0), 0u);
+    ASSERT_EQ(findExplicitDomainStart(domainValues, 30), 3u);
+    ASSERT_EQ(findExplicitDomainStart(domainValues, 50), 5u);
+}
+
+TEST(MultiReaderExplicitDomainTest, StartBetweenDomainValues)
+{
+    const std::vector<Int> domainValues{0, 10, 20, 30, 40, 50};
+
+    ASSERT_EQ(findExplicitDomainStart(domainValues, 1), 1u);
+    ASSERT_EQ(findExplicitDomainStart(domainValues, 25), 3u);
+    ASSERT_EQ(findExplicitDomainStart(domainValues, 49), 5u);
+}
+
+TEST(MultiReaderExplicitDomainTest, StartBeforeFirstDomainValue)
+{
+    const std::vector<Int> domainValues{100, 110, 120};
+
+    ASSERT_EQ(findExplicitDomainStart(domainValues, -5), 0u);
+    ASSERT_EQ(findExplicitDomainStart(domainValues, 99), 0u);
+}
+
+TEST(MultiReaderExplicitDomainTest, StartAfterLastDomainValue)
+{
+    const std::vector<Int> domainValues{100, 110, 120};
+
+    ASSERT_EQ(findExplicitDomainStart(domainValues, 121), domainValues.size());
+    ASSERT_EQ(findExplicitDomainStart({}, 0), 0u);
+}
+
+TEST(MultiReaderExplicitDomainTest, RepeatedDomainValues)
+{
+    const std::vector<Int> domainValues{0, 10, 10, 10, 20};
+
+    ASSERT_EQ(findExplicitDomainStart(domainValues, 10), 1u);
+}
+
+TEST(MultiReaderExplicitDomainTest, NonMonotonicDomainValues)
+{
+    // Explicit domains are expected to be non-decreasing. For a non-monotonic packet the search only guarantees
+    // that it stops on a value at or after the start that directly follows a value before the start.
+    const std::vector<Int> domainValues{0, 10, 20, 5, 30, 40};
+    const Int start = 15;
+
+    const SizeT index = findExplicitDomainStart(domainValues, start);
+    ASSERT_LT(index, domainValues.size());
+    ASSERT_GE(domainValues[index], start);
+    ASSERT_GT(index, 0u);
+    ASSERT_LT(domainValues[index - 1], start);
+}
+
+TEST(MultiReaderExplicitDomainTest, MultipleValuesPerSample)
+{
+    // Samples with two domain values each are scanned in order and the index of the first matching value is returned
+    const std::vector<Int> domainValues{0, 1, 10, 11, 20, 21};
+
+    ASSERT_EQ(findExplicitDomainStart(domainValues, 11, 2), 3u);
+    ASSERT_EQ(findExplicitDomainStart(domainValues, 22, 2), domainValues.size());
+}
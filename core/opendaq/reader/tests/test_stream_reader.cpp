@@ -12,6 +12,7 @@
 #include <opendaq/stream_reader_ptr.h>
 #include <testutils/testutils.h>
 #include <future>
+#include <limits>
 #include "reader_common.h"
 
 
@@ -1984,3 +1985,156 @@ TYPED_TEST(StreamReaderTest, TestReaderWithConnectedPortConnectionNotEmpty)
         ASSERT_EQ(samples[3], 444.4);
     }
 }
+
+template <typename TFrom, typename TTo>
+static void testConvertedRead(SampleType sampleType)
+{
+    // Odd count and multiple packets to cover the vector kernel tails
+    const SizeT NUM_SAMPLES = 37;
+
+    const auto signal = Signal(NullContext(), nullptr, "sig");
+    signal.setDescriptor(setupDescriptor(sampleType));
+
+    auto reader = StreamReaderBuilder()
+        .setSignal(signal)
+        .setValueReadType(SampleTypeFromType<TTo>::SampleType)
+        .setDomainReadType(SampleType::Int64)
+        .setSkipEvents(true)
+        .build();
+
+    std::vector<TFrom> expected;
+    for (SizeT packetIndex = 0; packetIndex < 3; ++packetIndex)
+    {
+        auto dataPacket = DataPacket(signal.getDescriptor(), NUM_SAMPLES);
+        auto data = static_cast<TFrom*>(dataPacket.getData());
+        for (SizeT i = 0; i < NUM_SAMPLES; ++i)
+        {
+            const auto n = static_cast<int64_t>(packetIndex * NUM_SAMPLES + i);
+            if constexpr (std::is_floating_point_v<TFrom>)
+                data[i] = static_cast<TFrom>((n - 50) * 1.25);
+            else if constexpr (std::is_signed_v<TFrom>)
+                data[i] = static_cast<TFrom>((n - 50) * 997);
+            else if (i % 2 == 0)
+                data[i] = static_cast<TFrom>(n * 601);
+            else
+                data[i] = static_cast<TFrom>(std::numeric_limits<TFrom>::max() - n * 601);
+            expected.push_back(data[i]);
+        }
+        signal.sendPacket(dataPacket);
+    }
+
+    std::vector<TTo> samples(expected.size());
+    SizeT count = samples.size();
+    reader.read(samples.data(), &count);
+
+    ASSERT_EQ(count, expected.size());
+    for (SizeT i = 0; i < count; ++i)
+        ASSERT_EQ(samples[i], static_cast<TTo>(expected[i])) << "at index " << i;
+}
+
+TEST(StreamReaderConversionTest, Int8ToFloatingPoint)
+{
+    testConvertedRead<int8_t, double>(SampleType::Int8);
+    testConvertedRead<int8_t, float>(SampleType::Int8);
+}
+
+TEST(StreamReaderConversionTest, UInt8ToFloatingPoint)
+{
+    testConvertedRead<uint8_t, double>(SampleType::UInt8);
+    testConvertedRead<uint8_t, float>(SampleType::UInt8);
+}
+
+TEST(StreamReaderConversionTest, Int16ToFloatingPoint)
+{
+    testConvertedRead<int16_t, double>(SampleType::Int16);
+    testConvertedRead<int16_t, float>(SampleType::Int16);
+}
+
+TEST(StreamReaderConversionTest, UInt16ToFloatingPoint)
+{
+    testConvertedRead<uint16_t, double>(SampleType::UInt16);
+    testConvertedRead<uint16_t, float>(SampleType::UInt16);
+}
+
+TEST(StreamReaderConversionTest, Int32ToFloatingPoint)
+{
+    testConvertedRead<int32_t, double>(SampleType::Int32);
+    testConvertedRead<int32_t, float>(SampleType::Int32);
+}
+
+TEST(StreamReaderConversionTest, UInt32ToFloatingPoint)
+{
+    testConvertedRead<uint32_t, double>(SampleType::UInt32);
+    testConvertedRead<uint32_t, float>(SampleType::UInt32);
+}
+
+TEST(StreamReaderConversionTest, Int64ToFloatingPoint)
+{
+    testConvertedRead<int64_t, double>(SampleType::Int64);
+    testConvertedRead<int64_t, float>(SampleType::Int64);
+    testConvertedRead<uint64_t, double>(SampleType::UInt64);
+    testConvertedRead<uint64_t, float>(SampleType::UInt64);
+}
+
+TEST(StreamReaderConversionTest, FloatingPointToFloatingPoint)
+{
+    testConvertedRead<float, double>(SampleType::Float32);
+    testConvertedRead<double, float>(SampleType::Float64);
+}
+
+TEST(StreamReaderScalingTest, ReadLinearScaled)
+{
+    const SizeT NUM_SAMPLES = 37;
+
+    const auto signal = Signal(NullContext(), nullptr, "sig");
+    signal.setDescriptor(setupDescriptor(SampleType::Float64, nullptr, LinearScaling(0.25, -10, SampleType::Int16, ScaledSampleType::Float64)));
+
+    // The scaled sample type matches the read type, so scaling is applied straight into the output buffer
+    auto directReader = StreamReaderBuilder()
+        .setSignal(signal)
+        .setValueReadType(SampleType::Float64)
+        .setDomainReadType(SampleType::Int64)
+        .setSkipEvents(true)
+        .build();
+
+    // Reads the scaled data buffer of the packet and converts it
+    auto convertingReader = StreamReaderBuilder()
+        .setSignal(signal)
+        .setValueReadType(SampleType::Float32)
+        .setDomainReadType(SampleType::Int64)
+        .setSkipEvents(true)
+        .build();
+
+    std::vector<double> expected;
+    for (SizeT packetIndex = 0; packetIndex < 3; ++packetIndex)
+    {
+        auto dataPacket = DataPacket(signal.getDescriptor(), NUM_SAMPLES);
+        auto data = static_cast<int16_t*>(dataPacket.getRawData());
+        for (SizeT i = 0; i < NUM_SAMPLES; ++i)
+        {
+            data[i] = static_cast<int16_t>((static_cast<int64_t>(packetIndex * NUM_SAMPLES + i) - 50) * 311);
+            expected.push_back(0.25 * data[i] - 10);
+        }
+        signal.sendPacket(dataPacket);
+    }
+
+    // Start in the middle of a packet
+    std::vector<double> doubleSamples(expected.size());
+    SizeT count = 5;
+    directReader.read(doubleSamples.data(), &count);
+    ASSERT_EQ(count, 5u);
+    count = expected.size() - 5;
+    directReader.read(doubleSamples.data() + 5, &count);
+    ASSERT_EQ(count, expected.size() - 5);
+
+    std::vector<float> floatSamples(expected.size());
+    count = expected.size();
+    convertingReader.read(floatSamples.data(), &count);
+    ASSERT_EQ(count, expected.size());
+
+    for (SizeT i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ(doubleSamples[i], expected[i]) << "at index " << i;
+        ASSERT_EQ(floatSamples[i], static_cast<float>(expected[i])) << "at index " << i;
+    }
+}
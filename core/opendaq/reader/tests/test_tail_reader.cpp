@@ -4,6 +4,8 @@
 #include <date/date.h>
 #include "reader_common.h"
 #include <opendaq/input_port_factory.h>
+#include <opendaq/dimension_factory.h>
+#include <opendaq/dimension_rule_factory.h>
 #include <future>
 
 using namespace daq;
@@ -1349,4 +1351,201 @@ TEST_F(TailReaderTest, TestReaderWithConnectedPortConnectionNotEmpty)
         ASSERT_EQ(samples[2], 333.3);
         ASSERT_EQ(samples[3], 444.4);
     }
-}
\ No newline at end of file
+}
+TEST_F(TailReaderTest, SampleBufferRolling)
+{
+    constexpr SizeT HISTORY_SIZE = 10u;
+    constexpr SizeT PACKET_SAMPLES = 4u;
+
+    this->signal.setDescriptor(setupDescriptor(SampleType::Int32));
+
+    auto reader = TailReaderBuilder()
+        .setSignal(this->signal)
+        .setHistorySize(HISTORY_SIZE)
+        .setValueReadType(SampleType::Float64)
+        .setDomainReadType(SampleType::Int64)
+        .setSkipEvents(true)
+        .setUseSampleBuffer(true)
+        .build();
+
+    const auto domainDescriptor = setupDescriptor(SampleType::Int64, LinearDataRule(2, 0), nullptr);
+    for (SizeT i = 0; i < 3; ++i)
+    {
+        auto domainPacket = DataPacket(domainDescriptor, PACKET_SAMPLES, static_cast<Int>(i * PACKET_SAMPLES * 2));
+        auto dataPacket = DataPacketWithDomain(domainPacket, this->signal.getDescriptor(), PACKET_SAMPLES);
+        auto dataPtr = static_cast<int32_t*>(dataPacket.getRawData());
+        for (SizeT j = 0; j < PACKET_SAMPLES; ++j)
+            dataPtr[j] = static_cast<int32_t>(i * PACKET_SAMPLES + j);
+
+        this->sendPacket(dataPacket);
+    }
+
+    ASSERT_EQ(reader.getAvailableCount(), HISTORY_SIZE);
+
+    SizeT count{HISTORY_SIZE};
+    double values[HISTORY_SIZE]{};
+    Int domain[HISTORY_SIZE]{};
+    auto status = reader.readWithDomain(&values, &domain, &count);
+
+    ASSERT_EQ(count, HISTORY_SIZE);
+    ASSERT_EQ(status.getOffset(), 4);
+    for (SizeT i = 0; i < HISTORY_SIZE; ++i)
+    {
+        ASSERT_EQ(values[i], static_cast<double>(i + 2));
+        ASSERT_EQ(domain[i], static_cast<Int>((i + 2) * 2));
+    }
+
+    // reading does not consume the history
+    count = 3;
+    status = reader.read(&values, &count);
+    ASSERT_EQ(count, 3u);
+    ASSERT_EQ(status.getOffset(), 18);
+    ASSERT_EQ(values[0], 9.0);
+    ASSERT_EQ(values[2], 11.0);
+}
+
+TEST_F(TailReaderTest, SampleBufferPacketLargerThanHistory)
+{
+    constexpr SizeT HISTORY_SIZE = 4u;
+    constexpr SizeT PACKET_SAMPLES = 10u;
+
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
+
+    auto reader = TailReaderBuilder()
+        .setSignal(this->signal)
+        .setHistorySize(HISTORY_SIZE)
+        .setSkipEvents(true)
+        .setUseSampleBuffer(true)
+        .build();
+
+    auto dataPacket = DataPacket(this->signal.getDescriptor(), PACKET_SAMPLES);
+    auto dataPtr = static_cast<double*>(dataPacket.getRawData());
+    for (SizeT i = 0; i < PACKET_SAMPLES; ++i)
+        dataPtr[i] = static_cast<double>(i);
+
+    this->sendPacket(dataPacket);
+
+    ASSERT_EQ(reader.getAvailableCount(), HISTORY_SIZE);
+
+    SizeT count{HISTORY_SIZE};
+    double values[HISTORY_SIZE]{};
+    reader.read(&values, &count);
+
+    ASSERT_EQ(count, HISTORY_SIZE);
+    for (SizeT i = 0; i < HISTORY_SIZE; ++i)
+        ASSERT_EQ(values[i], static_cast<double>(PACKET_SAMPLES - HISTORY_SIZE + i));
+
+    // the domain is not available without domain packets
+    count = HISTORY_SIZE;
+    Int domain[HISTORY_SIZE]{};
+    reader.readWithDomain(&values, &domain, &count);
+    ASSERT_EQ(count, 0u);
+}
+
+TEST_F(TailReaderTest, SampleBufferDescriptorChanged)
+{
+    constexpr SizeT HISTORY_SIZE = 4u;
+
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
+
+    auto reader = TailReaderBuilder()
+        .setSignal(this->signal)
+        .setHistorySize(HISTORY_SIZE)
+        .setValueReadType(SampleType::Undefined)
+        .setDomainReadType(SampleType::Undefined)
+        .setUseSampleBuffer(true)
+        .build();
+
+    {
+        SizeT count = 0;
+        auto status = reader.read(nullptr, &count);
+        ASSERT_EQ(status.getReadStatus(), ReadStatus::Event);
+        ASSERT_EQ(reader.getValueReadType(), SampleType::Float64);
+    }
+
+    auto dataPacket = DataPacket(this->signal.getDescriptor(), 2);
+    static_cast<double*>(dataPacket.getRawData())[1] = 1.5;
+    this->sendPacket(dataPacket);
+    ASSERT_EQ(reader.getAvailableCount(), 2u);
+
+    this->signal.setDescriptor(setupDescriptor(SampleType::Int32));
+    ASSERT_EQ(reader.getAvailableCount(), 0u);
+
+    dataPacket = DataPacket(this->signal.getDescriptor(), 1);
+    static_cast<int32_t*>(dataPacket.getRawData())[0] = 7;
+    this->sendPacket(dataPacket);
+
+    {
+        SizeT count = 0;
+        auto status = reader.read(nullptr, &count);
+        ASSERT_EQ(status.getReadStatus(), ReadStatus::Event);
+    }
+
+    SizeT count{HISTORY_SIZE};
+    double values[HISTORY_SIZE]{};
+    reader.read(&values, &count);
+
+    ASSERT_EQ(count, 1u);
+    ASSERT_EQ(values[0], 7.0);
+}
+
+TEST_F(TailReaderTest, SampleBufferRequiresFixedSizeReadType)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
+
+    auto builder = TailReaderBuilder()
+        .setSignal(this->signal)
+        .setHistorySize(10)
+        .setValueReadType(SampleType::Struct)
+        .setUseSampleBuffer(true);
+
+    ASSERT_THROW(builder.build(), CreateFailedException);
+}
+
+TEST_F(TailReaderTest, SampleBufferVectorSamples)
+{
+    constexpr SizeT HISTORY_SIZE = 4u;
+    constexpr SizeT PACKET_SAMPLES = 3u;
+    constexpr SizeT VALUES_PER_SAMPLE = 3u;
+
+    this->signal.setDescriptor(setupConfigurableDescriptor(SampleType::Int32)
+                                   .setDimensions(List<IDimension>(Dimension(LinearDimensionRule(1, 0, VALUES_PER_SAMPLE))))
+                                   .build());
+
+    // both modes convert each sample to three values
+    for (const bool useSampleBuffer : {false, true})
+    {
+        auto reader = TailReaderBuilder()
+            .setSignal(this->signal)
+            .setHistorySize(HISTORY_SIZE)
+            .setValueReadType(SampleType::Float64)
+            .setDomainReadType(SampleType::Int64)
+            .setSkipEvents(true)
+            .setUseSampleBuffer(useSampleBuffer)
+            .build();
+
+        // the history wraps around in the sample buffer
+        for (SizeT i = 0; i < 2; ++i)
+        {
+            auto dataPacket = createDataPacket(PACKET_SAMPLES, static_cast<Int>(i * PACKET_SAMPLES));
+            auto dataPtr = static_cast<int32_t*>(dataPacket.getRawData());
+            for (SizeT j = 0; j < PACKET_SAMPLES * VALUES_PER_SAMPLE; ++j)
+                dataPtr[j] = static_cast<int32_t>(i * PACKET_SAMPLES * VALUES_PER_SAMPLE + j);
+
+            this->sendPacket(dataPacket);
+        }
+
+        SizeT count{HISTORY_SIZE};
+        double values[HISTORY_SIZE * VALUES_PER_SAMPLE + 1]{};
+        Int domain[HISTORY_SIZE]{};
+        reader.readWithDomain(&values, &domain, &count);
+
+        ASSERT_EQ(count, HISTORY_SIZE);
+        for (SizeT i = 0; i < HISTORY_SIZE * VALUES_PER_SAMPLE; ++i)
+            ASSERT_EQ(values[i], static_cast<double>((PACKET_SAMPLES - 1) * VALUES_PER_SAMPLE + i));
+        ASSERT_EQ(values[HISTORY_SIZE * VALUES_PER_SAMPLE], 0.0);
+
+        for (SizeT i = 0; i < HISTORY_SIZE; ++i)
+            ASSERT_EQ(domain[i], static_cast<Int>(PACKET_SAMPLES - 1 + i));
+    }
+}
@@ -20,11 +20,23 @@
 #include <opendaq/task_graph.h>
 #include <opendaq/logger.h>
 #include <coretypes/listobject.h>
+#include <coretypes/dictobject.h>
+#include <coretypes/stringobject.h>
 #include <coretypes/procedure.h>
 #include <coretypes/function.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
+/*!
+ * @brief The OS scheduling priority of the worker threads of an execution domain.
+ */
+enum class ExecutionPriority : EnumType
+{
+    Normal = 0,                 ///< Default OS priority.
+    Low,                        ///< Below normal priority, for background work.
+    High                        ///< Above normal priority. May require elevated privileges; the request is logged and ignored if rejected.
+};
+
 /*!
  * @ingroup opendaq_scheduler_components
  * @addtogroup opendaq_scheduler Scheduler
@@ -132,6 +144,66 @@ DECLARE_OPENDAQ_INTERFACE(IScheduler, IBaseObject)
      */
     virtual ErrCode INTERFACE_FUNC scheduleWorkOnMainLoop(IWork* work) = 0;
 
+    // [elementType(cpuCores, IInteger)]
+    /*!
+     * @brief Adds a named execution domain with its own worker threads and work queues.
+     * @param name The name of the domain.
+     * @param numWorkers The number of worker threads of the domain. Must be greater than 0.
+     * @param priority The OS scheduling priority of the domain's worker threads.
+     * @param cpuCores The list of CPU core indices the domain's worker threads are pinned to. If empty or
+     * not assigned, the threads are not pinned.
+     * @retval OPENDAQ_ERR_ALREADYEXISTS when a domain with the same name already exists.
+     *
+     * Work scheduled on a domain only competes with other work of the same domain, so acquisition-critical
+     * processing can be isolated from background work running on the default thread-pool.
+     */
+    virtual ErrCode INTERFACE_FUNC addExecutionDomain(IString* name, SizeT numWorkers, ExecutionPriority priority, IList* cpuCores) = 0;
+
+    /*!
+     * @brief Schedules the specified work callback to run on the worker threads of an execution domain.
+     * The call does not block.
+     * @param domain The name of the execution domain. If not assigned or no such domain exists, the work
+     * runs on the default thread-pool as with @ref scheduleWork.
+     * @param work The function to schedule for execution.
+     * @retval OPENDAQ_ERR_SCHEDULER_STOPPED when the scheduler already stopped and is not accepting any more work.
+     */
+    virtual ErrCode INTERFACE_FUNC scheduleWorkOnDomain(IString* domain, IWork* work) = 0;
+
+    // [elementType(names, IString)]
+    /*!
+     * @brief Gets the names of the execution domains, including the "Default" domain of the thread-pool.
+     * @param[out] names The list of domain names.
+     */
+    virtual ErrCode INTERFACE_FUNC getExecutionDomainNames(IList** names) = 0;
+
+    // [templateType(statistics, IString, IBaseObject)]
+    /*!
+     * @brief Gets the work queue statistics of an execution domain.
+     * @param domain The name of the execution domain.
+     * @param[out] statistics The dictionary of statistics.
+     * @retval OPENDAQ_ERR_NOTFOUND when no domain with the given name exists.
+     *
+     * The dictionary contains the number of workers ("WorkerCount"), the number of queued and running work items
+     * ("QueueDepth"), the highest queue depth observed ("MaxQueueDepth"), the number of completed work items
+     * ("CompletedCount"), and the mean and maximum time in microseconds between scheduling and the start of
+     * execution ("MeanLatencyUs", "MaxLatencyUs"). Only work scheduled with @ref scheduleWork and
+     * @ref scheduleWorkOnDomain while statistics are enabled is counted.
+     */
+    virtual ErrCode INTERFACE_FUNC getExecutionDomainStatistics(IString* domain, IDict** statistics) = 0;
+
+    /*!
+     * @brief Enables or disables the collection of execution domain statistics. Disabled by default.
+     * @param enabled True to collect the statistics of work scheduled from now on.
+     *
+     * Collecting statistics adds atomic counter updates and clock reads to every scheduled work item.
+     */
+    virtual ErrCode INTERFACE_FUNC setExecutionDomainStatisticsEnabled(Bool enabled) = 0;
+
+    /*!
+     * @brief Gets whether execution domain statistics are collected.
+     * @param[out] enabled True if the statistics are collected.
+     */
+    virtual ErrCode INTERFACE_FUNC getExecutionDomainStatisticsEnabled(Bool* enabled) = 0;
 };
 /*!@}*/
 
@@ -16,6 +16,7 @@
 
 #pragma once
 #include <opendaq/scheduler.h>
+#include <opendaq/scheduler_internal.h>
 #include <coretypes/intfs.h>
 #include <coretypes/impl.h>
 #include <opendaq/logger_ptr.h>
@@ -23,6 +24,12 @@
 #include <opendaq/awaitable_ptr.h>
 #include <opendaq/task_flow.h>
 #include <opendaq/work_ptr.h>
+#include <coretypes/dictobject_factory.h>
+
+#include <atomic>
+#include <chrono>
+#include <shared_mutex>
+#include <unordered_map>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -54,7 +61,55 @@ private:
     bool running{ false };
 };
 
-class SchedulerImpl final : public ImplementationOf<IScheduler>
+// Work queue instrumentation of an execution domain. Updated lock-free by the scheduling and worker threads.
+class ExecutionDomainStatistics
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    void workScheduled();
+    void workStarted(Clock::time_point scheduledAt);
+    void workCompleted();
+
+    [[nodiscard]] DictPtr<IString, IBaseObject> toDict(SizeT workerCount) const;
+
+private:
+    std::atomic<SizeT> queueDepth{0};
+    std::atomic<SizeT> maxQueueDepth{0};
+    std::atomic<SizeT> startedCount{0};
+    std::atomic<SizeT> completedCount{0};
+    std::atomic<uint64_t> totalLatencyNs{0};
+    std::atomic<uint64_t> maxLatencyNs{0};
+};
+
+// Worker threads of a named execution domain. Input ports keep a reference to schedule their notifications
+// without looking the domain up by name.
+class ExecutionDomainImpl final : public ImplementationOf<IExecutionDomain>
+{
+public:
+    ExecutionDomainImpl(std::unique_ptr<tf::Executor> executor, bool statisticsEnabled);
+
+    ErrCode INTERFACE_FUNC scheduleWork(IWork* work) override;
+
+    void setStatisticsEnabled(bool enabled);
+    [[nodiscard]] DictPtr<IString, IBaseObject> getStatistics() const;
+
+    void waitAll();
+    void stop();
+
+private:
+    std::atomic<bool> statisticsEnabled;
+    SizeT workerCount;
+
+    // declared before the executor so that it outlives the work still running on destruction
+    ExecutionDomainStatistics statistics;
+
+    // input ports keep the domain after the scheduler is stopped, so the executor is only released under the lock
+    std::shared_mutex executorSync;
+    std::shared_ptr<tf::Executor> executor;
+};
+
+class SchedulerImpl final : public ImplementationOf<IScheduler, ISchedulerInternal>
 {
 public:
     explicit SchedulerImpl(LoggerPtr logger, SizeT numWorkers, Bool useMainLoop = false);
@@ -74,17 +129,35 @@ public:
     ErrCode INTERFACE_FUNC runMainLoopIteration() override;
     ErrCode INTERFACE_FUNC scheduleWorkOnMainLoop(IWork* work) override;
 
+    ErrCode INTERFACE_FUNC addExecutionDomain(IString* name, SizeT numWorkers, ExecutionPriority priority, IList* cpuCores) override;
+    ErrCode INTERFACE_FUNC scheduleWorkOnDomain(IString* domain, IWork* work) override;
+    ErrCode INTERFACE_FUNC getExecutionDomainNames(IList** names) override;
+    ErrCode INTERFACE_FUNC getExecutionDomainStatistics(IString* domain, IDict** statistics) override;
+    ErrCode INTERFACE_FUNC setExecutionDomainStatisticsEnabled(Bool enabled) override;
+    ErrCode INTERFACE_FUNC getExecutionDomainStatisticsEnabled(Bool* enabled) override;
+
+    // ISchedulerInternal
+    ErrCode INTERFACE_FUNC getExecutionDomain(IString* name, IExecutionDomain** domain) override;
+
     [[nodiscard]] std::size_t getWorkerCount() const;
 
+    static constexpr const char* DefaultDomainName = "Default";
+
 private:
     ErrCode checkAndPrepare(const IBaseObject* work, IAwaitable** awaitable);
+    static ExecutionDomainImpl& getDomainImpl(const ObjectPtr<IExecutionDomain>& domain);
 
     bool stopped;
     LoggerPtr logger;
     LoggerComponentPtr loggerComponent;
 
+    std::atomic<bool> statisticsEnabled{false};
+    ExecutionDomainStatistics defaultStatistics;
     std::unique_ptr<tf::Executor> executor;
 
+    std::shared_mutex domainsSync;
+    std::unordered_map<std::string, ObjectPtr<IExecutionDomain>> domains;
+
     std::unique_ptr<MainThreadLoop> mainThreadWorker;
 };
 
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/baseobject.h>
+#include <coretypes/stringobject.h>
+#include <opendaq/work.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_scheduler_components
+ * @addtogroup opendaq_scheduler SchedulerInternal
+ * @{
+ */
+
+/*!
+ * @brief The worker threads of a scheduler execution domain, resolved once from its name.
+ * It should only be used internally, e.g. by input ports that schedule a notification for every packet.
+ */
+DECLARE_OPENDAQ_INTERFACE(IExecutionDomain, IBaseObject)
+{
+    /*!
+     * @brief Schedules the specified work callback to run on the worker threads of the domain.
+     * @param work The function to schedule for execution.
+     * @retval OPENDAQ_ERR_SCHEDULER_STOPPED when the scheduler already stopped and is not accepting any more work.
+     */
+    virtual ErrCode INTERFACE_FUNC scheduleWork(IWork* work) = 0;
+};
+
+/*!
+ * @brief Interface for accessing scheduler internals. It should only be used internally.
+ */
+DECLARE_OPENDAQ_INTERFACE(ISchedulerInternal, IBaseObject)
+{
+    /*!
+     * @brief Gets the execution domain with the specified name.
+     * @param name The name of the execution domain.
+     * @param[out] domain The execution domain. Not assigned for the "Default" domain and when no such domain
+     * exists, including after the scheduler stopped; work is then scheduled on the default thread-pool with
+     * `IScheduler::scheduleWork`.
+     */
+    virtual ErrCode INTERFACE_FUNC getExecutionDomain(IString* name, IExecutionDomain** domain) = 0;
+};
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
@@ -10,8 +10,10 @@
 #include <opendaq/work_factory.h>
 #include <coretypes/function_ptr.h>
 #include <coretypes/validation.h>
+#include <coretypes/listobject_factory.h>
 #include <utility>
 #include <opendaq/thread_name.h>
+#include <opendaq/utils/thread_affinity.h>
 
 class CustomWorkerInterface : public tf::WorkerInterface
 {
@@ -27,6 +29,171 @@ public:
 };
 
 BEGIN_NAMESPACE_OPENDAQ
+
+namespace
+{
+
+class ExecutionDomainWorkerInterface : public tf::WorkerInterface
+{
+public:
+    ExecutionDomainWorkerInterface(std::string name,
+                                   ExecutionPriority priority,
+                                   std::vector<std::size_t> cpuCores,
+                                   LoggerComponentPtr loggerComponent)
+        : name(std::move(name))
+        , priority(priority)
+        , cpuCores(std::move(cpuCores))
+        , loggerComponent(std::move(loggerComponent))
+    {
+    }
+
+    void scheduler_prologue(tf::Worker& worker) override
+    {
+        daqNameThread(fmt::format("{}{}", name, worker.id()).c_str());
+
+        if (priority != ExecutionPriority::Normal)
+        {
+            const auto threadPriority = priority == ExecutionPriority::High ? utils::ThreadPriority::High : utils::ThreadPriority::Low;
+            if (!utils::setThreadPriority(threadPriority))
+                LOG_W("Failed to set the priority of execution domain \"{}\" worker {}", name, worker.id());
+        }
+
+        if (!utils::setThreadAffinity(cpuCores))
+            LOG_W("Failed to pin execution domain \"{}\" worker {} to CPU cores", name, worker.id());
+    }
+
+    void scheduler_epilogue(tf::Worker& /*worker*/, std::exception_ptr /*ptr*/) override
+    {
+    }
+
+private:
+    std::string name;
+    ExecutionPriority priority;
+    std::vector<std::size_t> cpuCores;
+    LoggerComponentPtr loggerComponent;
+};
+
+template <typename T>
+void updateMaximum(std::atomic<T>& maximum, T value)
+{
+    T current = maximum.load(std::memory_order_relaxed);
+    while (value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+// Without statistics, the work is scheduled as is
+void scheduleOnExecutor(tf::Executor& executor, ExecutionDomainStatistics* statistics, IWork* work)
+{
+    if (statistics == nullptr)
+    {
+        executor.silent_async([work = WorkPtr(work)]()
+        {
+            work->execute();
+        });
+        return;
+    }
+
+    statistics->workScheduled();
+    executor.silent_async([work = WorkPtr(work), statistics, scheduledAt = ExecutionDomainStatistics::Clock::now()]()
+    {
+        statistics->workStarted(scheduledAt);
+        work->execute();
+        statistics->workCompleted();
+    });
+}
+
+}
+
+void ExecutionDomainStatistics::workScheduled()
+{
+    const SizeT depth = queueDepth.fetch_add(1, std::memory_order_relaxed) + 1;
+    updateMaximum(maxQueueDepth, depth);
+}
+
+void ExecutionDomainStatistics::workStarted(Clock::time_point scheduledAt)
+{
+    const auto latency = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - scheduledAt).count());
+    startedCount.fetch_add(1, std::memory_order_relaxed);
+    totalLatencyNs.fetch_add(latency, std::memory_order_relaxed);
+    updateMaximum(maxLatencyNs, latency);
+}
+
+void ExecutionDomainStatistics::workCompleted()
+{
+    completedCount.fetch_add(1, std::memory_order_relaxed);
+    queueDepth.fetch_sub(1, std::memory_order_relaxed);
+}
+
+DictPtr<IString, IBaseObject> ExecutionDomainStatistics::toDict(SizeT workerCount) const
+{
+    const SizeT started = startedCount.load(std::memory_order_relaxed);
+    const uint64_t totalLatency = totalLatencyNs.load(std::memory_order_relaxed);
+
+    auto dict = Dict<IString, IBaseObject>();
+    dict.set("WorkerCount", static_cast<Int>(workerCount));
+    dict.set("QueueDepth", static_cast<Int>(queueDepth.load(std::memory_order_relaxed)));
+    dict.set("MaxQueueDepth", static_cast<Int>(maxQueueDepth.load(std::memory_order_relaxed)));
+    dict.set("CompletedCount", static_cast<Int>(completedCount.load(std::memory_order_relaxed)));
+    dict.set("MeanLatencyUs", started == 0 ? 0.0 : static_cast<Float>(totalLatency) / static_cast<Float>(started) / 1000.0);
+    dict.set("MaxLatencyUs", static_cast<Float>(maxLatencyNs.load(std::memory_order_relaxed)) / 1000.0);
+    return dict;
+}
+
+ExecutionDomainImpl::ExecutionDomainImpl(std::unique_ptr<tf::Executor> executor, bool statisticsEnabled)
+    : statisticsEnabled(statisticsEnabled)
+    , workerCount(executor->num_workers())
+    , executor(std::move(executor))
+{
+}
+
+ErrCode ExecutionDomainImpl::scheduleWork(IWork* work)
+{
+    OPENDAQ_PARAM_NOT_NULL(work);
+
+    std::shared_lock lock(executorSync);
+    if (!executor)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_SCHEDULER_STOPPED);
+
+    scheduleOnExecutor(*executor, statisticsEnabled.load(std::memory_order_relaxed) ? &statistics : nullptr, work);
+    return OPENDAQ_SUCCESS;
+}
+
+void ExecutionDomainImpl::setStatisticsEnabled(bool enabled)
+{
+    statisticsEnabled = enabled;
+}
+
+DictPtr<IString, IBaseObject> ExecutionDomainImpl::getStatistics() const
+{
+    return statistics.toDict(workerCount);
+}
+
+void ExecutionDomainImpl::waitAll()
+{
+    // waits without the lock, as the running work may schedule more
+    std::shared_ptr<tf::Executor> runningExecutor;
+    {
+        std::shared_lock lock(executorSync);
+        runningExecutor = executor;
+    }
+
+    if (runningExecutor)
+        runningExecutor->wait_for_all();
+}
+
+void ExecutionDomainImpl::stop()
+{
+    std::shared_ptr<tf::Executor> stoppedExecutor;
+    {
+        std::unique_lock lock(executorSync);
+        stoppedExecutor = std::move(executor);
+    }
+
+    // destroyed without the lock, as it waits for the running work; a concurrent waitAll destroys it instead
+    stoppedExecutor.reset();
+}
+
 MainThreadLoop::MainThreadLoop(const LoggerPtr& logger)
 {
     this->loggerComponent = logger.getOrAddComponent("MainThreadLoop");
@@ -197,6 +364,10 @@ ErrCode SchedulerImpl::waitAll()
     LOGP_I("Waiting for all current tasks to complete")
     executor->wait_for_all();
 
+    std::shared_lock lock(domainsSync);
+    for (const auto& [name, domain] : domains)
+        getDomainImpl(domain).waitAll();
+
     return OPENDAQ_SUCCESS;
 }
 
@@ -208,6 +379,15 @@ ErrCode SchedulerImpl::stop()
     LOGP_T("Stopping scheduler")
     executor.reset();
 
+    LOGP_T("Stopping execution domains")
+    {
+        // input ports may still hold the domains; they reject work from now on
+        std::unique_lock lock(domainsSync);
+        for (const auto& [name, domain] : domains)
+            getDomainImpl(domain).stop();
+        domains.clear();
+    }
+
     LOGP_T("Stopping main thread worker")
     mainThreadWorker.reset();
 
@@ -250,11 +430,148 @@ ErrCode SchedulerImpl::scheduleWork(IWork* work)
     if (stopped)
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_SCHEDULER_STOPPED);
 
-    executor->silent_async([work = WorkPtr(work)]()
+    scheduleOnExecutor(*executor, statisticsEnabled.load(std::memory_order_relaxed) ? &defaultStatistics : nullptr, work);
+    return OPENDAQ_SUCCESS;
+}
+
+ExecutionDomainImpl& SchedulerImpl::getDomainImpl(const ObjectPtr<IExecutionDomain>& domain)
+{
+    return *static_cast<ExecutionDomainImpl*>(domain.getObject());  // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
+}
+
+ErrCode SchedulerImpl::addExecutionDomain(IString* name, SizeT numWorkers, ExecutionPriority priority, IList* cpuCores)
+{
+    OPENDAQ_PARAM_NOT_NULL(name);
+
+    if (numWorkers == 0)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "Execution domain must have at least one worker");
+
+    if (stopped)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_SCHEDULER_STOPPED);
+
+    const std::string domainName = StringPtr::Borrow(name);
+    if (domainName.empty() || domainName == DefaultDomainName)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "Invalid execution domain name \"{}\"", domainName);
+
+    return daqTry([&]() -> ErrCode
     {
-        work->execute();
+        std::vector<std::size_t> cores;
+        if (cpuCores != nullptr)
+        {
+            for (const auto& core : ListPtr<IInteger>::Borrow(cpuCores))
+            {
+                const Int index = core;
+                if (index < 0)
+                    return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "CPU core index must not be negative");
+                cores.push_back(static_cast<std::size_t>(index));
+            }
+        }
+
+        std::unique_lock lock(domainsSync);
+        if (domains.find(domainName) != domains.end())
+            return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_ALREADYEXISTS, "Execution domain \"{}\" already exists", domainName);
+
+        auto domainExecutor = std::make_unique<tf::Executor>(
+            numWorkers, std::make_shared<ExecutionDomainWorkerInterface>(domainName, priority, std::move(cores), loggerComponent));
+        domains.emplace(domainName,
+                        createWithImplementation<IExecutionDomain, ExecutionDomainImpl>(std::move(domainExecutor), statisticsEnabled.load()));
+
+        LOG_D("Added execution domain \"{}\" with {} workers.", domainName, numWorkers)
+        return OPENDAQ_SUCCESS;
     });
+}
+
+ErrCode SchedulerImpl::scheduleWorkOnDomain(IString* domain, IWork* work)
+{
+    OPENDAQ_PARAM_NOT_NULL(work);
+
+    if (stopped)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_SCHEDULER_STOPPED);
+
+    if (domain != nullptr)
+    {
+        std::shared_lock lock(domainsSync);
+        if (!domains.empty())
+        {
+            const auto it = domains.find(StringPtr::Borrow(domain).toStdString());
+            if (it != domains.end())
+                return it->second->scheduleWork(work);
+        }
+    }
+
+    return scheduleWork(work);
+}
+
+ErrCode SchedulerImpl::getExecutionDomain(IString* name, IExecutionDomain** domain)
+{
+    OPENDAQ_PARAM_NOT_NULL(name);
+    OPENDAQ_PARAM_NOT_NULL(domain);
+
+    // the domains are removed when the scheduler stops
+    std::shared_lock lock(domainsSync);
+    const auto it = domains.find(StringPtr::Borrow(name).toStdString());
+    *domain = it != domains.end() ? it->second.addRefAndReturn() : nullptr;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode SchedulerImpl::getExecutionDomainNames(IList** names)
+{
+    OPENDAQ_PARAM_NOT_NULL(names);
+
+    return daqTry([&]
+    {
+        auto list = List<IString>(DefaultDomainName);
+
+        std::shared_lock lock(domainsSync);
+        for (const auto& [name, domain] : domains)
+            list.pushBack(name);
+
+        *names = list.detach();
+    });
+}
+
+ErrCode SchedulerImpl::getExecutionDomainStatistics(IString* domain, IDict** statistics)
+{
+    OPENDAQ_PARAM_NOT_NULL(domain);
+    OPENDAQ_PARAM_NOT_NULL(statistics);
+
+    if (stopped)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_SCHEDULER_STOPPED);
+
+    return daqTry([&]() -> ErrCode
+    {
+        const std::string domainName = StringPtr::Borrow(domain);
+        if (domainName == DefaultDomainName)
+        {
+            *statistics = defaultStatistics.toDict(executor->num_workers()).detach();
+            return OPENDAQ_SUCCESS;
+        }
+
+        std::shared_lock lock(domainsSync);
+        const auto it = domains.find(domainName);
+        if (it == domains.end())
+            return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOTFOUND, "Execution domain \"{}\" not found", domainName);
+
+        *statistics = getDomainImpl(it->second).getStatistics().detach();
+        return OPENDAQ_SUCCESS;
+    });
+}
+
+ErrCode SchedulerImpl::setExecutionDomainStatisticsEnabled(Bool enabled)
+{
+    std::shared_lock lock(domainsSync);
+    statisticsEnabled = enabled;
+    for (const auto& [name, domain] : domains)
+        getDomainImpl(domain).setStatisticsEnabled(enabled);
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode SchedulerImpl::getExecutionDomainStatisticsEnabled(Bool* enabled)
+{
+    OPENDAQ_PARAM_NOT_NULL(enabled);
 
+    *enabled = statisticsEnabled.load();
     return OPENDAQ_SUCCESS;
 }
 
@@ -4,7 +4,13 @@
 #include <chrono>
 #include <thread>
 #include <future>
+#include <atomic>
+#include <vector>
+#include <opendaq/scheduler_internal.h>
 #include <opendaq/work_factory.h>
+#include <coretypes/listobject_factory.h>
+#include <coretypes/stringobject_factory.h>
+#include <testutils/testutils.h>
 
 #include <opendaq/logger_factory.h>
 
@@ -214,4 +220,151 @@ TEST_F(SchedulerTestCommon, ExecutesOneTimeWorkWithTimeLoop)
     scheduler.runMainLoop(loopTime);
     auto end = std::chrono::steady_clock::now();
     ASSERT_TRUE(end - begin >= std::chrono::milliseconds(loopTime));
-}
\ No newline at end of file
+}
+TEST_F(SchedulerTestCommon, AddExecutionDomain)
+{
+    auto scheduler = Scheduler(Logger(), 1);
+    scheduler.addExecutionDomain("Acquisition", 2, ExecutionPriority::Normal, List<IInteger>());
+
+    ASSERT_EQ(scheduler.getExecutionDomainNames(), List<IString>("Default", "Acquisition"));
+    ASSERT_THROW(scheduler.addExecutionDomain("Acquisition", 1, ExecutionPriority::Normal, nullptr), AlreadyExistsException);
+    ASSERT_THROW(scheduler.addExecutionDomain("Default", 1, ExecutionPriority::Normal, nullptr), InvalidParameterException);
+    ASSERT_THROW(scheduler.addExecutionDomain("Empty", 0, ExecutionPriority::Normal, nullptr), InvalidParameterException);
+}
+
+TEST_F(SchedulerTestCommon, WorkRunsOnDomainThreads)
+{
+    auto scheduler = Scheduler(Logger(), 1);
+    scheduler.addExecutionDomain("Acquisition", 1, ExecutionPriority::Low, nullptr);
+
+    std::promise<std::thread::id> defaultThread;
+    std::promise<std::thread::id> domainThread;
+    scheduler.scheduleWork(Work([&] { defaultThread.set_value(std::this_thread::get_id()); }));
+    scheduler.scheduleWorkOnDomain("Acquisition", Work([&] { domainThread.set_value(std::this_thread::get_id()); }));
+
+    const auto defaultId = defaultThread.get_future().get();
+    const auto domainId = domainThread.get_future().get();
+    ASSERT_NE(defaultId, domainId);
+    ASSERT_NE(domainId, std::this_thread::get_id());
+}
+
+TEST_F(SchedulerTestCommon, UnknownDomainFallsBackToDefault)
+{
+    auto scheduler = Scheduler(Logger(), 1);
+    scheduler.setExecutionDomainStatisticsEnabled(true);
+
+    std::promise<void> executed;
+    scheduler.scheduleWorkOnDomain("Unknown", Work([&] { executed.set_value(); }));
+
+    ASSERT_EQ(executed.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    scheduler.waitAll();
+    ASSERT_EQ(scheduler.getExecutionDomainStatistics("Default").get("CompletedCount"), 1);
+}
+
+TEST_F(SchedulerTestCommon, ExecutionDomainStatistics)
+{
+    auto scheduler = Scheduler(Logger(), 1);
+    scheduler.addExecutionDomain("Acquisition", 1, ExecutionPriority::Normal, nullptr);
+    scheduler.setExecutionDomainStatisticsEnabled(true);
+
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    scheduler.scheduleWorkOnDomain("Acquisition", Work([released] { released.wait(); }));
+    for (int i = 0; i < 4; ++i)
+        scheduler.scheduleWorkOnDomain("Acquisition", Work([] {}));
+
+    auto statistics = scheduler.getExecutionDomainStatistics("Acquisition");
+    ASSERT_EQ(statistics.get("WorkerCount"), 1);
+    ASSERT_EQ(statistics.get("MaxQueueDepth"), 5);
+
+    release.set_value();
+    scheduler.waitAll();
+
+    statistics = scheduler.getExecutionDomainStatistics("Acquisition");
+    ASSERT_EQ(statistics.get("QueueDepth"), 0);
+    ASSERT_EQ(statistics.get("CompletedCount"), 5);
+    ASSERT_GE(static_cast<Float>(statistics.get("MaxLatencyUs")), static_cast<Float>(statistics.get("MeanLatencyUs")));
+    ASSERT_THROW(scheduler.getExecutionDomainStatistics("Unknown"), NotFoundException);
+}
+
+TEST_F(SchedulerTestCommon, ExecutionDomainStatisticsDisabledByDefault)
+{
+    auto scheduler = Scheduler(Logger(), 1);
+    scheduler.addExecutionDomain("Acquisition", 1, ExecutionPriority::Normal, nullptr);
+    ASSERT_FALSE(scheduler.getExecutionDomainStatisticsEnabled());
+
+    scheduler.scheduleWork(Work([] {}));
+    scheduler.scheduleWorkOnDomain("Acquisition", Work([] {}));
+    scheduler.waitAll();
+
+    ASSERT_EQ(scheduler.getExecutionDomainStatistics("Default").get("CompletedCount"), 0);
+    ASSERT_EQ(scheduler.getExecutionDomainStatistics("Acquisition").get("CompletedCount"), 0);
+
+    scheduler.setExecutionDomainStatisticsEnabled(true);
+    ASSERT_TRUE(scheduler.getExecutionDomainStatisticsEnabled());
+
+    scheduler.scheduleWorkOnDomain("Acquisition", Work([] {}));
+    scheduler.waitAll();
+    ASSERT_EQ(scheduler.getExecutionDomainStatistics("Acquisition").get("CompletedCount"), 1);
+}
+
+TEST_F(SchedulerTestCommon, ExecutionDomainHandle)
+{
+    auto scheduler = Scheduler(Logger(), 1);
+    scheduler.addExecutionDomain("Acquisition", 1, ExecutionPriority::Normal, nullptr);
+    const auto schedulerInternal = scheduler.asPtr<ISchedulerInternal>();
+
+    ObjectPtr<IExecutionDomain> domain;
+    ASSERT_SUCCEEDED(schedulerInternal->getExecutionDomain(String("Unknown"), &domain));
+    ASSERT_FALSE(domain.assigned());
+
+    ASSERT_SUCCEEDED(schedulerInternal->getExecutionDomain(String("Acquisition"), &domain));
+    ASSERT_TRUE(domain.assigned());
+
+    std::promise<void> executed;
+    ASSERT_SUCCEEDED(domain->scheduleWork(Work([&] { executed.set_value(); })));
+    ASSERT_EQ(executed.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+
+    // a handle kept after the scheduler stopped rejects work
+    scheduler.stop();
+    ASSERT_EQ(domain->scheduleWork(Work([] {})), OPENDAQ_ERR_SCHEDULER_STOPPED);
+    daqClearErrorInfo();
+}
+
+TEST_F(SchedulerTestCommon, ExecutionDomainHandleStopWhileScheduling)
+{
+    auto scheduler = Scheduler(Logger(), 1);
+    scheduler.addExecutionDomain("Acquisition", 1, ExecutionPriority::Normal, nullptr);
+
+    ObjectPtr<IExecutionDomain> domain;
+    ASSERT_SUCCEEDED(scheduler.asPtr<ISchedulerInternal>()->getExecutionDomain(String("Acquisition"), &domain));
+
+    std::atomic<bool> unexpectedError{false};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&]
+        {
+            while (true)
+            {
+                const ErrCode errCode = domain->scheduleWork(Work([] {}));
+                if (errCode == OPENDAQ_ERR_SCHEDULER_STOPPED)
+                    break;
+                if (OPENDAQ_FAILED(errCode))
+                {
+                    unexpectedError = true;
+                    break;
+                }
+            }
+            daqClearErrorInfo();
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    scheduler.stop();
+
+    for (auto& thread : threads)
+        thread.join();
+
+    ASSERT_FALSE(unexpectedError);
+}
@@ -22,6 +22,11 @@
 
 BEGIN_NAMESPACE_OPENDAQ
 
+/*#
+ * [templated(defaultAliasName: AllocatorPtr)]
+ * [interfaceSmartPtr(IAllocator, GenericAllocatorPtr)]
+ */
+
 /*!
  * @ingroup opendaq_utility
  * @addtogroup opendaq_allocator Allocator
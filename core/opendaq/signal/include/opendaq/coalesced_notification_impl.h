@@ -0,0 +1,119 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <opendaq/input_port_notifications_ptr.h>
+#include <opendaq/input_port_ptr.h>
+#include <opendaq/logger_component_ptr.h>
+#include <opendaq/scheduler_ptr.h>
+#include <opendaq/scheduler_internal.h>
+#include <opendaq/work_ptr.h>
+#include <opendaq/scheduler_errors.h>
+#include <opendaq/custom_log.h>
+#include <coretypes/weakrefptr.h>
+#include <atomic>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief Packet-ready notification work of an input port of which at most one instance is pending on the scheduler.
+ *
+ * `notify` is called by the producer for every enqueued packet, but schedules the work only when none is pending.
+ * Before calling the listener, the work takes a snapshot of the notification count. If notifications arrived
+ * while the listener was running, the work schedules itself again instead of being re-armed by the producer,
+ * so no notification is lost and the listener is never called concurrently for the same port.
+ */
+class CoalescedNotificationImpl : public ImplementationOf<IWork>
+{
+public:
+    CoalescedNotificationImpl(SchedulerPtr scheduler,
+                              WeakRefPtr<IInputPortNotifications> listenerRef,
+                              WeakRefPtr<IInputPort> portRef,
+                              LoggerComponentPtr loggerComponent)
+        : scheduler(std::move(scheduler))
+        , listenerRef(std::move(listenerRef))
+        , portRef(std::move(portRef))
+        , loggerComponent(std::move(loggerComponent))
+        , pending(0)
+    {
+    }
+
+    // must not be called while notifications are being processed; if not assigned, the default thread-pool is used
+    void setDomain(const ObjectPtr<IExecutionDomain>& domain)
+    {
+        this->domain = domain;
+    }
+
+    ErrCode notify()
+    {
+        if (pending.fetch_add(1, std::memory_order_acq_rel) != 0)
+            return OPENDAQ_SUCCESS;
+
+        return schedule();
+    }
+
+    ErrCode INTERFACE_FUNC execute() override
+    {
+        SizeT seen = pending.load(std::memory_order_acquire);
+
+        const auto listener = listenerRef.getRef();
+        const auto port = portRef.getRef();
+        if (!listener.assigned() || !port.assigned())
+        {
+            pending.store(0, std::memory_order_release);
+            return OPENDAQ_SUCCESS;
+        }
+
+        try
+        {
+            listener.packetReceived(port);
+        }
+        catch (const std::exception& e)
+        {
+            LOG_E("Input port notification failed: {}", e.what());
+        }
+
+        if (pending.compare_exchange_strong(seen, 0, std::memory_order_acq_rel))
+            return OPENDAQ_SUCCESS;
+
+        // packets arrived while the listener was running; the count stays non-zero so producers do not schedule
+        return schedule();
+    }
+
+private:
+    // If the work cannot be scheduled, the count is cleared so that the next notification tries again
+    ErrCode schedule()
+    {
+        const ErrCode errCode = domain.assigned() ? domain->scheduleWork(this) : scheduler->scheduleWork(this);
+        if (OPENDAQ_SUCCEEDED(errCode))
+            return errCode;
+
+        pending.store(0, std::memory_order_release);
+        if (errCode == OPENDAQ_ERR_SCHEDULER_STOPPED)
+            return OPENDAQ_SUCCESS;
+        return errCode;
+    }
+
+    SchedulerPtr scheduler;
+    WeakRefPtr<IInputPortNotifications> listenerRef;
+    WeakRefPtr<IInputPort> portRef;
+    LoggerComponentPtr loggerComponent;
+    ObjectPtr<IExecutionDomain> domain;
+    std::atomic<SizeT> pending;
+};
+
+END_NAMESPACE_OPENDAQ
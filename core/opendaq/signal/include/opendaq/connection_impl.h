@@ -23,11 +23,14 @@
 #include <coretypes/weakrefobj.h>
 #include <opendaq/event_packet_ptr.h>
 #include <opendaq/data_packet_ptr.h>
+#include <opendaq/spsc_packet_queue.h>
 
 #ifdef OPENDAQ_THREAD_SAFE
     #include <mutex>
 #endif
 
+#include <atomic>
+#include <memory>
 #include <queue>
 
 BEGIN_NAMESPACE_OPENDAQ
@@ -69,6 +72,7 @@ public:
     // IConnectionInternal
     ErrCode INTERFACE_FUNC enqueueLastDescriptor() override;
 
+    // Only contains the queued packets in `PacketQueueMode::Locked` mode.
     [[nodiscard]] const std::deque<PacketPtr>& getPackets() const noexcept;
 
 #ifdef OPENDAQ_THREAD_SAFE
@@ -86,6 +90,15 @@ public:
     }
 #endif
 
+    // Takes the lock only if the packets are stored in the locked queue.
+    template <typename Func>
+    auto withQueueLock(Func&& func) const
+    {
+        if (spscQueue)
+            return func();
+        return withLock(std::forward<Func>(func));
+    }
+
 private:
     union DomainValue
     {
@@ -108,6 +121,26 @@ private:
     DataDescriptorPtr valueDataDescriptor;
     DataDescriptorPtr domainDataDescriptor;
 
+    // Lock-free mode state. Data packets are dropped once packetQueueCapacity packets are queued.
+    // The ring holds SpscReservedSlots slots more than that so that event and gap packets usually
+    // fit into it; when it is full, they are spilled into spscOverflow, guarded by the lock.
+    // While the overflow queue is non-empty, the producer appends to it instead of to the ring.
+    static constexpr SizeT SpscReservedSlots = 16;
+    SizeT packetQueueCapacity{};
+    std::unique_ptr<SpscPacketQueue> spscQueue;
+    std::deque<PacketPtr> spscOverflow;
+    std::atomic<bool> spscOverflowPending{false};
+    PacketPtr spscFrontPacket;
+    std::atomic<bool> spscFrontPacketPending{false};
+    SizeT droppedPacketsCnt{};
+
+    // Lock-free mode counterparts of the protected counters, updated concurrently by the producer
+    // and consumer threads. In locked mode, the plain counters are used under the lock instead.
+    std::atomic<SizeT> spscSamplesCnt{};
+    std::atomic<SizeT> spscEventPacketsCnt{};
+    std::atomic<SizeT> spscGapPacketsCnt{};
+    std::atomic<bool> spscQueueEmpty{true};
+
 #ifdef OPENDAQ_THREAD_SAFE
     mutable std::mutex mutex;
 #endif
@@ -121,6 +154,21 @@ private:
     bool doGapCheck(const DataPacketPtr& domainPacket, DomainValue& diff);
     void initGapCheck(const EventPacketPtr& packet);
     void countPackets();
+    void increaseCount(SizeT& counter, std::atomic<SizeT>& spscCounter, SizeT value);
+    void decreaseCount(SizeT& counter, std::atomic<SizeT>& spscCounter, SizeT value);
+    SizeT loadCount(const SizeT& counter, const std::atomic<SizeT>& spscCounter) const;
+    void setLastDescriptors(const DataDescriptorPtr& valueDescriptor, const DataDescriptorPtr& domainDescriptor);
+
+    template <class P>
+    bool enqueueLockFree(P&& packet, bool checkGaps);
+    void pushLockFree(PacketPtr&& packet);
+    bool dequeueLockFree(PacketPtr& packet);
+    bool popOverflow(PacketPtr& packet);
+    SizeT getLockFreePacketCount();
+    bool testAndClearQueueEmpty();
+    PacketPtr peekLockFree();
+    template <typename F>
+    void forEachPacket(F&& f);
 
     DomainValue numberToDomainValue(const NumberPtr& number);
 
@@ -17,6 +17,7 @@
 #pragma once
 #include <opendaq/packet.h>
 #include <opendaq/data_descriptor.h>
+#include <opendaq/allocator.h>
 #include <coretypes/number.h>
 #include <coretypes/type_manager.h>
 
@@ -226,6 +227,30 @@ OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
     SizeT, bufferSize
 )
 
+/*!
+ * @brief Creates a Data packet whose data memory is obtained from an allocator.
+ *
+ * @param domainPacket The Data packet carrying domain data.
+ * @param descriptor The descriptor of the signal sending the data.
+ * @param sampleCount The number of samples in the packet.
+ * @param offset Optional packet offset parameter, used to calculate the data of the packet
+ * if the Data rule of the Signal descriptor is not explicit.
+ * @param allocator The allocator used for the raw data buffer and, if the descriptor specifies
+ * post scaling, for the scaled data buffer.
+ *
+ * The packet holds a reference to the allocator and returns its buffers to it when destroyed. Sharing
+ * one recycling allocator (see PoolAllocator) among the packets of a signal avoids a heap allocation
+ * per packet once the allocator is warmed up.
+ */
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, DataPacketWithAllocator, IDataPacket,
+    IDataPacket*, domainPacket,
+    IDataDescriptor*, descriptor,
+    SizeT, sampleCount,
+    INumber*, offset,
+    IAllocator*, allocator
+)
+
 /*!
  * @brief Creates a Data packet with a given descriptor, sample count, memory size of each sample,
  * and an optional implicit value.
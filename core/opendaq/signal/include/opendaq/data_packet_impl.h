@@ -16,6 +16,7 @@
 
 #pragma once
 #include <coretypes/intfs.h>
+#include <opendaq/allocator_ptr.h>
 #include <opendaq/data_descriptor_ptr.h>
 #include <opendaq/data_rule_calc_private.h>
 #include <opendaq/deleter_ptr.h>
@@ -264,6 +265,12 @@ public:
                             SizeT sampleCount,
                             INumber* offset);
 
+    explicit DataPacketImpl(IDataPacket* domainPacket,
+                            IDataDescriptor* descriptor,
+                            SizeT sampleCount,
+                            INumber* offset,
+                            IAllocator* allocator);
+
     explicit DataPacketImpl(IDataDescriptor* descriptor, SizeT sampleCount, INumber* offset);
 
     explicit DataPacketImpl(PacketDetails::CreatePacketNoMemoryTag,
@@ -317,8 +324,10 @@ protected:
     void freeMemory();
     void freeScaledData();
     void initPacket();
+    void* allocateMemory(SizeT size, SizeT align);
 
     DeleterPtr deleter;
+    AllocatorPtr allocator;
     DataDescriptorPtr descriptor;
     NumberPtr offset = nullptr;
     uint32_t sampleCount;
@@ -336,6 +345,7 @@ protected:
     bool hasRawDataOnly;
     bool externalMemory;
     bool hasReferenceDomainOffset;
+    bool scaledDataFromAllocator = false;
 };
 
 template <typename TInterface, typename... TInterfaces>
@@ -359,7 +369,18 @@ DataPacketImpl<TInterface, TInterfaces...>::DataPacketImpl(IDataPacket* domainPa
                                                            IDataDescriptor* descriptor,
                                                            SizeT sampleCount,
                                                            INumber* offset)
+    : DataPacketImpl<TInterface, TInterfaces...>(domainPacket, descriptor, sampleCount, offset, nullptr)
+{
+}
+
+template <typename TInterface, typename... TInterfaces>
+DataPacketImpl<TInterface, TInterfaces...>::DataPacketImpl(IDataPacket* domainPacket,
+                                                           IDataDescriptor* descriptor,
+                                                           SizeT sampleCount,
+                                                           INumber* offset,
+                                                           IAllocator* allocator)
     : Super(domainPacket)
+    , allocator(allocator)
     , descriptor(descriptor)
     , offset(offset)
     , sampleCount(static_cast<uint32_t>(sampleCount))
@@ -381,12 +402,7 @@ DataPacketImpl<TInterface, TInterfaces...>::DataPacketImpl(IDataPacket* domainPa
     rawDataSize = this->sampleCount * rawSampleSize;
 
     if (rawDataSize > 0)
-    {
-        data = std::malloc(rawDataSize);
-
-        if (data == nullptr)
-            DAQ_THROW_EXCEPTION(NoMemoryException);
-    }
+        data = allocateMemory(rawDataSize, rawSampleSize);
     memorySize = rawDataSize;
 
     initPacket();
@@ -583,7 +599,14 @@ ErrCode DataPacketImpl<TInterface, TInterfaces...>::getData(void** address)
             ErrCode err = daqTry(
                 [&]()
                 {
-                    if (hasScalingCalc)
+                    if (hasScalingCalc && allocator.assigned())
+                    {
+                        void* buffer = allocateMemory(dataSize, sampleSize);
+                        scaledDataFromAllocator = true;
+                        scaledData = buffer;
+                        descriptor.asPtr<IScalingCalcPrivate>(true)->scaleData(data, sampleCount, &buffer);
+                    }
+                    else if (hasScalingCalc)
                     {
                         scaledData = descriptor.asPtr<IScalingCalcPrivate>(true)->scaleData(data, sampleCount);
                     }
@@ -798,10 +821,7 @@ ErrCode DataPacketImpl<TInterface, TInterfaces...>::reuse(IDataDescriptor* newDe
         scaledData = nullptr;
 
         memorySize = static_cast<uint32_t>(newRawDataSize);
-        data = std::malloc(newRawDataSize);
-
-        if (data == nullptr)
-            DAQ_THROW_EXCEPTION(NoMemoryException);
+        data = allocateMemory(newRawDataSize, newRawSampleSize);
     }
     else
     {
@@ -839,7 +859,27 @@ void DataPacketImpl<TInterface, TInterfaces...>::internalDispose(bool disposing)
 template <typename TInterface, typename... TInterfaces>
 void DataPacketImpl<TInterface, TInterfaces...>::freeScaledData()
 {
-    std::free(scaledData);
+    if (scaledDataFromAllocator)
+        allocator->free(scaledData);
+    else
+        std::free(scaledData);
+
+    scaledDataFromAllocator = false;
+}
+
+template <typename TInterface, typename... TInterfaces>
+void* DataPacketImpl<TInterface, TInterfaces...>::allocateMemory(SizeT size, SizeT align)
+{
+    void* address;
+    if (allocator.assigned())
+        address = allocator.allocate(descriptor, size, align);
+    else
+        address = std::malloc(size);
+
+    if (address == nullptr)
+        DAQ_THROW_EXCEPTION(NoMemoryException);
+
+    return address;
 }
 
 template <typename TInterface, typename... TInterfaces>
@@ -850,6 +890,10 @@ void DataPacketImpl<TInterface, TInterfaces...>::freeMemory()
         if (deleter.assigned())
             deleter.deleteMemory(data);
     }
+    else if (allocator.assigned())
+    {
+        allocator->free(data);
+    }
     else
     {
         std::free(data);
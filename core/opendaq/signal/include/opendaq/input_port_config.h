@@ -34,9 +34,20 @@ enum class PacketReadyNotification : EnumType
     SameThread,                 ///< Call the listener in the same thread the notification was received.
     Scheduler,                  ///< Call the listener asynchronously or in another thread.
     SchedulerQueueWasEmpty,     ///< Call the listener asynchronously or in another thread only if connection packet queue was empty
+    SchedulerCoalesced,         ///< Call the listener asynchronously or in another thread, with at most one pending call per input port.
+                                ///< The listener must process all packets in the connection queue.
     Unspecified = 99            ///< Invalid state for ports, used by readers when asked to preserve port notification mechanism
 };
 
+/*!
+ * @brief Represents the type of packet queue used by connections of an input port.
+ */
+enum class PacketQueueMode : EnumType
+{
+    Locked = 0,                 ///< Unbounded queue guarded by a mutex. Safe for any number of producers and consumers.
+    LockFreeSpsc                ///< Bounded lock-free ring queue. Requires a single producer and a single consumer thread.
+};
+
  /*!
  * @ingroup opendaq_signal_path
  * @addtogroup opendaq_input_port Input port
@@ -117,6 +128,55 @@ DECLARE_OPENDAQ_INTERFACE(IInputPortConfig, IInputPort)
      * @brief Gets the object receiving input-port related events and notifications.
      */
     virtual ErrCode INTERFACE_FUNC getListener(IInputPortNotifications** port) = 0;
+
+    /*!
+     * @brief Sets the type of packet queue used by connections of the input port.
+     * @param mode The packet queue mode.
+     *
+     * The mode is applied to connections created after the call, so it should be set before
+     * a signal is connected. `PacketQueueMode::LockFreeSpsc` must only be used when packets are
+     * enqueued by one thread (the signal's producer) and dequeued by one thread (the input port's owner).
+     */
+    virtual ErrCode INTERFACE_FUNC setPacketQueueMode(PacketQueueMode mode) = 0;
+
+    /*!
+     * @brief Gets the type of packet queue used by connections of the input port.
+     * @param[out] mode The packet queue mode.
+     */
+    virtual ErrCode INTERFACE_FUNC getPacketQueueMode(PacketQueueMode* mode) = 0;
+
+    /*!
+     * @brief Sets the maximum number of packets held by a bounded packet queue.
+     * @param capacity The number of packets.
+     *
+     * Only used by bounded queue modes. When the queue is full, data packets are dropped and,
+     * if gap checking is enabled, reported to the reader with a gap packet. Event packets are never dropped,
+     * they are enqueued even if the queue is full.
+     */
+    virtual ErrCode INTERFACE_FUNC setPacketQueueCapacity(SizeT capacity) = 0;
+
+    /*!
+     * @brief Gets the maximum number of packets held by a bounded packet queue.
+     * @param[out] capacity The number of packets.
+     */
+    virtual ErrCode INTERFACE_FUNC getPacketQueueCapacity(SizeT* capacity) = 0;
+
+    /*!
+     * @brief Sets the scheduler execution domain on which packet-ready notifications are processed.
+     * @param domain The name of the execution domain. If not assigned, the default thread-pool is used.
+     * @retval OPENDAQ_ERR_INVALIDSTATE when a signal is connected to the input port.
+     *
+     * Only used with the scheduler based notification methods. The domain must be added to the scheduler with
+     * `IScheduler::addExecutionDomain`, otherwise the notifications fall back to the default thread-pool. The domain
+     * is looked up when it is set and when a signal is connected, not for each notification.
+     */
+    virtual ErrCode INTERFACE_FUNC setSchedulerDomain(IString* domain) = 0;
+
+    /*!
+     * @brief Gets the scheduler execution domain on which packet-ready notifications are processed.
+     * @param[out] domain The name of the execution domain. Not assigned when the default thread-pool is used.
+     */
+    virtual ErrCode INTERFACE_FUNC getSchedulerDomain(IString** domain) = 0;
 };
 /*!@}*/
 
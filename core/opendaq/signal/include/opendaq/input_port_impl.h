@@ -30,8 +30,10 @@
 #include <opendaq/signal_private_ptr.h>
 #include <opendaq/work_factory.h>
 #include <opendaq/scheduler_errors.h>
+#include <opendaq/scheduler_internal.h>
 #include <opendaq/component_update_context_ptr.h>
 #include <opendaq/cyclic_ref_check.h>
+#include <opendaq/coalesced_notification_impl.h>
 
 #include "opendaq/errors.h"
 
@@ -86,6 +88,13 @@ public:
 
     ErrCode INTERFACE_FUNC getGapCheckingEnabled(Bool* gapCheckingEnabled) override;
 
+    ErrCode INTERFACE_FUNC setPacketQueueMode(PacketQueueMode mode) override;
+    ErrCode INTERFACE_FUNC getPacketQueueMode(PacketQueueMode* mode) override;
+    ErrCode INTERFACE_FUNC setPacketQueueCapacity(SizeT capacity) override;
+    ErrCode INTERFACE_FUNC getPacketQueueCapacity(SizeT* capacity) override;
+    ErrCode INTERFACE_FUNC setSchedulerDomain(IString* domain) override;
+    ErrCode INTERFACE_FUNC getSchedulerDomain(IString** domain) override;
+
     // IInputPortPrivate
     ErrCode INTERFACE_FUNC disconnectWithoutSignalNotification() override;
     ErrCode INTERFACE_FUNC connectSignalSchedulerNotification(ISignal* signal) override;
@@ -134,10 +143,16 @@ private:
     const bool gapCheckingEnabled;
     BaseObjectPtr customData;
     PacketReadyNotification notifyMethod{};
+    PacketQueueMode packetQueueMode;
+    SizeT packetQueueCapacity;
+    StringPtr schedulerDomain;
+    ObjectPtr<IExecutionDomain> executionDomain;
 
     WeakRefPtr<IInputPortNotifications> listenerRef;
     WeakRefPtr<IConnection> connectionRef{};
     WorkPtr notifySchedulerCallback;
+    WorkPtr coalescedNotificationWork;
+    CoalescedNotificationImpl* coalescedNotification;
 
     LoggerComponentPtr loggerComponent;
     SchedulerPtr scheduler;
@@ -148,6 +163,8 @@ private:
     void disconnectSignalInternal(ConnectionPtr&& connection, bool notifyListener, bool notifySignal, bool triggerCoreEvent);
     void notifyPacketEnqueuedSameThread();
     void notifyPacketEnqueuedScheduler();
+    void notifyPacketEnqueuedCoalesced();
+    void resolveExecutionDomain();
     void finishUpdate();
 
 };
@@ -167,8 +184,11 @@ GenericInputPortImpl<TInterface, Interfaces...>::GenericInputPortImpl(const Cont
     , isPublic(true)
     , gapCheckingEnabled(gapCheckingEnabled)
     , notifyMethod(PacketReadyNotification::None)
+    , packetQueueMode(PacketQueueMode::Locked)
+    , packetQueueCapacity(1024)
     , listenerRef(nullptr)
     , connectionRef(nullptr)
+    , coalescedNotification(nullptr)
 {
     loggerComponent = context.getLogger().getOrAddComponent("InputPort");
     if (context.assigned())
@@ -338,7 +358,9 @@ ErrCode GenericInputPortImpl<TInterface, Interfaces...>::setNotificationMethod(P
 {
     auto lock = this->getRecursiveConfigLock2();
 
-    if ((method == PacketReadyNotification::Scheduler || method == PacketReadyNotification::SchedulerQueueWasEmpty) && !scheduler.assigned())
+    if ((method == PacketReadyNotification::Scheduler || method == PacketReadyNotification::SchedulerQueueWasEmpty ||
+         method == PacketReadyNotification::SchedulerCoalesced) &&
+        !scheduler.assigned())
     {
         LOG_W("Scheduler based notification not available");
         notifyMethod = PacketReadyNotification::SameThread;
@@ -381,11 +403,40 @@ void GenericInputPortImpl<TInterface, Interfaces...>::notifyPacketEnqueuedSameTh
 template <typename TInterface, typename...  Interfaces>
 void GenericInputPortImpl<TInterface, Interfaces...>::notifyPacketEnqueuedScheduler()
 {
-    const auto errCode = scheduler->scheduleWork(notifySchedulerCallback);
+    const auto errCode = executionDomain.assigned()
+                             ? executionDomain->scheduleWork(notifySchedulerCallback)
+                             : scheduler->scheduleWork(notifySchedulerCallback);
     if (OPENDAQ_FAILED(errCode) && (errCode != OPENDAQ_ERR_SCHEDULER_STOPPED))
         checkErrorInfo(errCode);
 }
 
+// The domain is looked up by name once, when it is set and when a signal is connected, instead of on every packet
+template <typename TInterface, typename...  Interfaces>
+void GenericInputPortImpl<TInterface, Interfaces...>::resolveExecutionDomain()
+{
+    ObjectPtr<IExecutionDomain> domain;
+    if (schedulerDomain.assigned() && scheduler.assigned())
+    {
+        if (const auto schedulerInternal = scheduler.asPtrOrNull<ISchedulerInternal>(true); schedulerInternal.assigned())
+            checkErrorInfo(schedulerInternal->getExecutionDomain(schedulerDomain, &domain));
+    }
+
+    // read without a lock by the producer thread on each notification
+    if (domain.getObject() == executionDomain.getObject())
+        return;
+
+    executionDomain = domain;
+    if (coalescedNotification != nullptr)
+        coalescedNotification->setDomain(executionDomain);
+}
+
+template <typename TInterface, typename...  Interfaces>
+void GenericInputPortImpl<TInterface, Interfaces...>::notifyPacketEnqueuedCoalesced()
+{
+    if (coalescedNotification != nullptr)
+        checkErrorInfo(coalescedNotification->notify());
+}
+
 template <typename TInterface, typename...  Interfaces>
 ErrCode GenericInputPortImpl<TInterface, Interfaces...>::notifyPacketEnqueued(Bool queueWasEmpty)
 {
@@ -411,6 +462,11 @@ ErrCode GenericInputPortImpl<TInterface, Interfaces...>::notifyPacketEnqueued(Bo
                 notifyPacketEnqueuedScheduler();
                 break;
             }
+            case PacketReadyNotification::SchedulerCoalesced:
+            {
+                notifyPacketEnqueuedCoalesced();
+                break;
+            }
             case PacketReadyNotification::None:
             case PacketReadyNotification::Unspecified:
                 break;
@@ -430,6 +486,7 @@ ErrCode GenericInputPortImpl<TInterface, Interfaces...>::notifyPacketEnqueuedOnT
             case PacketReadyNotification::SameThread:
             case PacketReadyNotification::Scheduler:
             case PacketReadyNotification::SchedulerQueueWasEmpty:
+            case PacketReadyNotification::SchedulerCoalesced:
                 notifyPacketEnqueuedSameThread();
 
             case PacketReadyNotification::None:
@@ -452,6 +509,10 @@ ErrCode GenericInputPortImpl<TInterface, Interfaces...>::notifyPacketEnqueuedWit
             case PacketReadyNotification::Scheduler:
             case PacketReadyNotification::SchedulerQueueWasEmpty:
                 notifyPacketEnqueuedScheduler();
+                break;
+            case PacketReadyNotification::SchedulerCoalesced:
+                notifyPacketEnqueuedCoalesced();
+                break;
             case PacketReadyNotification::None:
             case PacketReadyNotification::Unspecified:
                 break;
@@ -491,9 +552,20 @@ ErrCode GenericInputPortImpl<TInterface, Interfaces...>::setListener(IInputPortN
                 }
             }
         });
+
+        if (scheduler.assigned())
+        {
+            coalescedNotificationWork = createWithImplementation<IWork, CoalescedNotificationImpl>(scheduler, listenerRef, portRef, loggerComponent);
+            coalescedNotification = static_cast<CoalescedNotificationImpl*>(coalescedNotificationWork.getObject());
+            coalescedNotification->setDomain(executionDomain);
+        }
     }
     else
+    {
         notifySchedulerCallback.release();
+        coalescedNotificationWork.release();
+        coalescedNotification = nullptr;
+    }
 
     return OPENDAQ_SUCCESS;
 }
@@ -677,6 +749,9 @@ ErrCode GenericInputPortImpl<TInterface, Interfaces...>::connectInternal(ISignal
                 connectionRef.release();
                 disconnectSignalInternal(std::move(oldConnection), false, true, false);
             }
+
+            // the domain may have been added to the scheduler after it was set
+            resolveExecutionDomain();
             connectionRef = connection;
 
             if (listenerRef.assigned())
@@ -913,6 +988,72 @@ ErrCode GenericInputPortImpl<TInterface, Interfaces...>::getGapCheckingEnabled(B
     return OPENDAQ_SUCCESS;
 }
 
+template <typename TInterface, typename... Interfaces>
+ErrCode GenericInputPortImpl<TInterface, Interfaces...>::setPacketQueueMode(PacketQueueMode mode)
+{
+    if (mode != PacketQueueMode::Locked && mode != PacketQueueMode::LockFreeSpsc)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "Invalid packet queue mode");
+
+    auto lock = this->getRecursiveConfigLock2();
+    packetQueueMode = mode;
+    return OPENDAQ_SUCCESS;
+}
+
+template <typename TInterface, typename... Interfaces>
+ErrCode GenericInputPortImpl<TInterface, Interfaces...>::getPacketQueueMode(PacketQueueMode* mode)
+{
+    OPENDAQ_PARAM_NOT_NULL(mode);
+
+    *mode = packetQueueMode;
+    return OPENDAQ_SUCCESS;
+}
+
+template <typename TInterface, typename... Interfaces>
+ErrCode GenericInputPortImpl<TInterface, Interfaces...>::setPacketQueueCapacity(SizeT capacity)
+{
+    if (capacity == 0)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "Packet queue capacity must be greater than 0");
+
+    auto lock = this->getRecursiveConfigLock2();
+    packetQueueCapacity = capacity;
+    return OPENDAQ_SUCCESS;
+}
+
+template <typename TInterface, typename... Interfaces>
+ErrCode GenericInputPortImpl<TInterface, Interfaces...>::getPacketQueueCapacity(SizeT* capacity)
+{
+    OPENDAQ_PARAM_NOT_NULL(capacity);
+
+    *capacity = packetQueueCapacity;
+    return OPENDAQ_SUCCESS;
+}
+
+template <typename TInterface, typename... Interfaces>
+ErrCode GenericInputPortImpl<TInterface, Interfaces...>::setSchedulerDomain(IString* domain)
+{
+    auto lock = this->getRecursiveConfigLock2();
+
+    // read without a lock by the producer thread on each notification
+    if (connectionRef.assigned())
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE, "Scheduler domain must be set before a signal is connected");
+
+    return daqTry([&]
+    {
+        schedulerDomain = domain;
+        resolveExecutionDomain();
+    });
+}
+
+template <typename TInterface, typename... Interfaces>
+ErrCode GenericInputPortImpl<TInterface, Interfaces...>::getSchedulerDomain(IString** domain)
+{
+    OPENDAQ_PARAM_NOT_NULL(domain);
+
+    auto lock = this->getRecursiveConfigLock2();
+    *domain = schedulerDomain.addRefAndReturn();
+    return OPENDAQ_SUCCESS;
+}
+
 OPENDAQ_REGISTER_DESERIALIZE_FACTORY(InputPortImpl)
 
 END_NAMESPACE_OPENDAQ
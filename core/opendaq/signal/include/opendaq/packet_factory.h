@@ -134,6 +134,26 @@ inline DataPacketPtr DataPacketWithExternalMemory(const DataPacketPtr& domainPac
     return obj;
 }
 
+/*!
+ * @brief Creates a Data packet whose data memory is obtained from an allocator.
+ *
+ * @param domainPacket The Data packet carrying domain data.
+ * @param descriptor The descriptor of the signal sending the data.
+ * @param sampleCount The number of samples in the packet.
+ * @param allocator The allocator providing the data buffers of the packet.
+ * @param offset Optional packet offset parameter, used to calculate the data of the packet
+ * if the Data rule of the Signal descriptor is not explicit.
+ */
+inline DataPacketPtr DataPacketWithAllocator(const DataPacketPtr& domainPacket,
+                                             const DataDescriptorPtr& descriptor,
+                                             uint64_t sampleCount,
+                                             const AllocatorPtr& allocator,
+                                             NumberPtr offset = nullptr)
+{
+    DataPacketPtr obj(DataPacketWithAllocator_Create(domainPacket, descriptor, static_cast<SizeT>(sampleCount), offset, allocator));
+    return obj;
+}
+
 /*!
  * @brief Creates and Event packet with a given id and parameter dictionary.
  * @param id The ID of the event.
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/allocator.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*#
+ * [interfaceSmartPtr(IAllocator, GenericAllocatorPtr)]
+ */
+
+/*!
+ * @ingroup opendaq_utility
+ * @addtogroup opendaq_allocator Allocator
+ * @{
+ */
+
+/*!
+ * @brief An allocator that recycles released packet buffers instead of returning them to the system.
+ *
+ * Requested sizes are rounded up to size classes spaced at a quarter of a power of two, and released
+ * blocks are kept in per-class free lists, each guarded by its own lock. A signal that emits packets
+ * of a fixed size thus reuses the same few buffers once the pool is warmed up. The total number of bytes
+ * held in the free lists never exceeds the configured limit; blocks released above the limit, as well
+ * as requests larger than the biggest size class, go straight to `malloc`/`free`.
+ *
+ * A single instance is meant to be shared by the packets of one signal (or of signals with equal
+ * descriptors), and can be used from any thread.
+ */
+DECLARE_OPENDAQ_INTERFACE(IPoolAllocator, IAllocator)
+{
+    /*!
+     * @brief Gets the number of allocations that were served from the pool.
+     * @param[out] hitCount The number of recycled allocations.
+     */
+    virtual ErrCode INTERFACE_FUNC getHitCount(SizeT* hitCount) = 0;
+
+    /*!
+     * @brief Gets the number of allocations that had to request new memory from the system.
+     * @param[out] missCount The number of non-recycled allocations.
+     */
+    virtual ErrCode INTERFACE_FUNC getMissCount(SizeT* missCount) = 0;
+
+    /*!
+     * @brief Gets the number of bytes currently held in the free lists of the pool.
+     * @param[out] cachedBytes The number of cached bytes.
+     */
+    virtual ErrCode INTERFACE_FUNC getCachedBytes(SizeT* cachedBytes) = 0;
+
+    /*!
+     * @brief Gets the maximum number of bytes the pool keeps in its free lists.
+     * @param[out] maxCachedBytes The limit of cached bytes.
+     */
+    virtual ErrCode INTERFACE_FUNC getMaxCachedBytes(SizeT* maxCachedBytes) = 0;
+
+    /*!
+     * @brief Returns all cached blocks to the system.
+     *
+     * Blocks still in use by packets are not affected and return to the pool when released.
+     */
+    virtual ErrCode INTERFACE_FUNC trim() = 0;
+};
+/*!@}*/
+
+/*!
+ * @brief Creates a pool allocator.
+ * @param maxCachedBytes The maximum number of bytes of released blocks the pool keeps for reuse.
+ */
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, PoolAllocator,
+    IPoolAllocator,
+    SizeT, maxCachedBytes
+)
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/pool_allocator.h>
+#include <opendaq/data_descriptor.h>
+#include <coretypes/common.h>
+#include <coretypes/intfs.h>
+#include <array>
+#include <cstddef>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+class PoolAllocatorImpl : public ImplementationOf<IPoolAllocator>
+{
+public:
+    explicit PoolAllocatorImpl(SizeT maxCachedBytes);
+    ~PoolAllocatorImpl() override;
+
+    ErrCode INTERFACE_FUNC allocate(
+        const IDataDescriptor *descriptor,
+        daq::SizeT bytes,
+        daq::SizeT align,
+        VoidPtr* address) override;
+
+    ErrCode INTERFACE_FUNC free(VoidPtr address) override;
+
+    ErrCode INTERFACE_FUNC getHitCount(SizeT* hitCount) override;
+    ErrCode INTERFACE_FUNC getMissCount(SizeT* missCount) override;
+    ErrCode INTERFACE_FUNC getCachedBytes(SizeT* cachedBytes) override;
+    ErrCode INTERFACE_FUNC getMaxCachedBytes(SizeT* maxCachedBytes) override;
+    ErrCode INTERFACE_FUNC trim() override;
+
+    static size_t getSizeClass(size_t bytes);
+    static size_t getClassSize(size_t sizeClass);
+
+    // Size classes: 64 B, then 4 classes per power of two up to 1 GiB
+    static constexpr size_t MinClassShift = 6;
+    static constexpr size_t MaxClassShift = 30;
+    static constexpr size_t ClassesPerDoubling = 4;
+    static constexpr size_t SizeClassCount = (MaxClassShift - MinClassShift) * ClassesPerDoubling + 1;
+    static constexpr size_t NoSizeClass = SizeClassCount;
+
+private:
+    // Stored in front of every returned address
+    struct BlockHeader
+    {
+        void* block;
+        size_t sizeClass;
+    };
+
+    struct FreeList
+    {
+        std::mutex sync;
+        std::vector<void*> blocks;
+    };
+
+    void* allocateUnpooled(size_t bytes, size_t align);
+    void releaseBlocks(FreeList& freeList, size_t sizeClass);
+
+    const size_t maxCachedBytes;
+    std::atomic<size_t> cachedBytes;
+    std::atomic<size_t> hitCount;
+    std::atomic<size_t> missCount;
+    std::array<FreeList, SizeClassCount> freeLists;
+};
+
+END_NAMESPACE_OPENDAQ
@@ -15,6 +15,7 @@
  */
 
 #pragma once
+#include <opendaq/scaling_kernels.h>
 #include <opendaq/scaling_ptr.h>
 #include <opendaq/signal_exceptions.h>
 #include <opendaq/sample_type_traits.h>
@@ -105,12 +106,7 @@ void* ScalingCalcTyped<T, U>::scaleLinear(void* data, SizeT sampleCount)
 template <typename T, typename U>
 void ScalingCalcTyped<T, U>::scaleLinear(void* data, SizeT sampleCount, void** output)
 {
-    T* rawData = static_cast<T*>(data);
-    U* scaledData = static_cast<U*>(*output);
-    const U scale = params[0];
-    const U offset = params[1];
-    for (SizeT i = 0; i < sampleCount; ++i)
-        scaledData[i] = scale * static_cast<U>(rawData[i]) + offset;
+    scaling::scaleLinear(static_cast<const T*>(data), static_cast<U*>(*output), sampleCount, params[0], params[1]);
 }
 
 static ScalingCalc* createScalingCalcTyped(const ScalingPtr& scaling)
@@ -0,0 +1,36 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/common.h>
+#include <cstdint>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace scaling
+{
+    /*!
+     * @brief Writes `scale * src[i] + offset` to `dst[i]`, computed in the output type.
+     *
+     * Instantiated for all integral and floating point input types, with `float` or `double` output. The
+     * kernel (AVX2, or AVX-512 for 64-bit integers) is selected at runtime on first use; other CPUs and
+     * architectures use a scalar loop.
+     */
+    template <typename T, typename U>
+    void scaleLinear(const T* src, U* dst, SizeT count, U scale, U offset);
+}
+
+END_NAMESPACE_OPENDAQ
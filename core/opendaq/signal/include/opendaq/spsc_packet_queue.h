@@ -0,0 +1,160 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/packet_ptr.h>
+#include <atomic>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief Bounded lock-free ring queue of packets for exactly one producer and one consumer thread.
+ *
+ * `tryPush` and `freeSlots` may only be called by the producer. `tryPop`, `front`, `forEach`
+ * and `clear` may only be called by the consumer. `size` and `empty` may be called from any thread
+ * and return a snapshot.
+ *
+ * The capacity is rounded up to a power of two so that positions can be mapped to slots with a mask.
+ * Head and tail are kept on separate cache lines, and each side caches the last seen position of
+ * the other side to avoid touching the shared cache line on every operation.
+ */
+class SpscPacketQueue
+{
+public:
+    explicit SpscPacketQueue(SizeT capacity)
+        : slots(roundUpToPowerOfTwo(capacity))
+        , mask(slots.size() - 1)
+    {
+    }
+
+    SpscPacketQueue(const SpscPacketQueue&) = delete;
+    SpscPacketQueue& operator=(const SpscPacketQueue&) = delete;
+
+    SizeT capacity() const noexcept
+    {
+        return slots.size();
+    }
+
+    // producer
+
+    bool tryPush(PacketPtr&& packet)
+    {
+        const SizeT h = head.load(std::memory_order_relaxed);
+        if (h - cachedTail == slots.size())
+        {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h - cachedTail == slots.size())
+                return false;
+        }
+
+        slots[h & mask] = std::move(packet);
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    SizeT freeSlots() noexcept
+    {
+        cachedTail = tail.load(std::memory_order_acquire);
+        return slots.size() - (head.load(std::memory_order_relaxed) - cachedTail);
+    }
+
+    // consumer
+
+    bool tryPop(PacketPtr& packet)
+    {
+        const SizeT t = tail.load(std::memory_order_relaxed);
+        if (t == cachedHead)
+        {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (t == cachedHead)
+                return false;
+        }
+
+        packet = std::move(slots[t & mask]);
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    const PacketPtr* front() noexcept
+    {
+        const SizeT t = tail.load(std::memory_order_relaxed);
+        if (t == cachedHead)
+        {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (t == cachedHead)
+                return nullptr;
+        }
+
+        return &slots[t & mask];
+    }
+
+    // Calls f for each queued packet, from front to back, until f returns false.
+    template <typename F>
+    void forEach(F&& f)
+    {
+        const SizeT t = tail.load(std::memory_order_relaxed);
+        cachedHead = head.load(std::memory_order_acquire);
+        for (SizeT i = t; i != cachedHead; ++i)
+        {
+            if (!f(static_cast<const PacketPtr&>(slots[i & mask])))
+                return;
+        }
+    }
+
+    void clear()
+    {
+        PacketPtr packet;
+        while (tryPop(packet))
+            packet.release();
+    }
+
+    // any thread
+
+    SizeT size() const noexcept
+    {
+        const SizeT t = tail.load(std::memory_order_acquire);
+        const SizeT h = head.load(std::memory_order_acquire);
+        return h - t;
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+private:
+    static constexpr SizeT CacheLineSize = 64;
+
+    static SizeT roundUpToPowerOfTwo(SizeT value) noexcept
+    {
+        SizeT result = 2;
+        while (result < value)
+            result <<= 1;
+        return result;
+    }
+
+    std::vector<PacketPtr> slots;
+    const SizeT mask;
+
+    alignas(CacheLineSize) std::atomic<SizeT> head{0};
+    SizeT cachedTail{0};
+
+    alignas(CacheLineSize) std::atomic<SizeT> tail{0};
+    SizeT cachedHead{0};
+};
+
+END_NAMESPACE_OPENDAQ
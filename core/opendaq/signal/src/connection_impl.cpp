@@ -30,6 +30,13 @@ ConnectionImpl::ConnectionImpl(const InputPortPtr& port, const SignalPtr& signal
         gapCheckState = GapCheckState::disabled;
         LOGP_T("Gap checking disabled.")
     }
+
+    if (portConfig.assigned() && portConfig.getPacketQueueMode() == PacketQueueMode::LockFreeSpsc)
+    {
+        packetQueueCapacity = portConfig.getPacketQueueCapacity();
+        spscQueue = std::make_unique<SpscPacketQueue>(packetQueueCapacity + SpscReservedSlots);
+        LOG_D("Lock-free packet queue enabled, capacity = {}.", packetQueueCapacity)
+    }
 }
 
 template <class P, class F>
@@ -47,18 +54,28 @@ ErrCode ConnectionImpl::enqueueInternal(P&& packet, const F& f)
 
         bool queueWasEmpty;
 
-        withLock(
-            [&packet, &queueWasEmpty, this]()
-            {
-                queueWasEmpty = queueEmpty;
-                if (gapCheckState != GapCheckState::disabled)
-                    checkForGaps(packet);
+        if (spscQueue)
+        {
+            if (!enqueueLockFree(std::forward<P>(packet), true))
+                return OPENDAQ_IGNORED;
 
-                onPacketEnqueued(packet);
-                packets.emplace_back(std::forward<P>(packet));
-                queueEmpty = false;
-                LOGP_T("Packet enqueued.")
-            });
+            queueWasEmpty = testAndClearQueueEmpty();
+        }
+        else
+        {
+            withLock(
+                [&packet, &queueWasEmpty, this]()
+                {
+                    queueWasEmpty = queueEmpty;
+                    if (gapCheckState != GapCheckState::disabled)
+                        checkForGaps(packet);
+
+                    onPacketEnqueued(packet);
+                    packets.emplace_back(std::forward<P>(packet));
+                    queueEmpty = false;
+                    LOGP_T("Packet enqueued.")
+                });
+        }
 
         f(queueWasEmpty);
         return OPENDAQ_SUCCESS;
@@ -67,6 +84,184 @@ ErrCode ConnectionImpl::enqueueInternal(P&& packet, const F& f)
     return errCode;
 }
 
+template <class P>
+bool ConnectionImpl::enqueueLockFree(P&& packet, bool checkGaps)
+{
+    // Only data packets are dropped when the queue is full. A dropped data packet does not
+    // advance the gap check state, so the next enqueued data packet is preceded by a gap packet.
+    if (packet.getType() == PacketType::Data && getLockFreePacketCount() >= packetQueueCapacity)
+    {
+        if (droppedPacketsCnt++ == 0)
+            LOGP_W("Lock-free packet queue is full, dropping data packets.")
+        return false;
+    }
+
+    if (droppedPacketsCnt != 0 && packet.getType() == PacketType::Data)
+    {
+        LOG_W("Lock-free packet queue accepting packets again, {} data packets dropped.", droppedPacketsCnt)
+        droppedPacketsCnt = 0;
+    }
+
+    if (checkGaps && gapCheckState != GapCheckState::disabled)
+        checkForGaps(packet);
+
+    onPacketEnqueued(packet);
+    pushLockFree(PacketPtr(std::forward<P>(packet)));
+    LOGP_T("Packet enqueued.")
+    return true;
+}
+
+void ConnectionImpl::pushLockFree(PacketPtr&& packet)
+{
+    // Packets are appended to the overflow queue until the consumer drains it, to keep them in order
+    if (spscOverflowPending.load(std::memory_order_acquire))
+    {
+        const bool spilled = withLock([&packet, this]
+        {
+            if (spscOverflow.empty())
+                return false;
+            spscOverflow.push_back(std::move(packet));
+            return true;
+        });
+        if (spilled)
+            return;
+    }
+
+    if (spscQueue->tryPush(std::move(packet)))
+        return;
+
+    withLock([&packet, this]
+    {
+        if (spscOverflow.empty())
+            LOGP_D("Lock-free packet ring is full, spilling packets into the overflow queue.")
+        spscOverflow.push_back(std::move(packet));
+        spscOverflowPending.store(true, std::memory_order_release);
+    });
+}
+
+bool ConnectionImpl::popOverflow(PacketPtr& packet)
+{
+    return withLock([&packet, this]
+    {
+        if (spscOverflow.empty())
+            return false;
+
+        packet = std::move(spscOverflow.front());
+        spscOverflow.pop_front();
+        if (spscOverflow.empty())
+            spscOverflowPending.store(false, std::memory_order_release);
+        return true;
+    });
+}
+
+SizeT ConnectionImpl::getLockFreePacketCount()
+{
+    SizeT count = spscQueue->size();
+    if (spscOverflowPending.load(std::memory_order_acquire))
+        count += withLock([this] { return spscOverflow.size(); });
+    if (spscFrontPacketPending.load(std::memory_order_acquire))
+        ++count;
+    return count;
+}
+
+bool ConnectionImpl::dequeueLockFree(PacketPtr& packet)
+{
+    if (spscFrontPacketPending.load(std::memory_order_acquire))
+    {
+        withLock([&packet, this]
+        {
+            packet = std::move(spscFrontPacket);
+            spscFrontPacketPending = false;
+        });
+        if (packet.assigned())
+            return true;
+    }
+
+    // The flag is read before the ring: the producer only spills after all earlier packets were
+    // pushed to the ring, so if the ring is empty, the overflow queue holds the next packet.
+    bool overflowPending = spscOverflowPending.load(std::memory_order_acquire);
+    if (spscQueue->tryPop(packet) || (overflowPending && popOverflow(packet)))
+        return true;
+
+    // Pairs with testAndClearQueueEmpty: the producer reads the flag after pushing, so it either
+    // sees the flag set and notifies the listener, or the packet is visible to the check below.
+    spscQueueEmpty.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    overflowPending = spscOverflowPending.load(std::memory_order_acquire);
+    if (spscQueue->tryPop(packet) || (overflowPending && popOverflow(packet)))
+    {
+        spscQueueEmpty.store(false, std::memory_order_relaxed);
+        return true;
+    }
+
+    return false;
+}
+
+bool ConnectionImpl::testAndClearQueueEmpty()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return spscQueueEmpty.load(std::memory_order_relaxed) && spscQueueEmpty.exchange(false);
+}
+
+PacketPtr ConnectionImpl::peekLockFree()
+{
+    if (spscFrontPacketPending.load(std::memory_order_acquire))
+    {
+        PacketPtr packet = withLock([this] { return spscFrontPacket; });
+        if (packet.assigned())
+            return packet;
+    }
+
+    const bool overflowPending = spscOverflowPending.load(std::memory_order_acquire);
+    if (const auto front = spscQueue->front())
+        return *front;
+
+    if (overflowPending)
+        return withLock([this] { return spscOverflow.empty() ? PacketPtr() : spscOverflow.front(); });
+    return nullptr;
+}
+
+template <typename F>
+void ConnectionImpl::forEachPacket(F&& f)
+{
+    if (spscQueue)
+    {
+        if (spscFrontPacketPending.load(std::memory_order_acquire))
+        {
+            const PacketPtr frontPacket = withLock([this] { return spscFrontPacket; });
+            if (frontPacket.assigned() && !f(frontPacket))
+                return;
+        }
+
+        const bool overflowPending = spscOverflowPending.load(std::memory_order_acquire);
+        bool completed = true;
+        spscQueue->forEach([&f, &completed](const PacketPtr& packet)
+        {
+            completed = f(packet);
+            return completed;
+        });
+
+        if (completed && overflowPending)
+        {
+            withLock([&f, this]
+            {
+                for (const auto& packet : spscOverflow)
+                {
+                    if (!f(packet))
+                        return;
+                }
+            });
+        }
+        return;
+    }
+
+    for (const auto& packet : packets)
+    {
+        if (!f(packet))
+            return;
+    }
+}
+
 ErrCode ConnectionImpl::enqueue(IPacket* packet)
 {
     OPENDAQ_PARAM_NOT_NULL(packet);
@@ -105,18 +300,32 @@ ErrCode ConnectionImpl::enqueueMultipleInternal(const ListPtr<IPacket>& packets)
 
         bool queueWasEmpty;
 
-        withLock([&packets, &queueWasEmpty, this]()
+        if (spscQueue)
         {
-            queueWasEmpty = queueEmpty;
+            bool enqueued = false;
             const size_t cnt = packets.getCount();
             for (size_t i = 0; i < cnt; ++i)
+                enqueued |= enqueueLockFree(packets.getItemAt(i), false);
+            if (!enqueued)
+                return OPENDAQ_IGNORED;
+
+            queueWasEmpty = testAndClearQueueEmpty();
+        }
+        else
+        {
+            withLock([&packets, &queueWasEmpty, this]()
             {
-                auto packet = packets.getItemAt(i);
-                onPacketEnqueued(packet);
-                this->packets.push_back(packet);
-            }
-            queueEmpty = false;
-        });
+                queueWasEmpty = queueEmpty;
+                const size_t cnt = packets.getCount();
+                for (size_t i = 0; i < cnt; ++i)
+                {
+                    auto packet = packets.getItemAt(i);
+                    onPacketEnqueued(packet);
+                    this->packets.push_back(packet);
+                }
+                queueEmpty = false;
+            });
+        }
 
         port.notifyPacketEnqueued(queueWasEmpty);
         return OPENDAQ_SUCCESS;
@@ -134,17 +343,31 @@ ErrCode ConnectionImpl::enqueueMultipleInternal(ListPtr<IPacket>&& packets)
 
         bool queueWasEmpty;
 
-        withLock([&packets, &queueWasEmpty, this]() {
-            queueWasEmpty = queueEmpty;
+        if (spscQueue)
+        {
+            bool enqueued = false;
             const size_t cnt = packets.getCount();
             for (size_t i = 0; i < cnt; ++i)
-            {
-                auto packet = packets.popBack();
-                onPacketEnqueued(packet);
-                this->packets.push_back(packet);
-            }
-            queueEmpty = false;
-        });
+                enqueued |= enqueueLockFree(packets.popBack(), false);
+            if (!enqueued)
+                return OPENDAQ_IGNORED;
+
+            queueWasEmpty = testAndClearQueueEmpty();
+        }
+        else
+        {
+            withLock([&packets, &queueWasEmpty, this]() {
+                queueWasEmpty = queueEmpty;
+                const size_t cnt = packets.getCount();
+                for (size_t i = 0; i < cnt; ++i)
+                {
+                    auto packet = packets.popBack();
+                    onPacketEnqueued(packet);
+                    this->packets.push_back(packet);
+                }
+                queueEmpty = false;
+            });
+        }
 
         port.notifyPacketEnqueued(queueWasEmpty);
         return OPENDAQ_SUCCESS;
@@ -165,27 +388,46 @@ ErrCode ConnectionImpl::enqueueMultipleInternal(P&& packets)
 
         bool queueWasEmpty;
 
-        withLock(
-            [&packets, &queueWasEmpty, this]()
+        if (spscQueue)
+        {
+            bool enqueued = false;
+            const size_t cnt = packets.getCount();
+            for (size_t i = 0; i < cnt; ++i)
             {
-                queueWasEmpty = queueEmpty;
-                const size_t cnt = packets.getCount();
-                for (size_t i = 0; i < cnt; ++i)
+                if constexpr (std::is_rvalue_reference_v<P&&>)
+                    enqueued |= enqueueLockFree(packets.popBack(), false);
+                else
+                    enqueued |= enqueueLockFree(packets.getItemAt(i), false);
+            }
+            if (!enqueued)
+                return OPENDAQ_IGNORED;
+
+            queueWasEmpty = testAndClearQueueEmpty();
+        }
+        else
+        {
+            withLock(
+                [&packets, &queueWasEmpty, this]()
                 {
-                    PacketPtr packet;
-                    if constexpr (std::is_rvalue_reference_v<P&&>)
-                    {
-                        packet = packets.popBack();
-                    }
-                    else
+                    queueWasEmpty = queueEmpty;
+                    const size_t cnt = packets.getCount();
+                    for (size_t i = 0; i < cnt; ++i)
                     {
-                        packet = packets.getItemAt(i);
+                        PacketPtr packet;
+                        if constexpr (std::is_rvalue_reference_v<P&&>)
+                        {
+                            packet = packets.popBack();
+                        }
+                        else
+                        {
+                            packet = packets.getItemAt(i);
+                        }
+                        onPacketEnqueued(packet);
+                        this->packets.push_back(packet);
                     }
-                    onPacketEnqueued(packet);
-                    this->packets.push_back(packet);
-                }
-                queueEmpty = false;
-            });
+                    queueEmpty = false;
+                });
+        }
 
         port.notifyPacketEnqueued(queueWasEmpty);
         return OPENDAQ_SUCCESS;
@@ -227,6 +469,22 @@ ErrCode ConnectionImpl::dequeue(IPacket** packet)
 {
     OPENDAQ_PARAM_NOT_NULL(packet);
 
+    if (spscQueue)
+    {
+        PacketPtr packetPtr;
+        if (!dequeueLockFree(packetPtr))
+        {
+            LOGP_T("No packet to dequeue.")
+            *packet = nullptr;
+            return OPENDAQ_NO_MORE_ITEMS;
+        }
+
+        onPacketDequeued(packetPtr);
+        *packet = packetPtr.detach();
+        LOGP_T("Packet dequeued.")
+        return OPENDAQ_SUCCESS;
+    }
+
     return withLock([&packet, this]()
     {
         if (packets.empty())
@@ -252,6 +510,19 @@ ErrCode INTERFACE_FUNC ConnectionImpl::dequeueAll(IList** packets)
 
     auto packetsPtr = List<IPacket>();
 
+    if (spscQueue)
+    {
+        PacketPtr packet;
+        while (dequeueLockFree(packet))
+        {
+            onPacketDequeued(packet);
+            packetsPtr.pushBack(std::move(packet));
+        }
+
+        *packets = packetsPtr.detach();
+        return OPENDAQ_NO_MORE_ITEMS;
+    }
+
     return withLock(
         [&packetsPtr, packets, this]()
         {
@@ -272,6 +543,19 @@ ErrCode ConnectionImpl::peek(IPacket** packet)
 {
     OPENDAQ_PARAM_NOT_NULL(packet);
 
+    if (spscQueue)
+    {
+        *packet = peekLockFree().detach();
+        if (*packet == nullptr)
+        {
+            LOGP_T("No packet to peek.")
+            return OPENDAQ_NO_MORE_ITEMS;
+        }
+
+        LOGP_T("Packet peeked.")
+        return OPENDAQ_SUCCESS;
+    }
+
     return withLock([&packet, this]()
     {
         if (packets.empty())
@@ -291,6 +575,13 @@ ErrCode ConnectionImpl::getPacketCount(SizeT* packetCount)
 {
     OPENDAQ_PARAM_NOT_NULL(packetCount);
 
+    if (spscQueue)
+    {
+        *packetCount = getLockFreePacketCount();
+        LOG_T("Packet count = {}.", *packetCount)
+        return OPENDAQ_SUCCESS;
+    }
+
     return withLock([&packetCount, this]()
     {
         *packetCount = packets.size();
@@ -303,9 +594,9 @@ ErrCode ConnectionImpl::getAvailableSamples(SizeT* samples)
 {
     OPENDAQ_PARAM_NOT_NULL(samples);
 
-    return withLock([samples, this]()
+    return withQueueLock([samples, this]()
     {
-        *samples = samplesCnt;
+        *samples = loadCount(samplesCnt, spscSamplesCnt);
 
         LOG_T("Available samples = {}.", *samples)
         return OPENDAQ_SUCCESS;
@@ -316,15 +607,15 @@ ErrCode ConnectionImpl::getSamplesUntilNextEventPacket(SizeT* samples)
 {
     OPENDAQ_PARAM_NOT_NULL(samples);
 
-    return withLock([samples, this]() {
-        if (eventPacketsCnt == 0 && gapPacketsCnt == 0)
+    return withQueueLock([samples, this]() {
+        if (loadCount(eventPacketsCnt, spscEventPacketsCnt) == 0 && loadCount(gapPacketsCnt, spscGapPacketsCnt) == 0)
         {
-            *samples = samplesCnt;
+            *samples = loadCount(samplesCnt, spscSamplesCnt);
             LOG_T("Samples until next event packet = {}.", *samples)
             return OPENDAQ_SUCCESS;
         }
         *samples = 0;
-        for (const auto& packet : packets)
+        forEachPacket([samples](const PacketPtr& packet)
         {
             switch (packet.getType())
             {
@@ -338,14 +629,12 @@ ErrCode ConnectionImpl::getSamplesUntilNextEventPacket(SizeT* samples)
                     break;
                 }
                 case PacketType::Event:
-                {
-                    LOG_T("Samples until next event packet = {}.", *samples)
-                    return OPENDAQ_SUCCESS;
-                }
+                    return false;
                 case PacketType::None:
                     break;
             }
-        }
+            return true;
+        });
 
         LOG_T("Samples until next event packet = {}.", *samples)
         return OPENDAQ_SUCCESS;
@@ -356,15 +645,15 @@ ErrCode ConnectionImpl::getSamplesUntilNextDescriptor(SizeT* samples)
 {
     OPENDAQ_PARAM_NOT_NULL(samples);
 
-    return withLock([samples, this]() {
-        if (eventPacketsCnt == 0)
+    return withQueueLock([samples, this]() {
+        if (loadCount(eventPacketsCnt, spscEventPacketsCnt) == 0)
         {
-            *samples = samplesCnt;
+            *samples = loadCount(samplesCnt, spscSamplesCnt);
             LOG_T("Samples until next descriptor = {}.", *samples)
             return OPENDAQ_SUCCESS;
         }
         *samples = 0;
-        for (const auto& packet : packets)
+        forEachPacket([samples](const PacketPtr& packet)
         {
             switch (packet.getType())
             {
@@ -381,16 +670,14 @@ ErrCode ConnectionImpl::getSamplesUntilNextDescriptor(SizeT* samples)
                 {
                     auto eventPacket = packet.template asPtrOrNull<IEventPacket>(true);
                     if (eventPacket.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
-                    {
-                        LOG_T("Samples until next descriptor = {}.", *samples)
-                        return OPENDAQ_SUCCESS;
-                    }
+                        return false;
                     break;
                 }
                 case PacketType::None:
                     break;
             }
-        }
+            return true;
+        });
 
         LOG_T("Samples until next descriptor = {}.", *samples)
         return OPENDAQ_SUCCESS;
@@ -399,17 +686,17 @@ ErrCode ConnectionImpl::getSamplesUntilNextDescriptor(SizeT* samples)
 
 ErrCode ConnectionImpl::getSamplesUntilNextGapPacket(SizeT* samples)
 {
-        OPENDAQ_PARAM_NOT_NULL(samples);
+    OPENDAQ_PARAM_NOT_NULL(samples);
 
-    return withLock([samples, this]() {
-        if (gapPacketsCnt == 0)
+    return withQueueLock([samples, this]() {
+        if (loadCount(gapPacketsCnt, spscGapPacketsCnt) == 0)
         {
-            *samples = samplesCnt;
+            *samples = loadCount(samplesCnt, spscSamplesCnt);
             LOG_T("Samples until next gap packet = {}.", *samples)
             return OPENDAQ_SUCCESS;
         }
         *samples = 0;
-        for (const auto& packet : packets)
+        forEachPacket([samples](const PacketPtr& packet)
         {
             switch (packet.getType())
             {
@@ -426,29 +713,27 @@ ErrCode ConnectionImpl::getSamplesUntilNextGapPacket(SizeT* samples)
                 {
                     auto eventPacket = packet.template asPtr<IEventPacket>(true);
                     if (eventPacket.getEventId() == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED)
-                    {
-                        LOG_T("Samples until next gap packet = {}.", *samples)
-                        return OPENDAQ_SUCCESS;
-                    }
+                        return false;
                     break;
                 }
                 case PacketType::None:
                     break;
             }
-        }
+            return true;
+        });
 
         LOG_T("Samples until next gap packet = {}.", *samples)
         return OPENDAQ_SUCCESS;
-    });    
+    });
 }
 
 ErrCode ConnectionImpl::hasEventPacket(Bool* hasEventPacket)
 {
     OPENDAQ_PARAM_NOT_NULL(hasEventPacket);
 
-    return withLock([hasEventPacket, this]()
+    return withQueueLock([hasEventPacket, this]()
     {
-        *hasEventPacket = eventPacketsCnt != 0 || gapPacketsCnt != 0;
+        *hasEventPacket = loadCount(eventPacketsCnt, spscEventPacketsCnt) != 0 || loadCount(gapPacketsCnt, spscGapPacketsCnt) != 0;
         LOG_T("Has event packet = {}.", *hasEventPacket)
         return OPENDAQ_SUCCESS;
     });
@@ -458,9 +743,9 @@ ErrCode ConnectionImpl::hasGapPacket(Bool* hasGapPacket)
 {
     OPENDAQ_PARAM_NOT_NULL(hasGapPacket);
 
-    return withLock([hasGapPacket, this]()
+    return withQueueLock([hasGapPacket, this]()
     {
-        *hasGapPacket = gapPacketsCnt != 0;
+        *hasGapPacket = loadCount(gapPacketsCnt, spscGapPacketsCnt) != 0;
         LOG_T("Has gap packet = {}.", *hasGapPacket)
         return OPENDAQ_SUCCESS;
     });
@@ -504,6 +789,20 @@ ErrCode ConnectionImpl::dequeueUpTo(IPacket** packetPtr, SizeT* count)
     OPENDAQ_PARAM_NOT_NULL(packetPtr);
     OPENDAQ_PARAM_NOT_NULL(count);
 
+    if (spscQueue)
+    {
+        SizeT dequeued = 0;
+        PacketPtr packet;
+        while (dequeued < *count && dequeueLockFree(packet))
+        {
+            onPacketDequeued(packet);
+            packetPtr[dequeued++] = packet.detach();
+        }
+
+        *count = dequeued;
+        return OPENDAQ_SUCCESS;
+    }
+
     return withLock(
         [&packetPtr, &count, this]()
         {
@@ -572,8 +871,11 @@ void ConnectionImpl::enqueueGapPacket(const DomainValue& diff)
         diffNumber = diff.valueInt64_t;
 
     const auto gapPacket = ImplicitDomainGapDetectedEventPacket(diffNumber);
-    gapPacketsCnt += 1;
-    packets.emplace_back(gapPacket);
+    increaseCount(gapPacketsCnt, spscGapPacketsCnt, 1);
+    if (spscQueue)
+        pushLockFree(PacketPtr(gapPacket));
+    else
+        packets.emplace_back(gapPacket);
     LOGP_T("Gap packet enqueued.")
 }
 
@@ -707,16 +1009,39 @@ void ConnectionImpl::countPackets()
     }
 }
 
+void ConnectionImpl::increaseCount(SizeT& counter, std::atomic<SizeT>& spscCounter, SizeT value)
+{
+    if (spscQueue)
+        spscCounter.fetch_add(value, std::memory_order_relaxed);
+    else
+        counter += value;
+}
+
+void ConnectionImpl::decreaseCount(SizeT& counter, std::atomic<SizeT>& spscCounter, SizeT value)
+{
+    if (spscQueue)
+        spscCounter.fetch_sub(value, std::memory_order_relaxed);
+    else
+        counter -= value;
+}
+
+SizeT ConnectionImpl::loadCount(const SizeT& counter, const std::atomic<SizeT>& spscCounter) const
+{
+    if (spscQueue)
+        return spscCounter.load(std::memory_order_relaxed);
+    return counter;
+}
+
 void ConnectionImpl::onPacketEnqueued(const PacketPtr& packet)
 {
     if (packet.getType() == PacketType::Data)
     {
         auto dataPacket = packet.asPtr<IDataPacket>(true);
-        samplesCnt += dataPacket.getSampleCount();
+        increaseCount(samplesCnt, spscSamplesCnt, dataPacket.getSampleCount());
     }
     else if (packet.getType() == PacketType::Event)
     {
-        eventPacketsCnt++;
+        increaseCount(eventPacketsCnt, spscEventPacketsCnt, 1);
         auto eventPacket = packet.asPtr<IEventPacket>(true);
         if (!(eventPacket.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED))
             return;
@@ -725,15 +1050,24 @@ void ConnectionImpl::onPacketEnqueued(const PacketPtr& packet)
         const DataDescriptorPtr valueDescriptorParam = params[event_packet_param::DATA_DESCRIPTOR];
         const DataDescriptorPtr domainDescriptorParam = params[event_packet_param::DOMAIN_DATA_DESCRIPTOR];
 
-        if (valueDescriptorParam.assigned())
-        {
-            valueDataDescriptor = valueDescriptorParam;
-        }
+        // In lock-free mode the descriptors are read by enqueueLastDescriptor on another thread
+        if (spscQueue)
+            withLock([&] { setLastDescriptors(valueDescriptorParam, domainDescriptorParam); });
+        else
+            setLastDescriptors(valueDescriptorParam, domainDescriptorParam);
+    }
+}
 
-        if (domainDescriptorParam.assigned())
-        {
-            domainDataDescriptor = domainDescriptorParam;
-        }
+void ConnectionImpl::setLastDescriptors(const DataDescriptorPtr& valueDescriptor, const DataDescriptorPtr& domainDescriptor)
+{
+    if (valueDescriptor.assigned())
+    {
+        valueDataDescriptor = valueDescriptor;
+    }
+
+    if (domainDescriptor.assigned())
+    {
+        domainDataDescriptor = domainDescriptor;
     }
 }
 
@@ -744,7 +1078,7 @@ void ConnectionImpl::onPacketDequeued(const PacketPtr& packet)
         auto dataPacket = packet.asPtrOrNull<IDataPacket>(true);
         if (dataPacket.assigned())
         {
-            samplesCnt -= dataPacket.getSampleCount();
+            decreaseCount(samplesCnt, spscSamplesCnt, dataPacket.getSampleCount());
         }
     }
     else if (packet.getType() == PacketType::Event)
@@ -752,11 +1086,11 @@ void ConnectionImpl::onPacketDequeued(const PacketPtr& packet)
         auto eventPacket = packet.asPtr<IEventPacket>(true);
         if (eventPacket.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
         {
-            eventPacketsCnt--;
+            decreaseCount(eventPacketsCnt, spscEventPacketsCnt, 1);
         }
         else if (eventPacket.getEventId() == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED)
         {
-            gapPacketsCnt--;
+            decreaseCount(gapPacketsCnt, spscGapPacketsCnt, 1);
         }  
     }
 }
@@ -767,9 +1101,21 @@ ErrCode ConnectionImpl::enqueueLastDescriptor()
     {
         if (valueDataDescriptor.assigned() || domainDataDescriptor.assigned())
         {
-            eventPacketsCnt++;
+            increaseCount(eventPacketsCnt, spscEventPacketsCnt, 1);
             const auto dataDescriptorEventPacket = DataDescriptorChangedEventPacket(valueDataDescriptor, domainDataDescriptor);
-            packets.emplace_front(dataDescriptorEventPacket);
+            if (spscQueue)
+            {
+                // The ring can only be written at the back by the producer, so the packet is
+                // kept aside and handed out by the consumer before the queued packets.
+                if (spscFrontPacketPending)
+                    decreaseCount(eventPacketsCnt, spscEventPacketsCnt, 1);
+                spscFrontPacket = dataDescriptorEventPacket;
+                spscFrontPacketPending.store(true, std::memory_order_release);
+            }
+            else
+            {
+                packets.emplace_front(dataDescriptorEventPacket);
+            }
         }
         return OPENDAQ_SUCCESS;
     });
@@ -32,6 +32,16 @@ OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC_OBJ(
     SizeT, bufferSize
 )
 
+OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC_OBJ(
+    LIBRARY_FACTORY, DataPacketImpl<IDataPacket>,
+    IDataPacket, createDataPacketWithAllocator,
+    IDataPacket*, domainPacket,
+    IDataDescriptor*, descriptor,
+    SizeT, sampleCount,
+    INumber*, offset,
+    IAllocator*, allocator
+)
+
 OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC_OBJ(
     LIBRARY_FACTORY, DataPacketImpl<IDataPacket>,
     IDataPacket, createConstantDataPacketWithDomain,
@@ -0,0 +1,237 @@
+#include <opendaq/pool_allocator_impl.h>
+#include <coretypes/common.h>
+#include <coretypes/impl.h>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace
+{
+    size_t floorLog2(size_t value)
+    {
+        size_t result = 0;
+        while (value >>= 1)
+            ++result;
+        return result;
+    }
+
+    bool isPowerOfTwo(size_t value)
+    {
+        return value != 0 && (value & (value - 1)) == 0;
+    }
+}
+
+PoolAllocatorImpl::PoolAllocatorImpl(SizeT maxCachedBytes)
+    : maxCachedBytes(maxCachedBytes)
+    , cachedBytes(0)
+    , hitCount(0)
+    , missCount(0)
+{
+}
+
+PoolAllocatorImpl::~PoolAllocatorImpl()
+{
+    for (size_t sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass)
+        releaseBlocks(freeLists[sizeClass], sizeClass);
+}
+
+size_t PoolAllocatorImpl::getSizeClass(size_t bytes)
+{
+    if (bytes <= (size_t(1) << MinClassShift))
+        return 0;
+    if (bytes > (size_t(1) << MaxClassShift))
+        return NoSizeClass;
+
+    // 2^shift < bytes <= 2^(shift + 1), split into ClassesPerDoubling equal steps
+    const size_t shift = floorLog2(bytes - 1);
+    const size_t step = size_t(1) << (shift - 2);
+    const size_t subClass = (bytes - 1 - (size_t(1) << shift)) / step;
+    return (shift - MinClassShift) * ClassesPerDoubling + subClass + 1;
+}
+
+size_t PoolAllocatorImpl::getClassSize(size_t sizeClass)
+{
+    if (sizeClass == 0)
+        return size_t(1) << MinClassShift;
+
+    const size_t shift = (sizeClass - 1) / ClassesPerDoubling + MinClassShift;
+    const size_t subClass = (sizeClass - 1) % ClassesPerDoubling;
+    return (size_t(1) << shift) + (subClass + 1) * (size_t(1) << (shift - 2));
+}
+
+ErrCode PoolAllocatorImpl::allocate(
+    const IDataDescriptor* /*descriptor*/,
+    SizeT bytes,
+    SizeT align,
+    VoidPtr* address)
+{
+    OPENDAQ_PARAM_NOT_NULL(address);
+
+    const size_t sizeClass = getSizeClass(bytes);
+    if (sizeClass == NoSizeClass || (align > alignof(std::max_align_t) && isPowerOfTwo(align)))
+    {
+        missCount.fetch_add(1, std::memory_order_relaxed);
+        *address = allocateUnpooled(bytes, align);
+        if (*address == nullptr)
+            return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOMEMORY);
+        return OPENDAQ_SUCCESS;
+    }
+
+    const size_t classSize = getClassSize(sizeClass);
+    FreeList& freeList = freeLists[sizeClass];
+
+    void* block = nullptr;
+    {
+        std::scoped_lock lock(freeList.sync);
+        if (!freeList.blocks.empty())
+        {
+            block = freeList.blocks.back();
+            freeList.blocks.pop_back();
+        }
+    }
+
+    if (block != nullptr)
+    {
+        cachedBytes.fetch_sub(classSize, std::memory_order_relaxed);
+        hitCount.fetch_add(1, std::memory_order_relaxed);
+        *address = static_cast<BlockHeader*>(block) + 1;
+        return OPENDAQ_SUCCESS;
+    }
+
+    missCount.fetch_add(1, std::memory_order_relaxed);
+    block = std::malloc(sizeof(BlockHeader) + classSize);
+    if (block == nullptr)
+    {
+        *address = nullptr;
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOMEMORY);
+    }
+
+    const auto header = static_cast<BlockHeader*>(block);
+    header->block = block;
+    header->sizeClass = sizeClass;
+    *address = header + 1;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PoolAllocatorImpl::free(VoidPtr address)
+{
+    if (address == nullptr)
+        return OPENDAQ_SUCCESS;
+
+    const auto header = static_cast<BlockHeader*>(address) - 1;
+    void* block = header->block;
+    const size_t sizeClass = header->sizeClass;
+
+    if (sizeClass == NoSizeClass)
+    {
+        std::free(block);
+        return OPENDAQ_SUCCESS;
+    }
+
+    const size_t classSize = getClassSize(sizeClass);
+    if (cachedBytes.fetch_add(classSize, std::memory_order_relaxed) + classSize > maxCachedBytes)
+    {
+        cachedBytes.fetch_sub(classSize, std::memory_order_relaxed);
+        std::free(block);
+        return OPENDAQ_SUCCESS;
+    }
+
+    FreeList& freeList = freeLists[sizeClass];
+    try
+    {
+        std::scoped_lock lock(freeList.sync);
+        freeList.blocks.push_back(block);
+    }
+    catch (const std::bad_alloc&)
+    {
+        cachedBytes.fetch_sub(classSize, std::memory_order_relaxed);
+        std::free(block);
+    }
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PoolAllocatorImpl::getHitCount(SizeT* hitCount)
+{
+    OPENDAQ_PARAM_NOT_NULL(hitCount);
+
+    *hitCount = this->hitCount.load(std::memory_order_relaxed);
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PoolAllocatorImpl::getMissCount(SizeT* missCount)
+{
+    OPENDAQ_PARAM_NOT_NULL(missCount);
+
+    *missCount = this->missCount.load(std::memory_order_relaxed);
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PoolAllocatorImpl::getCachedBytes(SizeT* cachedBytes)
+{
+    OPENDAQ_PARAM_NOT_NULL(cachedBytes);
+
+    *cachedBytes = this->cachedBytes.load(std::memory_order_relaxed);
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PoolAllocatorImpl::getMaxCachedBytes(SizeT* maxCachedBytes)
+{
+    OPENDAQ_PARAM_NOT_NULL(maxCachedBytes);
+
+    *maxCachedBytes = this->maxCachedBytes;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PoolAllocatorImpl::trim()
+{
+    for (size_t sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass)
+        releaseBlocks(freeLists[sizeClass], sizeClass);
+
+    return OPENDAQ_SUCCESS;
+}
+
+void* PoolAllocatorImpl::allocateUnpooled(size_t bytes, size_t align)
+{
+    if (!isPowerOfTwo(align) || align < alignof(std::max_align_t))
+        align = alignof(std::max_align_t);
+
+    if (bytes > std::numeric_limits<size_t>::max() - sizeof(BlockHeader) - align)
+        return nullptr;
+
+    void* block = std::malloc(sizeof(BlockHeader) + bytes + align);
+    if (block == nullptr)
+        return nullptr;
+
+    const auto start = reinterpret_cast<uintptr_t>(block) + sizeof(BlockHeader);
+    const auto aligned = (start + align - 1) & ~static_cast<uintptr_t>(align - 1);
+
+    const auto header = reinterpret_cast<BlockHeader*>(aligned) - 1;
+    header->block = block;
+    header->sizeClass = NoSizeClass;
+    return header + 1;
+}
+
+void PoolAllocatorImpl::releaseBlocks(FreeList& freeList, size_t sizeClass)
+{
+    std::vector<void*> blocks;
+    {
+        std::scoped_lock lock(freeList.sync);
+        blocks.swap(freeList.blocks);
+    }
+
+    for (void* block : blocks)
+        std::free(block);
+
+    cachedBytes.fetch_sub(blocks.size() * getClassSize(sizeClass), std::memory_order_relaxed);
+}
+
+OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, PoolAllocator,
+    IPoolAllocator,
+    SizeT, maxCachedBytes)
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,293 @@
+#include <opendaq/scaling_kernels.h>
+#include <opendaq/simd_level.h>
+#include <cstring>
+#include <type_traits>
+
+#if defined(DAQ_SIMD_X86)
+    #include <immintrin.h>
+#endif
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace scaling
+{
+
+namespace
+{
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4244)
+#endif
+
+template <typename T, typename U>
+void scaleScalar(const T* src, U* dst, SizeT count, U scale, U offset)
+{
+    for (SizeT i = 0; i < count; ++i)
+        dst[i] = scale * static_cast<U>(src[i]) + offset;  // C4244 - possible data loss due to conversion
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+template <typename T, typename U>
+using ScalingKernel = void (*)(const T*, U*, SizeT, U, U);
+
+#if defined(DAQ_SIMD_X86)
+
+namespace avx2
+{
+    DAQ_SIMD_TARGET("avx2") __m128i load32(const void* src)
+    {
+        int32_t value;
+        std::memcpy(&value, src, sizeof(value));
+        return _mm_cvtsi32_si128(value);
+    }
+
+    DAQ_SIMD_TARGET("avx2") __m128i load64(const void* src)
+    {
+        return _mm_loadl_epi64(static_cast<const __m128i*>(src));
+    }
+
+    DAQ_SIMD_TARGET("avx2") __m128i load128(const void* src)
+    {
+        return _mm_loadu_si128(static_cast<const __m128i*>(src));
+    }
+
+    // Converts 4 values to double
+
+    DAQ_SIMD_TARGET("avx2") __m256d loadAsDouble(const int8_t* src)
+    {
+        return _mm256_cvtepi32_pd(_mm_cvtepi8_epi32(load32(src)));
+    }
+
+    DAQ_SIMD_TARGET("avx2") __m256d loadAsDouble(const uint8_t* src)
+    {
+        return _mm256_cvtepi32_pd(_mm_cvtepu8_epi32(load32(src)));
+    }
+
+    DAQ_SIMD_TARGET("avx2") __m256d loadAsDouble(const int16_t* src)
+    {
+        return _mm256_cvtepi32_pd(_mm_cvtepi16_epi32(load64(src)));
+    }
+
+    DAQ_SIMD_TARGET("avx2") __m256d loadAsDouble(const uint16_t* src)
+    {
+        return _mm256_cvtepi32_pd(_mm_cvtepu16_epi32(load64(src)));
+    }
+
+    DAQ_SIMD_TARGET("avx2") __m256d loadAsDouble(const int32_t* src)
+    {
+        return _mm256_cvtepi32_pd(load128(src));
+    }
+
+    DAQ_SIMD_TARGET("avx2") __m256d loadAsDouble(const uint32_t* src)
+    {
+        // No unsigned conversion before AVX-512; flip the sign bit, convert as signed and add 2^31 back (exact in double)
+        const __m128i flipped = _mm_xor_si128(load128(src), _mm_set1_epi32(INT32_MIN));
+        return _mm256_add_pd(_mm256_cvtepi32_pd(flipped), _mm256_set1_pd(2147483648.0));
+    }
+
+    DAQ_SIMD_TARGET("avx2") __m256d loadAsDouble(const float* src)
+    {
+        return _mm256_cvtps_pd(_mm_loadu_ps(src));
+    }
+
+    DAQ_SIMD_TARGET("avx2") __m256d loadAsDouble(const double* src)
+    {
+        return _mm256_loadu_pd(src);
+    }
+
+    // Converts 8 values to float
+
+    DAQ_SIMD_TARGET("avx2") __m256 loadAsFloat(const int8_t* src)
+    {
+        return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(load64(src)));
+    }
+
+    DAQ_SIMD_TARGET("avx2") __m256 loadAsFloat(const uint8_t* src)
+    {
+        return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(load64(src)));
+    }
+
+    DAQ_SIMD_TARGET("avx2") __m256 loadAsFloat(const int16_t* src)
+    {
+        return _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(load128(src)));
+    }
+
+    DAQ_SIMD_TARGET("avx2") __m256 loadAsFloat(const uint16_t* src)
+    {
+        return _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(load128(src)));
+    }
+
+    DAQ_SIMD_TARGET("avx2") __m256 loadAsFloat(const int32_t* src)
+    {
+        return _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)));
+    }
+
+    DAQ_SIMD_TARGET("avx2") __m256 loadAsFloat(const uint32_t* src)
+    {
+        // Converting through double rounds once, same as the scalar conversion
+        const __m128 lo = _mm256_cvtpd_ps(loadAsDouble(src));
+        const __m128 hi = _mm256_cvtpd_ps(loadAsDouble(src + 4));
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+    }
+
+    DAQ_SIMD_TARGET("avx2") __m256 loadAsFloat(const float* src)
+    {
+        return _mm256_loadu_ps(src);
+    }
+
+    DAQ_SIMD_TARGET("avx2") __m256 loadAsFloat(const double* src)
+    {
+        const __m128 lo = _mm256_cvtpd_ps(_mm256_loadu_pd(src));
+        const __m128 hi = _mm256_cvtpd_ps(_mm256_loadu_pd(src + 4));
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+    }
+
+    template <typename T>
+    DAQ_SIMD_TARGET("avx2") void scaleToDouble(const T* src, double* dst, SizeT count, double scale, double offset)
+    {
+        const __m256d vScale = _mm256_set1_pd(scale);
+        const __m256d vOffset = _mm256_set1_pd(offset);
+
+        SizeT i = 0;
+        for (; i + 4 <= count; i += 4)
+            _mm256_storeu_pd(dst + i, _mm256_add_pd(_mm256_mul_pd(vScale, loadAsDouble(src + i)), vOffset));
+        scaleScalar(src + i, dst + i, count - i, scale, offset);
+    }
+
+    template <typename T>
+    DAQ_SIMD_TARGET("avx2") void scaleToFloat(const T* src, float* dst, SizeT count, float scale, float offset)
+    {
+        const __m256 vScale = _mm256_set1_ps(scale);
+        const __m256 vOffset = _mm256_set1_ps(offset);
+
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(vScale, loadAsFloat(src + i)), vOffset));
+        scaleScalar(src + i, dst + i, count - i, scale, offset);
+    }
+}
+
+// 64-bit integers can only be converted in vector registers with AVX-512 DQ
+
+namespace avx512
+{
+    DAQ_SIMD_TARGET("avx512f,avx512dq") __m512d loadAsDouble(const int64_t* src)
+    {
+        return _mm512_cvtepi64_pd(_mm512_loadu_si512(src));
+    }
+
+    DAQ_SIMD_TARGET("avx512f,avx512dq") __m512d loadAsDouble(const uint64_t* src)
+    {
+        return _mm512_cvtepu64_pd(_mm512_loadu_si512(src));
+    }
+
+    DAQ_SIMD_TARGET("avx512f,avx512dq") __m256 loadAsFloat(const int64_t* src)
+    {
+        return _mm512_cvtepi64_ps(_mm512_loadu_si512(src));
+    }
+
+    DAQ_SIMD_TARGET("avx512f,avx512dq") __m256 loadAsFloat(const uint64_t* src)
+    {
+        return _mm512_cvtepu64_ps(_mm512_loadu_si512(src));
+    }
+
+    template <typename T>
+    DAQ_SIMD_TARGET("avx512f,avx512dq") void scaleToDouble(const T* src, double* dst, SizeT count, double scale, double offset)
+    {
+        const __m512d vScale = _mm512_set1_pd(scale);
+        const __m512d vOffset = _mm512_set1_pd(offset);
+
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm512_storeu_pd(dst + i, _mm512_add_pd(_mm512_mul_pd(vScale, loadAsDouble(src + i)), vOffset));
+        scaleScalar(src + i, dst + i, count - i, scale, offset);
+    }
+
+    template <typename T>
+    DAQ_SIMD_TARGET("avx512f,avx512dq") void scaleToFloat(const T* src, float* dst, SizeT count, float scale, float offset)
+    {
+        const __m256 vScale = _mm256_set1_ps(scale);
+        const __m256 vOffset = _mm256_set1_ps(offset);
+
+        SizeT i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(vScale, loadAsFloat(src + i)), vOffset));
+        scaleScalar(src + i, dst + i, count - i, scale, offset);
+    }
+}
+
+template <typename T, typename U>
+ScalingKernel<T, U> selectKernel()
+{
+    const SimdLevel level = getSimdLevel();
+
+    if constexpr (std::is_integral_v<T> && sizeof(T) == 8)
+    {
+        if (level != SimdLevel::Avx512)
+            return scaleScalar<T, U>;
+
+        if constexpr (std::is_same_v<U, double>)
+            return avx512::scaleToDouble<T>;
+        else
+            return avx512::scaleToFloat<T>;
+    }
+    else
+    {
+        if (level == SimdLevel::Sse2)
+            return scaleScalar<T, U>;
+
+        if constexpr (std::is_same_v<U, double>)
+            return avx2::scaleToDouble<T>;
+        else
+            return avx2::scaleToFloat<T>;
+    }
+}
+
+#else
+
+template <typename T, typename U>
+ScalingKernel<T, U> selectKernel()
+{
+    return scaleScalar<T, U>;
+}
+
+#endif
+
+}
+
+template <typename T, typename U>
+void scaleLinear(const T* src, U* dst, SizeT count, U scale, U offset)
+{
+    static const ScalingKernel<T, U> kernel = selectKernel<T, U>();
+    kernel(src, dst, count, scale, offset);
+}
+
+template void scaleLinear<int8_t, float>(const int8_t*, float*, SizeT, float, float);
+template void scaleLinear<uint8_t, float>(const uint8_t*, float*, SizeT, float, float);
+template void scaleLinear<int16_t, float>(const int16_t*, float*, SizeT, float, float);
+template void scaleLinear<uint16_t, float>(const uint16_t*, float*, SizeT, float, float);
+template void scaleLinear<int32_t, float>(const int32_t*, float*, SizeT, float, float);
+template void scaleLinear<uint32_t, float>(const uint32_t*, float*, SizeT, float, float);
+template void scaleLinear<int64_t, float>(const int64_t*, float*, SizeT, float, float);
+template void scaleLinear<uint64_t, float>(const uint64_t*, float*, SizeT, float, float);
+template void scaleLinear<float, float>(const float*, float*, SizeT, float, float);
+template void scaleLinear<double, float>(const double*, float*, SizeT, float, float);
+
+template void scaleLinear<int8_t, double>(const int8_t*, double*, SizeT, double, double);
+template void scaleLinear<uint8_t, double>(const uint8_t*, double*, SizeT, double, double);
+template void scaleLinear<int16_t, double>(const int16_t*, double*, SizeT, double, double);
+template void scaleLinear<uint16_t, double>(const uint16_t*, double*, SizeT, double, double);
+template void scaleLinear<int32_t, double>(const int32_t*, double*, SizeT, double, double);
+template void scaleLinear<uint32_t, double>(const uint32_t*, double*, SizeT, double, double);
+template void scaleLinear<int64_t, double>(const int64_t*, double*, SizeT, double, double);
+template void scaleLinear<uint64_t, double>(const uint64_t*, double*, SizeT, double, double);
+template void scaleLinear<float, double>(const float*, double*, SizeT, double, double);
+template void scaleLinear<double, double>(const double*, double*, SizeT, double, double);
+
+}
+
+END_NAMESPACE_OPENDAQ
@@ -1,4 +1,5 @@
 #include <array>
+#include <thread>
 #include <opendaq/connection_factory.h>
 #include <coretypes/objectptr.h>
 #include <gtest/gtest.h>
@@ -332,3 +333,200 @@ TEST_F(ConnectionTest, DequeueUpTo2)
     for (SizeT i = 0; i < count; ++i)
         PacketPtr pkt = std::move(buf[i]);
 }
+
+class LockFreeConnectionTest : public ConnectionTest
+{
+protected:
+    ConnectionPtr createConnection(SizeT capacity = 1024)
+    {
+        inputPort.mock().packetQueueMode = PacketQueueMode::LockFreeSpsc;
+        inputPort.mock().packetQueueCapacity = capacity;
+        EXPECT_CALL(inputPort.mock(), getGapCheckingEnabled(testing::_)).WillOnce(GetBool(False));
+        return Connection(inputPort->asPtr<IInputPort>(), signal, context);
+    }
+};
+
+TEST_F(LockFreeConnectionTest, Enqueue)
+{
+    const auto connection = createConnection();
+    const std::array packets{
+        createWithImplementation<IPacket, MockPacket>(),
+        createWithImplementation<IPacket, MockPacket>(),
+        createWithImplementation<IPacket, MockPacket>(),
+    };
+
+    std::size_t n = 0;
+
+    for (const auto& packet : packets)
+    {
+        EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued(n == 0 ? True : False)).Times(1);
+        ASSERT_NO_THROW(connection.enqueue(packet));
+        EXPECT_EQ(connection.getPacketCount(), ++n);
+        EXPECT_EQ(connection.peek(), packets[0]);
+    }
+
+    while (n)
+    {
+        EXPECT_EQ(connection.peek(), packets[packets.size() - n]);
+        ASSERT_EQ(connection.dequeue(), packets[packets.size() - n]);
+        EXPECT_EQ(connection.getPacketCount(), --n);
+    }
+
+    ASSERT_FALSE(connection.dequeue().assigned());
+    ASSERT_FALSE(connection.peek().assigned());
+}
+
+TEST_F(LockFreeConnectionTest, EnqueueQueueWasEmpty)
+{
+    const auto connection = createConnection();
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued(True)).Times(1);
+    connection.enqueue(createWithImplementation<IPacket, MockPacket>());
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued(False)).Times(2);
+    connection.enqueue(createWithImplementation<IPacket, MockPacket>());
+    connection.enqueue(createWithImplementation<IPacket, MockPacket>());
+
+    ASSERT_TRUE(connection.dequeue().assigned());
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued(False)).Times(1);
+    connection.enqueue(createWithImplementation<IPacket, MockPacket>());
+
+    ASSERT_TRUE(connection.dequeue().assigned());
+    ASSERT_TRUE(connection.dequeue().assigned());
+    ASSERT_TRUE(connection.dequeue().assigned());
+    ASSERT_FALSE(connection.dequeue().assigned());
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued(True)).Times(1);
+    connection.enqueue(createWithImplementation<IPacket, MockPacket>());
+}
+
+TEST_F(LockFreeConnectionTest, EnqueueMultipleAndDequeueAll)
+{
+    const auto connection = createConnection();
+
+    const auto packets = List<IPacket>(
+        createWithImplementation<IPacket, MockPacket>(),
+        createWithImplementation<IPacket, MockPacket>(),
+        createWithImplementation<IPacket, MockPacket>());
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued(True)).Times(1);
+    connection.enqueueMultiple(packets);
+    ASSERT_EQ(connection.getPacketCount(), 3u);
+
+    const auto packetsOut = connection.dequeueAll();
+    ASSERT_EQ(packetsOut.getCount(), 3u);
+    for (SizeT i = 0; i < 3; ++i)
+        ASSERT_EQ(packetsOut[i], packets[i]);
+
+    ASSERT_FALSE(connection.dequeue().assigned());
+}
+
+TEST_F(LockFreeConnectionTest, FullQueueDropsDataPackets)
+{
+    const auto connection = createConnection(4);
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+
+    for (int i = 0; i < 100; ++i)
+        connection.enqueue(DataPacket(descriptor, 1));
+
+    ASSERT_EQ(connection.getPacketCount(), 4u);
+    ASSERT_EQ(connection.getAvailableSamples(), 4u);
+
+    // event packets are never dropped
+    connection.enqueue(DataDescriptorChangedEventPacket(descriptor, nullptr));
+    ASSERT_EQ(connection.getPacketCount(), 5u);
+    ASSERT_EQ(connection.getSamplesUntilNextEventPacket(), 4u);
+
+    // data packets are accepted again once the consumer makes room
+    ASSERT_TRUE(connection.dequeue().assigned());
+    ASSERT_TRUE(connection.dequeue().assigned());
+    connection.enqueue(DataPacket(descriptor, 1));
+    connection.enqueue(DataPacket(descriptor, 1));
+    ASSERT_EQ(connection.getPacketCount(), 4u);
+    ASSERT_EQ(connection.getAvailableSamples(), 3u);
+}
+
+TEST_F(LockFreeConnectionTest, EventPacketsSpillWhenRingIsFull)
+{
+    const auto connection = createConnection(4);
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+
+    constexpr SizeT eventPacketCount = 1000;
+    std::vector<PacketPtr> packets;
+    for (SizeT i = 0; i < 4; ++i)
+        packets.push_back(DataPacket(descriptor, 1));
+    for (SizeT i = 0; i < eventPacketCount; ++i)
+        packets.push_back(DataDescriptorChangedEventPacket(descriptor, nullptr));
+    packets.push_back(DataPacket(descriptor, 1));
+
+    for (const auto& packet : packets)
+        ASSERT_NO_THROW(connection.enqueue(packet));
+
+    // the last data packet is dropped, as the queue is full
+    ASSERT_EQ(connection.getPacketCount(), 4 + eventPacketCount);
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 4u);
+    ASSERT_TRUE(connection.hasEventPacket());
+
+    for (SizeT i = 0; i < 4 + eventPacketCount; ++i)
+    {
+        ASSERT_EQ(connection.peek(), packets[i]);
+        ASSERT_EQ(connection.dequeue(), packets[i]);
+    }
+
+    ASSERT_FALSE(connection.dequeue().assigned());
+    ASSERT_EQ(connection.getPacketCount(), 0u);
+    ASSERT_FALSE(connection.hasEventPacket());
+
+    // the ring is used again once the overflow queue is drained
+    connection.enqueue(packets[0]);
+    ASSERT_EQ(connection.dequeue(), packets[0]);
+}
+
+TEST_F(LockFreeConnectionTest, ConcurrentProducerConsumer)
+{
+    auto sig = Signal(context, nullptr, "sig");
+    sig.setDescriptor(DataDescriptorBuilder().setSampleType(SampleType::Int64).build());
+
+    auto ip = InputPort(context, nullptr, "ip");
+    ip.setPacketQueueMode(PacketQueueMode::LockFreeSpsc);
+    ip.setPacketQueueCapacity(64);
+    ip.connect(sig);
+
+    const auto connection = ip.getConnection();
+    ASSERT_EQ(connection.dequeue().getType(), PacketType::Event);
+
+    constexpr int64_t packetCount = 100000;
+    std::thread producer([&sig, &connection]
+    {
+        for (int64_t i = 0; i < packetCount; ++i)
+        {
+            auto packet = DataPacket(sig.getDescriptor(), 1);
+            *static_cast<int64_t*>(packet.getRawData()) = i;
+
+            // wait for the consumer instead of dropping packets
+            while (connection.getPacketCount() >= 64)
+                std::this_thread::yield();
+
+            sig.sendPacket(packet);
+        }
+    });
+
+    int64_t expected = 0;
+    while (expected < packetCount)
+    {
+        const DataPacketPtr packet = connection.dequeue();
+        if (!packet.assigned())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const auto value = *static_cast<int64_t*>(packet.getRawData());
+        EXPECT_EQ(value, expected);
+        expected = value + 1;
+    }
+
+    producer.join();
+    ASSERT_EQ(connection.getPacketCount(), 0u);
+    ASSERT_EQ(connection.getAvailableSamples(), 0u);
+}
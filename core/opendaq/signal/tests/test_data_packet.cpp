@@ -10,6 +10,7 @@
 #include <opendaq/scaling_ptr.h>
 #include <opendaq/deleter_factory.h>
 #include <opendaq/binary_data_packet_factory.h>
+#include <limits>
 
 using DataPacketTest = testing::Test;
 
@@ -254,6 +255,60 @@ TEST_F(DataPacketTest, TestInt64LinearScaling)
     validateLinearScalingPacket<int64_t, double>(descriptor, 1012, 10020);
 }
 
+template <typename T, typename U>
+static void validateLinearScalingFullRange(SampleType rawType, U scale, U offset)
+{
+    const auto scaledType = std::is_same_v<U, float> ? ScaledSampleType::Float32 : ScaledSampleType::Float64;
+    const auto descriptor =
+        setupDescriptor(SampleTypeFromType<U>::SampleType, ExplicitDataRule(), LinearScaling(scale, offset, rawType, scaledType));
+
+    const double lowest = std::is_floating_point_v<T> ? -1e6 : static_cast<double>(std::numeric_limits<T>::lowest());
+    const double highest = std::is_floating_point_v<T> ? 1e6 : static_cast<double>(std::numeric_limits<T>::max()) * 0.999;
+
+    // Odd count to cover the vector kernel tails
+    const DataPacketPtr packet = DataPacket(descriptor, 101);
+    T* rawData = static_cast<T*>(packet.getRawData());
+    for (size_t i = 0; i < packet.getSampleCount(); ++i)
+    {
+        const double position = static_cast<double>(i) / static_cast<double>(packet.getSampleCount() - 1);
+        rawData[i] = static_cast<T>(lowest * (1.0 - position) + highest * position);
+    }
+
+    const auto scaledData = static_cast<U*>(packet.getData());
+    for (size_t i = 0; i < packet.getSampleCount(); ++i)
+    {
+        if constexpr (std::is_same_v<U, float>)
+            ASSERT_FLOAT_EQ(scaledData[i], scale * static_cast<U>(rawData[i]) + offset);
+        else
+            ASSERT_DOUBLE_EQ(scaledData[i], scale * static_cast<U>(rawData[i]) + offset);
+    }
+}
+
+TEST_F(DataPacketTest, TestLinearScalingFullRange)
+{
+    validateLinearScalingFullRange<int8_t, double>(SampleType::Int8, 0.5, -3.25);
+    validateLinearScalingFullRange<uint8_t, double>(SampleType::UInt8, 0.5, -3.25);
+    validateLinearScalingFullRange<int16_t, double>(SampleType::Int16, 0.5, -3.25);
+    validateLinearScalingFullRange<uint16_t, double>(SampleType::UInt16, 0.5, -3.25);
+    validateLinearScalingFullRange<int32_t, double>(SampleType::Int32, 0.5, -3.25);
+    validateLinearScalingFullRange<uint32_t, double>(SampleType::UInt32, 0.5, -3.25);
+    validateLinearScalingFullRange<int64_t, double>(SampleType::Int64, 0.5, -3.25);
+    validateLinearScalingFullRange<uint64_t, double>(SampleType::UInt64, 0.5, -3.25);
+    validateLinearScalingFullRange<float, double>(SampleType::Float32, 0.5, -3.25);
+    validateLinearScalingFullRange<double, double>(SampleType::Float64, 0.5, -3.25);
+
+    validateLinearScalingFullRange<int8_t, float>(SampleType::Int8, 0.5f, -3.25f);
+    validateLinearScalingFullRange<uint8_t, float>(SampleType::UInt8, 0.5f, -3.25f);
+    validateLinearScalingFullRange<int16_t, float>(SampleType::Int16, 0.5f, -3.25f);
+    validateLinearScalingFullRange<uint16_t, float>(SampleType::UInt16, 0.5f, -3.25f);
+    validateLinearScalingFullRange<int32_t, float>(SampleType::Int32, 0.5f, -3.25f);
+    validateLinearScalingFullRange<uint32_t, float>(SampleType::UInt32, 0.5f, -3.25f);
+    validateLinearScalingFullRange<int64_t, float>(SampleType::Int64, 0.5f, -3.25f);
+    validateLinearScalingFullRange<uint64_t, float>(SampleType::UInt64, 0.5f, -3.25f);
+    validateLinearScalingFullRange<float, float>(SampleType::Float32, 0.5f, -3.25f);
+    validateLinearScalingFullRange<double, float>(SampleType::Float64, 0.5f, -3.25f);
+}
+
 template <typename DataType>
 class ConstantRuleTest : public DataPacketTest
 {
@@ -4,6 +4,7 @@
 #include <opendaq/gmock/context.h>
 #include <opendaq/gmock/input_port.h>
 #include <opendaq/gmock/input_port_notifications.h>
+#include <opendaq/gmock/scheduler.h>
 #include <opendaq/gmock/signal.h>
 #include <opendaq/deserialize_component_ptr.h>
 #include <opendaq/context_factory.h>
@@ -11,6 +12,10 @@
 #include <opendaq/component_private_ptr.h>
 #include <opendaq/scheduler_factory.h>
 #include <opendaq/signal_factory.h>
+#include <opendaq/coalesced_notification_impl.h>
+#include <algorithm>
+#include <atomic>
+#include <future>
 
 using namespace daq;
 using namespace testing;
@@ -206,3 +211,125 @@ TEST_F(InputPortTest, LockedAttributes)
     ASSERT_NO_THROW(inputPort.setPublic(true));
     ASSERT_FALSE(inputPort.getPublic());
 }
+
+TEST_F(InputPortTest, SchedulerDomain)
+{
+    auto logger = Logger();
+    auto context = Context(Scheduler(logger, 1), logger, nullptr, nullptr, nullptr);
+    auto scheduler = context.getScheduler();
+    scheduler.setExecutionDomainStatisticsEnabled(true);
+
+    MockInputPortNotifications::Strict domainNotifications;
+    auto ip = InputPort(context, nullptr, "ip");
+    ip.setListener(domainNotifications);
+    ip.setNotificationMethod(PacketReadyNotification::Scheduler);
+
+    ASSERT_FALSE(ip.getSchedulerDomain().assigned());
+    ip.setSchedulerDomain("Acquisition");
+    ASSERT_EQ(ip.getSchedulerDomain(), "Acquisition");
+
+    // the domain is looked up again when the signal is connected
+    scheduler.addExecutionDomain("Acquisition", 1, ExecutionPriority::Normal, nullptr);
+
+    auto signal = Signal(context, nullptr, "sig");
+    ip.connect(signal);
+    ASSERT_THROW(ip.setSchedulerDomain(nullptr), InvalidStateException);
+
+    scheduler.waitAll();
+    const Int completed = scheduler.getExecutionDomainStatistics("Acquisition").get("CompletedCount");
+
+    ip.notifyPacketEnqueued(True);
+    scheduler.waitAll();
+    ASSERT_EQ(scheduler.getExecutionDomainStatistics("Acquisition").get("CompletedCount"), completed + 1);
+
+    EXPECT_CALL(domainNotifications.mock(), disconnected).WillOnce(Return(OPENDAQ_SUCCESS));
+    ip.disconnect();
+}
+
+TEST_F(InputPortTest, CoalescedNotification)
+{
+    auto logger = Logger();
+    auto context = Context(Scheduler(logger, 2), logger, nullptr, nullptr, nullptr);
+    auto scheduler = context.getScheduler();
+    scheduler.setExecutionDomainStatisticsEnabled(true);
+
+    std::promise<void> entered;
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::atomic<int> calls{0};
+    std::atomic<int> running{0};
+    std::atomic<int> maxRunning{0};
+
+    MockInputPortNotifications::Strict coalescedNotifications;
+    EXPECT_CALL(coalescedNotifications.mock(), packetReceived).WillRepeatedly(Invoke([&](IInputPort*)
+    {
+        maxRunning = std::max(maxRunning.load(), ++running);
+        if (calls++ == 0)
+        {
+            entered.set_value();
+            released.wait();
+        }
+        --running;
+        return OPENDAQ_SUCCESS;
+    }));
+
+    auto ip = InputPort(context, nullptr, "ip");
+    ip.setListener(coalescedNotifications);
+    ip.setNotificationMethod(PacketReadyNotification::SchedulerCoalesced);
+    ASSERT_EQ(ip.getNotificationMethod(), PacketReadyNotification::SchedulerCoalesced);
+
+    // notifications arriving while the listener runs are merged into a single follow-up call
+    ip.notifyPacketEnqueued(True);
+    entered.get_future().wait();
+    for (int i = 0; i < 10; ++i)
+        ip.notifyPacketEnqueued(False);
+    release.set_value();
+
+    scheduler.waitAll();
+    ASSERT_EQ(calls, 2);
+    ASSERT_EQ(maxRunning, 1);
+    ASSERT_EQ(scheduler.getExecutionDomainStatistics("Default").get("CompletedCount"), 2);
+
+    // a notification after the listener returned schedules a new call
+    ip.notifyPacketEnqueued(True);
+    scheduler.waitAll();
+    ASSERT_EQ(calls, 3);
+}
+
+TEST_F(InputPortTest, CoalescedNotificationScheduleFailure)
+{
+    MockScheduler::Strict scheduler;
+    auto ip = InputPort(NullContext(), nullptr, "ip");
+
+    const WorkPtr work = createWithImplementation<IWork, CoalescedNotificationImpl>(
+        scheduler.ptr, WeakRefPtr<IInputPortNotifications>(notifications.ptr), WeakRefPtr<IInputPort>(ip), nullptr);
+    auto coalesced = static_cast<CoalescedNotificationImpl*>(work.getObject());
+
+    EXPECT_CALL(scheduler.mock(), scheduleWork).WillOnce(Return(OPENDAQ_ERR_GENERALERROR)).WillOnce(Return(OPENDAQ_SUCCESS));
+
+    // a failed schedule must not leave the work marked as pending
+    ASSERT_EQ(coalesced->notify(), OPENDAQ_ERR_GENERALERROR);
+    ASSERT_EQ(coalesced->notify(), OPENDAQ_SUCCESS);
+
+    // the work is pending now, so further notifications are merged
+    ASSERT_EQ(coalesced->notify(), OPENDAQ_SUCCESS);
+}
+
+TEST_F(InputPortTest, CoalescedNotificationExpiredPort)
+{
+    MockScheduler::Strict scheduler;
+    auto ip = InputPort(NullContext(), nullptr, "ip");
+
+    const WorkPtr work = createWithImplementation<IWork, CoalescedNotificationImpl>(
+        scheduler.ptr, WeakRefPtr<IInputPortNotifications>(notifications.ptr), WeakRefPtr<IInputPort>(ip), nullptr);
+    auto coalesced = static_cast<CoalescedNotificationImpl*>(work.getObject());
+
+    EXPECT_CALL(scheduler.mock(), scheduleWork).Times(2).WillRepeatedly(Return(OPENDAQ_SUCCESS));
+
+    ASSERT_EQ(coalesced->notify(), OPENDAQ_SUCCESS);
+    ip.release();
+
+    // the listener is not called for an expired port, but the pending count is cleared
+    ASSERT_EQ(work->execute(), OPENDAQ_SUCCESS);
+    ASSERT_EQ(coalesced->notify(), OPENDAQ_SUCCESS);
+}
@@ -0,0 +1,192 @@
+#include <opendaq/pool_allocator_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/data_rule_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/scaling_factory.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using PoolAllocatorTest = testing::Test;
+
+BEGIN_NAMESPACE_OPENDAQ
+
+TEST_F(PoolAllocatorTest, TestFactory)
+{
+    PoolAllocatorPtr allocator;
+    void* ptr = nullptr;
+
+    ASSERT_NO_THROW(allocator = PoolAllocator());
+    ASSERT_EQ(allocator.getMaxCachedBytes(), 16u * 1024 * 1024);
+
+    ASSERT_NO_THROW(ptr = allocator.allocate(nullptr, 32, 8));
+    ASSERT_NO_THROW(allocator.free(ptr));
+    ASSERT_NO_THROW(ptr = allocator.allocate(nullptr, 0, 0));
+    ASSERT_NO_THROW(allocator.free(ptr));
+    ASSERT_NO_THROW(allocator.free(nullptr));
+}
+
+TEST_F(PoolAllocatorTest, RecyclesBlocks)
+{
+    const auto allocator = PoolAllocator();
+
+    void* first = allocator.allocate(nullptr, 1000, 8);
+    ASSERT_NE(first, nullptr);
+    ASSERT_EQ(allocator.getMissCount(), 1u);
+    ASSERT_EQ(allocator.getHitCount(), 0u);
+
+    allocator.free(first);
+    ASSERT_EQ(allocator.getCachedBytes(), 1024u);
+
+    // 1000 and 990 bytes share the 1024-byte size class
+    void* second = allocator.allocate(nullptr, 990, 8);
+    ASSERT_EQ(second, first);
+    ASSERT_EQ(allocator.getHitCount(), 1u);
+    ASSERT_EQ(allocator.getCachedBytes(), 0u);
+
+    void* other = allocator.allocate(nullptr, 2000, 8);
+    ASSERT_NE(other, second);
+    ASSERT_EQ(allocator.getMissCount(), 2u);
+
+    allocator.free(second);
+    allocator.free(other);
+}
+
+TEST_F(PoolAllocatorTest, MaxCachedBytes)
+{
+    const auto allocator = PoolAllocator(1024);
+
+    void* first = allocator.allocate(nullptr, 1000, 8);
+    void* second = allocator.allocate(nullptr, 1000, 8);
+    allocator.free(first);
+    allocator.free(second);
+    ASSERT_EQ(allocator.getCachedBytes(), 1024u);
+
+    first = allocator.allocate(nullptr, 1000, 8);
+    second = allocator.allocate(nullptr, 1000, 8);
+    ASSERT_EQ(allocator.getHitCount(), 1u);
+    ASSERT_EQ(allocator.getMissCount(), 3u);
+
+    allocator.free(first);
+    allocator.free(second);
+}
+
+TEST_F(PoolAllocatorTest, Trim)
+{
+    const auto allocator = PoolAllocator();
+
+    std::vector<void*> blocks;
+    for (size_t size = 10; size < 100000; size *= 3)
+        blocks.push_back(allocator.allocate(nullptr, size, 0));
+    for (void* block : blocks)
+        allocator.free(block);
+
+    ASSERT_GT(allocator.getCachedBytes(), 0u);
+    allocator.trim();
+    ASSERT_EQ(allocator.getCachedBytes(), 0u);
+}
+
+TEST_F(PoolAllocatorTest, OverAlignedAllocations)
+{
+    const auto allocator = PoolAllocator();
+
+    for (SizeT align : {64, 256, 4096})
+    {
+        void* ptr = allocator.allocate(nullptr, 100, align);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % align, 0u);
+        allocator.free(ptr);
+    }
+
+    ASSERT_EQ(allocator.getCachedBytes(), 0u);
+}
+
+TEST_F(PoolAllocatorTest, ConcurrentAllocateFree)
+{
+    const auto allocator = PoolAllocator(64 * 1024);
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&allocator, t]
+            {
+                for (size_t i = 0; i < 10000; ++i)
+                {
+                    const auto size = 100 + (i % 4) * 1000 + t;
+                    auto ptr = static_cast<uint8_t*>(allocator.allocate(nullptr, size, 0));
+                    ptr[0] = 1;
+                    ptr[size - 1] = 2;
+                    allocator.free(ptr);
+                }
+            });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(allocator.getHitCount() + allocator.getMissCount(), 40000u);
+    ASSERT_LE(allocator.getCachedBytes(), 64u * 1024);
+}
+
+TEST_F(PoolAllocatorTest, DataPacketWithAllocator)
+{
+    const auto allocator = PoolAllocator();
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+
+    void* address;
+    {
+        const auto packet = DataPacketWithAllocator(nullptr, descriptor, 100, allocator);
+        address = packet.getRawData();
+        auto data = static_cast<double*>(packet.getRawData());
+        for (size_t i = 0; i < 100; ++i)
+            data[i] = static_cast<double>(i);
+        ASSERT_EQ(static_cast<double*>(packet.getData())[99], 99.0);
+    }
+
+    ASSERT_EQ(allocator.getMissCount(), 1u);
+    // 800 bytes of samples are served from the 896-byte size class
+    ASSERT_EQ(allocator.getCachedBytes(), 896u);
+
+    const auto packet = DataPacketWithAllocator(nullptr, descriptor, 100, allocator);
+    ASSERT_EQ(packet.getRawData(), address);
+    ASSERT_EQ(allocator.getHitCount(), 1u);
+}
+
+TEST_F(PoolAllocatorTest, ScaledDataPacketWithAllocator)
+{
+    const auto allocator = PoolAllocator();
+    const auto descriptor = DataDescriptorBuilder()
+                                .setSampleType(SampleType::Float64)
+                                .setRule(ExplicitDataRule())
+                                .setPostScaling(LinearScaling(2, 5, SampleType::Int32, ScaledSampleType::Float64))
+                                .build();
+
+    for (size_t iteration = 0; iteration < 3; ++iteration)
+    {
+        const auto packet = DataPacketWithAllocator(nullptr, descriptor, 50, allocator);
+        auto raw = static_cast<int32_t*>(packet.getRawData());
+        for (int32_t i = 0; i < 50; ++i)
+            raw[i] = i;
+
+        const auto scaled = static_cast<double*>(packet.getData());
+        for (int32_t i = 0; i < 50; ++i)
+            ASSERT_EQ(scaled[i], i * 2.0 + 5.0);
+    }
+
+    // Raw and scaled buffers are both recycled after the first packet
+    ASSERT_EQ(allocator.getMissCount(), 2u);
+    ASSERT_EQ(allocator.getHitCount(), 4u);
+}
+
+TEST_F(PoolAllocatorTest, OutOfMemory)
+{
+    const auto allocator = PoolAllocator();
+
+    void* address = nullptr;
+    ASSERT_EQ(allocator->allocate(nullptr, std::numeric_limits<SizeT>::max(), 0, &address), OPENDAQ_ERR_NOMEMORY);
+    ASSERT_EQ(address, nullptr);
+    ASSERT_THROW(allocator.allocate(nullptr, std::numeric_limits<SizeT>::max(), 0), NoMemoryException);
+}
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,48 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/common.h>
+
+// Runtime instruction set detection for the vectorized sample processing kernels. Kernels are compiled for
+// each instruction set with `DAQ_SIMD_TARGET` and selected on first use, so the library keeps running on
+// any x86-64 CPU.
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define DAQ_SIMD_X86
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #define DAQ_SIMD_TARGET(isa)
+    #else
+        #define DAQ_SIMD_TARGET(isa) __attribute__((target(isa)))
+    #endif
+#endif
+
+BEGIN_NAMESPACE_OPENDAQ
+
+#if defined(DAQ_SIMD_X86)
+
+enum class SimdLevel
+{
+    Sse2,
+    Avx2,
+    Avx512  // AVX-512 F and DQ
+};
+
+SimdLevel getSimdLevel();
+
+#endif
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,56 @@
+#include <opendaq/simd_level.h>
+
+#if defined(DAQ_SIMD_X86) && defined(_MSC_VER) && !defined(__clang__)
+    #include <immintrin.h>
+    #include <intrin.h>
+#endif
+
+BEGIN_NAMESPACE_OPENDAQ
+
+#if defined(DAQ_SIMD_X86)
+
+static SimdLevel detectSimdLevel()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    const int maxLeaf = info[0];
+
+    __cpuid(info, 1);
+    const bool osXSave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osXSave || !avx || maxLeaf < 7)
+        return SimdLevel::Sse2;
+
+    // the OS must save the YMM (and for AVX-512 also the opmask and ZMM) registers on context switch
+    const auto xcr0 = _xgetbv(0);
+    if ((xcr0 & 0x6) != 0x6)
+        return SimdLevel::Sse2;
+
+    __cpuidex(info, 7, 0);
+    const bool avx512f = (info[1] & (1 << 16)) != 0;
+    const bool avx512dq = (info[1] & (1 << 17)) != 0;
+    if (avx512f && avx512dq && (xcr0 & 0xE6) == 0xE6)
+        return SimdLevel::Avx512;
+    if ((info[1] & (1 << 5)) != 0)
+        return SimdLevel::Avx2;
+    return SimdLevel::Sse2;
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq"))
+        return SimdLevel::Avx512;
+    if (__builtin_cpu_supports("avx2"))
+        return SimdLevel::Avx2;
+    return SimdLevel::Sse2;
+#endif
+}
+
+SimdLevel getSimdLevel()
+{
+    static const SimdLevel level = detectSimdLevel();
+    return level;
+}
+
+#endif
+
+END_NAMESPACE_OPENDAQ
@@ -77,7 +77,8 @@ class BasicCsvRecorderSignal
         void onEventPacketReceived(const EventPacketPtr packet);
 
         /*!
-         * @brief Records the values the specified packet to the CSV file.
+         * @brief Records the values the specified packet to the CSV file. The formatted lines
+         *     are written to the file before returning.
          *
          * @todo Templated writer functions are selected based on the packet's sample type. This
          *     involves inspecting the descriptor for every packet. This could be optimized by
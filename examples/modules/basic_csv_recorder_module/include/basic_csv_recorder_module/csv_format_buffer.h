@@ -0,0 +1,95 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+#include <fmt/format.h>
+
+#include <basic_csv_recorder_module/common.h>
+
+BEGIN_NAMESPACE_OPENDAQ_BASIC_CSV_RECORDER_MODULE
+
+/*!
+ * @brief A reusable character buffer that CSV lines are formatted into before they are written
+ *     to a file.
+ *
+ * Values are formatted with fmt, which is independent of the stream locale. Floating-point
+ * values are written in the shortest form that reads back to the same value. The buffer keeps
+ * its capacity when it is cleared, so formatting does not allocate once the buffer has grown
+ * to its working size.
+ */
+class CsvFormatBuffer
+{
+    public:
+
+        /*!
+         * @brief Appends a numeric value.
+         *
+         * @tparam T The type of @p value. Character types are written as numbers.
+         * @param value The value to append.
+         */
+        template <typename T>
+        void appendValue(T value)
+        {
+            // invoking operator+() promotes character types to numerically-printable types
+            fmt::format_to(fmt::appender(buffer), "{}", +value);
+        }
+
+        void append(char ch)
+        {
+            buffer.push_back(ch);
+        }
+
+        void append(const std::string& str)
+        {
+            buffer.append(str.data(), str.data() + str.size());
+        }
+
+        std::size_t size() const
+        {
+            return buffer.size();
+        }
+
+        /*!
+         * @brief Writes the buffered characters to @p file and clears the buffer.
+         *
+         * @param file The stream to write to.
+         *
+         * @throws std::ios_base::failure The characters could not be written, if exceptions are
+         *     enabled on @p file.
+         */
+        void writeTo(std::ofstream& file)
+        {
+            file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+
+        void clear()
+        {
+            buffer.clear();
+        }
+
+    private:
+
+        fmt::memory_buffer buffer;
+};
+
+END_NAMESPACE_OPENDAQ_BASIC_CSV_RECORDER_MODULE
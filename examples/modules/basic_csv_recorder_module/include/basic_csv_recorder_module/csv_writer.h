@@ -24,6 +24,7 @@
 #include <opendaq/opendaq.h>
 
 #include <basic_csv_recorder_module/common.h>
+#include <basic_csv_recorder_module/csv_format_buffer.h>
 
 BEGIN_NAMESPACE_OPENDAQ_BASIC_CSV_RECORDER_MODULE
 
@@ -33,8 +34,9 @@ BEGIN_NAMESPACE_OPENDAQ_BASIC_CSV_RECORDER_MODULE
  * Writer objects own a std::ofstream handle, and the class provides templated functions for
  * writing data lines to the file as well as a function to write a header line.
  *
- * @remarks Platform-standard buffering and line endings from the C++ ostream library are used.
- *     Output is not explicitly flushed.
+ * @remarks Data lines are formatted into a CsvFormatBuffer, which is written to the file when it
+ *     exceeds FLUSH_SIZE bytes, when flush() is called and when the writer is destroyed. Callers
+ *     flush after each packet, so that the file does not lag behind the recording.
  *
  * @todo In the future, it may be desirable to add some control over the output formatting: for
  *     example, specifying the level of precision for floating-point values.
@@ -44,6 +46,11 @@ class CsvWriter
 {
     public:
 
+        /*!
+         * @brief The number of formatted bytes after which data lines are written to the file.
+         */
+        static constexpr std::size_t FLUSH_SIZE = 1 << 20;
+
         /*!
          * @brief Opens a new CSV file.
          *
@@ -62,6 +69,23 @@ class CsvWriter
             file.open(filename);
         }
 
+        /*!
+         * @brief Writes the buffered data lines and closes the file. I/O errors are ignored.
+         */
+        ~CsvWriter()
+        {
+            try
+            {
+                flush();
+            }
+            catch (const std::exception&)
+            {
+            }
+        }
+
+        CsvWriter(const CsvWriter&) = delete;
+        CsvWriter& operator=(const CsvWriter&) = delete;
+
         /*!
          * @brief Writes a header line to the CSV file.
          *
@@ -87,6 +111,8 @@ class CsvWriter
             const char *auxDomainName = nullptr,
             const char *auxValueName = nullptr)
         {
+            flush();
+
             file << quoteHeader(domainName) << ',' << quoteHeader(valueName) << '\n';
 
             if (auxDomainName || auxValueName)
@@ -97,9 +123,8 @@ class CsvWriter
         /*!
          * @brief Writes a data line to the CSV file.
          *
-         * Standard output conversions are used for the specified data types. Generally this means
-         * decimal values for integer types, and scientific-notation values for floating-point
-         * types.
+         * Integer types are written as decimal values, and floating-point types in the shortest
+         * form that reads back to the same value. The line is buffered; see flush().
          *
          * @tparam Domain The type of the @p domainValue argument.
          * @tparam Sample The type of the @p sample argument.
@@ -113,8 +138,27 @@ class CsvWriter
         template <typename Domain, typename Sample>
         void write(Domain domainValue, Sample sample)
         {
-            // invoking operator+() promotes character types to numerically-printable types
-            file << +domainValue << ',' << +sample << '\n';
+            buffer.appendValue(domainValue);
+            buffer.append(',');
+            buffer.appendValue(sample);
+            buffer.append('\n');
+
+            if (buffer.size() >= FLUSH_SIZE)
+                buffer.writeTo(file);
+        }
+
+        /*!
+         * @brief Writes the buffered data lines to the file and flushes the file stream, so that
+         *     the lines written so far can be read from the file.
+         *
+         * @throws std::ios_base::failure The data lines could not be written to the file due to an
+         *     I/O error.
+         */
+        void flush()
+        {
+            if (buffer.size() > 0)
+                buffer.writeTo(file);
+            file.flush();
         }
 
     private:
@@ -142,6 +186,7 @@ class CsvWriter
         }
 
         std::ofstream file;
+        CsvFormatBuffer buffer;
 };
 
 END_NAMESPACE_OPENDAQ_BASIC_CSV_RECORDER_MODULE
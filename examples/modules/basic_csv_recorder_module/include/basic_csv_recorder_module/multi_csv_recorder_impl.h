@@ -51,6 +51,7 @@ public:
         static constexpr const char* BASENAME = "Basename";
         static constexpr const char* FILE_TIMESTAMP_ENABLED = "FileTimestampEnabled";
         static constexpr const char* WRITE_DOMAIN = "WriteDomain";
+        static constexpr const char* FORMAT_THREADS = "FormatThreads";
     };
 
     /*!
@@ -125,6 +126,7 @@ private:
     std::string fileBasename;
     bool timestampEnabled;
     bool writeDomain;
+    size_t formatThreadCount = 1;
 
     std::optional<MultiCsvWriter> writer = std::nullopt;
 };
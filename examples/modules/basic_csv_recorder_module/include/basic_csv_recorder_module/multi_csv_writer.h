@@ -25,6 +25,7 @@
 #include <opendaq/opendaq.h>
 
 #include <basic_csv_recorder_module/common.h>
+#include <basic_csv_recorder_module/csv_format_buffer.h>
 #include <condition_variable>
 
 BEGIN_NAMESPACE_OPENDAQ_BASIC_CSV_RECORDER_MODULE
@@ -45,7 +46,10 @@ public:
         bool operator==(const DomainMetadata& rhs) const;
     };
 
-    MultiCsvWriter(const fs::path& file);
+    // Blocks with fewer values than this are formatted on the writer thread only
+    static constexpr size_t PARALLEL_FORMAT_THRESHOLD = 1 << 16;
+
+    MultiCsvWriter(const fs::path& file, size_t formatThreadCount = 1);
     ~MultiCsvWriter();
 
     void setHeaderInformation(const DataDescriptorPtr& domainDescriptor,
@@ -68,6 +72,9 @@ private:
     };
 
     void threadLoop();
+    void formatThreadLoop(size_t thread);
+    void formatRows(const JaggedBuffer& samples, size_t first, size_t last, CsvFormatBuffer& buffer) const;
+    void writeBlock(const JaggedBuffer& samples);
 
     void writeHeaders(Int firstPacketOffset, bool writeDomainColumn);
     std::string getMetadataHeader(const DomainMetadata& metadata);
@@ -89,6 +96,20 @@ private:
     std::string domainMetadata;
     DomainMetadata metadata;
 
+    size_t formatThreadCount;
+    std::vector<CsvFormatBuffer> formatBuffers;
+
+    // Format threads are started with the writer and format the row ranges of a block into their buffers
+    std::mutex formatMutex;
+    std::condition_variable formatCv;
+    std::condition_variable formatDoneCv;
+    const JaggedBuffer* formatBlock;
+    std::vector<std::pair<size_t, size_t>> formatRanges;
+    std::vector<bool> formatDone;
+    size_t formatGeneration;
+    bool formatExitFlag;
+    std::vector<std::thread> formatThreads;
+
     std::thread writerThread;
 };
 
@@ -255,18 +255,21 @@ void BasicCsvRecorderSignal::onDataPacketReceived(DataPacketPtr packet)
 
     switch (descriptor.getSampleType())
     {
-        case SampleType::Int8:      writeSamples<std::int8_t>(packet, writer); return;
-        case SampleType::Int16:     writeSamples<std::int16_t>(packet, writer); return;
-        case SampleType::Int32:     writeSamples<std::int32_t>(packet, writer); return;
-        case SampleType::Int64:     writeSamples<std::int64_t>(packet, writer); return;
-        case SampleType::UInt8:     writeSamples<std::uint8_t>(packet, writer); return;
-        case SampleType::UInt16:    writeSamples<std::uint16_t>(packet, writer); return;
-        case SampleType::UInt32:    writeSamples<std::uint32_t>(packet, writer); return;
-        case SampleType::UInt64:    writeSamples<std::uint64_t>(packet, writer); return;
-        case SampleType::Float32:   writeSamples<float>(packet, writer); return;
-        case SampleType::Float64:   writeSamples<double>(packet, writer); return;
+        case SampleType::Int8:      writeSamples<std::int8_t>(packet, writer); break;
+        case SampleType::Int16:     writeSamples<std::int16_t>(packet, writer); break;
+        case SampleType::Int32:     writeSamples<std::int32_t>(packet, writer); break;
+        case SampleType::Int64:     writeSamples<std::int64_t>(packet, writer); break;
+        case SampleType::UInt8:     writeSamples<std::uint8_t>(packet, writer); break;
+        case SampleType::UInt16:    writeSamples<std::uint16_t>(packet, writer); break;
+        case SampleType::UInt32:    writeSamples<std::uint32_t>(packet, writer); break;
+        case SampleType::UInt64:    writeSamples<std::uint64_t>(packet, writer); break;
+        case SampleType::Float32:   writeSamples<float>(packet, writer); break;
+        case SampleType::Float64:   writeSamples<double>(packet, writer); break;
         default: break;
     }
+
+    // the packet's lines are written together, so the file does not lag behind the recording
+    writer.flush();
 }
 
 void BasicCsvRecorderSignal::tryWriteHeaders(const DataDescriptorPtr& descriptor, const DataDescriptorPtr& domainDescriptor)
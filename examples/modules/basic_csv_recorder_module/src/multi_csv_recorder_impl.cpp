@@ -183,6 +183,10 @@ void MultiCsvRecorderImpl::initProperties()
 
     objPtr.addProperty(BoolProperty(Props::WRITE_DOMAIN, False));
     objPtr.getOnPropertyValueWrite(Props::WRITE_DOMAIN) += std::bind(&MultiCsvRecorderImpl::onPropertiesChanged, this);
+
+    // Large blocks of many-channel recordings are formatted on this many threads
+    objPtr.addProperty(IntPropertyBuilder(Props::FORMAT_THREADS, 1).setMinValue(1).setMaxValue(64).build());
+    objPtr.getOnPropertyValueWrite(Props::FORMAT_THREADS) += std::bind(&MultiCsvRecorderImpl::onPropertiesChanged, this);
 }
 
 std::string MultiCsvRecorderImpl::getNextPortID() const
@@ -324,7 +328,7 @@ void MultiCsvRecorderImpl::configureWriter(const DataDescriptorPtr& domainDescri
         fs::path outputFile = getNextCsvFilename(filePath.value(), fileBasename, timestampEnabled);
 
         // Replace the csv writer (can it ever survive a reconfigure?)
-        writer.emplace(outputFile);
+        writer.emplace(outputFile, formatThreadCount);
         writer.value().setHeaderInformation(recorderDomainDataDescriptor, valueDescriptors, signalNames, writeDomain);
 
         // Auto resume recording if recording was stopped internally.
@@ -371,6 +375,7 @@ void MultiCsvRecorderImpl::onPropertiesChanged()
     fileBasename = static_cast<std::string>(objPtr.getPropertyValue(Props::BASENAME));
     timestampEnabled = static_cast<bool>(objPtr.getPropertyValue(Props::FILE_TIMESTAMP_ENABLED));
     writeDomain = static_cast<bool>(objPtr.getPropertyValue(Props::WRITE_DOMAIN));
+    formatThreadCount = static_cast<size_t>(static_cast<Int>(objPtr.getPropertyValue(Props::FORMAT_THREADS)));
 
     reconfigureWriter();
 }
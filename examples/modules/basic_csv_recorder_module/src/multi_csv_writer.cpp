@@ -2,6 +2,7 @@
 #include <opendaq/custom_log.h>
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
 #include <iostream>
 
 BEGIN_NAMESPACE_OPENDAQ_BASIC_CSV_RECORDER_MODULE
@@ -51,10 +52,17 @@ bool MultiCsvWriter::DomainMetadata::operator==(const DomainMetadata& rhs) const
            referenceDomainTimeProtocol == rhs.referenceDomainTimeProtocol;
 }
 
-MultiCsvWriter::MultiCsvWriter(const fs::path& file)
+MultiCsvWriter::MultiCsvWriter(const fs::path& file, size_t formatThreadCount)
     : exitFlag(false)
     , headersWritten(false)
     , filepath(file)
+    , formatThreadCount(std::max<size_t>(formatThreadCount, 1))
+    , formatBuffers(this->formatThreadCount)
+    , formatBlock(nullptr)
+    , formatRanges(this->formatThreadCount)
+    , formatDone(this->formatThreadCount, true)
+    , formatGeneration(0)
+    , formatExitFlag(false)
     , writerThread([this]() { this->threadLoop(); })
 {
     if (filepath.has_parent_path())
@@ -63,6 +71,10 @@ MultiCsvWriter::MultiCsvWriter(const fs::path& file)
     }
 
     outFile.exceptions(std::ios::failbit | std::ios::badbit);
+
+    // the writer thread formats the first range of each block itself
+    for (size_t thread = 1; thread < this->formatThreadCount; ++thread)
+        formatThreads.emplace_back([this, thread]() { this->formatThreadLoop(thread); });
 }
 
 MultiCsvWriter::~MultiCsvWriter()
@@ -73,6 +85,14 @@ MultiCsvWriter::~MultiCsvWriter()
     cv.notify_all();
 
     writerThread.join();
+
+    std::unique_lock formatLock(formatMutex);
+    formatExitFlag = true;
+    formatLock.unlock();
+    formatCv.notify_all();
+
+    for (auto& thread : formatThreads)
+        thread.join();
 }
 
 void MultiCsvWriter::setHeaderInformation(const DataDescriptorPtr& domainDescriptor,
@@ -142,26 +162,104 @@ void MultiCsvWriter::threadLoop()
             writeHeaders(samples.packetOffset, writeDomainColumn);
         }
 
-        const size_t signalNum = samples.buffers.size();
-        // Write to file
-        for (size_t i = 0; i < samples.count; ++i)
+        writeBlock(samples);
+    }
+}
+
+void MultiCsvWriter::formatThreadLoop(size_t thread)
+{
+    size_t generation = 0;
+    while (true)
+    {
+        std::unique_lock lock{formatMutex};
+        formatCv.wait(lock, [this, &generation]() { return formatGeneration != generation || formatExitFlag; });
+
+        if (formatExitFlag)
         {
-            if (writeDomainColumn)
-            {
-                outFile << (samples.packetOffset + i * metadata.ruleDelta) << ",";
-            }
-            for (size_t signal = 0; signal < signalNum; ++signal)
-            {
-                double* signalSamplesPtr = samples.buffers[signal].get();
-                outFile << signalSamplesPtr[i];
+            return;
+        }
+
+        generation = formatGeneration;
+        if (formatDone[thread])
+        {
+            continue;
+        }
+
+        const JaggedBuffer& samples = *formatBlock;
+        const auto [first, last] = formatRanges[thread];
+        lock.unlock();
+
+        formatRows(samples, first, last, formatBuffers[thread]);
+
+        lock.lock();
+        formatDone[thread] = true;
+        lock.unlock();
+        formatDoneCv.notify_all();
+    }
+}
 
-                if (signal != signalNum - 1)
-                {
-                    outFile << ",";
-                }
+void MultiCsvWriter::formatRows(const JaggedBuffer& samples, size_t first, size_t last, CsvFormatBuffer& buffer) const
+{
+    const size_t signalNum = samples.buffers.size();
+    for (size_t i = first; i < last; ++i)
+    {
+        if (writeDomainColumn)
+        {
+            buffer.appendValue(samples.packetOffset + static_cast<Int>(i) * metadata.ruleDelta);
+            buffer.append(',');
+        }
+        for (size_t signal = 0; signal < signalNum; ++signal)
+        {
+            buffer.appendValue(samples.buffers[signal][i]);
+
+            if (signal != signalNum - 1)
+            {
+                buffer.append(',');
             }
-            outFile << "\n";
         }
+        buffer.append('\n');
+    }
+}
+
+void MultiCsvWriter::writeBlock(const JaggedBuffer& samples)
+{
+    const size_t valueCount = samples.count * (samples.buffers.size() + 1);
+    const size_t threadCount = valueCount < PARALLEL_FORMAT_THRESHOLD ? 1 : std::min(formatThreadCount, samples.count);
+
+    if (threadCount <= 1)
+    {
+        formatRows(samples, 0, samples.count, formatBuffers[0]);
+        formatBuffers[0].writeTo(outFile);
+        return;
+    }
+
+    // Rows are split into contiguous ranges that are formatted in parallel and written in order
+    const size_t rowsPerThread = (samples.count + threadCount - 1) / threadCount;
+
+    std::unique_lock lock(formatMutex);
+    formatBlock = &samples;
+    for (size_t thread = 1; thread < threadCount; ++thread)
+    {
+        const size_t first = std::min(thread * rowsPerThread, samples.count);
+        const size_t last = std::min(first + rowsPerThread, samples.count);
+        formatRanges[thread] = {first, last};
+        formatDone[thread] = false;
+    }
+    ++formatGeneration;
+    lock.unlock();
+    formatCv.notify_all();
+
+    formatRows(samples, 0, std::min(rowsPerThread, samples.count), formatBuffers[0]);
+
+    // the format threads are done with the block before anything is written, as writing can throw
+    lock.lock();
+    formatDoneCv.wait(lock, [this]() { return std::all_of(formatDone.begin(), formatDone.end(), [](bool done) { return done; }); });
+    formatBlock = nullptr;
+    lock.unlock();
+
+    for (size_t thread = 0; thread < threadCount; ++thread)
+    {
+        formatBuffers[thread].writeTo(outFile);
     }
 }
 
@@ -12,6 +12,14 @@
 #include <opendaq/recorder.h>
 #include <opendaq/sample_type_traits.h>
 #include <opendaq/scheduler_factory.h>
+#include <basic_csv_recorder_module/csv_writer.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <thread>
 
 using BasicCsvRecorderModuleTest = testing::Test;
 using namespace daq;
@@ -158,4 +166,70 @@ TEST_F(BasicCsvRecorderModuleTest, WritesToConfiguredSubdir)
     ASSERT_FALSE(foundInCwd);
 
     cleanup();
-}
\ No newline at end of file
+}
+
+TEST_F(BasicCsvRecorderModuleTest, CsvWriterFormatting)
+{
+    const fs::path file = fs::current_path() / "csv_test_formatting" / "values.csv";
+
+    {
+        basic_csv_recorder_module::CsvWriter writer(file);
+        writer.headers("Domain", "Value");
+        writer.write(std::int64_t{-5}, 0.1);
+        writer.write(std::uint8_t{200}, std::int8_t{-7});
+        writer.write(std::int64_t{1}, 1.0f / 3.0f);
+        writer.write(std::int64_t{2}, std::numeric_limits<double>::max());
+    }
+
+    std::ifstream readIn(file.string());
+    std::stringstream contents;
+    contents << readIn.rdbuf();
+
+    ASSERT_EQ(contents.str(), "\"Domain\",\"Value\"\n-5,0.1\n200,-7\n1,0.33333334\n2,1.7976931348623157e+308\n");
+
+    readIn.close();
+    fs::remove_all(file.parent_path());
+}
+
+TEST_F(BasicCsvRecorderModuleTest, PacketWrittenWhileRecording)
+{
+    const fs::path subdir = fs::current_path() / "csv_test_while_recording";
+    fs::remove_all(subdir);
+    fs::create_directories(subdir);
+
+    auto module = CreateModuleWithScheduler();
+    auto fb = module.createFunctionBlock("BasicCsvRecorder", nullptr, "fb");
+    auto recorder = fb.asPtr<daq::IRecorder>(true);
+    auto signal = CreateSignal(fb.getContext());
+    fb.getInputPorts().getItemAt(0).connect(signal);
+
+    fb.setPropertyValue("Path", subdir.string());
+    recorder->startRecording();
+
+    auto domain = DataPacket(signal.getDomainSignal().getDescriptor(), 100, 0);
+    auto data = DataPacketWithDomain(domain, signal.getDescriptor(), 100);
+    std::iota(static_cast<Float*>(data.getData()), static_cast<Float*>(data.getData()) + 100, 0);
+    signal.sendPacket(data);
+
+    const auto countLines = [&subdir]()
+    {
+        size_t lines = 0;
+        for (const auto& item : fs::directory_iterator(subdir))
+        {
+            std::ifstream readIn(item.path().string());
+            lines += static_cast<size_t>(std::count(std::istreambuf_iterator<char>(readIn), std::istreambuf_iterator<char>(), '\n'));
+        }
+        return lines;
+    };
+
+    // the packet is recorded on a worker thread, and reaches the file without stopping the recording
+    constexpr size_t expectedLines = 2 + 100;
+    for (int i = 0; i < 500 && countLines() < expectedLines; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_EQ(countLines(), expectedLines);
+
+    recorder->stopRecording();
+    fb = nullptr;
+
+    fs::remove_all(subdir);
+}
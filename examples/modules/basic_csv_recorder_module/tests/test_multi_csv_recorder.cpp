@@ -332,4 +332,41 @@ TEST_F(MultiCsvTest, DetectDescriptorChange)
     std::getline(readIn2, line);
     reference = "832,0.87,1.87,2.87,3.87,4.87,5.87,6.87,7.87,8.87,9.87";
     EXPECT_EQ(line, reference);
-}
\ No newline at end of file
+}
+
+TEST_F(MultiCsvTest, WriteSamplesFormatThreads)
+{
+    EXPECT_NO_THROW(fs::remove_all(outputFolder));
+    fb.setPropertyValue("WriteDomain", true);
+    fb.setPropertyValue("FormatThreads", 4);
+
+    for (size_t i = 0; i < validSignals.getCount(); ++i)
+        fb.getInputPorts()[i].connect(validSignals[i]);
+
+    fb.asPtr<IRecorder>(true).startRecording();
+
+    // large enough to be split between the format threads
+    constexpr size_t sampleCount = 10000;
+    sendData(sampleCount, 817, false, std::make_pair(0, 10));
+
+    fb.asPtr<IRecorder>(true).stopRecording();
+
+    std::ifstream readIn((this->outputFolder / "output.csv").string());
+    ASSERT_TRUE(readIn.is_open());
+
+    std::string line;
+    std::getline(readIn, line);
+    std::getline(readIn, line);
+
+    for (size_t j = 0; j < sampleCount; ++j)
+    {
+        std::string reference = std::to_string(817 + j);
+        for (size_t i = 0; i < 10; ++i)
+            reference += fmt::format(",{}", i + j - 0.13);
+
+        ASSERT_TRUE(std::getline(readIn, line));
+        ASSERT_EQ(line, reference);
+    }
+
+    ASSERT_FALSE(std::getline(readIn, line));
+}
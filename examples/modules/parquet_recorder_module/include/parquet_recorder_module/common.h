@@ -64,6 +64,23 @@ struct Props
      * This property can be set to `true` to stop recording and `false` to keep it active.
      */
     static constexpr const char* StopRecording = "StopRecording";
+    /*!
+     * @brief The number of samples accumulated per signal before a row group is written.
+     *
+     * Samples are written when a row group is full and when the recording stops. A value of 0
+     * writes every packet as soon as it is processed.
+     */
+    static constexpr const char* RowGroupSize = "RowGroupSize";
+    /*!
+     * @brief The compression codec used for column chunks.
+     *
+     * Codecs that are not available in the Arrow build fall back to uncompressed output.
+     */
+    static constexpr const char* Compression = "Compression";
+    /*!
+     * @brief Whether dictionary encoding is used for the recorded columns.
+     */
+    static constexpr const char* Dictionary = "Dictionary";
 };
 
 END_NAMESPACE_OPENDAQ_PARQUET_RECORDER_MODULE
@@ -26,11 +26,10 @@
 #include <opendaq/opendaq.h>
 
 #include <parquet_recorder_module/common.h>
+#include <parquet_recorder_module/parquet_writer.h>
 
 BEGIN_NAMESPACE_OPENDAQ_PARQUET_RECORDER_MODULE
 
-class ParquetWriter;
-
 /*!
  * @brief A function block recording data from its input signals into a Parquet
  *     file.
@@ -111,6 +110,7 @@ protected:
 private:
     void addProperties();
     void addInputPort();
+    ParquetWriterOptions getWriterOptions();
     void reconfigure();
     void clearWriters();
     std::shared_ptr<ParquetWriter> findWriterForSignal(IInputPort* port);
@@ -120,6 +120,7 @@ private:
     std::atomic_uint32_t portCount = 0;
     std::atomic_bool recording = false;
     std::optional<fs::path> cachedPath;
+    std::optional<ParquetWriterOptions> cachedOptions;
 };
 
 END_NAMESPACE_OPENDAQ_PARQUET_RECORDER_MODULE
@@ -33,6 +33,7 @@ namespace parquet
 
 namespace arrow
 {
+    class ArrayBuilder;
     class Schema;
     namespace io
     {
@@ -42,12 +43,49 @@ namespace arrow
 
 BEGIN_NAMESPACE_OPENDAQ_PARQUET_RECORDER_MODULE
 
+/*!
+ * @brief Column chunk compression codecs, in the order of the `Compression` selection property values.
+ */
+enum class ParquetCompression
+{
+    Uncompressed = 0,
+    Snappy,
+    Gzip,
+    Zstd,
+    Lz4
+};
+
+struct ParquetWriterOptions
+{
+    /*!
+     * @brief The number of samples accumulated before a row group is written. With 0, every packet
+     * is written as soon as it is processed.
+     */
+    size_t rowGroupSize = 0;
+    ParquetCompression compression = ParquetCompression::Uncompressed;
+    bool dictionary = true;
+
+    bool operator==(const ParquetWriterOptions& other) const
+    {
+        return rowGroupSize == other.rowGroupSize && compression == other.compression && dictionary == other.dictionary;
+    }
+
+    bool operator!=(const ParquetWriterOptions& other) const
+    {
+        return !(*this == other);
+    }
+};
+
 class ParquetWriter
 {
 public:
     static constexpr const size_t PACKET_BUFFER_SIZE_TO_WRITE = 10;
 
-    ParquetWriter(fs::path path, SignalPtr signal, daq::LoggerComponentPtr logger_component, daq::SchedulerPtr scheduler);
+    ParquetWriter(fs::path path,
+                  SignalPtr signal,
+                  daq::LoggerComponentPtr logger_component,
+                  daq::SchedulerPtr scheduler,
+                  ParquetWriterOptions options = {});
     ~ParquetWriter();
 
     void enqueuePacketList(ListPtr<IPacket>& packets);
@@ -57,6 +95,7 @@ private:
     SignalPtr signal;
     daq::LoggerComponentPtr loggerComponent;
     daq::SchedulerPtr scheduler;
+    ParquetWriterOptions options;
     std::string filename;
 
     std::mutex mutex;
@@ -66,6 +105,11 @@ private:
     DataDescriptorPtr currentDataDescriptor;
     DataDescriptorPtr currentDomainDescriptor;
 
+    // Builders are kept across packets and hold the samples of the row group being accumulated
+    std::unique_ptr<arrow::ArrayBuilder> sampleBuilder;
+    std::unique_ptr<arrow::ArrayBuilder> domainBuilder;
+    DataRulePtr linearDomainRule;
+
     std::vector<PacketPtr> packetBuffer;
     std::mutex packetBufferMutex;
 
@@ -83,9 +127,14 @@ private:
     void generateMetadata(const DataDescriptorPtr& dataDescriptor, const DataDescriptorPtr& domainDescriptor);
     void openFile();
     void closeFile();
+    void createBuilders();
+    void reserveBuilders();
+    void flushRowGroup();
 
     template <typename TDataType, typename TDomainType>
     void writePackets(const DataPacketPtr& data, const DataPacketPtr& domain);
+    template <typename TDomainType>
+    bool appendDomainValues(const DataPacketPtr& domain, SizeT sampleCount);
     template <typename TDataType>
     void writePackets(const DataPacketPtr& data, const DataPacketPtr& domain);
     void writePackets(const DataPacketPtr& data, const DataPacketPtr& domain);
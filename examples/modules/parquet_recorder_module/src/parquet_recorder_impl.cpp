@@ -127,6 +127,15 @@ void ParquetRecorderImpl::addProperties()
 
     objPtr.getOnPropertyValueWrite(Props::Path) += std::bind(&ParquetRecorderImpl::reconfigure, this);
 
+    objPtr.addProperty(IntPropertyBuilder(Props::RowGroupSize, 65536).setMinValue(0).build());
+    objPtr.getOnPropertyValueWrite(Props::RowGroupSize) += std::bind(&ParquetRecorderImpl::reconfigure, this);
+
+    objPtr.addProperty(SelectionProperty(Props::Compression, List<IString>("Uncompressed", "Snappy", "Gzip", "Zstd", "Lz4"), 0));
+    objPtr.getOnPropertyValueWrite(Props::Compression) += std::bind(&ParquetRecorderImpl::reconfigure, this);
+
+    objPtr.addProperty(BoolProperty(Props::Dictionary, True));
+    objPtr.getOnPropertyValueWrite(Props::Dictionary) += std::bind(&ParquetRecorderImpl::reconfigure, this);
+
     const auto startRecordingProp = FunctionProperty(Props::StartRecording, ProcedureInfo());
     objPtr.addProperty(startRecordingProp);
     objPtr.setPropertyValue(Props::StartRecording, Procedure([this] { this->startRecording(); }));
@@ -142,16 +151,32 @@ void ParquetRecorderImpl::addInputPort()
     auto c = createAndAddInputPort("Value" + std::to_string(portCount.fetch_add(1)), PacketReadyNotification::SameThread);
 }
 
+ParquetWriterOptions ParquetRecorderImpl::getWriterOptions()
+{
+    ParquetWriterOptions options;
+    options.rowGroupSize = static_cast<size_t>(static_cast<Int>(objPtr.getPropertyValue(Props::RowGroupSize)));
+    options.compression = static_cast<ParquetCompression>(static_cast<Int>(objPtr.getPropertyValue(Props::Compression)));
+    options.dictionary = objPtr.getPropertyValue(Props::Dictionary);
+    return options;
+}
+
 void ParquetRecorderImpl::reconfigure()
 {
     LOG_D("ParquetRecorderImpl::reconfigure: Reconfiguring ParquetRecorder...");
     auto lock = getRecursiveConfigLock();
     fs::path path = fs::path(static_cast<std::string>(objPtr.getPropertyValue(Props::Path))).lexically_normal();
 
-    bool pathChanged = false;
+    bool settingsChanged = false;
     if (!cachedPath.has_value() || cachedPath.value() != path){
         cachedPath = path;
-        pathChanged = true;
+        settingsChanged = true;
+    }
+
+    const auto options = getWriterOptions();
+    if (!cachedOptions.has_value() || cachedOptions.value() != options)
+    {
+        cachedOptions = options;
+        settingsChanged = true;
     }
 
     if (!recording)
@@ -172,14 +197,14 @@ void ParquetRecorderImpl::reconfigure()
             auto signal = connection.getSignal();
             ports.emplace(inputPort.getObject());
 
-            // Create writer for any new ports as well as replace writers when path changes.
+            // Create writer for any new ports as well as replace writers when path or writer options change.
             auto it = writers.find(inputPort.getObject());
-            if (it == writers.end() || pathChanged)
+            if (it == writers.end() || settingsChanged)
             {
                 // Might take a long time to stop the existing writer and create a new one.
                 writers.insert_or_assign(
                     inputPort.getObject(),
-                    std::make_shared<ParquetWriter>(path, signal, loggerComponent, context.getScheduler()));
+                    std::make_shared<ParquetWriter>(path, signal, loggerComponent, context.getScheduler(), options));
             }
         }
     }
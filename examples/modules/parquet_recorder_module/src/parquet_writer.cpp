@@ -8,6 +8,7 @@
 
 #include <arrow/api.h>
 #include <arrow/io/file.h>
+#include <arrow/util/compression.h>
 #include <parquet/arrow/writer.h>
 
 #include <parquet_recorder_module/type_resolver.h>
@@ -48,11 +49,58 @@ static std::string getFilename(const fs::path& path, const SignalPtr& signal)
     return retPath.string();
 }
 
-ParquetWriter::ParquetWriter(fs::path path, SignalPtr signal, daq::LoggerComponentPtr logger_component, daq::SchedulerPtr scheduler)
+template <typename T>
+static T numberAs(const NumberPtr& number)
+{
+    if constexpr (std::is_floating_point_v<T>)
+        return static_cast<T>(number.getFloatValue());
+    else
+        return static_cast<T>(number.getIntValue());
+}
+
+static arrow::Compression::type toArrowCompression(ParquetCompression compression)
+{
+    switch (compression)
+    {
+        case ParquetCompression::Snappy:
+            return arrow::Compression::SNAPPY;
+        case ParquetCompression::Gzip:
+            return arrow::Compression::GZIP;
+        case ParquetCompression::Zstd:
+            return arrow::Compression::ZSTD;
+        case ParquetCompression::Lz4:
+            return arrow::Compression::LZ4;
+        case ParquetCompression::Uncompressed:
+        default:
+            return arrow::Compression::UNCOMPRESSED;
+    }
+}
+
+static bool isIntegralSampleType(SampleType type)
+{
+    switch (type)
+    {
+        case SampleType::UInt8:
+        case SampleType::Int8:
+        case SampleType::UInt16:
+        case SampleType::Int16:
+        case SampleType::UInt32:
+        case SampleType::Int32:
+        case SampleType::UInt64:
+        case SampleType::Int64:
+            return true;
+        default:
+            return false;
+    }
+}
+
+ParquetWriter::ParquetWriter(
+    fs::path path, SignalPtr signal, daq::LoggerComponentPtr logger_component, daq::SchedulerPtr scheduler, ParquetWriterOptions options)
     : path(std::move(path))
     , signal(std::move(signal))
     , loggerComponent(std::move(logger_component))
     , scheduler(std::move(scheduler))
+    , options(options)
     , filename(getFilename(this->path, this->signal))
 {
     packetBuffer.reserve(PACKET_BUFFER_SIZE_TO_WRITE);
@@ -62,8 +110,16 @@ ParquetWriter::~ParquetWriter()
 {
     isClosing = true;
     scheduler.waitAll();
-    std::lock_guard bufferLock(packetBufferMutex);
     std::lock_guard lock(mutex);
+    try
+    {
+        // packets that did not fill a whole batch are still written
+        processPacketList(dequeuePacketList());
+    }
+    catch (const std::exception& e)
+    {
+        LOG_E("ParquetWriter::~ParquetWriter: Exception while processing remaining packets: {}", e.what());
+    }
     closeFile();
 }
 
@@ -207,83 +263,180 @@ void ParquetWriter::writePackets(const DataPacketPtr& data, const DataPacketPtr&
 template <typename TDataType, typename TDomainType>
 void ParquetWriter::writePackets(const DataPacketPtr& data, const DataPacketPtr& domain)
 {
-    typename ArrowTypeResolver<TDataType>::BuilderType sampleBuilder;
-    typename ArrowTypeResolver<TDomainType>::BuilderType domainBuilder;
-
     if (!data.assigned())
     {
         LOG_E("Data packet is null, cannot write samples");
         return;
     }
 
-    auto status = sampleBuilder.AppendValues(static_cast<TDataType*>(data.getData()), data.getSampleCount());
-    if(!status.ok()) {
+    if (!sampleBuilder || !domainBuilder)
+    {
+        LOG_E("Column builders for {} are not initialized", filename);
+        return;
+    }
+
+    const auto sampleCount = data.getSampleCount();
+    const auto domainCount = domain.assigned() ? domain.getSampleCount() : sampleCount;
+
+    if (sampleCount != domainCount)
+    {
+        LOG_E("Sample count ({}) does not match domain count ({}), cannot write to Parquet file", sampleCount, domainCount);
+        return;
+    }
+
+    if (sampleBuilder->length() == 0)
+        reserveBuilders();
+
+    auto& samples = static_cast<typename ArrowTypeResolver<TDataType>::BuilderType&>(*sampleBuilder);
+    auto status = samples.AppendValues(static_cast<TDataType*>(data.getData()), sampleCount);
+    if (!status.ok())
+    {
         LOG_E("Failed to append sample values: {}", status.ToString());
         return;
     }
 
-    if (domain.assigned())
+    if (!appendDomainValues<TDomainType>(domain, sampleCount))
     {
-        status = domainBuilder.AppendValues(static_cast<TDomainType*>(domain.getData()), domain.getSampleCount());
-        if(!status.ok()) {
-            LOG_E("Failed to append domain values: {}", status.ToString());
+        // both columns of a row group must have the same length; the domain column is nullable, so the samples of
+        // the failed packet are kept without domain values instead of dropping the rows already collected
+        const auto missingDomainCount = sampleBuilder->length() - domainBuilder->length();
+        status = domainBuilder->AppendNulls(missingDomainCount);
+        if (!status.ok())
+        {
+            LOG_E("Failed to append null domain values, dropping the current row group: {}", status.ToString());
+            sampleBuilder->Reset();
+            domainBuilder->Reset();
             return;
         }
-    } else {
-        status = domainBuilder.AppendNulls(data.getSampleCount());
-        if(!status.ok()) {
-            LOG_E("Failed to append null domain values: {}", status.ToString());
-            return;
+    }
+
+    if (sampleBuilder->length() >= static_cast<int64_t>(options.rowGroupSize))
+        flushRowGroup();
+}
+
+template <typename TDomainType>
+bool ParquetWriter::appendDomainValues(const DataPacketPtr& domain, SizeT sampleCount)
+{
+    auto& domains = static_cast<typename ArrowTypeResolver<TDomainType>::BuilderType&>(*domainBuilder);
+
+    arrow::Status status;
+    if (!domain.assigned())
+    {
+        status = domains.AppendNulls(sampleCount);
+    }
+    else if (linearDomainRule.assigned())
+    {
+        // Linear domain values are generated from the rule; reading the packet data would materialise them first
+        const auto parameters = linearDomainRule.getParameters();
+        const auto delta = numberAs<TDomainType>(parameters.get("delta"));
+        const NumberPtr packetOffset = domain.getOffset();
+        const auto offset = static_cast<TDomainType>(
+            (packetOffset.assigned() ? numberAs<TDomainType>(packetOffset) : TDomainType{}) + numberAs<TDomainType>(parameters.get("start")));
+
+        status = domains.Reserve(sampleCount);
+        if (status.ok())
+        {
+            for (SizeT i = 0; i < sampleCount; ++i)
+                domains.UnsafeAppend(static_cast<TDomainType>(delta * static_cast<TDomainType>(i) + offset));
         }
     }
+    else
+    {
+        status = domains.AppendValues(static_cast<TDomainType*>(domain.getData()), sampleCount);
+    }
 
-    const auto sampleCount = data.getSampleCount();
-    const auto domainCount = domain.assigned() ? domain.getSampleCount() : sampleCount;
+    if (!status.ok())
+    {
+        LOG_E("Failed to append domain values: {}", status.ToString());
+        return false;
+    }
 
-    if (sampleCount != domainCount)
+    return true;
+}
+
+void ParquetWriter::createBuilders()
+{
+    sampleBuilder.reset();
+    domainBuilder.reset();
+
+    if (!schema)
+        return;
+
+    auto domains = arrow::MakeBuilder(schema->field(0)->type());
+    auto samples = arrow::MakeBuilder(schema->field(1)->type());
+    if (!domains.ok() || !samples.ok())
     {
-        LOG_E("Sample count ({}) does not match domain count ({}), cannot write to Parquet file", sampleCount, domainCount);
+        LOG_E("Failed to create column builders: {}", (domains.ok() ? samples.status() : domains.status()).ToString());
         return;
     }
 
-    auto samples = sampleBuilder.Finish().ValueOr(nullptr);
-    auto domains = domainBuilder.Finish().ValueOr(nullptr);
+    domainBuilder = std::move(domains).ValueUnsafe();
+    sampleBuilder = std::move(samples).ValueUnsafe();
+}
+
+void ParquetWriter::reserveBuilders()
+{
+    if (options.rowGroupSize == 0)
+        return;
+
+    const auto capacity = static_cast<int64_t>(options.rowGroupSize);
+    auto status = sampleBuilder->Reserve(capacity);
+    if (status.ok())
+        status = domainBuilder->Reserve(capacity);
+
+    if (!status.ok())
+        LOG_W("Failed to reserve space for a row group of {} samples: {}", options.rowGroupSize, status.ToString());
+}
+
+void ParquetWriter::flushRowGroup()
+{
+    if (!sampleBuilder || !domainBuilder || sampleBuilder->length() == 0)
+        return;
+
+    std::shared_ptr<arrow::Array> samples;
+    std::shared_ptr<arrow::Array> domains;
+
+    auto status = sampleBuilder->Finish(&samples);
+    if (status.ok())
+        status = domainBuilder->Finish(&domains);
 
-    if (!domains)
+    if (!status.ok())
     {
-        LOG_E("Failed to finish domain values");
+        LOG_E("Failed to finish row group values: {}", status.ToString());
+        sampleBuilder->Reset();
+        domainBuilder->Reset();
         return;
     }
-    if (!samples)
+
+    if (!writer)
     {
-        LOG_E("Failed to finish sample values");
+        LOG_E("Writer for {} is not initialized", filename);
         return;
     }
 
-    auto batch = arrow::RecordBatch::Make(schema, sampleCount, {domains, samples});
-
+    const auto rowCount = samples->length();
+    auto batch = arrow::RecordBatch::Make(schema, rowCount, {domains, samples});
     if (!batch)
     {
         LOG_E("Failed to create RecordBatch for Parquet file");
         return;
     }
 
-    if (writer)
+    if (options.rowGroupSize == 0)
     {
         status = writer->WriteRecordBatch(*batch);
-        if (!status.ok())
-        {
-            LOG_E("Failed to write record batch to Parquet file: {}", status.ToString());
-        }
-        else
-        {
-            LOG_D("ParquetWriter::writePackets: Successfully wrote record batch with ID: {} and sample count: {}", data.getPacketId(), sampleCount);
-        }
     }
     else
     {
-        LOG_E("Writer for {} is not initialized", filename);
+        // each accumulated batch is written as a row group of its own
+        auto table = arrow::Table::FromRecordBatches({batch});
+        status = table.ok() ? writer->WriteTable(**table, rowCount) : table.status();
     }
+
+    if (!status.ok())
+        LOG_E("Failed to write record batch to Parquet file: {}", status.ToString());
+    else
+        LOG_D("ParquetWriter::flushRowGroup: Successfully wrote record batch with sample count: {}", rowCount);
 }
 
 void ParquetWriter::onEventPacket(const EventPacketPtr& packet)
@@ -334,6 +487,9 @@ void ParquetWriter::generateMetadata(const DataDescriptorPtr& dataDescriptor, co
     currentDataDescriptor = dataDescriptor;
     currentDomainDescriptor = domainDescriptor;
 
+    const auto domainRule = domainDescriptor.getRule();
+    linearDomainRule = domainRule.assigned() && domainRule.getType() == DataRuleType::Linear ? domainRule : nullptr;
+
     schema = arrow::schema(
         {arrow::field(domainName, arrow_type_from_sample_type(domainType), true, arrow::key_value_metadata({{"metadata", domainMetadata}})),
          arrow::field(dataName, arrow_type_from_sample_type(dataType), false, arrow::key_value_metadata({{"metadata", dataMetadata}}))});
@@ -350,6 +506,8 @@ void ParquetWriter::generateMetadata(const DataDescriptorPtr& dataDescriptor, co
     {
         LOG_E("Failed to generate schema for Parquet file");
     }
+
+    createBuilders();
 }
 
 void ParquetWriter::openFile()
@@ -366,6 +524,29 @@ void ParquetWriter::openFile()
 
         auto writerPropertiesBuilder = parquet::WriterProperties::Builder();
 
+        auto compression = toArrowCompression(options.compression);
+        if (!arrow::util::Codec::IsAvailable(compression))
+        {
+            LOG_W("Compression codec {} is not available, writing uncompressed", arrow::util::Codec::GetCodecAsString(compression));
+            compression = arrow::Compression::UNCOMPRESSED;
+        }
+        writerPropertiesBuilder.compression(compression);
+
+        if (!options.dictionary)
+            writerPropertiesBuilder.disable_dictionary();
+
+        // row group boundaries are decided by the accumulated batches
+        if (options.rowGroupSize > 0)
+            writerPropertiesBuilder.max_row_group_length(std::numeric_limits<int64_t>::max());
+
+        // linear domain values have a constant difference and delta encode to almost nothing
+        if (linearDomainRule.assigned() && isIntegralSampleType(currentDomainDescriptor.getSampleType()))
+        {
+            const auto& domainColumn = schema->field(0)->name();
+            writerPropertiesBuilder.disable_dictionary(domainColumn);
+            writerPropertiesBuilder.encoding(domainColumn, parquet::Encoding::DELTA_BINARY_PACKED);
+        }
+
         // Create Parquet FileWriter
         writer = parquet::arrow::FileWriter::Open(
                      *schema, arrow::default_memory_pool(), outfile, writerPropertiesBuilder.build(), arrowPropertiesBuilder.build())
@@ -379,6 +560,8 @@ void ParquetWriter::openFile()
 void ParquetWriter::closeFile()
 {
     LOG_D("ParquetWriter::closeFile: Closing Parquet file and writer");
+    flushRowGroup();
+
     if (writer)
     {
         auto status = writer->Close();
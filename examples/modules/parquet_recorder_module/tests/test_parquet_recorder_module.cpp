@@ -2,6 +2,7 @@
 #include <chrono>
 #include <cstddef>
 #include <filesystem>
+#include <numeric>
 #include <thread>
 #include <utility>
 
@@ -47,6 +48,27 @@ static SignalConfigPtr CreateSignal(const ContextPtr& context)
     return signal;
 }
 
+static std::shared_ptr<arrow::Table> ReadRecordedTable(const fs::path& dir, int* rowGroupCount = nullptr)
+{
+    auto items = fs::directory_iterator(dir);
+    auto parquetItem =
+        std::find_if(fs::begin(items),
+                     fs::end(items),
+                     [](const fs::directory_entry& item) { return item.is_regular_file() && item.path().extension() == ".parquet"; });
+    if (parquetItem == fs::end(items))
+        return nullptr;
+
+    std::shared_ptr<arrow::io::ReadableFile> input = arrow::io::ReadableFile::Open(parquetItem->path().string()).ValueOrDie();
+    std::unique_ptr<parquet::arrow::FileReader> arrowReader = parquet::arrow::OpenFile(input, arrow::default_memory_pool()).ValueOrDie();
+    if (rowGroupCount)
+        *rowGroupCount = arrowReader->num_row_groups();
+
+    std::shared_ptr<arrow::Table> table;
+    if (!arrowReader->ReadTable(&table).ok())
+        return nullptr;
+    return table;
+}
+
 static ModulePtr CreateModule()
 {
     ModulePtr module;
@@ -227,4 +249,70 @@ TEST_F(ParquetRecorderModuleTest, WritesToConfiguredSubdir)
     ASSERT_FALSE(foundInCwd);
 
     cleanup();
-}
\ No newline at end of file
+}
+
+TEST_F(ParquetRecorderModuleTest, BufferedRowGroups)
+{
+    const fs::path subdir = fs::current_path() / "parquet_test_row_groups";
+    fs::remove_all(subdir);
+    fs::create_directories(subdir);
+
+    auto module = CreateModuleWithScheduler();
+    auto fb = module.createFunctionBlock("ParquetRecorder", nullptr, "fb");
+    auto recorder = fb.asPtr<daq::IRecorder>(true);
+    auto signal = CreateSignal(fb.getContext());
+    fb.getInputPorts().getItemAt(0).connect(signal);
+
+    fb.setPropertyValue("Path", subdir.string());
+    fb.setPropertyValue("RowGroupSize", 10'000);
+    recorder->startRecording();
+
+    // a partial row group is written when the recording stops
+    for (auto i = 0; i < 25'050; i += 50)
+    {
+        auto domain = DataPacket(signal.getDomainSignal().getDescriptor(), 50, i);
+        auto data = DataPacketWithDomain(domain, signal.getDescriptor(), 50);
+        std::iota(static_cast<Float*>(data.getData()), static_cast<Float*>(data.getData()) + 50, i);
+        signal.sendPacket(data);
+    }
+
+    recorder->stopRecording();
+    fb = nullptr;
+
+    int rowGroupCount = 0;
+    auto table = ReadRecordedTable(subdir, &rowGroupCount);
+    ASSERT_TRUE(table);
+    ASSERT_EQ(table->num_rows(), 25'050);
+    ASSERT_EQ(rowGroupCount, 3);
+
+    // linear domain values are generated from the packet offsets
+    Int expectedDomain = 0;
+    for (const auto& chunk : table->column(0)->chunks())
+    {
+        auto array = std::static_pointer_cast<arrow::Int64Array>(chunk);
+        for (const auto& value : *array)
+            ASSERT_EQ(value, expectedDomain++);
+    }
+
+    Float expectedValue = 0;
+    for (const auto& chunk : table->column(1)->chunks())
+    {
+        auto array = std::static_pointer_cast<arrow::DoubleArray>(chunk);
+        for (const auto& value : *array)
+            ASSERT_EQ(value, expectedValue++);
+    }
+
+    fs::remove_all(subdir);
+}
+
+TEST_F(ParquetRecorderModuleTest, WriterOptions)
+{
+    auto module = CreateModule();
+    auto fb = module.createFunctionBlock("ParquetRecorder", nullptr, "fb");
+
+    ASSERT_EQ(fb.getPropertyValue("RowGroupSize"), 65536);
+    ASSERT_EQ(fb.getPropertyValue("Compression"), 0);
+    ASSERT_EQ(fb.getPropertyValue("Dictionary"), True);
+    fb.setPropertyValue("RowGroupSize", -1);
+    ASSERT_EQ(fb.getPropertyValue("RowGroupSize"), 0);
+}
@@ -21,7 +21,7 @@
 #include <opendaq/signal_config_ptr.h>
 #include <opendaq/block_reader_ptr.h>
 #include <opendaq/event_packet_ptr.h>
-#include <kiss_fft.h>
+#include <ref_fb_module/real_fft.h>
 
 BEGIN_NAMESPACE_REF_FB_MODULE
 namespace FFT
@@ -34,7 +34,6 @@ class FFTFbImpl final : public FunctionBlock
 {
 public:
     explicit FFTFbImpl(const ModuleInfoPtr& moduleInfo, const ContextPtr& ctx, const ComponentPtr& parent, const StringPtr& localId);
-    ~FFTFbImpl() override;
 
     static FunctionBlockTypePtr CreateType(const ModuleInfoPtr& moduleInfo);
 
@@ -60,10 +59,7 @@ private:
     std::vector<float> inputData;
     std::vector<uint64_t> inputDomainData;
 
-
-    kiss_fft_cfg cfg;
-    std::vector<kiss_fft_cpx> fftIn;
-    std::vector<kiss_fft_cpx> fftOut;
+    RealFft fft;
 
     void createInputPorts();
     void createSignals();
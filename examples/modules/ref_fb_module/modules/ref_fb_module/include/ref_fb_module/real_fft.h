@@ -0,0 +1,72 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <ref_fb_module/common.h>
+#include <kiss_fft.h>
+#include <vector>
+
+BEGIN_NAMESPACE_REF_FB_MODULE
+namespace FFT
+{
+
+/*!
+ * @brief Amplitude spectrum of real-valued blocks.
+ *
+ * A block of N real samples is transformed as N/2 complex values (even samples as the real part,
+ * odd samples as the imaginary part) by a complex FFT of half the size, and the spectrum of the
+ * real input is then recovered from it. The input is read in place, without widening it to
+ * complex samples.
+ */
+class RealFft
+{
+public:
+    RealFft() = default;
+    ~RealFft();
+
+    RealFft(const RealFft&) = delete;
+    RealFft& operator=(const RealFft&) = delete;
+
+    /*!
+     * @brief Prepares the transform for blocks of `blockSize` samples. `blockSize` must be even.
+     */
+    void configure(size_t blockSize);
+
+    /*!
+     * @brief Computes the amplitude spectra of `blockCount` consecutive blocks of `input`.
+     *
+     * For each block, `blockSize / 2` amplitudes of the bins 1 to `blockSize / 2` are written
+     * to `output`, scaled so that a sine of amplitude A yields A in its bin.
+     */
+    void computeAmplitudes(const float* input, size_t blockCount, double* output);
+
+private:
+    size_t blockSize = 0;
+    size_t halfSize = 0;
+    kiss_fft_cfg cfg = nullptr;
+
+    std::vector<kiss_fft_cpx> spectrum;
+    std::vector<double> twiddleRe;
+    std::vector<double> twiddleIm;
+    std::vector<double> binRe;
+    std::vector<double> binIm;
+
+    void computeBins();
+};
+
+}
+
+END_NAMESPACE_REF_FB_MODULE
@@ -18,8 +18,10 @@
 #include <opendaq/data_packet_ptr.h>
 #include <opendaq/function_block_impl.h>
 #include <opendaq/input_port_config_ptr.h>
+#include <opendaq/pool_allocator_ptr.h>
 #include <opendaq/sample_type_traits.h>
 #include <ref_fb_module/common.h>
+#include <ref_fb_module/statistics_kernels.h>
 
 BEGIN_NAMESPACE_REF_FB_MODULE
 
@@ -115,6 +117,16 @@ private:
         }
     };
 
+    struct OutputBuffers
+    {
+        uint8_t* avg = nullptr;
+        uint8_t* rms = nullptr;
+        uint8_t* min = nullptr;
+        uint8_t* max = nullptr;
+        uint8_t* peakToPeak = nullptr;
+        uint8_t* stdDev = nullptr;
+    };
+
     FunctionBlockPtr nestedTriggerFunctionBlock;
     InputPortConfigPtr triggerInput;
     TriggerHistory triggerHistory;
@@ -128,17 +140,27 @@ private:
 
     SignalConfigPtr avgSignal;
     SignalConfigPtr rmsSignal;
+    SignalConfigPtr minSignal;
+    SignalConfigPtr maxSignal;
+    SignalConfigPtr peakToPeakSignal;
+    SignalConfigPtr stdDevSignal;
     SignalConfigPtr domainSignal;
 
     DataDescriptorPtr inputValueDataDescriptor;
     DataDescriptorPtr inputDomainDataDescriptor;
     DataDescriptorPtr outputAverageDataDescriptor;
     DataDescriptorPtr outputRmsDataDescriptor;
+    DataDescriptorPtr outputMinDataDescriptor;
+    DataDescriptorPtr outputMaxDataDescriptor;
+    DataDescriptorPtr outputPeakToPeakDataDescriptor;
+    DataDescriptorPtr outputStdDevDataDescriptor;
     DataDescriptorPtr outputDomainDataDescriptor;
 
     SampleType sampleType;
     std::unique_ptr<uint8_t, FreeDeleter> calcBuf;
 
+    PoolAllocatorPtr packetAllocator;
+
     size_t calcBufSize;
     size_t calcBufAllocatedSize;
     size_t sampleSize;
@@ -167,6 +189,12 @@ private:
     void processDataPacketTrigger(const DataPacketPtr& packet);
     void processDataPacketInput(const DataPacketPtr& packet);
     NumberPtr addNumbers(const NumberPtr a, const NumberPtr& b);
+    DataDescriptorPtr buildOutputDataDescriptor(const std::string& nameSuffix, SampleType outputSampleType = SampleType::Invalid);
+    DataPacketPtr createOutputPacket(const SignalConfigPtr& signal,
+                                     const DataDescriptorPtr& descriptor,
+                                     const DataPacketPtr& domainPacket,
+                                     size_t sampleCount,
+                                     uint8_t*& buffer);
 
     template <SampleType ST,
               SampleType DST,
@@ -174,7 +202,7 @@ private:
               class SampleT = typename SampleTypeToType<ST>::Type,
               class AggT = typename SampleTypeToType<AT>::Type,
               class DomainSampleT = typename SampleTypeToType<DST>::Type>
-    void calc(SampleT* data, int64_t firstTick, SampleT* outAvgData, SampleT* outRmsData, DomainSampleT* outDomainData, size_t avgCount);
+    void calc(SampleT* data, int64_t firstTick, const OutputBuffers& outputs, DomainSampleT* outDomainData, size_t avgCount);
 
     template <SampleType ST,
               SampleType DST,
@@ -182,9 +210,9 @@ private:
               class SampleT = typename SampleTypeToType<ST>::Type,
               class AggT = typename SampleTypeToType<AT>::Type,
               class DomainSampleT = typename SampleTypeToType<DST>::Type>
-    void calcUntyped(uint8_t* data, int64_t firstTick, uint8_t* outAvgData, uint8_t* outRmsData, uint8_t* outDomainData, size_t avgCount);
+    void calcUntyped(uint8_t* data, int64_t firstTick, const OutputBuffers& outputs, uint8_t* outDomainData, size_t avgCount);
 
-    void calculate(uint8_t* data, int64_t firstTick, uint8_t* outAvgData, uint8_t* outRmsData, uint8_t* outDomainData, size_t avgCount);
+    void calculate(uint8_t* data, int64_t firstTick, const OutputBuffers& outputs, uint8_t* outDomainData, size_t avgCount);
 
     void onPacketReceived(const InputPortPtr& port) override;
     void processTriggerPackets(const InputPortPtr& port);
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <ref_fb_module/common.h>
+#include <cstddef>
+
+BEGIN_NAMESPACE_REF_FB_MODULE
+
+namespace Statistics
+{
+
+template <class SampleT, class AggT>
+struct BlockStatistics
+{
+    AggT sum;
+    AggT sumOfSquares;
+    SampleT min;
+    SampleT max;
+};
+
+/*!
+ * @brief Computes the sum, sum of squares, minimum and maximum of `count` samples in a single pass.
+ *
+ * The samples are accumulated into a fixed number of interleaved partial results, which gives the
+ * loop independent dependency chains that the compiler can map onto packed SIMD instructions
+ * without relaxing floating-point semantics. `count` must be greater than zero.
+ */
+template <class SampleT, class AggT>
+BlockStatistics<SampleT, AggT> computeBlockStatistics(const SampleT* data, size_t count)
+{
+    constexpr size_t lanes = 8;
+
+    AggT sum[lanes] = {};
+    AggT sumOfSquares[lanes] = {};
+    SampleT min[lanes];
+    SampleT max[lanes];
+    for (size_t lane = 0; lane < lanes; ++lane)
+    {
+        min[lane] = data[0];
+        max[lane] = data[0];
+    }
+
+    size_t i = 0;
+    for (; i + lanes <= count; i += lanes)
+    {
+        for (size_t lane = 0; lane < lanes; ++lane)
+        {
+            const SampleT value = data[i + lane];
+            const auto aggValue = static_cast<AggT>(value);
+            sum[lane] += aggValue;
+            sumOfSquares[lane] += aggValue * aggValue;
+            min[lane] = value < min[lane] ? value : min[lane];
+            max[lane] = max[lane] < value ? value : max[lane];
+        }
+    }
+
+    for (size_t lane = 0; i < count; ++i, ++lane)
+    {
+        const SampleT value = data[i];
+        const auto aggValue = static_cast<AggT>(value);
+        sum[lane] += aggValue;
+        sumOfSquares[lane] += aggValue * aggValue;
+        min[lane] = value < min[lane] ? value : min[lane];
+        max[lane] = max[lane] < value ? value : max[lane];
+    }
+
+    BlockStatistics<SampleT, AggT> result{sum[0], sumOfSquares[0], min[0], max[0]};
+    for (size_t lane = 1; lane < lanes; ++lane)
+    {
+        result.sum += sum[lane];
+        result.sumOfSquares += sumOfSquares[lane];
+        result.min = min[lane] < result.min ? min[lane] : result.min;
+        result.max = result.max < max[lane] ? max[lane] : result.max;
+    }
+
+    return result;
+}
+
+template <class SampleT, class AggT>
+void mergeBlockStatistics(BlockStatistics<SampleT, AggT>& target, const BlockStatistics<SampleT, AggT>& source)
+{
+    target.sum += source.sum;
+    target.sumOfSquares += source.sumOfSquares;
+    target.min = source.min < target.min ? source.min : target.min;
+    target.max = target.max < source.max ? source.max : target.max;
+}
+
+}
+
+END_NAMESPACE_REF_FB_MODULE
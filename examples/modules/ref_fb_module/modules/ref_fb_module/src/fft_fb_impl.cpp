@@ -27,13 +27,6 @@ FFTFbImpl::FFTFbImpl(const ModuleInfoPtr& moduleInfo, const ContextPtr& ctx, con
     initProperties();
     createSignals();
     createInputPorts();
-
-    cfg = nullptr;
-}
-
-FFTFbImpl::~FFTFbImpl()
-{
-    kiss_fft_free(cfg);
 }
 
 void FFTFbImpl::initProperties()
@@ -171,10 +164,7 @@ void FFTFbImpl::configure()
             DataDescriptorBuilderCopy(inputDomainDataDescriptor).setRule(ExplicitDataRule()).setSampleType(SampleType::UInt64).build();
         outputDomainSignal.setDescriptor(outputDomainDataDescriptor);
 
-        kiss_fft_free(cfg);
-        cfg = kiss_fft_alloc(static_cast<int>(blockSize), 0, nullptr, nullptr);
-        fftIn.resize(blockSize);
-        fftOut.resize(blockSize);
+        fft.configure(blockSize);
 
         configValid = true;
         setComponentStatus(ComponentStatus::Ok);
@@ -232,20 +222,10 @@ void FFTFbImpl::processData(SizeT readAmount)
     const auto outputPacket = DataPacketWithDomain(outputDomainPacket, outputDataDescriptor, readAmount);
     const auto outputData = static_cast<double*>(outputPacket.getData());
 
-    for (size_t blockIdx = 0; blockIdx < readAmount; blockIdx++)
-    {
-        for (size_t i = 0; i < blockSize; i++)
-        {
-            fftIn[i].r = inputData[blockIdx * blockSize + i];
-            fftIn[i].i = 0;
-        }
-
-        kiss_fft(cfg, fftIn.data(), fftOut.data());
+    fft.computeAmplitudes(inputData.data(), readAmount, outputData);
 
-        for (size_t idx = 0; idx < blockSize / 2; idx++)
-            outputData[blockIdx * (blockSize / 2) + idx] = 2 * std::sqrt(std::pow(fftOut[idx + 1].r, 2) + std::pow(fftOut[idx + 1].i, 2)) / blockSize;
+    for (size_t blockIdx = 0; blockIdx < readAmount; blockIdx++)
         outputDomainData[blockIdx] = inputDomainData[blockIdx * blockSize];
-    }
 
     outputSignal.sendPacket(outputPacket);
     outputDomainSignal.sendPacket(outputDomainPacket);
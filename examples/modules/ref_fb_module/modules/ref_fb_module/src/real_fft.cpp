@@ -0,0 +1,91 @@
+#include <ref_fb_module/real_fft.h>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+
+BEGIN_NAMESPACE_REF_FB_MODULE
+
+namespace FFT
+{
+
+static_assert(std::is_same_v<kiss_fft_scalar, float>, "RealFft expects single precision kissfft");
+static_assert(sizeof(kiss_fft_cpx) == 2 * sizeof(float), "kiss_fft_cpx must be a packed pair of floats");
+
+RealFft::~RealFft()
+{
+    kiss_fft_free(cfg);
+}
+
+void RealFft::configure(size_t blockSize)
+{
+    if (blockSize < 2 || blockSize % 2 != 0)
+        throw std::invalid_argument("FFT: Block size must be even");
+
+    kiss_fft_free(cfg);
+    cfg = nullptr;
+
+    this->blockSize = blockSize;
+    halfSize = blockSize / 2;
+    cfg = kiss_fft_alloc(static_cast<int>(halfSize), 0, nullptr, nullptr);
+    if (cfg == nullptr)
+        throw std::runtime_error("FFT: Failed to allocate FFT configuration");
+
+    spectrum.resize(halfSize);
+    binRe.resize(halfSize);
+    binIm.resize(halfSize);
+
+    // t[k] = -i * exp(-2 * pi * i * k / N), for k = 1 .. N/2
+    twiddleRe.resize(halfSize);
+    twiddleIm.resize(halfSize);
+    const double pi = std::acos(-1.0);
+    for (size_t k = 1; k <= halfSize; k++)
+    {
+        const double phase = -2.0 * pi * static_cast<double>(k) / static_cast<double>(blockSize);
+        twiddleRe[k - 1] = std::sin(phase);
+        twiddleIm[k - 1] = -std::cos(phase);
+    }
+}
+
+void RealFft::computeAmplitudes(const float* input, size_t blockCount, double* output)
+{
+    const double scale = 2.0 / static_cast<double>(blockSize);
+
+    for (size_t blockIdx = 0; blockIdx < blockCount; blockIdx++)
+    {
+        // Pairs of real samples are laid out exactly like kiss_fft_cpx, as kiss_fftr also relies on
+        const auto packed = reinterpret_cast<const kiss_fft_cpx*>(input + blockIdx * blockSize);
+        kiss_fft(cfg, packed, spectrum.data());
+
+        computeBins();
+
+        double* amplitudes = output + blockIdx * halfSize;
+        for (size_t k = 0; k < halfSize; k++)
+            amplitudes[k] = scale * std::sqrt(binRe[k] * binRe[k] + binIm[k] * binIm[k]);
+    }
+}
+
+void RealFft::computeBins()
+{
+    // X[k] = (F1 + t[k] * F2) / 2, where F1 = Z[k] + conj(Z[M - k]) and F2 = Z[k] - conj(Z[M - k]),
+    // with Z the spectrum of the packed samples and M = N/2 (indices taken modulo M)
+    for (size_t k = 1; k <= halfSize; k++)
+    {
+        const auto& zk = spectrum[k % halfSize];
+        const auto& zn = spectrum[halfSize - k];
+
+        const double f1Re = static_cast<double>(zk.r) + zn.r;
+        const double f1Im = static_cast<double>(zk.i) - zn.i;
+        const double f2Re = static_cast<double>(zk.r) - zn.r;
+        const double f2Im = static_cast<double>(zk.i) + zn.i;
+
+        const double tRe = twiddleRe[k - 1];
+        const double tIm = twiddleIm[k - 1];
+
+        binRe[k - 1] = 0.5 * (f1Re + tRe * f2Re - tIm * f2Im);
+        binIm[k - 1] = 0.5 * (f1Im + tRe * f2Im + tIm * f2Re);
+    }
+}
+
+}
+
+END_NAMESPACE_REF_FB_MODULE
@@ -1,21 +1,28 @@
 #include <opendaq/custom_log.h>
 #include <opendaq/event_packet_params.h>
 #include <opendaq/packet_factory.h>
+#include <opendaq/pool_allocator_factory.h>
 #include <ref_fb_module/statistics_fb_impl.h>
 #include <opendaq/module_manager_utils_ptr.h>
 #include <opendaq/component_type_private.h>
+#include <algorithm>
+#include <numeric>
 
 BEGIN_NAMESPACE_REF_FB_MODULE
 
 namespace Statistics
 {
 
+// Overlapping windows are assembled from the statistics of shared chunks only if the chunks are at least this long
+static constexpr size_t minMergedChunkSize = 16;
+
 StatisticsFbImpl::StatisticsFbImpl(const ModuleInfoPtr& moduleInfo,
                                    const ContextPtr& ctx,
                                    const ComponentPtr& parent,
                                    const StringPtr& localId,
                                    const PropertyObjectPtr& config)
     : FunctionBlock(CreateType(moduleInfo), ctx, parent, localId)
+    , packetAllocator(PoolAllocator())
 {
     initComponentStatus();
     initProperties();
@@ -26,6 +33,16 @@ StatisticsFbImpl::StatisticsFbImpl(const ModuleInfoPtr& moduleInfo,
     avgSignal.setDomainSignal(domainSignal);
     rmsSignal.setDomainSignal(domainSignal);
 
+    if (config.assigned() && config.hasProperty("ExtendedStatistics") && config.getPropertyValue("ExtendedStatistics"))
+    {
+        minSignal = createAndAddSignal("min");
+        maxSignal = createAndAddSignal("max");
+        peakToPeakSignal = createAndAddSignal("peak_to_peak");
+        stdDevSignal = createAndAddSignal("std_dev");
+        for (const auto& signal : {minSignal, maxSignal, peakToPeakSignal, stdDevSignal})
+            signal.setDomainSignal(domainSignal);
+    }
+
     if (config.assigned() && config.hasProperty("UseMultiThreadedScheduler") && !config.getPropertyValue("UseMultiThreadedScheduler"))
         packetReadyNotification = PacketReadyNotification::SameThread;
     else
@@ -42,6 +59,7 @@ FunctionBlockTypePtr StatisticsFbImpl::CreateType(const ModuleInfoPtr& moduleInf
 {
     auto defaultConfig = PropertyObject();
     defaultConfig.addProperty(BoolProperty("UseMultiThreadedScheduler", true));
+    defaultConfig.addProperty(BoolProperty("ExtendedStatistics", false));
 
     auto fbType = FunctionBlockType("RefFBModuleStatistics",
                                     "Statistics",
@@ -200,19 +218,26 @@ void StatisticsFbImpl::configure()
     }
     sampleSize = getSampleSize(sampleType);
 
-    const auto outputAverageDataDescriptor = DataDescriptorBuilderCopy(inputValueDataDescriptor)
-                                                 .setName(static_cast<std::string>(inputValueDataDescriptor.getName() + "/Avg"))
-                                                 .setPostScaling(nullptr);
-    this->outputAverageDataDescriptor = outputAverageDataDescriptor.build();
+    outputAverageDataDescriptor = buildOutputDataDescriptor("/Avg");
+    avgSignal.setDescriptor(outputAverageDataDescriptor);
 
-    avgSignal.setDescriptor(this->outputAverageDataDescriptor);
+    outputRmsDataDescriptor = buildOutputDataDescriptor("/Rms");
+    rmsSignal.setDescriptor(outputRmsDataDescriptor);
 
-    const auto outputRmsDataDescriptor = DataDescriptorBuilderCopy(inputValueDataDescriptor)
-                                             .setName(static_cast<std::string>(inputValueDataDescriptor.getName() + "/Rms"))
-                                             .setPostScaling(nullptr);
-    this->outputRmsDataDescriptor = outputRmsDataDescriptor.build();
+    if (minSignal.assigned())
+    {
+        outputMinDataDescriptor = buildOutputDataDescriptor("/Min");
+        minSignal.setDescriptor(outputMinDataDescriptor);
 
-    rmsSignal.setDescriptor(this->outputRmsDataDescriptor);
+        outputMaxDataDescriptor = buildOutputDataDescriptor("/Max");
+        maxSignal.setDescriptor(outputMaxDataDescriptor);
+
+        outputPeakToPeakDataDescriptor = buildOutputDataDescriptor("/PeakToPeak", SampleType::Float64);
+        peakToPeakSignal.setDescriptor(outputPeakToPeakDataDescriptor);
+
+        outputStdDevDataDescriptor = buildOutputDataDescriptor("/StdDev", SampleType::Float64);
+        stdDevSignal.setDescriptor(outputStdDevDataDescriptor);
+    }
 
     resetCalcBuf();
     triggerHistory.dropHistory();
@@ -223,6 +248,20 @@ void StatisticsFbImpl::configure()
     LOG_T("Configured: Input data sample type {}", convertSampleTypeToString(sampleType))
 }
 
+DataDescriptorPtr StatisticsFbImpl::buildOutputDataDescriptor(const std::string& nameSuffix, SampleType outputSampleType)
+{
+    auto builder = DataDescriptorBuilderCopy(inputValueDataDescriptor)
+                       .setName(static_cast<std::string>(inputValueDataDescriptor.getName()) + nameSuffix)
+                       .setPostScaling(nullptr);
+
+    // Outputs that do not fit the input sample type (e.g. the peak-to-peak of a full-scale integer signal)
+    // are not limited to the input value range
+    if (outputSampleType != SampleType::Invalid)
+        builder.setSampleType(outputSampleType).setValueRange(nullptr);
+
+    return builder.build();
+}
+
 bool StatisticsFbImpl::acceptSampleType(SampleType sampleType)
 {
     switch (sampleType)  // NOLINT(clang-diagnostic-switch-enum)
@@ -376,46 +415,60 @@ void StatisticsFbImpl::calculateAndSendPackets(const DataPacketPtr& domainPacket
     if (outSampleCount == 0)
         return;
 
-    const auto outDomainPacket = DataPacket(outputDomainDataDescriptor,
-                                            outSampleCount,
-                                            domainSignalType == DomainSignalType::implicit ? outputPacketStartDomainValue : nullptr);
+    const auto outDomainPacket = domainSignalType == DomainSignalType::implicit
+                                     ? DataPacket(outputDomainDataDescriptor, outSampleCount, outputPacketStartDomainValue)
+                                     : DataPacketWithAllocator(nullptr, outputDomainDataDescriptor, outSampleCount, packetAllocator);
     const auto outDomainPacketBuf = static_cast<uint8_t*>(outDomainPacket.getRawData());
 
-    const bool calcAvg = avgSignal.getActive();
-    const bool calcRms = rmsSignal.getActive();
+    OutputBuffers outputs;
+    const auto avgDataPacket = createOutputPacket(avgSignal, outputAverageDataDescriptor, outDomainPacket, outSampleCount, outputs.avg);
+    const auto rmsDataPacket = createOutputPacket(rmsSignal, outputRmsDataDescriptor, outDomainPacket, outSampleCount, outputs.rms);
+    const auto minDataPacket = createOutputPacket(minSignal, outputMinDataDescriptor, outDomainPacket, outSampleCount, outputs.min);
+    const auto maxDataPacket = createOutputPacket(maxSignal, outputMaxDataDescriptor, outDomainPacket, outSampleCount, outputs.max);
+    const auto peakToPeakDataPacket =
+        createOutputPacket(peakToPeakSignal, outputPeakToPeakDataDescriptor, outDomainPacket, outSampleCount, outputs.peakToPeak);
+    const auto stdDevDataPacket =
+        createOutputPacket(stdDevSignal, outputStdDevDataDescriptor, outDomainPacket, outSampleCount, outputs.stdDev);
 
-    uint8_t* outAvgDataPacketBuf = nullptr;
-    uint8_t* outRmsDataPacketBuf = nullptr;
-    DataPacketPtr avgDataPacket;
-    DataPacketPtr rmsDataPacket;
+    calculate(calcBuf.get(), outputPacketStartDomainValue, outputs, outDomainPacketBuf, outSampleCount);
 
-    if (calcAvg)
-    {
-        avgDataPacket = DataPacketWithDomain(outDomainPacket, outputAverageDataDescriptor, outSampleCount);
-
-        outAvgDataPacketBuf = static_cast<uint8_t*>(avgDataPacket.getRawData());
-    }
+    copyRemainingCalcBuf(outSampleCount * overlappedBlockSizeRemainder);
 
-    if (calcRms)
-    {
-        rmsDataPacket = DataPacketWithDomain(outDomainPacket, outputRmsDataDescriptor, outSampleCount);
+    if (avgDataPacket.assigned())
+        avgSignal.sendPacket(avgDataPacket);
 
-        outRmsDataPacketBuf = static_cast<uint8_t*>(rmsDataPacket.getRawData());
-    }
+    if (rmsDataPacket.assigned())
+        rmsSignal.sendPacket(rmsDataPacket);
 
-    calculate(calcBuf.get(), outputPacketStartDomainValue, outAvgDataPacketBuf, outRmsDataPacketBuf, outDomainPacketBuf, outSampleCount);
+    if (minDataPacket.assigned())
+        minSignal.sendPacket(minDataPacket);
 
-    copyRemainingCalcBuf(outSampleCount * overlappedBlockSizeRemainder);
+    if (maxDataPacket.assigned())
+        maxSignal.sendPacket(maxDataPacket);
 
-    if (calcAvg)
-        avgSignal.sendPacket(avgDataPacket);
+    if (peakToPeakDataPacket.assigned())
+        peakToPeakSignal.sendPacket(peakToPeakDataPacket);
 
-    if (calcRms)
-        rmsSignal.sendPacket(rmsDataPacket);
+    if (stdDevDataPacket.assigned())
+        stdDevSignal.sendPacket(stdDevDataPacket);
 
     domainSignal.sendPacket(outDomainPacket);
 }
 
+DataPacketPtr StatisticsFbImpl::createOutputPacket(const SignalConfigPtr& signal,
+                                                   const DataDescriptorPtr& descriptor,
+                                                   const DataPacketPtr& domainPacket,
+                                                   size_t sampleCount,
+                                                   uint8_t*& buffer)
+{
+    if (!signal.assigned() || !signal.getActive())
+        return nullptr;
+
+    auto packet = DataPacketWithAllocator(domainPacket, descriptor, sampleCount, packetAllocator);
+    buffer = static_cast<uint8_t*>(packet.getRawData());
+    return packet;
+}
+
 void StatisticsFbImpl::processDataPacketInput(const DataPacketPtr& packet)
 {
     if (!valid)
@@ -493,26 +546,65 @@ NumberPtr StatisticsFbImpl::addNumbers(const NumberPtr a, const NumberPtr& b)
 }
 
 template <SampleType ST, SampleType DST, SampleType AT, class SampleT, class AggT, class DomainSampleT>
-void StatisticsFbImpl::calc(
-    SampleT* data, int64_t firstTick, SampleT* outAvgData, SampleT* outRmsData, DomainSampleT* outDomainData, size_t avgCount)
+void StatisticsFbImpl::calc(SampleT* data, int64_t firstTick, const OutputBuffers& outputs, DomainSampleT* outDomainData, size_t avgCount)
 {
+    using Stats = BlockStatistics<SampleT, AggT>;
+
+    auto* outAvgData = reinterpret_cast<SampleT*>(outputs.avg);
+    auto* outRmsData = reinterpret_cast<SampleT*>(outputs.rms);
+    auto* outMinData = reinterpret_cast<SampleT*>(outputs.min);
+    auto* outMaxData = reinterpret_cast<SampleT*>(outputs.max);
+    auto* outPeakToPeakData = reinterpret_cast<Float*>(outputs.peakToPeak);
+    auto* outStdDevData = reinterpret_cast<Float*>(outputs.stdDev);
+
+    // Overlapping windows share whole chunks of gcd(block size, hop) samples. The statistics of each chunk
+    // are computed once, and each window merges the statistics of its chunks instead of revisiting its samples.
+    const size_t chunkSize = std::gcd(blockSize, overlappedBlockSizeRemainder);
+    const bool mergeChunks = overlappedBlockSize > 0 && chunkSize >= minMergedChunkSize;
+    const size_t chunksPerBlock = blockSize / chunkSize;
+    const size_t chunksPerHop = overlappedBlockSizeRemainder / chunkSize;
+
+    // Kept across calls so that the chunk statistics are not reallocated for every packet
+    static thread_local std::vector<Stats> chunkStatistics;
+    if (mergeChunks)
+    {
+        const size_t chunkCount = (avgCount - 1) * chunksPerHop + chunksPerBlock;
+        chunkStatistics.resize(chunkCount);
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+            chunkStatistics[chunk] = computeBlockStatistics<SampleT, AggT>(data + chunk * chunkSize, chunkSize);
+    }
+
     for (size_t i = 0; i < avgCount; ++i)
     {
-        AggT sumAvg = 0;
-        AggT sumRms = 0;
-        for (size_t j = 0; j < blockSize; ++j)
+        Stats stats;
+        if (mergeChunks)
         {
-            const auto val = data[i * overlappedBlockSizeRemainder + j];
-            if (outAvgData != nullptr)
-                sumAvg += val;
-            if (outRmsData != nullptr)
-                sumRms += val * val;
+            stats = chunkStatistics[i * chunksPerHop];
+            for (size_t chunk = 1; chunk < chunksPerBlock; ++chunk)
+                mergeBlockStatistics(stats, chunkStatistics[i * chunksPerHop + chunk]);
+        }
+        else
+        {
+            stats = computeBlockStatistics<SampleT, AggT>(data + i * overlappedBlockSizeRemainder, blockSize);
         }
 
         if (outAvgData != nullptr)
-            *outAvgData++ = sumAvg / static_cast<AggT>(blockSize);
+            *outAvgData++ = stats.sum / static_cast<AggT>(blockSize);
         if (outRmsData != nullptr)
-            *outRmsData++ = std::sqrt(sumRms / static_cast<AggT>(blockSize));
+            *outRmsData++ = std::sqrt(stats.sumOfSquares / static_cast<AggT>(blockSize));
+        if (outMinData != nullptr)
+            *outMinData++ = stats.min;
+        if (outMaxData != nullptr)
+            *outMaxData++ = stats.max;
+        if (outPeakToPeakData != nullptr)
+            *outPeakToPeakData++ = static_cast<Float>(stats.max) - static_cast<Float>(stats.min);
+        if (outStdDevData != nullptr)
+        {
+            // Population standard deviation
+            const double mean = static_cast<double>(stats.sum) / static_cast<double>(blockSize);
+            const double variance = static_cast<double>(stats.sumOfSquares) / static_cast<double>(blockSize) - mean * mean;
+            *outStdDevData++ = std::sqrt(std::max(variance, 0.0));
+        }
 
         if (outDomainData)
         {
@@ -533,19 +625,15 @@ void StatisticsFbImpl::calc(
 }
 
 template <SampleType ST, SampleType DST, SampleType AT, class SampleT, class AggT, class DomainSampleT>
-void StatisticsFbImpl::calcUntyped(
-    uint8_t* data, int64_t firstTick, uint8_t* outAvgData, uint8_t* outRmsData, uint8_t* outDomainData, size_t avgCount)
+void StatisticsFbImpl::calcUntyped(uint8_t* data, int64_t firstTick, const OutputBuffers& outputs, uint8_t* outDomainData, size_t avgCount)
 {
     auto* dataTyped = reinterpret_cast<SampleT*>(data);
-    auto* outAvgDataTyped = reinterpret_cast<SampleT*>(outAvgData);
-    auto* outRmsDataTyped = reinterpret_cast<SampleT*>(outRmsData);
     auto* outDomainDataTyped = reinterpret_cast<DomainSampleT*>(outDomainData);
 
-    calc<ST, DST, AT, SampleT, AggT>(dataTyped, firstTick, outAvgDataTyped, outRmsDataTyped, outDomainDataTyped, avgCount);
+    calc<ST, DST, AT, SampleT, AggT>(dataTyped, firstTick, outputs, outDomainDataTyped, avgCount);
 }
 
-void StatisticsFbImpl::calculate(
-    uint8_t* data, int64_t firstTick, uint8_t* outAvgData, uint8_t* outRmsData, uint8_t* outDomainData, size_t avgCount)
+void StatisticsFbImpl::calculate(uint8_t* data, int64_t firstTick, const OutputBuffers& outputs, uint8_t* outDomainData, size_t avgCount)
 {
     switch (domainSignalType)
     {
@@ -553,34 +641,34 @@ void StatisticsFbImpl::calculate(
             switch (sampleType)
             {
                 case SampleType::Float32:
-                    calcUntyped<SampleType::Float32, SampleType::Invalid>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::Float32, SampleType::Invalid>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::Float64:
-                    calcUntyped<SampleType::Float64, SampleType::Invalid>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::Float64, SampleType::Invalid>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::UInt8:
-                    calcUntyped<SampleType::UInt8, SampleType::Invalid>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::UInt8, SampleType::Invalid>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::Int8:
-                    calcUntyped<SampleType::Int8, SampleType::Invalid>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::Int8, SampleType::Invalid>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::UInt16:
-                    calcUntyped<SampleType::UInt16, SampleType::Invalid>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::UInt16, SampleType::Invalid>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::Int16:
-                    calcUntyped<SampleType::Int16, SampleType::Invalid>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::Int16, SampleType::Invalid>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::UInt32:
-                    calcUntyped<SampleType::UInt32, SampleType::Invalid>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::UInt32, SampleType::Invalid>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::Int32:
-                    calcUntyped<SampleType::Int32, SampleType::Invalid>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::Int32, SampleType::Invalid>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::UInt64:
-                    calcUntyped<SampleType::UInt64, SampleType::Invalid>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::UInt64, SampleType::Invalid>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::Int64:
-                    calcUntyped<SampleType::Int64, SampleType::Invalid>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::Int64, SampleType::Invalid>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 default:
                     setComponentStatusWithMessage(ComponentStatus::Error,
@@ -592,34 +680,34 @@ void StatisticsFbImpl::calculate(
             switch (sampleType)
             {
                 case SampleType::Float32:
-                    calcUntyped<SampleType::Float32, SampleType::Int64>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::Float32, SampleType::Int64>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::Float64:
-                    calcUntyped<SampleType::Float64, SampleType::Int64>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::Float64, SampleType::Int64>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::UInt8:
-                    calcUntyped<SampleType::UInt8, SampleType::Int64>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::UInt8, SampleType::Int64>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::Int8:
-                    calcUntyped<SampleType::Int8, SampleType::Int64>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::Int8, SampleType::Int64>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::UInt16:
-                    calcUntyped<SampleType::UInt16, SampleType::UInt64>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::UInt16, SampleType::Int64>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::Int16:
-                    calcUntyped<SampleType::Int16, SampleType::Int64>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::Int16, SampleType::Int64>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::UInt32:
-                    calcUntyped<SampleType::UInt32, SampleType::Int64>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::UInt32, SampleType::Int64>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::Int32:
-                    calcUntyped<SampleType::Int32, SampleType::Int64>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::Int32, SampleType::Int64>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::UInt64:
-                    calcUntyped<SampleType::UInt64, SampleType::Int64>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::UInt64, SampleType::Int64>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::Int64:
-                    calcUntyped<SampleType::Int64, SampleType::Int64>(data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                    calcUntyped<SampleType::Int64, SampleType::Int64>(data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 default:
                     setComponentStatusWithMessage(ComponentStatus::Error,
@@ -632,43 +720,43 @@ void StatisticsFbImpl::calculate(
             {
                 case SampleType::Float32:
                     calcUntyped<SampleType::Float32, SampleType::RangeInt64>(
-                        data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                        data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::Float64:
                     calcUntyped<SampleType::Float64, SampleType::RangeInt64>(
-                        data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                        data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::UInt8:
                     calcUntyped<SampleType::UInt8, SampleType::RangeInt64>(
-                        data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                        data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::Int8:
                     calcUntyped<SampleType::Int8, SampleType::RangeInt64>(
-                        data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                        data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::UInt16:
                     calcUntyped<SampleType::UInt16, SampleType::RangeInt64>(
-                        data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                        data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::Int16:
                     calcUntyped<SampleType::Int16, SampleType::RangeInt64>(
-                        data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                        data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::UInt32:
                     calcUntyped<SampleType::UInt32, SampleType::RangeInt64>(
-                        data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                        data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::Int32:
                     calcUntyped<SampleType::Int32, SampleType::RangeInt64>(
-                        data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                        data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::UInt64:
                     calcUntyped<SampleType::UInt64, SampleType::RangeInt64>(
-                        data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                        data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 case SampleType::Int64:
                     calcUntyped<SampleType::Int64, SampleType::RangeInt64>(
-                        data, firstTick, outAvgData, outRmsData, outDomainData, avgCount);
+                        data, firstTick, outputs, outDomainData, avgCount);
                     break;
                 default:
                     setComponentStatusWithMessage(ComponentStatus::Error,
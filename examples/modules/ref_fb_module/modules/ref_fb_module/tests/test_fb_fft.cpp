@@ -0,0 +1,175 @@
+#include <opendaq/context_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/module_ptr.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/reader_factory.h>
+#include <opendaq/scheduler_factory.h>
+#include <opendaq/signal_factory.h>
+#include <ref_fb_module/module_dll.h>
+#include <testutils/testutils.h>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+using namespace daq;
+
+class FFTFbTest : public testing::Test
+{
+protected:
+    ContextPtr context;
+    ModulePtr module;
+    FunctionBlockPtr fb;
+    SignalConfigPtr domainSignal;
+    SignalConfigPtr dataSignal;
+    PacketReaderPtr reader;
+
+    void SetUp() override
+    {
+        const auto logger = Logger();
+        context = Context(Scheduler(logger), logger, TypeManager(), nullptr, nullptr);
+        createModule(&module, context);
+
+        const auto domainDescriptor = DataDescriptorBuilder()
+                                          .setSampleType(SampleType::Int64)
+                                          .setRule(LinearDataRule(1, 0))
+                                          .setTickResolution(Ratio(1, 1000))
+                                          .setUnit(Unit("s", -1, "seconds", "time"))
+                                          .setOrigin("1970-01-01T00:00:00")
+                                          .build();
+        domainSignal = SignalWithDescriptor(context, domainDescriptor, nullptr, "DomainSignal");
+
+        const auto dataDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).setRule(ExplicitDataRule()).build();
+        dataSignal = SignalWithDescriptor(context, dataDescriptor, nullptr, "Signal");
+        dataSignal.setDomainSignal(domainSignal);
+
+        fb = module.createFunctionBlock("RefFBModuleFFT", nullptr, "FB");
+    }
+
+    void TearDown() override
+    {
+        context.getScheduler().stop();
+    }
+
+    void connect(size_t blockSize)
+    {
+        fb.setPropertyValue("BlockSize", static_cast<Int>(blockSize / 2));
+        fb.getInputPorts()[0].connect(dataSignal);
+        reader = PacketReader(fb.getSignals()[0]);
+    }
+
+    void send(const std::vector<float>& samples, Int offset)
+    {
+        const auto domainPacket = DataPacket(domainSignal.getDescriptor(), samples.size(), offset);
+        const auto dataPacket = DataPacketWithDomain(domainPacket, dataSignal.getDescriptor(), samples.size());
+        std::memcpy(dataPacket.getRawData(), samples.data(), samples.size() * sizeof(float));
+
+        domainSignal.sendPacket(domainPacket);
+        dataSignal.sendPacket(dataPacket);
+    }
+
+    // Collects output data packets until `blockCount` spectra were received
+    std::vector<DataPacketPtr> receive(size_t blockCount)
+    {
+        std::vector<DataPacketPtr> packets;
+        size_t received = 0;
+        int timeout = 1000;
+        while (received < blockCount && timeout-- > 0)
+        {
+            const auto packet = reader.read();
+            if (!packet.assigned())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                continue;
+            }
+
+            if (packet.getType() == PacketType::Data)
+            {
+                const auto dataPacket = packet.asPtr<IDataPacket>();
+                received += dataPacket.getSampleCount();
+                packets.push_back(dataPacket);
+            }
+        }
+        return packets;
+    }
+};
+
+static std::vector<float> createSignal(size_t blockSize, size_t blockCount, const std::vector<std::pair<size_t, double>>& tones)
+{
+    const double pi = std::acos(-1.0);
+    std::vector<float> samples(blockSize * blockCount);
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        double value = 0;
+        for (const auto& [bin, amplitude] : tones)
+            value += amplitude * std::sin(2.0 * pi * static_cast<double>(bin * i) / static_cast<double>(blockSize));
+        samples[i] = static_cast<float>(value);
+    }
+    return samples;
+}
+
+TEST_F(FFTFbTest, SineAmplitudes)
+{
+    constexpr size_t blockSize = 64;
+    constexpr size_t blockCount = 4;
+    connect(blockSize);
+
+    const std::vector<std::pair<size_t, double>> tones{{5, 3.0}, {12, 0.5}};
+    send(createSignal(blockSize, blockCount, tones), 0);
+
+    const auto packets = receive(blockCount);
+    ASSERT_FALSE(packets.empty());
+
+    size_t blockIdx = 0;
+    for (const auto& packet : packets)
+    {
+        const auto amplitudes = static_cast<double*>(packet.getData());
+        const auto domain = static_cast<uint64_t*>(packet.getDomainPacket().getData());
+        for (size_t i = 0; i < packet.getSampleCount(); i++, blockIdx++)
+        {
+            ASSERT_EQ(domain[i], blockIdx * blockSize);
+
+            const double* spectrum = amplitudes + i * (blockSize / 2);
+            for (size_t bin = 1; bin <= blockSize / 2; bin++)
+            {
+                double expected = 0;
+                for (const auto& [toneBin, amplitude] : tones)
+                    if (toneBin == bin)
+                        expected = amplitude;
+                ASSERT_NEAR(spectrum[bin - 1], expected, 1e-4) << "block " << blockIdx << ", bin " << bin;
+            }
+        }
+    }
+    ASSERT_EQ(blockIdx, blockCount);
+}
+
+TEST_F(FFTFbTest, DefaultBlockSizeMatchesDft)
+{
+    constexpr size_t blockSize = 2048;
+    connect(blockSize);
+
+    std::vector<float> samples(blockSize);
+    for (size_t i = 0; i < blockSize; i++)
+        samples[i] = static_cast<float>(std::sin(0.37 * static_cast<double>(i)) + 0.25 * std::cos(1.9 * static_cast<double>(i * i % 97)));
+    send(samples, 0);
+
+    const auto packets = receive(1);
+    ASSERT_EQ(packets.size(), 1u);
+    const auto amplitudes = static_cast<double*>(packets[0].getData());
+
+    const double pi = std::acos(-1.0);
+    for (size_t bin = 1; bin <= blockSize / 2; bin += 37)
+    {
+        double re = 0;
+        double im = 0;
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const double phase = -2.0 * pi * static_cast<double>(bin * i % blockSize) / static_cast<double>(blockSize);
+            re += samples[i] * std::cos(phase);
+            im += samples[i] * std::sin(phase);
+        }
+
+        const double expected = 2.0 * std::sqrt(re * re + im * im) / static_cast<double>(blockSize);
+        ASSERT_NEAR(amplitudes[bin - 1], expected, 1e-4) << "bin " << bin;
+    }
+}
@@ -4,6 +4,11 @@
 #include <opendaq/opendaq.h>
 #include <ref_fb_module/module_dll.h>
 #include <testutils/memcheck_listener.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
 
 using namespace daq;
 
@@ -1069,3 +1074,206 @@ TEST_F(StatisticsTestStatusSignal, StatisticsOk2)
     ASSERT_EQ(fb.getStatusContainer().getStatus("ComponentStatus"), Enumeration("ComponentStatusType", "Ok", context.getTypeManager()));
     ASSERT_EQ(fb.getStatusContainer().getStatusMessage("ComponentStatus"), "");
 }
+
+class StatisticsTestExtended : public StatisticsTest
+{
+protected:
+    ContextPtr context;
+    ModulePtr module;
+    FunctionBlockPtr fb;
+    SignalConfigPtr domainSignal;
+    SignalConfigPtr signal;
+    Int nextDomainOffset = 0;
+
+    void createFunctionBlock(SampleType sampleType, Int blockSize, Int overlap = 0)
+    {
+        const auto logger = Logger();
+        context = Context(Scheduler(logger), logger, TypeManager(), nullptr, nullptr);
+        createModule(&module, context);
+
+        PropertyObjectPtr config = module.getAvailableFunctionBlockTypes().get("RefFBModuleStatistics").createDefaultConfig();
+        config.setPropertyValue("UseMultiThreadedScheduler", false);
+        config.setPropertyValue("ExtendedStatistics", true);
+        fb = module.createFunctionBlock("RefFBModuleStatistics", nullptr, "fb", config);
+        fb.setPropertyValue("BlockSize", blockSize);
+        fb.setPropertyValue("Overlap", overlap);
+
+        const auto domainDescriptor = DataDescriptorBuilder()
+                                          .setUnit(Unit("s", -1, "seconds", "Time"))
+                                          .setSampleType(SampleType::Int64)
+                                          .setRule(LinearDataRule(1, 0))
+                                          .setOrigin("1970")
+                                          .setTickResolution(Ratio(1, 1000))
+                                          .build();
+        domainSignal = SignalWithDescriptor(context, domainDescriptor, nullptr, "domain_signal");
+
+        const auto descriptor = DataDescriptorBuilder().setSampleType(sampleType).setRule(ExplicitDataRule()).build();
+        signal = SignalWithDescriptor(context, descriptor, nullptr, "signal");
+        signal.setDomainSignal(domainSignal);
+
+        fb.getInputPorts()[0].connect(signal);
+    }
+
+    void TearDown() override
+    {
+        if (context.assigned())
+            context.getScheduler().stop();
+    }
+
+    SignalPtr getOutputSignal(const std::string& localId)
+    {
+        for (const auto& outputSignal : fb.getSignals())
+            if (outputSignal.getLocalId() == localId)
+                return outputSignal;
+        return nullptr;
+    }
+
+    template <typename T>
+    void send(const std::vector<T>& samples)
+    {
+        const auto domainPacket = DataPacket(domainSignal.getDescriptor(), samples.size(), nextDomainOffset);
+        const auto dataPacket = DataPacketWithDomain(domainPacket, signal.getDescriptor(), samples.size());
+        std::memcpy(dataPacket.getRawData(), samples.data(), samples.size() * sizeof(T));
+        nextDomainOffset += static_cast<Int>(samples.size());
+
+        domainSignal.sendPacket(domainPacket);
+        signal.sendPacket(dataPacket);
+    }
+
+    template <typename T>
+    static std::vector<T> readAll(const PacketReaderPtr& reader)
+    {
+        std::vector<T> values;
+        for (const auto& packet : reader.readAll())
+        {
+            if (packet.getType() != PacketType::Data)
+                continue;
+
+            const auto dataPacket = packet.asPtr<IDataPacket>();
+            const auto data = static_cast<T*>(dataPacket.getData());
+            values.insert(values.end(), data, data + dataPacket.getSampleCount());
+        }
+        return values;
+    }
+};
+
+TEST_F(StatisticsTestExtended, NumOfSignals)
+{
+    createFunctionBlock(SampleType::Float64, 5);
+    ASSERT_EQ(fb.getSignals(search::Recursive(search::Any())).getCount(), 7u);
+
+    for (const auto& localId : {"avg", "rms", "min", "max", "peak_to_peak", "std_dev"})
+        ASSERT_TRUE(getOutputSignal(localId).assigned()) << localId;
+}
+
+TEST_F(StatisticsTestExtended, Float64)
+{
+    createFunctionBlock(SampleType::Float64, 5);
+
+    const auto avgReader = PacketReader(getOutputSignal("avg"));
+    const auto minReader = PacketReader(getOutputSignal("min"));
+    const auto maxReader = PacketReader(getOutputSignal("max"));
+    const auto peakToPeakReader = PacketReader(getOutputSignal("peak_to_peak"));
+    const auto stdDevReader = PacketReader(getOutputSignal("std_dev"));
+
+    send<Float>({1, 4, 2, 8, 5, -3, 0, 3, 6, -6});
+
+    ASSERT_EQ(readAll<Float>(avgReader), std::vector<Float>({4.0, 0.0}));
+    ASSERT_EQ(readAll<Float>(minReader), std::vector<Float>({1.0, -6.0}));
+    ASSERT_EQ(readAll<Float>(maxReader), std::vector<Float>({8.0, 6.0}));
+    ASSERT_EQ(readAll<Float>(peakToPeakReader), std::vector<Float>({7.0, 12.0}));
+
+    const auto stdDev = readAll<Float>(stdDevReader);
+    ASSERT_EQ(stdDev.size(), 2u);
+    ASSERT_DOUBLE_EQ(stdDev[0], std::sqrt(6.0));
+    ASSERT_DOUBLE_EQ(stdDev[1], std::sqrt(18.0));
+}
+
+TEST_F(StatisticsTestExtended, Int16)
+{
+    createFunctionBlock(SampleType::Int16, 5);
+
+    const auto avgReader = PacketReader(getOutputSignal("avg"));
+    const auto minReader = PacketReader(getOutputSignal("min"));
+    const auto maxReader = PacketReader(getOutputSignal("max"));
+    const auto peakToPeakReader = PacketReader(getOutputSignal("peak_to_peak"));
+    const auto stdDevReader = PacketReader(getOutputSignal("std_dev"));
+
+    send<int16_t>({1, 4, 2, 8, 5, -3, 0, 3, 6, -6});
+
+    ASSERT_EQ(readAll<int16_t>(avgReader), std::vector<int16_t>({4, 0}));
+    ASSERT_EQ(readAll<int16_t>(minReader), std::vector<int16_t>({1, -6}));
+    ASSERT_EQ(readAll<int16_t>(maxReader), std::vector<int16_t>({8, 6}));
+
+    // peak-to-peak and standard deviation are always Float64
+    ASSERT_EQ(getOutputSignal("peak_to_peak").getDescriptor().getSampleType(), SampleType::Float64);
+    ASSERT_EQ(getOutputSignal("std_dev").getDescriptor().getSampleType(), SampleType::Float64);
+    ASSERT_EQ(readAll<Float>(peakToPeakReader), std::vector<Float>({7.0, 12.0}));
+
+    const auto stdDev = readAll<Float>(stdDevReader);
+    ASSERT_EQ(stdDev.size(), 2u);
+    ASSERT_DOUBLE_EQ(stdDev[0], std::sqrt(6.0));
+    ASSERT_DOUBLE_EQ(stdDev[1], std::sqrt(18.0));
+}
+
+TEST_F(StatisticsTestExtended, Int16FullScale)
+{
+    // with a block of two samples the Int32 sum of squares of a full-scale Int16 signal does not overflow
+    createFunctionBlock(SampleType::Int16, 2);
+
+    const auto peakToPeakReader = PacketReader(getOutputSignal("peak_to_peak"));
+    const auto stdDevReader = PacketReader(getOutputSignal("std_dev"));
+
+    constexpr auto low = std::numeric_limits<int16_t>::min();
+    constexpr auto high = std::numeric_limits<int16_t>::max();
+    send<int16_t>({low, high, low, high});
+
+    ASSERT_EQ(readAll<Float>(peakToPeakReader), std::vector<Float>({65535.0, 65535.0}));
+    ASSERT_EQ(readAll<Float>(stdDevReader), std::vector<Float>({32767.5, 32767.5}));
+}
+
+TEST_F(StatisticsTestExtended, OverlappingWindows)
+{
+    // 75 % overlap of 64 samples gives a hop of 16 samples, so windows are merged from chunks of 16 samples
+    constexpr size_t blockSize = 64;
+    constexpr size_t hop = 16;
+    createFunctionBlock(SampleType::Float64, blockSize, 75);
+
+    const auto avgReader = PacketReader(getOutputSignal("avg"));
+    const auto rmsReader = PacketReader(getOutputSignal("rms"));
+    const auto minReader = PacketReader(getOutputSignal("min"));
+    const auto maxReader = PacketReader(getOutputSignal("max"));
+
+    std::vector<Float> samples(640);
+    for (size_t i = 0; i < samples.size(); i++)
+        samples[i] = std::sin(0.1 * static_cast<double>(i)) * 10.0 + static_cast<double>(i % 7);
+
+    // Split across packets that do not line up with windows
+    send(std::vector<Float>(samples.begin(), samples.begin() + 100));
+    send(std::vector<Float>(samples.begin() + 100, samples.end()));
+
+    const auto avg = readAll<Float>(avgReader);
+    const auto rms = readAll<Float>(rmsReader);
+    const auto min = readAll<Float>(minReader);
+    const auto max = readAll<Float>(maxReader);
+
+    const size_t windowCount = (samples.size() - blockSize) / hop + 1;
+    ASSERT_EQ(avg.size(), windowCount);
+    ASSERT_EQ(rms.size(), windowCount);
+    ASSERT_EQ(min.size(), windowCount);
+    ASSERT_EQ(max.size(), windowCount);
+
+    for (size_t window = 0; window < windowCount; window++)
+    {
+        const auto begin = samples.begin() + window * hop;
+        const auto end = begin + blockSize;
+
+        const double sum = std::accumulate(begin, end, 0.0);
+        const double sumOfSquares = std::inner_product(begin, end, begin, 0.0);
+
+        ASSERT_NEAR(avg[window], sum / blockSize, 1e-9) << "window " << window;
+        ASSERT_NEAR(rms[window], std::sqrt(sumOfSquares / blockSize), 1e-9) << "window " << window;
+        ASSERT_EQ(min[window], *std::min_element(begin, end)) << "window " << window;
+        ASSERT_EQ(max[window], *std::max_element(begin, end)) << "window " << window;
+    }
+}
@@ -61,6 +61,8 @@ public:
 private:
     void transportConnectionStatusChangedHandler(const EnumerationPtr& status, const StringPtr& statusMessage);
     config_protocol::PacketBuffer doConfigRequestAndGetReply(const config_protocol::PacketBuffer& reqPacket);
+    std::future<config_protocol::PacketBuffer> doConfigRequestAsync(const config_protocol::PacketBuffer& reqPacket);
+    config_protocol::PacketBuffer waitForConfigReply(uint64_t reqId, std::future<config_protocol::PacketBuffer>& future);
     void doConfigNoReplyRequest(const config_protocol::PacketBuffer& reqPacket);
     void sendConfigRequest(const config_protocol::PacketBuffer& reqPacket);
     std::future<config_protocol::PacketBuffer> registerConfigRequest(uint64_t requestId);
@@ -262,6 +262,15 @@ void NativeDeviceHelper::setupProtocolClients(const ContextPtr& context)
             nullptr,
             downgradePacketStreamingCallback
         );
+    configProtocolClient->getClientComm()->setSendAsyncRequestCallback(
+        [this](const PacketBuffer& packet)
+        {
+            return this->doConfigRequestAsync(packet);
+        },
+        [this](uint64_t requestId)
+        {
+            this->unregisterConfigRequest(requestId);
+        });
 
     ProcessConfigProtocolPacketCb receiveConfigPacketCb =
         [this](PacketBuffer&& packetBuffer)
@@ -304,6 +313,11 @@ void NativeDeviceHelper::setupProtocolClients(const ContextPtr& context)
 }
 
 PacketBuffer NativeDeviceHelper::doConfigRequestAndGetReply(const PacketBuffer& reqPacket)
+{
+    return doConfigRequestAsync(reqPacket).get();
+}
+
+std::future<PacketBuffer> NativeDeviceHelper::doConfigRequestAsync(const PacketBuffer& reqPacket)
 {
     auto reqId = reqPacket.getId();
 
@@ -332,6 +346,16 @@ PacketBuffer NativeDeviceHelper::doConfigRequestAndGetReply(const PacketBuffer&
         DAQ_THROW_EXCEPTION(ComponentRemovedException);
     }
 
+    // the reply is awaited only when requested, which allows further requests to be sent in the meantime
+    return std::async(std::launch::deferred,
+                      [this, reqId, future = std::move(future)]() mutable
+                      {
+                          return waitForConfigReply(reqId, future);
+                      });
+}
+
+PacketBuffer NativeDeviceHelper::waitForConfigReply(uint64_t reqId, std::future<PacketBuffer>& future)
+{
     if (future.wait_for(configProtocolRequestTimeout) == std::future_status::ready)
     {
         return future.get();
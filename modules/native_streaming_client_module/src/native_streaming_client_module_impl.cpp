@@ -429,6 +429,8 @@ PropertyObjectPtr NativeStreamingClientModule::createTransportLayerDefaultConfig
     transportLayerConfig.addProperty(daq::IntProperty("ConnectionTimeout", 1000));
     transportLayerConfig.addProperty(daq::IntProperty("StreamingInitTimeout", 1000));
     transportLayerConfig.addProperty(daq::IntProperty("ReconnectionPeriod", 1000));
+    transportLayerConfig.addProperty(daq::IntProperty("EventPacketEncoding", EVENT_PACKET_ENCODING_BINARY));
+    transportLayerConfig.addProperty(daq::IntProperty("DataPacketHeaderEncoding", DATA_PACKET_HEADER_ENCODING_COMPACT));
 
     daq::ClientTypeTools::DefineConfigProperties(transportLayerConfig);
 
@@ -16,6 +16,7 @@
 
 #pragma once
 #include <native_streaming_server_module/common.h>
+#include <native_streaming_server_module/ready_signal_set.h>
 #include <opendaq/device_ptr.h>
 #include <opendaq/packet_reader_ptr.h>
 #include <opendaq/server.h>
@@ -55,6 +56,8 @@ protected:
     void startReading();
     void stopReading();
     void startReadThread();
+    void startEventDrivenReadThread();
+    bool readReadySignals(const std::vector<std::string>& readySignalIds);
     void addReader(SignalPtr signalToRead);
     void removeReader(SignalPtr signalToRead);
     void clearIndices();
@@ -88,6 +91,11 @@ protected:
     std::vector<IPacket*> packetBuf;
     tsl::ordered_map<std::string, opendaq_native_streaming_protocol::PacketBufferData> packetIndices;
 
+    bool eventDrivenRead;
+    std::shared_ptr<ReadySignalSet> readySignals;
+    std::unordered_map<std::string, std::pair<ObjectPtr<IConnectionInternal>, ObjectPtr<IInputPortNotifications>>> eventDrivenReaders;
+    tsl::ordered_map<std::string, opendaq_native_streaming_protocol::PacketBufferData> readyPacketIndices;
+
     std::shared_ptr<boost::asio::io_context> transportIOContextPtr;
     std::thread transportThread;
 
@@ -107,6 +115,7 @@ protected:
     std::unordered_map<std::string, SizeT> disconnectedClientIds;
     StreamingPtr streaming;
     std::unique_ptr<boost::asio::thread_pool> workerPool;
+    config_protocol::ConfigServerRevisionTrackerPtr revisionTracker;
 };
 
 OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <native_streaming_server_module/common.h>
+#include <opendaq/input_port_notifications.h>
+#include <coretypes/impl.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_SERVER_MODULE
+
+/*!
+ * @brief Set of signals that have packets waiting to be streamed.
+ *
+ * Filled by the input port listeners of the streaming server readers and drained by the read thread,
+ * which blocks in `waitAndTake` until at least one signal becomes ready.
+ */
+class ReadySignalSet
+{
+public:
+    ReadySignalSet();
+
+    void markReady(const std::string& signalGlobalId);
+
+    /*!
+     * @brief Blocks until a signal is marked ready or `wakeUp` is called, then moves the global IDs
+     * of all ready signals into `ready`.
+     */
+    void waitAndTake(std::vector<std::string>& ready);
+
+    void wakeUp();
+
+private:
+    std::mutex sync;
+    std::condition_variable cv;
+    std::vector<std::string> readySignals;
+    bool wakeUpRequested;
+};
+
+/*!
+ * @brief Input port listener of a streaming server reader which marks its signal as ready.
+ *
+ * Only the first packet received after the read thread last drained the connection touches the
+ * ready set; subsequent packets only test an atomic flag.
+ */
+class ReadySignalNotificationsImpl : public ImplementationOfWeak<IInputPortNotifications>
+{
+public:
+    ReadySignalNotificationsImpl(std::string signalGlobalId, std::shared_ptr<ReadySignalSet> readySignals);
+
+    ErrCode INTERFACE_FUNC acceptsSignal(IInputPort* port, ISignal* signal, Bool* accept) override;
+    ErrCode INTERFACE_FUNC connected(IInputPort* port) override;
+    ErrCode INTERFACE_FUNC disconnected(IInputPort* port) override;
+    ErrCode INTERFACE_FUNC packetReceived(IInputPort* port) override;
+
+    void markReady();
+
+    // Must be called by the read thread before the connection is drained.
+    void clearReady();
+
+private:
+    std::string signalGlobalId;
+    std::shared_ptr<ReadySignalSet> readySignals;
+    std::atomic<bool> ready;
+};
+
+END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_SERVER_MODULE
@@ -26,6 +26,7 @@ using namespace config_protocol;
 
 static constexpr size_t DEFAULT_MAX_PACKET_READ_COUNT = 5000;
 static constexpr size_t DEFAULT_POLLING_PERIOD = 20;
+static constexpr bool DEFAULT_EVENT_DRIVEN_READ = false;
 
 NativeStreamingServerImpl::NativeStreamingServerImpl(const DevicePtr& rootDevice,
                                                      const PropertyObjectPtr& config,
@@ -33,6 +34,8 @@ NativeStreamingServerImpl::NativeStreamingServerImpl(const DevicePtr& rootDevice
     : Server("OpenDAQNativeStreaming", config, rootDevice, context)
     , readThreadActive(false)
     , readThreadSleepTime(std::chrono::milliseconds(20))
+    , eventDrivenRead(DEFAULT_EVENT_DRIVEN_READ)
+    , readySignals(std::make_shared<ReadySignalSet>())
     , transportIOContextPtr(std::make_shared<boost::asio::io_context>())
     , processingIOContextPtr(std::make_shared<boost::asio::io_context>())
     , processingStrand(*processingIOContextPtr)
@@ -41,6 +44,7 @@ NativeStreamingServerImpl::NativeStreamingServerImpl(const DevicePtr& rootDevice
     , loggerComponent(logger.getOrAddComponent(id))
     , serverStopped(false)
     , workerPool(nullptr)
+    , revisionTracker(std::make_shared<ConfigServerRevisionTracker>(rootDevice.getContext(), rootDeviceGlobalId))
 {
     auto info = rootDevice.getInfo();
     if (info.hasServerCapability("OpenDAQNativeStreaming"))
@@ -85,6 +89,7 @@ NativeStreamingServerImpl::NativeStreamingServerImpl(const DevicePtr& rootDevice
 
     const uint16_t pollingPeriod = config.getPropertyValue("StreamingDataPollingPeriod");
     readThreadSleepTime = std::chrono::milliseconds(pollingPeriod);
+    eventDrivenRead = config.getPropertyValue("StreamingDataEventDriven");
 
     maxPacketReadCount = config.getPropertyValue("MaxPacketReadCount");
     packetBuf.resize(maxPacketReadCount);
@@ -328,6 +333,7 @@ void NativeStreamingServerImpl::prepareServerHandler()
         if (const DevicePtr rootDevice = this->rootDeviceRef.assigned() ? this->rootDeviceRef.getRef() : nullptr; rootDevice.assigned())
         {
             auto configServer = std::make_shared<ConfigProtocolServer>(rootDevice, sendConfigPacketCb, user, connectionType, this->signals);
+            configServer->setRevisionTracker(revisionTracker);
             processConfigRequestCb =
                 [this, configServer, sendConfigPacketCb](PacketBuffer&& packetBuffer)
             {
@@ -506,6 +512,13 @@ PropertyObjectPtr NativeStreamingServerImpl::createDefaultConfig(const ContextPt
                                        .build();
     defaultConfig.addProperty(pollingPeriodProp);
 
+    const auto eventDrivenProp = BoolPropertyBuilder("StreamingDataEventDriven", DEFAULT_EVENT_DRIVEN_READ)
+                                     .setDescription("If enabled, the server waits for subscribed signals to report new packets "
+                                                     "and reads only those signals, instead of polling all subscribed signals "
+                                                     "each polling period")
+                                     .build();
+    defaultConfig.addProperty(eventDrivenProp);
+
     const auto maxPacketReadCountProp = IntPropertyBuilder("MaxPacketReadCount", DEFAULT_MAX_PACKET_READ_COUNT)
                                                 .setMinValue(1)
                                                 .setDescription("Specifies the size of a pre-allocated packet buffer into "
@@ -569,7 +582,10 @@ void NativeStreamingServerImpl::startReading()
     this->readThread = std::thread([this]()
     {
         daqNameThread("NatSrvStreamRead");
-        this->startReadThread();
+        if (eventDrivenRead)
+            this->startEventDrivenReadThread();
+        else
+            this->startReadThread();
         LOG_I("Reading thread finished");
     });
 }
@@ -577,6 +593,7 @@ void NativeStreamingServerImpl::startReading()
 void NativeStreamingServerImpl::stopReading()
 {
     readThreadActive = false;
+    readySignals->wakeUp();
     if (readThread.joinable())
     {
         readThread.join();
@@ -588,6 +605,7 @@ void NativeStreamingServerImpl::stopReading()
         ports.pushBack(port);
 
     signalReaders.clear();
+    eventDrivenReaders.clear();
 
     for (const auto& port : ports)
         port.remove();
@@ -640,6 +658,73 @@ void NativeStreamingServerImpl::startReadThread()
     }
 }
 
+void NativeStreamingServerImpl::startEventDrivenReadThread()
+{
+    std::vector<std::string> readySignalIds;
+    while (readThreadActive)
+    {
+        readySignals->waitAndTake(readySignalIds);
+        if (readySignalIds.empty())
+            continue;
+
+        if (readReadySignals(readySignalIds))
+            serverHandler->sendAvailableStreamingPackets();
+
+        readySignalIds.clear();
+    }
+}
+
+bool NativeStreamingServerImpl::readReadySignals(const std::vector<std::string>& readySignalIds)
+{
+    std::scoped_lock lock(readersSync);
+
+    SizeT read = 0;
+    bool sendData = false;
+
+    const auto processRead = [this, &read, &sendData]()
+    {
+        if (read)
+            serverHandler->processStreamingPackets(readyPacketIndices, packetBuf);
+
+        sendData = sendData || read;
+        readyPacketIndices.clear();
+        read = 0;
+    };
+
+    for (const auto& signalGlobalId : readySignalIds)
+    {
+        const auto it = eventDrivenReaders.find(signalGlobalId);
+        if (it == eventDrivenReaders.end())
+            continue;
+
+        const auto& [connection, notifications] = it->second;
+        static_cast<ReadySignalNotificationsImpl*>(notifications.getObject())->clearReady();
+
+        bool repeatRead;
+        do
+        {
+            SizeT count = maxPacketReadCount - read;
+            connection->dequeueUpTo(packetBuf.data() + read, &count);
+            if (count)
+            {
+                auto& packetData = readyPacketIndices[signalGlobalId];
+                packetData.index = static_cast<int>(read);
+                packetData.count = static_cast<int>(count);
+                read += count;
+            }
+
+            // Max packet read count exceeded; Send packets and re-read to not drop data.
+            repeatRead = read == maxPacketReadCount;
+            if (repeatRead)
+                processRead();
+        }
+        while (repeatRead);
+    }
+
+    processRead();
+    return sendData;
+}
+
 void NativeStreamingServerImpl::addReader(SignalPtr signalToRead)
 {
     auto it = std::find_if(signalReaders.begin(),
@@ -653,14 +738,33 @@ void NativeStreamingServerImpl::addReader(SignalPtr signalToRead)
 
     LOG_I("Add reader for signal {}", signalToRead.getGlobalId());
 
+    const auto signalGlobalId = signalToRead.getGlobalId().toStdString();
     auto port = InputPort(signalToRead.getContext(), nullptr, "readsig");
-    port.connect(signalToRead);
-    port.setNotificationMethod(PacketReadyNotification::None);
+    ObjectPtr<IInputPortNotifications> notifications;
+    if (eventDrivenRead)
+    {
+        notifications = createWithImplementation<IInputPortNotifications, ReadySignalNotificationsImpl>(signalGlobalId, readySignals);
+        port.setListener(notifications);
+        port.setNotificationMethod(PacketReadyNotification::SameThread);
+        port.connect(signalToRead);
+    }
+    else
+    {
+        port.connect(signalToRead);
+        port.setNotificationMethod(PacketReadyNotification::None);
+    }
     auto connection = port.getConnection().asPtr<IConnectionInternal>();
 
     signalReaders.push_back(std::tuple<SignalPtr, std::string, InputPortPtr, ObjectPtr<IConnectionInternal>>(
-        {signalToRead, signalToRead.getGlobalId().toStdString(), port, connection}));
-    packetIndices.insert(std::make_pair(signalToRead.getGlobalId().toStdString(), PacketBufferData()));
+        {signalToRead, signalGlobalId, port, connection}));
+    packetIndices.insert(std::make_pair(signalGlobalId, PacketBufferData()));
+
+    if (eventDrivenRead)
+    {
+        eventDrivenReaders.insert({signalGlobalId, {connection, notifications}});
+        // Ensures packets enqueued on connect are read even if the connection did not notify the listener.
+        static_cast<ReadySignalNotificationsImpl*>(notifications.getObject())->markReady();
+    }
 }
 
 void NativeStreamingServerImpl::removeReader(SignalPtr signalToRead)
@@ -679,6 +783,7 @@ void NativeStreamingServerImpl::removeReader(SignalPtr signalToRead)
     auto port = std::get<2>(*it);
     signalReaders.erase(it);
     packetIndices.erase(signalToRead.getGlobalId().toStdString());
+    eventDrivenReaders.erase(signalToRead.getGlobalId().toStdString());
     port.remove();
 }
 
@@ -0,0 +1,81 @@
+#include <native_streaming_server_module/ready_signal_set.h>
+
+BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_SERVER_MODULE
+
+ReadySignalSet::ReadySignalSet()
+    : wakeUpRequested(false)
+{
+}
+
+void ReadySignalSet::markReady(const std::string& signalGlobalId)
+{
+    {
+        std::scoped_lock lock(sync);
+        readySignals.push_back(signalGlobalId);
+    }
+    cv.notify_one();
+}
+
+void ReadySignalSet::waitAndTake(std::vector<std::string>& ready)
+{
+    std::unique_lock lock(sync);
+    cv.wait(lock, [this] { return !readySignals.empty() || wakeUpRequested; });
+
+    wakeUpRequested = false;
+    ready.swap(readySignals);
+}
+
+void ReadySignalSet::wakeUp()
+{
+    {
+        std::scoped_lock lock(sync);
+        wakeUpRequested = true;
+    }
+    cv.notify_one();
+}
+
+ReadySignalNotificationsImpl::ReadySignalNotificationsImpl(std::string signalGlobalId, std::shared_ptr<ReadySignalSet> readySignals)
+    : signalGlobalId(std::move(signalGlobalId))
+    , readySignals(std::move(readySignals))
+    , ready(false)
+{
+}
+
+ErrCode ReadySignalNotificationsImpl::acceptsSignal(IInputPort* /*port*/, ISignal* /*signal*/, Bool* accept)
+{
+    OPENDAQ_PARAM_NOT_NULL(accept);
+
+    *accept = true;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode ReadySignalNotificationsImpl::connected(IInputPort* /*port*/)
+{
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode ReadySignalNotificationsImpl::disconnected(IInputPort* /*port*/)
+{
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode ReadySignalNotificationsImpl::packetReceived(IInputPort* /*port*/)
+{
+    return daqTry([this] { markReady(); });
+}
+
+void ReadySignalNotificationsImpl::markReady()
+{
+    if (!ready.exchange(true))
+        readySignals->markReady(signalGlobalId);
+}
+
+void ReadySignalNotificationsImpl::clearReady()
+{
+    // Orders the flag reset before the subsequent dequeue, so that a packet enqueued concurrently is
+    // either dequeued or marks the signal ready again.
+    ready.store(false);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_SERVER_MODULE
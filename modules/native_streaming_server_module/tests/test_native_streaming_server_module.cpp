@@ -159,6 +159,9 @@ TEST_F(NativeStreamingServerModuleTest, ServerConfig)
     ASSERT_TRUE(config.hasProperty("StreamingDataPollingPeriod"));
     ASSERT_EQ(config.getPropertyValue("StreamingDataPollingPeriod"), 20);
 
+    ASSERT_TRUE(config.hasProperty("StreamingDataEventDriven"));
+    ASSERT_EQ(config.getPropertyValue("StreamingDataEventDriven"), False);
+
     ASSERT_TRUE(config.hasProperty("StreamingCacheablePayloadSizeMax"));
     ASSERT_EQ(config.getPropertyValue("StreamingCacheablePayloadSizeMax"), 10);
 
@@ -185,3 +188,14 @@ TEST_F(NativeStreamingServerModuleTest, CreateServerFromInstance)
 
     ASSERT_NO_THROW(device.addServer("OpenDAQNativeStreaming", config));
 }
+
+TEST_F(NativeStreamingServerModuleTest, CreateEventDrivenServer)
+{
+    auto device = CreateTestInstance();
+    auto config = CreateServerConfig(device);
+    config.setPropertyValue("StreamingDataEventDriven", True);
+
+    ServerPtr server;
+    ASSERT_NO_THROW(server = device.addServer("OpenDAQNativeStreaming", config));
+    ASSERT_NO_THROW(device.removeServer(server));
+}
@@ -526,6 +526,10 @@ ErrCode ConfigClientPropertyObjectBaseImpl<Impl>::remoteUpdate(ISerializedObject
 {
     const ErrCode errCode = daqTry([&serialized, this]
     {
+        // placeholder of a component that did not change on the server since the last synchronization
+        if (SerializedObjectPtr::Borrow(serialized).hasKey(UnchangedComponentKey))
+            return OPENDAQ_SUCCESS;
+
         onRemoteUpdate(serialized);
         return OPENDAQ_SUCCESS;
     });
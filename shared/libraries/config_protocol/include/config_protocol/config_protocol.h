@@ -180,9 +180,12 @@ public:
 
 inline constexpr uint16_t GetLatestConfigProtocolVersion()
 {
-    return 24;
+    return 27;
 }
 
+// key of the placeholder objects sent for components that did not change since the revision known to a reconnecting client
+static constexpr char UnchangedComponentKey[] = "__unchanged";
+
 inline std::set<uint16_t> GetSupportedConfigProtocolVersions()
 {
     const std::set<uint16_t> supportedVersions = []() -> std::set<uint16_t>
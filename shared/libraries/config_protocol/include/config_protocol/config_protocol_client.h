@@ -32,12 +32,16 @@
 #include <coreobjects/property_object_class_internal_ptr.h>
 #include <opendaq/mirrored_input_port_private_ptr.h>
 #include <algorithm>
+#include <future>
+#include <vector>
 #include <opendaq/component_update_context_ptr.h>
 
 namespace daq::config_protocol
 {
 
 using SendRequestCallback = std::function<PacketBuffer(PacketBuffer&)>;
+using SendAsyncRequestCallback = std::function<std::future<PacketBuffer>(PacketBuffer&)>;
+using CancelAsyncRequestCallback = std::function<void(uint64_t requestId)>;
 using SendNoReplyRequestCallback = std::function<void(PacketBuffer&)>;
 using ServerNotificationReceivedCallback = std::function<bool(const BaseObjectPtr& obj)>;
 using ComponentDeserializeCallback = std::function<ErrCode(ISerializedObject*, IBaseObject*, IFunction*, IBaseObject**)>;
@@ -58,6 +62,44 @@ private:
     uint16_t minServerVersion;
 };
 
+// Collects RPC requests that are sent to the server together with ConfigProtocolClientComm::executeBatch.
+// Only requests whose replies do not contain components can be batched.
+class ConfigProtocolBatch
+{
+public:
+    void setPropertyValue(const std::string& globalId, const std::string& propertyName, const BaseObjectPtr& propertyValue);
+    void getPropertyValue(const std::string& globalId, const std::string& propertyName);
+    void clearPropertyValue(const std::string& globalId, const std::string& propertyName);
+    void callProperty(const std::string& globalId, const std::string& propertyName, const BaseObjectPtr& params);
+    void addCommand(const ClientCommand& command, const ParamsDictPtr& params);
+
+    size_t getCount() const;
+    bool isEmpty() const;
+
+private:
+    friend class ConfigProtocolClientComm;
+
+    std::vector<std::pair<ClientCommand, ParamsDictPtr>> requests;
+};
+
+class ConfigProtocolBatchResult
+{
+public:
+    ConfigProtocolBatchResult(ErrCode errorCode, const std::string& errorMessage, const BaseObjectPtr& returnValue);
+
+    ErrCode getErrorCode() const;
+    std::string getErrorMessage() const;
+    bool succeeded() const;
+
+    // returns the reply value of the request or throws the exception the request failed with
+    BaseObjectPtr getValue() const;
+
+private:
+    ErrCode errorCode;
+    std::string errorMessage;
+    BaseObjectPtr returnValue;
+};
+
 class ConfigProtocolClientComm : public std::enable_shared_from_this<ConfigProtocolClientComm>
 {
 public:
@@ -164,10 +206,22 @@ public:
 
     uint16_t getProtocolVersion() const;
 
+    // Requests of the batch are sent within a single "Batch" RPC if the server supports it. Otherwise they
+    // are pipelined through the send async request callback or, if it is not set, sent one after another.
+    // A result is returned for each request in the order of the batch; failed requests do not abort the batch.
+    std::vector<ConfigProtocolBatchResult> executeBatch(const ConfigProtocolBatch& batch);
+
+    // optional; enables sending new requests before replies to the previous ones are received. The cancel callback
+    // is called with the ids of sent requests whose replies are no longer awaited because the batch was aborted
+    void setSendAsyncRequestCallback(SendAsyncRequestCallback sendAsyncRequestCallback,
+                                     CancelAsyncRequestCallback cancelAsyncRequestCallback = nullptr);
+
 private:
     ContextPtr daqContext;
     std::atomic<uint64_t> id;
     SendRequestCallback sendRequestCallback;
+    SendAsyncRequestCallback sendAsyncRequestCallback;
+    CancelAsyncRequestCallback cancelAsyncRequestCallback;
     SendNoReplyRequestCallback sendNoReplyRequestCallback;
     ComponentDeserializeCallback rootDeviceDeserializeCallback;
     bool connected;
@@ -175,6 +229,8 @@ private:
     uint16_t protocolVersion;
     std::weak_ptr<ConfigProtocolStreamingProducer> streamingProducerRef;
     LoggerComponentPtr loggerComponent;
+    std::string treeEpoch;
+    uint64_t treeRevision;
 
     void requireMinServerVersion(const ClientCommand& command);
     ComponentDeserializeContextPtr createDeserializeContext(const std::string& remoteGlobalId,
@@ -190,6 +246,10 @@ private:
     BaseObjectPtr parseRpcOrRejectReply(const StringPtr& jsonReply,
                                         const ComponentDeserializeContextPtr& context = nullptr,
                                         bool isGetRootDeviceReply = false);
+    ParamsDictPtr deserializeRpcReply(const StringPtr& jsonReply,
+                                      const ComponentDeserializeContextPtr& context,
+                                      bool isGetRootDeviceReply = false);
+    static ConfigProtocolBatchResult createBatchResult(const ParamsDictPtr& reply);
     uint64_t generateId();
 
     BaseObjectPtr sendComponentCommand(const StringPtr& globalId,
@@ -206,8 +266,15 @@ private:
     BaseObjectPtr sendCommand(const ClientCommand& command, const ParamsDictPtr& params = nullptr);
     void sendNoReplyCommand(const ClientCommand& command, const ParamsDictPtr& params = nullptr);
 
+    std::vector<ConfigProtocolBatchResult> sendBatchRequest(const ConfigProtocolBatch& batch);
+    std::vector<ConfigProtocolBatchResult> sendPipelinedRequests(const ConfigProtocolBatch& batch);
+    std::vector<ConfigProtocolBatchResult> sendSequentialRequests(const ConfigProtocolBatch& batch);
+
     BaseObjectPtr requestRootDevice(const ComponentPtr& parentComponent);
     StringPtr requestSerializedRootDevice();
+    // revision of the server component tree the client is synchronized with; used to fetch only changes on reconnect
+    void requestTreeRevision();
+    StringPtr requestChangedComponents();
 
     static SignalPtr findSignalByRemoteGlobalIdWithComponent(const ComponentPtr& component, const std::string& remoteGlobalId);
 
@@ -448,7 +515,10 @@ void ConfigProtocolClient<TRootDeviceImpl>::reconnect(Bool restoreClientConfigOn
     }
     else
     {
-        const StringPtr serializedServerRootDevice = clientComm->requestSerializedRootDevice();
+        const StringPtr serializedServerRootDevice = getProtocolVersion() >= 27 ? clientComm->requestChangedComponents()
+                                                                                : clientComm->requestSerializedRootDevice();
+        if (!serializedServerRootDevice.assigned())
+            return;
 
         auto dict = Dict<IString, IBaseObject>();
         dict.set("SerializedComponent", serializedServerRootDevice);
@@ -470,6 +540,9 @@ DevicePtr ConfigProtocolClient<TRootDeviceImpl>::connect(const ComponentPtr& par
     protocolHandshake(protocolVersion);
     enumerateTypes();
 
+    if (getProtocolVersion() >= 27)
+        clientComm->requestTreeRevision();
+
     const ComponentHolderPtr deviceHolder = clientComm->requestRootDevice(parent);
     auto device = deviceHolder.getComponent();
     device.asPtr<IComponentPrivate>().setComponentConfig(nullptr);
@@ -18,6 +18,7 @@
 
 #include <config_protocol/config_protocol.h>
 #include <config_protocol/config_protocol_streaming_consumer.h>
+#include <config_protocol/config_server_revision_tracker.h>
 #include <opendaq/device_ptr.h>
 
 #include <opendaq/component_holder_ptr.h>
@@ -79,11 +80,15 @@ public:
     void setComponentFinder(std::unique_ptr<IComponentFinder>& componentFinder);
     std::unique_ptr<IComponentFinder>& getComponentFinder();
 
+    // optional; shared between connections to enable sending only changed components to reconnecting clients
+    void setRevisionTracker(const ConfigServerRevisionTrackerPtr& revisionTracker);
+
     void processClientToServerStreamingPacket(SignalNumericIdType signalNumericId, const PacketPtr& packet);
 
     uint16_t getProtocolVersion() const;
     void setProtocolVersion(uint16_t protocolVersion);
     SerializerPtr createSerializer();
+    SerializerPtr createRpcReplySerializer();
 
 private:
     using DispatchFunction = std::function<BaseObjectPtr(const ParamsDictPtr&)>;
@@ -107,10 +112,13 @@ private:
     ContextPtr daqContext;
     NotificationReadyCallback notificationReadyCallback;
     DeserializerPtr deserializer;
+    DeserializerPtr binaryDeserializer;
     SerializerPtr notificationSerializer;
     std::unordered_map<std::string, DispatchFunction> rpcDispatch;
+    std::unordered_map<std::string, uint16_t> rpcMinProtocolVersions;
     std::mutex notificationSerializerLock;
     std::unique_ptr<IComponentFinder> componentFinder;
+    ConfigServerRevisionTrackerPtr revisionTracker;
     UserPtr user;
     ClientType connectionType;
     uint16_t protocolVersion;
@@ -124,14 +132,19 @@ private:
     void processNoReplyPacket(const PacketBuffer& packetBuffer);
     StringPtr processRpcAndGetReply(const StringPtr& jsonStr);
     void processNoReplyRpc(const StringPtr& jsonStr);
+    BaseObjectPtr deserializeRpcRequest(const StringPtr& request) const;
     static StringPtr prepareErrorResponse(Int errorCode, const StringPtr& message, const SerializerPtr& serializer);
 
     BaseObjectPtr callRpc(const StringPtr& name, const ParamsDictPtr& params);
+    BaseObjectPtr batch(const ParamsDictPtr& params);
+    void requireMinProtocolVersion(const std::string& name) const;
     ComponentPtr findComponent(const std::string& componentGlobalId) const;
 
     BaseObjectPtr getComponent(const ParamsDictPtr& params) const;
     BaseObjectPtr getTypeManager(const ParamsDictPtr& params) const;
     BaseObjectPtr getSerializedRootDevice(const ParamsDictPtr& params);
+    BaseObjectPtr getTreeRevision(const ParamsDictPtr& params) const;
+    BaseObjectPtr getChangedComponents(const ParamsDictPtr& params);
     BaseObjectPtr connectSignal(const RpcContext& context, const InputPortPtr& inputPort, const ParamsDictPtr& params);
     BaseObjectPtr connectExternalSignal(const RpcContext& context, const InputPortPtr& inputPort, const ParamsDictPtr& params);
     BaseObjectPtr changeInputPortStreamingSource(const RpcContext& context, const InputPortPtr& inputPort, const ParamsDictPtr& params);
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <config_protocol/config_protocol.h>
+#include <coretypes/serializer_ptr.h>
+#include <coreobjects/core_event_args_ptr.h>
+#include <opendaq/component_ptr.h>
+#include <opendaq/context_ptr.h>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace daq::config_protocol
+{
+
+/*!
+ * @brief Server-side revision counters of the component tree, used to send only changed subtrees to reconnecting clients.
+ *
+ * Each core event of a component under the root device increments the tree revision and stamps the component and
+ * all of its ancestors with it. Added or updated components are additionally marked to be sent in full. The epoch
+ * identifies the tracker instance, so revisions are never compared across server restarts. The tracker outlives
+ * single client connections and must therefore be shared between the config protocol servers of a root device.
+ */
+class ConfigServerRevisionTracker
+{
+public:
+    ConfigServerRevisionTracker(const ContextPtr& context, const std::string& rootGlobalId);
+    ~ConfigServerRevisionTracker();
+
+    ConfigServerRevisionTracker(const ConfigServerRevisionTracker&) = delete;
+    ConfigServerRevisionTracker& operator=(const ConfigServerRevisionTracker&) = delete;
+
+    const std::string& getEpoch() const;
+    uint64_t getRevision() const;
+
+    bool isChangedSince(const std::string& globalId, uint64_t revision) const;
+    bool isAddedSince(const std::string& globalId, uint64_t revision) const;
+
+    // wraps the serializer so that components not changed after `revision` are written as unchanged placeholders
+    SerializerPtr createDeltaSerializer(const SerializerPtr& serializer, uint64_t revision);
+
+    void handleCoreEvent(const ComponentPtr& component, const CoreEventArgsPtr& args);
+
+private:
+    struct Revisions
+    {
+        uint64_t changed = 0;
+        uint64_t added = 0;
+    };
+
+    void coreEventCallback(ComponentPtr& component, CoreEventArgsPtr& args);
+    void markChanged(const std::string& globalId, bool added);
+    void removeSubtree(const std::string& globalId);
+    bool isInTree(const std::string& globalId) const;
+
+    ContextPtr context;
+    std::string rootGlobalId;
+    std::string epoch;
+
+    mutable std::mutex sync;
+    uint64_t revision;
+    std::unordered_map<std::string, Revisions> revisions;
+};
+
+using ConfigServerRevisionTrackerPtr = std::shared_ptr<ConfigServerRevisionTracker>;
+
+}
@@ -39,6 +39,92 @@ uint16_t ClientCommand::getMinServerVersion() const
     return minServerVersion;
 }
 
+// ConfigProtocolBatch
+
+void ConfigProtocolBatch::setPropertyValue(const std::string& globalId,
+                                           const std::string& propertyName,
+                                           const BaseObjectPtr& propertyValue)
+{
+    auto dict = Dict<IString, IBaseObject>();
+    dict.set("ComponentGlobalId", String(globalId));
+    dict.set("PropertyName", String(propertyName));
+    dict.set("PropertyValue", propertyValue);
+    requests.emplace_back(ClientCommand("SetPropertyValue"), dict);
+}
+
+void ConfigProtocolBatch::getPropertyValue(const std::string& globalId, const std::string& propertyName)
+{
+    auto dict = Dict<IString, IBaseObject>();
+    dict.set("ComponentGlobalId", String(globalId));
+    dict.set("PropertyName", String(propertyName));
+    requests.emplace_back(ClientCommand("GetPropertyValue"), dict);
+}
+
+void ConfigProtocolBatch::clearPropertyValue(const std::string& globalId, const std::string& propertyName)
+{
+    auto dict = Dict<IString, IBaseObject>();
+    dict.set("ComponentGlobalId", String(globalId));
+    dict.set("PropertyName", String(propertyName));
+    requests.emplace_back(ClientCommand("ClearPropertyValue"), dict);
+}
+
+void ConfigProtocolBatch::callProperty(const std::string& globalId, const std::string& propertyName, const BaseObjectPtr& params)
+{
+    auto dict = Dict<IString, IBaseObject>();
+    dict.set("ComponentGlobalId", String(globalId));
+    dict.set("PropertyName", String(propertyName));
+    if (params.assigned())
+        dict.set("Params", params);
+    requests.emplace_back(ClientCommand("CallProperty"), dict);
+}
+
+void ConfigProtocolBatch::addCommand(const ClientCommand& command, const ParamsDictPtr& params)
+{
+    requests.emplace_back(command, params);
+}
+
+size_t ConfigProtocolBatch::getCount() const
+{
+    return requests.size();
+}
+
+bool ConfigProtocolBatch::isEmpty() const
+{
+    return requests.empty();
+}
+
+// ConfigProtocolBatchResult
+
+ConfigProtocolBatchResult::ConfigProtocolBatchResult(ErrCode errorCode, const std::string& errorMessage, const BaseObjectPtr& returnValue)
+    : errorCode(errorCode)
+    , errorMessage(errorMessage)
+    , returnValue(returnValue)
+{
+}
+
+ErrCode ConfigProtocolBatchResult::getErrorCode() const
+{
+    return errorCode;
+}
+
+std::string ConfigProtocolBatchResult::getErrorMessage() const
+{
+    return errorMessage;
+}
+
+bool ConfigProtocolBatchResult::succeeded() const
+{
+    return OPENDAQ_SUCCEEDED(errorCode);
+}
+
+BaseObjectPtr ConfigProtocolBatchResult::getValue() const
+{
+    if (OPENDAQ_FAILED(errorCode))
+        throwExceptionFromErrorCode(errorCode, errorMessage);
+
+    return returnValue;
+}
+
 // ConfigProtocolClientComm
 
 ConfigProtocolClientComm::ConfigProtocolClientComm(const ContextPtr& daqContext,
@@ -55,6 +141,7 @@ ConfigProtocolClientComm::ConfigProtocolClientComm(const ContextPtr& daqContext,
     , protocolVersion(0)
     , streamingProducerRef(streamingProducer)
     , loggerComponent(daqContext.getLogger().getOrAddComponent("NativeClient"))
+    , treeRevision(0)
 {
 }
 
@@ -480,8 +567,10 @@ StringPtr ConfigProtocolClientComm::createRpcRequestJson(const StringPtr& name,
     SerializerPtr serializer;
     if (getProtocolVersion() < 10)
         serializer = JsonSerializerWithVersion(1);
-    else
+    else if (getProtocolVersion() < 26)
         serializer = JsonSerializerWithVersion(2);
+    else
+        serializer = BinarySerializerWithVersion(2);
 
     obj.serialize(serializer);
     return serializer.getOutput();
@@ -508,11 +597,31 @@ PacketBuffer ConfigProtocolClientComm::createNoReplyRpcRequestPacketBuffer(const
 BaseObjectPtr ConfigProtocolClientComm::parseRpcOrRejectReply(const StringPtr& jsonReply,
                                                               const ComponentDeserializeContextPtr& context,
                                                               bool isGetRootDeviceReply)
+{
+    const ParamsDictPtr reply = deserializeRpcReply(jsonReply, context, isGetRootDeviceReply);
+
+    if (!reply.hasKey("ErrorCode"))
+        throw ConfigProtocolException("Invalid reply");
+
+    const ErrCode errCode = reply["ErrorCode"];
+    if (OPENDAQ_FAILED(errCode))
+    {
+        std::string msg = reply.getOrDefault("ErrorMessage", "");
+        throwExceptionFromErrorCode(errCode, msg);
+    }
+
+    return reply.getOrDefault("ReturnValue");
+}
+
+ParamsDictPtr ConfigProtocolClientComm::deserializeRpcReply(const StringPtr& jsonReply,
+                                                            const ComponentDeserializeContextPtr& context,
+                                                            bool isGetRootDeviceReply)
 {
     ParamsDictPtr reply;
     try
     {
-        const auto deserializer = JsonDeserializer();
+        // connection rejected replies are sent before the protocol version is negotiated and are always JSON
+        const auto deserializer = IsBinarySerialized(jsonReply) ? BinaryDeserializer() : JsonDeserializer();
         if (isGetRootDeviceReply && this->rootDeviceDeserializeCallback)
         {
             bool rootDeviceDeserialized = false;
@@ -547,17 +656,17 @@ BaseObjectPtr ConfigProtocolClientComm::parseRpcOrRejectReply(const StringPtr& j
         throw ConfigProtocolException(fmt::format("Invalid reply: {}", e.what()));
     }
 
-    if (!reply.hasKey("ErrorCode"))
+    return reply;
+}
+
+ConfigProtocolBatchResult ConfigProtocolClientComm::createBatchResult(const ParamsDictPtr& reply)
+{
+    if (!reply.assigned() || !reply.hasKey("ErrorCode"))
         throw ConfigProtocolException("Invalid reply");
 
     const ErrCode errCode = reply["ErrorCode"];
-    if (OPENDAQ_FAILED(errCode))
-    {
-        std::string msg = reply.getOrDefault("ErrorMessage", "");
-        throwExceptionFromErrorCode(errCode, msg);
-    }
-
-    return reply.getOrDefault("ReturnValue");
+    const std::string msg = reply.getOrDefault("ErrorMessage", "");
+    return ConfigProtocolBatchResult(errCode, msg, reply.getOrDefault("ReturnValue"));
 }
 
 BaseObjectPtr ConfigProtocolClientComm::deserializeConfigComponent(const StringPtr& typeId,
@@ -673,6 +782,28 @@ uint16_t ConfigProtocolClientComm::getProtocolVersion() const
     return protocolVersion;
 }
 
+std::vector<ConfigProtocolBatchResult> ConfigProtocolClientComm::executeBatch(const ConfigProtocolBatch& batch)
+{
+    if (batch.isEmpty())
+        return {};
+
+    for (const auto& [command, params] : batch.requests)
+        requireMinServerVersion(command);
+
+    if (protocolVersion >= 25)
+        return sendBatchRequest(batch);
+    if (sendAsyncRequestCallback)
+        return sendPipelinedRequests(batch);
+    return sendSequentialRequests(batch);
+}
+
+void ConfigProtocolClientComm::setSendAsyncRequestCallback(SendAsyncRequestCallback sendAsyncRequestCallback,
+                                                           CancelAsyncRequestCallback cancelAsyncRequestCallback)
+{
+    this->sendAsyncRequestCallback = std::move(sendAsyncRequestCallback);
+    this->cancelAsyncRequestCallback = std::move(cancelAsyncRequestCallback);
+}
+
 bool ConfigProtocolClientComm::isComponentNested(const StringPtr& componentGlobalId)
 {
     const auto dev = getRootDevice();
@@ -856,6 +987,27 @@ StringPtr ConfigProtocolClientComm::requestSerializedRootDevice()
     return sendComponentCommandInternal(ClientCommand("GetSerializedRootDevice"), params, nullptr);
 }
 
+void ConfigProtocolClientComm::requestTreeRevision()
+{
+    const DictPtr<IString, IBaseObject> reply = sendCommand(ClientCommand("GetTreeRevision", 27));
+    treeEpoch = StringPtr(reply.get("Epoch")).toStdString();
+    treeRevision = static_cast<Int>(reply.get("Revision"));
+}
+
+StringPtr ConfigProtocolClientComm::requestChangedComponents()
+{
+    auto params = Dict<IString, IBaseObject>();
+    params.set("Epoch", treeEpoch);
+    params.set("Revision", static_cast<Int>(treeRevision));
+
+    // the whole root device is returned if the server was restarted since the revision was taken
+    const DictPtr<IString, IBaseObject> reply = sendCommand(ClientCommand("GetChangedComponents", 27), params);
+    treeEpoch = StringPtr(reply.get("Epoch")).toStdString();
+    treeRevision = static_cast<Int>(reply.get("Revision"));
+
+    return reply.get("SerializedComponent");
+}
+
 BaseObjectPtr ConfigProtocolClientComm::sendCommand(const ClientCommand& command, const ParamsDictPtr& params)
 {
     requireMinServerVersion(command);
@@ -881,6 +1033,113 @@ void ConfigProtocolClientComm::sendNoReplyCommand(const ClientCommand& command,
     }
 }
 
+std::vector<ConfigProtocolBatchResult> ConfigProtocolClientComm::sendBatchRequest(const ConfigProtocolBatch& batch)
+{
+    auto requests = List<IDict>();
+    for (const auto& [command, params] : batch.requests)
+    {
+        auto request = Dict<IString, IBaseObject>();
+        request.set("Name", String(command.getName()));
+        if (params.assigned())
+            request.set("Params", params);
+        requests.pushBack(request);
+    }
+
+    auto batchRpcRequestPacketBuffer = createRpcRequestPacketBuffer(generateId(), "Batch", Dict<IString, IBaseObject>({{"Requests", requests}}));
+    const auto batchRpcReplyPacketBuffer = sendRequestCallback(batchRpcRequestPacketBuffer);
+
+    const auto deserializeContext = createDeserializeContext(std::string{}, daqContext);
+    const ListPtr<IDict> replies = parseRpcOrRejectReply(batchRpcReplyPacketBuffer.parseRpcRequestOrReply(), deserializeContext);
+    if (!replies.assigned() || replies.getCount() != batch.getCount())
+        throw ConfigProtocolException("Invalid batch reply");
+
+    std::vector<ConfigProtocolBatchResult> results;
+    results.reserve(batch.getCount());
+    for (ParamsDictPtr reply : replies)
+        results.push_back(createBatchResult(reply));
+    return results;
+}
+
+std::vector<ConfigProtocolBatchResult> ConfigProtocolClientComm::sendPipelinedRequests(const ConfigProtocolBatch& batch)
+{
+    // cancels the requests whose replies were not collected if sending or waiting throws
+    class OutstandingRequestsGuard
+    {
+    public:
+        explicit OutstandingRequestsGuard(const CancelAsyncRequestCallback& cancelCallback)
+            : cancelCallback(cancelCallback)
+        {
+        }
+
+        ~OutstandingRequestsGuard()
+        {
+            if (!cancelCallback)
+                return;
+
+            for (size_t i = completedCount; i < requestIds.size(); ++i)
+                cancelCallback(requestIds[i]);
+        }
+
+        OutstandingRequestsGuard(const OutstandingRequestsGuard&) = delete;
+        OutstandingRequestsGuard& operator=(const OutstandingRequestsGuard&) = delete;
+
+        void sent(uint64_t requestId)
+        {
+            requestIds.push_back(requestId);
+        }
+
+        void completed()
+        {
+            ++completedCount;
+        }
+
+    private:
+        const CancelAsyncRequestCallback& cancelCallback;
+        std::vector<uint64_t> requestIds;
+        size_t completedCount = 0;
+    };
+
+    OutstandingRequestsGuard outstandingRequests(cancelAsyncRequestCallback);
+
+    // all requests are sent before waiting for the first reply; replies are matched to requests by the packet id
+    std::vector<std::future<PacketBuffer>> replies;
+    replies.reserve(batch.getCount());
+    for (const auto& [command, params] : batch.requests)
+    {
+        const auto requestId = generateId();
+        auto rpcRequestPacketBuffer = createRpcRequestPacketBuffer(requestId, command.getName(), params);
+        replies.push_back(sendAsyncRequestCallback(rpcRequestPacketBuffer));
+        outstandingRequests.sent(requestId);
+    }
+
+    const auto deserializeContext = createDeserializeContext(std::string{}, daqContext);
+
+    std::vector<ConfigProtocolBatchResult> results;
+    results.reserve(batch.getCount());
+    for (auto& reply : replies)
+    {
+        const auto rpcReplyPacketBuffer = reply.get();
+        outstandingRequests.completed();
+        results.push_back(createBatchResult(deserializeRpcReply(rpcReplyPacketBuffer.parseRpcRequestOrReply(), deserializeContext)));
+    }
+    return results;
+}
+
+std::vector<ConfigProtocolBatchResult> ConfigProtocolClientComm::sendSequentialRequests(const ConfigProtocolBatch& batch)
+{
+    const auto deserializeContext = createDeserializeContext(std::string{}, daqContext);
+
+    std::vector<ConfigProtocolBatchResult> results;
+    results.reserve(batch.getCount());
+    for (const auto& [command, params] : batch.requests)
+    {
+        auto rpcRequestPacketBuffer = createRpcRequestPacketBuffer(generateId(), command.getName(), params);
+        const auto rpcReplyPacketBuffer = sendRequestCallback(rpcRequestPacketBuffer);
+        results.push_back(createBatchResult(deserializeRpcReply(rpcReplyPacketBuffer.parseRpcRequestOrReply(), deserializeContext)));
+    }
+    return results;
+}
+
 void ConfigProtocolClientComm::setRootDevice(const DevicePtr& rootDevice)
 {
     this->rootDeviceRef = rootDevice;
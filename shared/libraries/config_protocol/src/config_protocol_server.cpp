@@ -82,12 +82,13 @@ ConfigProtocolServer::ConfigProtocolServer(DevicePtr rootDevice,
     , daqContext(this->rootDevice.getContext())
     , notificationReadyCallback(std::move(notificationReadyCallback))
     , deserializer(JsonDeserializer())
+    , binaryDeserializer(BinaryDeserializer())
     , notificationSerializer(JsonSerializer())
     , componentFinder(std::make_unique<ComponentFinderRootDevice>(this->rootDevice))
     , user(user)
     , connectionType(connectionType)
     , protocolVersion(0)
-    , supportedServerVersions(std::set<uint16_t>({17, 18, 19, 20, 21, 22, 23, 24}))
+    , supportedServerVersions(std::set<uint16_t>({17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27}))
     , streamingConsumer(this->daqContext, externalSignalsFolder)
     , packedCoreEvents(List<IBaseObject>())
 {
@@ -136,7 +137,14 @@ void ConfigProtocolServer::buildRpcDispatchStructure()
     rpcDispatch.insert({"GetComponent", std::bind(&ConfigProtocolServer::getComponent, this,  _1)});
     rpcDispatch.insert({"GetTypeManager", std::bind(&ConfigProtocolServer::getTypeManager, this, _1)});
     rpcDispatch.insert({"GetSerializedRootDevice", std::bind(&ConfigProtocolServer::getSerializedRootDevice, this,  _1)});
+    rpcDispatch.insert({"GetTreeRevision", std::bind(&ConfigProtocolServer::getTreeRevision, this,  _1)});
+    rpcDispatch.insert({"GetChangedComponents", std::bind(&ConfigProtocolServer::getChangedComponents, this,  _1)});
     rpcDispatch.insert({"RemoveExternalSignals", std::bind(&ConfigProtocolServer::removeExternalSignals, this,  _1)});
+    rpcDispatch.insert({"Batch", std::bind(&ConfigProtocolServer::batch, this,  _1)});
+
+    rpcMinProtocolVersions.insert({"Batch", 25});
+    rpcMinProtocolVersions.insert({"GetTreeRevision", 27});
+    rpcMinProtocolVersions.insert({"GetChangedComponents", 27});
 
     addHandler<ComponentPtr>("SetPropertyValue", &ConfigServerComponent::setPropertyValue);
     addHandler<ComponentPtr>("GetPropertyValue", &ConfigServerComponent::getPropertyValue);
@@ -265,6 +273,11 @@ void ConfigProtocolServer::setComponentFinder(std::unique_ptr<IComponentFinder>&
     this->componentFinder = std::move(componentFinder);
 }
 
+void ConfigProtocolServer::setRevisionTracker(const ConfigServerRevisionTrackerPtr& revisionTracker)
+{
+    this->revisionTracker = revisionTracker;
+}
+
 std::unique_ptr<IComponentFinder>& ConfigProtocolServer::getComponentFinder()
 {
     return componentFinder;
@@ -306,7 +319,7 @@ PacketBuffer ConfigProtocolServer::processPacketAndGetReply(const PacketBuffer&
                 }
                 catch (const std::exception& e)
                 {
-                    auto serializer = createSerializer();
+                    auto serializer = createRpcReplySerializer();
                     const auto errorReply = prepareErrorResponse(OPENDAQ_ERR_GENERALERROR, e.what(), serializer);
                     return PacketBuffer::createRpcRequestOrReply(requestId, errorReply.getCharPtr(), errorReply.getLength());
                 }
@@ -325,13 +338,13 @@ void ConfigProtocolServer::processNoReplyPacket(const PacketBuffer& packetBuffer
 
 StringPtr ConfigProtocolServer::processRpcAndGetReply(const StringPtr& jsonStr)
 {
-    auto serializer = createSerializer();
+    auto serializer = createRpcReplySerializer();
 
     try
     {
         auto retObj = Dict<IString, IBaseObject>();
 
-        const auto obj = deserializer.deserialize(jsonStr, daqContext.getTypeManager());
+        const auto obj = deserializeRpcRequest(jsonStr);
         const DictPtr<IString, IBaseObject> dictObj = obj.asPtr<IDict>(true);
 
         const auto funcName = dictObj.get("Name");
@@ -374,7 +387,7 @@ void ConfigProtocolServer::processNoReplyRpc(const StringPtr& jsonStr)
     StringPtr funcName;
     try
     {
-        const auto obj = deserializer.deserialize(jsonStr, daqContext.getTypeManager());
+        const auto obj = deserializeRpcRequest(jsonStr);
         const DictPtr<IString, IBaseObject> dictObj = obj.asPtr<IDict>(true);
 
         funcName = dictObj.get("Name");
@@ -389,11 +402,26 @@ void ConfigProtocolServer::processNoReplyRpc(const StringPtr& jsonStr)
     }
 }
 
+BaseObjectPtr ConfigProtocolServer::deserializeRpcRequest(const StringPtr& request) const
+{
+    // clients that negotiated protocol version 26 or newer send binary requests
+    if (IsBinarySerialized(request))
+    {
+        if (protocolVersion < 26)
+            throw ConfigProtocolException(
+                fmt::format("Binary requests are not supported by the negotiated protocol version {}", protocolVersion));
+        return binaryDeserializer.deserialize(request, daqContext.getTypeManager());
+    }
+
+    return deserializer.deserialize(request, daqContext.getTypeManager());
+}
+
 BaseObjectPtr ConfigProtocolServer::callRpc(const StringPtr& name, const ParamsDictPtr& params)
 {
     const auto it = rpcDispatch.find(name.toStdString());
     if (it == rpcDispatch.end())
         throw ConfigProtocolException(fmt::format("Invalid function call: {}", name));
+    requireMinProtocolVersion(it->first);
 
     if (protocolVersion < 20)
         return it->second(params);
@@ -402,6 +430,55 @@ BaseObjectPtr ConfigProtocolServer::callRpc(const StringPtr& name, const ParamsD
     return it->second(params);
 }
 
+BaseObjectPtr ConfigProtocolServer::batch(const ParamsDictPtr& params)
+{
+    // All requests of a batch run within the scope of the "Batch" RPC, so core events triggered
+    // by them are sent out together once the whole batch is processed
+    const ListPtr<IDict> requests = params.get("Requests");
+
+    auto results = List<IDict>();
+    for (DictPtr<IString, IBaseObject> request : requests)
+    {
+        auto result = Dict<IString, IBaseObject>();
+        try
+        {
+            const StringPtr funcName = request.get("Name");
+            const auto it = rpcDispatch.find(funcName.toStdString());
+            if (it == rpcDispatch.end() || funcName == "Batch")
+                throw ConfigProtocolException(fmt::format("Invalid function call: {}", funcName));
+            requireMinProtocolVersion(it->first);
+
+            const auto retValue = it->second(request.getOrDefault("Params"));
+
+            result.set("ErrorCode", OPENDAQ_SUCCESS);
+            if (retValue.assigned())
+                result.set("ReturnValue", retValue);
+        }
+        catch (const daq::DaqException& e)
+        {
+            result.set("ErrorCode", e.getErrCode());
+            result.set("ErrorMessage", e.what());
+        }
+        catch (const std::exception& e)
+        {
+            result.set("ErrorCode", OPENDAQ_ERR_GENERALERROR);
+            result.set("ErrorMessage", e.what());
+        }
+
+        results.pushBack(result);
+    }
+
+    return results;
+}
+
+void ConfigProtocolServer::requireMinProtocolVersion(const std::string& name) const
+{
+    const auto it = rpcMinProtocolVersions.find(name);
+    if (it != rpcMinProtocolVersions.end() && protocolVersion < it->second)
+        throw ConfigProtocolException(
+            fmt::format("Function call {} requires protocol version {}, negotiated version is {}", name, it->second, protocolVersion));
+}
+
 ComponentPtr ConfigProtocolServer::findComponent(const std::string& componentGlobalId) const
 {
     ComponentPtr component;
@@ -434,6 +511,42 @@ BaseObjectPtr ConfigProtocolServer::getSerializedRootDevice(const ParamsDictPtr&
     return serializer.getOutput();
 }
 
+BaseObjectPtr ConfigProtocolServer::getTreeRevision(const ParamsDictPtr& /*params*/) const
+{
+    auto result = Dict<IString, IBaseObject>();
+    result.set("Epoch", revisionTracker ? String(revisionTracker->getEpoch()) : String(""));
+    result.set("Revision", revisionTracker ? static_cast<Int>(revisionTracker->getRevision()) : 0);
+    return result;
+}
+
+BaseObjectPtr ConfigProtocolServer::getChangedComponents(const ParamsDictPtr& params)
+{
+    ConfigServerAccessControl::protectObject(rootDevice, user, Permission::Read);
+
+    // the revision is taken before serializing, so changes made meanwhile are sent again on the next reconnect
+    DictPtr<IString, IBaseObject> result = getTreeRevision(params);
+    auto serializer = createSerializer();
+
+    const StringPtr epoch = params.get("Epoch");
+    if (!revisionTracker || epoch.toStdString() != revisionTracker->getEpoch())
+    {
+        rootDevice.serialize(serializer);
+        result.set("SerializedComponent", serializer.getOutput());
+        return result;
+    }
+
+    const auto revision = static_cast<uint64_t>(static_cast<Int>(params.get("Revision")));
+    if (!revisionTracker->isChangedSince(rootDevice.getGlobalId(), revision))
+    {
+        result.set("SerializedComponent", nullptr);
+        return result;
+    }
+
+    rootDevice.serialize(revisionTracker->createDeltaSerializer(serializer, revision));
+    result.set("SerializedComponent", serializer.getOutput());
+    return result;
+}
+
 BaseObjectPtr ConfigProtocolServer::connectSignal(const RpcContext& context, const InputPortPtr& inputPort, const ParamsDictPtr& params)
 {
     const StringPtr signalId = params.get("SignalId");
@@ -768,4 +881,16 @@ SerializerPtr ConfigProtocolServer::createSerializer()
     return serializer;
 }
 
+SerializerPtr ConfigProtocolServer::createRpcReplySerializer()
+{
+    // RPC replies switch to the binary format from version 26 on; payloads nested in replies and
+    // notifications stay JSON, as the client parses them independently of the negotiated version
+    if (protocolVersion < 26)
+        return createSerializer();
+
+    SerializerPtr serializer = BinarySerializer();
+    serializer.setUser(user);
+    return serializer;
+}
+
 }
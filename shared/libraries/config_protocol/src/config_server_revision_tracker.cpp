@@ -0,0 +1,351 @@
+#include <config_protocol/config_server_revision_tracker.h>
+#include <coreobjects/core_event_args_ids.h>
+#include <coretypes/impl.h>
+#include <coretypes/serializable.h>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+namespace daq::config_protocol
+{
+
+namespace
+{
+
+std::string generateEpoch()
+{
+    std::random_device rd;
+    std::mt19937_64 generator(rd());
+
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0') << std::setw(16) << generator();
+    return ss.str();
+}
+
+// Forwards to the wrapped serializer. Components that did not change after the given revision are written as
+// tagged objects holding only the unchanged placeholder key, and everything they serialize is skipped.
+class DeltaSerializerImpl : public ImplementationOf<ISerializer>
+{
+public:
+    DeltaSerializerImpl(ConfigServerRevisionTracker* tracker, ISerializer* serializer, uint64_t revision)
+        : tracker(tracker)
+        , serializer(serializer)
+        , revision(revision)
+        , depth(0)
+        , skippedDepth(0)
+        , addedDepth(0)
+    {
+    }
+
+    ErrCode INTERFACE_FUNC startTaggedObject(ISerializable* obj) override
+    {
+        if (skippedDepth > 0)
+        {
+            ++skippedDepth;
+            return OPENDAQ_SUCCESS;
+        }
+
+        ComponentPtr component;
+        if (obj != nullptr && addedDepth == 0)
+            component = BaseObjectPtr::Borrow(obj).asPtrOrNull<IComponent>();
+
+        ErrCode errCode = serializer->startTaggedObject(obj);
+        OPENDAQ_RETURN_IF_FAILED(errCode);
+
+        if (component.assigned())
+        {
+            const std::string globalId = component.getGlobalId();
+            if (!tracker->isChangedSince(globalId, revision))
+            {
+                errCode = serializer->key(UnchangedComponentKey);
+                OPENDAQ_RETURN_IF_FAILED(errCode);
+                errCode = serializer->writeBool(True);
+                OPENDAQ_RETURN_IF_FAILED(errCode);
+
+                skippedDepth = 1;
+                return OPENDAQ_SUCCESS;
+            }
+
+            // the client has no part of added subtrees
+            if (tracker->isAddedSince(globalId, revision))
+                addedDepth = depth + 1;
+        }
+
+        ++depth;
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC startObject() override
+    {
+        if (skippedDepth > 0)
+        {
+            ++skippedDepth;
+            return OPENDAQ_SUCCESS;
+        }
+
+        ++depth;
+        return serializer->startObject();
+    }
+
+    ErrCode INTERFACE_FUNC endObject() override
+    {
+        if (skippedDepth > 0)
+        {
+            // the placeholder is closed with the end of the skipped component
+            if (--skippedDepth == 0)
+                return serializer->endObject();
+            return OPENDAQ_SUCCESS;
+        }
+
+        if (addedDepth == depth)
+            addedDepth = 0;
+        --depth;
+        return serializer->endObject();
+    }
+
+    ErrCode INTERFACE_FUNC startList() override
+    {
+        if (skippedDepth > 0)
+        {
+            ++skippedDepth;
+            return OPENDAQ_SUCCESS;
+        }
+
+        ++depth;
+        return serializer->startList();
+    }
+
+    ErrCode INTERFACE_FUNC endList() override
+    {
+        if (skippedDepth > 0)
+        {
+            --skippedDepth;
+            return OPENDAQ_SUCCESS;
+        }
+
+        --depth;
+        return serializer->endList();
+    }
+
+    ErrCode INTERFACE_FUNC getOutput(IString** serialized) override
+    {
+        return serializer->getOutput(serialized);
+    }
+
+    ErrCode INTERFACE_FUNC key(ConstCharPtr string) override
+    {
+        return skippedDepth > 0 ? OPENDAQ_SUCCESS : serializer->key(string);
+    }
+
+    ErrCode INTERFACE_FUNC keyStr(IString* name) override
+    {
+        return skippedDepth > 0 ? OPENDAQ_SUCCESS : serializer->keyStr(name);
+    }
+
+    ErrCode INTERFACE_FUNC keyRaw(ConstCharPtr string, SizeT length) override
+    {
+        return skippedDepth > 0 ? OPENDAQ_SUCCESS : serializer->keyRaw(string, length);
+    }
+
+    ErrCode INTERFACE_FUNC writeInt(Int integer) override
+    {
+        return skippedDepth > 0 ? OPENDAQ_SUCCESS : serializer->writeInt(integer);
+    }
+
+    ErrCode INTERFACE_FUNC writeBool(Bool boolean) override
+    {
+        return skippedDepth > 0 ? OPENDAQ_SUCCESS : serializer->writeBool(boolean);
+    }
+
+    ErrCode INTERFACE_FUNC writeFloat(Float real) override
+    {
+        return skippedDepth > 0 ? OPENDAQ_SUCCESS : serializer->writeFloat(real);
+    }
+
+    ErrCode INTERFACE_FUNC writeString(ConstCharPtr string, SizeT length) override
+    {
+        return skippedDepth > 0 ? OPENDAQ_SUCCESS : serializer->writeString(string, length);
+    }
+
+    ErrCode INTERFACE_FUNC writeNull() override
+    {
+        return skippedDepth > 0 ? OPENDAQ_SUCCESS : serializer->writeNull();
+    }
+
+    ErrCode INTERFACE_FUNC reset() override
+    {
+        depth = 0;
+        skippedDepth = 0;
+        addedDepth = 0;
+        return serializer->reset();
+    }
+
+    ErrCode INTERFACE_FUNC isComplete(Bool* complete) override
+    {
+        return serializer->isComplete(complete);
+    }
+
+    ErrCode INTERFACE_FUNC getUser(IBaseObject** user) override
+    {
+        return serializer->getUser(user);
+    }
+
+    ErrCode INTERFACE_FUNC setUser(IBaseObject* user) override
+    {
+        return serializer->setUser(user);
+    }
+
+    ErrCode INTERFACE_FUNC getVersion(Int* version) override
+    {
+        return serializer->getVersion(version);
+    }
+
+private:
+    ConfigServerRevisionTracker* tracker;
+    SerializerPtr serializer;
+    uint64_t revision;
+    size_t depth;
+    size_t skippedDepth;
+    size_t addedDepth;
+};
+
+}
+
+ConfigServerRevisionTracker::ConfigServerRevisionTracker(const ContextPtr& context, const std::string& rootGlobalId)
+    : context(context)
+    , rootGlobalId(rootGlobalId)
+    , epoch(generateEpoch())
+    , revision(0)
+{
+    if (this->context.assigned())
+        this->context.getOnCoreEvent() += event(this, &ConfigServerRevisionTracker::coreEventCallback);
+}
+
+ConfigServerRevisionTracker::~ConfigServerRevisionTracker()
+{
+    if (context.assigned())
+        context.getOnCoreEvent() -= event(this, &ConfigServerRevisionTracker::coreEventCallback);
+}
+
+const std::string& ConfigServerRevisionTracker::getEpoch() const
+{
+    return epoch;
+}
+
+uint64_t ConfigServerRevisionTracker::getRevision() const
+{
+    std::scoped_lock lock(sync);
+    return revision;
+}
+
+bool ConfigServerRevisionTracker::isChangedSince(const std::string& globalId, uint64_t revision) const
+{
+    std::scoped_lock lock(sync);
+
+    const auto it = revisions.find(globalId);
+    return it != revisions.end() && it->second.changed > revision;
+}
+
+bool ConfigServerRevisionTracker::isAddedSince(const std::string& globalId, uint64_t revision) const
+{
+    std::scoped_lock lock(sync);
+
+    const auto it = revisions.find(globalId);
+    return it != revisions.end() && it->second.added > revision;
+}
+
+SerializerPtr ConfigServerRevisionTracker::createDeltaSerializer(const SerializerPtr& serializer, uint64_t revision)
+{
+    SerializerPtr deltaSerializer;
+    checkErrorInfo(createObject<ISerializer, DeltaSerializerImpl>(&deltaSerializer, this, serializer.getObject(), revision));
+    return deltaSerializer;
+}
+
+void ConfigServerRevisionTracker::coreEventCallback(ComponentPtr& component, CoreEventArgsPtr& args)
+{
+    handleCoreEvent(component, args);
+}
+
+void ConfigServerRevisionTracker::handleCoreEvent(const ComponentPtr& component, const CoreEventArgsPtr& args)
+{
+    if (!component.assigned())
+        return;
+
+    const std::string globalId = component.getGlobalId();
+    if (!isInTree(globalId))
+        return;
+
+    switch (static_cast<CoreEventId>(args.getEventId()))
+    {
+        case CoreEventId::ComponentAdded:
+        {
+            const ComponentPtr added = args.getParameters().get("Component");
+            markChanged(added.getGlobalId(), true);
+            break;
+        }
+        case CoreEventId::ComponentRemoved:
+        {
+            const StringPtr localId = args.getParameters().get("Id");
+            removeSubtree(globalId + "/" + localId.toStdString());
+            markChanged(globalId, false);
+            break;
+        }
+        case CoreEventId::ComponentUpdateEnd:
+            markChanged(globalId, true);
+            break;
+        case CoreEventId::TypeAdded:
+        case CoreEventId::TypeRemoved:
+            // types are enumerated again on every reconnect
+            break;
+        default:
+            markChanged(globalId, false);
+            break;
+    }
+}
+
+void ConfigServerRevisionTracker::markChanged(const std::string& globalId, bool added)
+{
+    std::scoped_lock lock(sync);
+
+    ++revision;
+    if (added)
+        revisions[globalId].added = revision;
+
+    // stamp the component and all of its ancestors up to the root device
+    std::string id = globalId;
+    while (true)
+    {
+        revisions[id].changed = revision;
+        if (id.size() <= rootGlobalId.size())
+            break;
+
+        const auto pos = id.rfind('/');
+        if (pos == std::string::npos || pos == 0)
+            break;
+        id.resize(pos);
+    }
+}
+
+void ConfigServerRevisionTracker::removeSubtree(const std::string& globalId)
+{
+    std::scoped_lock lock(sync);
+
+    const std::string prefix = globalId + "/";
+    for (auto it = revisions.begin(); it != revisions.end();)
+    {
+        if (it->first == globalId || it->first.compare(0, prefix.size(), prefix) == 0)
+            it = revisions.erase(it);
+        else
+            ++it;
+    }
+}
+
+bool ConfigServerRevisionTracker::isInTree(const std::string& globalId) const
+{
+    if (globalId.compare(0, rootGlobalId.size(), rootGlobalId) != 0)
+        return false;
+
+    return globalId.size() == rootGlobalId.size() || globalId[rootGlobalId.size()] == '/';
+}
+
+}
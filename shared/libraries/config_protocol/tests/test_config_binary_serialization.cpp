@@ -0,0 +1,155 @@
+// ReSharper disable CppClangTidyModernizeAvoidBind
+#include <gtest/gtest.h>
+#include <config_protocol/config_protocol_server.h>
+#include <config_protocol/config_protocol_client.h>
+#include <config_protocol/config_client_device_impl.h>
+#include <opendaq/mock/advanced_components_setup_utils.h>
+#include <opendaq/mock/mock_physical_device.h>
+#include <opendaq/context_factory.h>
+#include <coreobjects/user_factory.h>
+#include <testutils/testutils.h>
+
+using namespace daq;
+using namespace config_protocol;
+using namespace testing;
+
+class ConfigBinarySerializationTest : public Test
+{
+public:
+    void SetUp() override
+    {
+        serverDevice = test_utils::createTestDevice();
+        serverDevice.addProperty(StringProperty("TestProperty", ""));
+        server = std::make_unique<ConfigProtocolServer>(
+            serverDevice,
+            std::bind(&ConfigBinarySerializationTest::serverNotificationReady, this, std::placeholders::_1),
+            User("", ""),
+            ClientType::Control,
+            test_utils::dummyExtSigFolder(serverDevice.getContext()));
+    }
+
+    // adds child devices, each with its own channels, signals and properties
+    void addChildDevices(size_t count) const
+    {
+        const FolderConfigPtr devicesFolder = serverDevice.getItem("Dev");
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto localId = String("mock_phys_dev_" + std::to_string(i));
+            devicesFolder.addItem(MockPhysicalDevice_Create(serverDevice.getContext(), devicesFolder, localId, nullptr));
+        }
+    }
+
+    DevicePtr connect(uint16_t protocolVersion = GetLatestConfigProtocolVersion())
+    {
+        client = std::make_unique<ConfigProtocolClient<ConfigClientDeviceImpl>>(
+            NullContext(),
+            std::bind(&ConfigBinarySerializationTest::sendRequestAndGetReply, this, std::placeholders::_1),
+            std::bind(&ConfigBinarySerializationTest::sendNoReplyRequest, this, std::placeholders::_1),
+            nullptr,
+            nullptr,
+            nullptr);
+
+        return client->connect(nullptr, protocolVersion);
+    }
+
+    PacketBuffer sendRequestAndGetReply(const PacketBuffer& requestPacket)
+    {
+        auto replyPacket = server->processRequestAndGetReply(requestPacket);
+        if (requestPacket.getPacketType() == PacketType::Rpc)
+        {
+            checkPayload(requestPacket.parseRpcRequestOrReply());
+            checkPayload(replyPacket.parseRpcRequestOrReply());
+        }
+        return replyPacket;
+    }
+
+    void sendNoReplyRequest(const PacketBuffer& requestPacket)
+    {
+        checkPayload(requestPacket.parseNoReplyRpcRequest());
+        server->processNoReplyRequest(requestPacket);
+    }
+
+    void serverNotificationReady(const PacketBuffer& notificationPacket) const
+    {
+        if (client)
+            client->triggerNotificationPacket(notificationPacket);
+    }
+
+    void checkPayload(const StringPtr& payload)
+    {
+        if (IsBinarySerialized(payload))
+            ++binaryPayloadCount;
+        else
+            ++jsonPayloadCount;
+    }
+
+    static StringPtr serializeComponent(const ComponentPtr& component)
+    {
+        const auto serializer = JsonSerializer();
+        component.serialize(serializer);
+        return serializer.getOutput();
+    }
+
+protected:
+    DevicePtr serverDevice;
+    std::unique_ptr<ConfigProtocolServer> server;
+    std::unique_ptr<ConfigProtocolClient<ConfigClientDeviceImpl>> client;
+    size_t binaryPayloadCount = 0;
+    size_t jsonPayloadCount = 0;
+};
+
+TEST_F(ConfigBinarySerializationTest, BinaryPayloads)
+{
+    const auto clientDevice = connect();
+    clientDevice.setPropertyValue("TestProperty", "binary");
+
+    ASSERT_EQ(serverDevice.getPropertyValue("TestProperty"), "binary");
+    ASSERT_GT(binaryPayloadCount, 0u);
+    ASSERT_EQ(jsonPayloadCount, 0u);
+}
+
+TEST_F(ConfigBinarySerializationTest, JsonPayloadsBeforeVersion26)
+{
+    const auto clientDevice = connect(25);
+    clientDevice.setPropertyValue("TestProperty", "json");
+
+    ASSERT_EQ(serverDevice.getPropertyValue("TestProperty"), "json");
+    ASSERT_GT(jsonPayloadCount, 0u);
+    ASSERT_EQ(binaryPayloadCount, 0u);
+}
+
+TEST_F(ConfigBinarySerializationTest, BinaryRequestsRejectedBeforeVersion26)
+{
+    const auto clientDevice = connect();
+    server->setProtocolVersion(25);
+
+    ASSERT_THROW(clientDevice.setPropertyValue("TestProperty", "binary"), GeneralErrorException);
+    ASSERT_NE(serverDevice.getPropertyValue("TestProperty"), "binary");
+}
+
+TEST_F(ConfigBinarySerializationTest, SameTreeInBothFormats)
+{
+    const auto jsonSerializedTree = serializeComponent(connect(25));
+    const auto binarySerializedTree = serializeComponent(connect());
+
+    ASSERT_EQ(jsonSerializedTree, binarySerializedTree);
+    ASSERT_EQ(binarySerializedTree, serializeComponent(serverDevice));
+}
+
+TEST_F(ConfigBinarySerializationTest, SameTreeWithChildDevicesInBothFormats)
+{
+    addChildDevices(10);
+
+    const auto jsonSerializedTree = serializeComponent(connect(25));
+    const auto binarySerializedTree = serializeComponent(connect());
+
+    ASSERT_EQ(jsonSerializedTree, binarySerializedTree);
+    ASSERT_EQ(binarySerializedTree, serializeComponent(serverDevice));
+}
+
+TEST_F(ConfigBinarySerializationTest, ErrorReply)
+{
+    const auto clientDevice = connect();
+
+    ASSERT_THROW(clientDevice.setPropertyValue("UnknownProperty", 1), NotFoundException);
+}
@@ -0,0 +1,297 @@
+// ReSharper disable CppClangTidyModernizeAvoidBind
+#include <gtest/gtest.h>
+#include <config_protocol/config_protocol_server.h>
+#include <config_protocol/config_protocol_client.h>
+#include <config_protocol/config_client_device_impl.h>
+#include <opendaq/mock/advanced_components_setup_utils.h>
+#include <opendaq/context_factory.h>
+#include <coreobjects/property_factory.h>
+#include <coreobjects/user_factory.h>
+#include <testutils/testutils.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace daq;
+using namespace config_protocol;
+using namespace testing;
+
+class ConfigProtocolBatchTest : public Test
+{
+public:
+    static constexpr size_t ChannelCount = 64;
+
+    void SetUp() override
+    {
+        serverDevice = test_utils::createTestDevice();
+        for (size_t i = 0; i < ChannelCount; ++i)
+            serverDevice.addProperty(IntProperty(getPropertyName(i), 0));
+
+        server = std::make_unique<ConfigProtocolServer>(
+            serverDevice,
+            std::bind(&ConfigProtocolBatchTest::serverNotificationReady, this, std::placeholders::_1),
+            User("", ""),
+            ClientType::Control,
+            test_utils::dummyExtSigFolder(serverDevice.getContext()));
+
+        createClient();
+    }
+
+    void createClient()
+    {
+        client =
+            std::make_unique<ConfigProtocolClient<ConfigClientDeviceImpl>>(
+                NullContext(),
+                std::bind(&ConfigProtocolBatchTest::sendRequestAndGetReply, this, std::placeholders::_1),
+                std::bind(&ConfigProtocolBatchTest::sendNoReplyRequest, this, std::placeholders::_1),
+                nullptr,
+                nullptr,
+                nullptr
+            );
+    }
+
+    static std::string getPropertyName(size_t channel)
+    {
+        return "Channel" + std::to_string(channel) + "Gain";
+    }
+
+    void connect(uint16_t protocolVersion = GetLatestConfigProtocolVersion(), bool enableAsyncRequests = false)
+    {
+        client->connect(nullptr, protocolVersion);
+        if (enableAsyncRequests)
+            client->getClientComm()->setSendAsyncRequestCallback(
+                std::bind(&ConfigProtocolBatchTest::sendAsyncRequest, this, std::placeholders::_1),
+                std::bind(&ConfigProtocolBatchTest::cancelAsyncRequest, this, std::placeholders::_1));
+        requestCount = 0;
+    }
+
+    // client handling; latency simulates the round trip time of the connection
+    PacketBuffer sendRequestAndGetReply(const PacketBuffer& requestPacket)
+    {
+        ++requestCount;
+        std::this_thread::sleep_for(latency);
+        std::scoped_lock lock(serverSync);
+        return server->processRequestAndGetReply(requestPacket);
+    }
+
+    std::future<PacketBuffer> sendAsyncRequest(PacketBuffer& requestPacket)
+    {
+        const size_t requestIndex = ++requestCount;
+        if (requestIndex == failedSendIndex)
+            DAQ_THROW_EXCEPTION(ConnectionLostException);
+
+        sentRequestIds.push_back(requestPacket.getId());
+        if (requestIndex == failedReplyIndex)
+        {
+            std::promise<PacketBuffer> reply;
+            reply.set_exception(std::make_exception_ptr(ConnectionLostException()));
+            return reply.get_future();
+        }
+
+        auto packet = std::make_shared<PacketBuffer>(std::move(requestPacket));
+        return std::async(std::launch::async,
+                          [this, packet]
+                          {
+                              std::this_thread::sleep_for(latency);
+                              std::scoped_lock lock(serverSync);
+                              return server->processRequestAndGetReply(*packet);
+                          });
+    }
+
+    void cancelAsyncRequest(uint64_t requestId)
+    {
+        cancelledRequestIds.push_back(requestId);
+    }
+
+    void sendNoReplyRequest(const PacketBuffer& requestPacket)
+    {
+        std::scoped_lock lock(serverSync);
+        server->processNoReplyRequest(requestPacket);
+    }
+
+    void serverNotificationReady(const PacketBuffer& notificationPacket) const
+    {
+        client->triggerNotificationPacket(notificationPacket);
+    }
+
+    ConfigProtocolBatch createConfigurationBatch(Int valueOffset) const
+    {
+        ConfigProtocolBatch batch;
+        for (size_t i = 0; i < ChannelCount; ++i)
+            batch.setPropertyValue("//root", getPropertyName(i), static_cast<Int>(i) + valueOffset);
+        return batch;
+    }
+
+    void checkBatchResults()
+    {
+        const auto results = client->getClientComm()->executeBatch(createConfigurationBatch(10));
+        ASSERT_EQ(results.size(), ChannelCount);
+        for (size_t i = 0; i < ChannelCount; ++i)
+        {
+            ASSERT_TRUE(results[i].succeeded());
+            ASSERT_EQ(serverDevice.getPropertyValue(getPropertyName(i)), static_cast<Int>(i) + 10);
+        }
+
+        ConfigProtocolBatch getBatch;
+        for (size_t i = 0; i < ChannelCount; ++i)
+            getBatch.getPropertyValue("//root", getPropertyName(i));
+
+        const auto values = client->getClientComm()->executeBatch(getBatch);
+        ASSERT_EQ(values.size(), ChannelCount);
+        for (size_t i = 0; i < ChannelCount; ++i)
+            ASSERT_EQ(values[i].getValue(), static_cast<Int>(i) + 10);
+    }
+
+protected:
+    DevicePtr serverDevice;
+    std::unique_ptr<ConfigProtocolServer> server;
+    std::unique_ptr<ConfigProtocolClient<ConfigClientDeviceImpl>> client;
+    std::mutex serverSync;
+    std::atomic<size_t> requestCount{0};
+    std::chrono::microseconds latency{0};
+
+    // 1-based indices of pipelined requests that fail to be sent or fail to get a reply; 0 disables the failure
+    size_t failedSendIndex = 0;
+    size_t failedReplyIndex = 0;
+    std::vector<uint64_t> sentRequestIds;
+    std::vector<uint64_t> cancelledRequestIds;
+};
+
+TEST_F(ConfigProtocolBatchTest, BatchRequest)
+{
+    connect();
+
+    checkBatchResults();
+    ASSERT_EQ(requestCount.load(), 2u);
+}
+
+TEST_F(ConfigProtocolBatchTest, EmptyBatch)
+{
+    connect();
+
+    ASSERT_TRUE(client->getClientComm()->executeBatch(ConfigProtocolBatch()).empty());
+    ASSERT_EQ(requestCount.load(), 0u);
+}
+
+TEST_F(ConfigProtocolBatchTest, FailedRequestsDoNotAbortBatch)
+{
+    connect();
+
+    ConfigProtocolBatch batch;
+    batch.setPropertyValue("//root", getPropertyName(0), 5);
+    batch.setPropertyValue("//root", "Unknown", 5);
+    batch.getPropertyValue("/unknown/component", getPropertyName(0));
+    batch.addCommand(ClientCommand("UnknownCommand"), Dict<IString, IBaseObject>());
+    batch.addCommand(ClientCommand("Batch"), Dict<IString, IBaseObject>({{"Requests", List<IDict>()}}));
+    batch.getPropertyValue("//root", getPropertyName(0));
+
+    const auto results = client->getClientComm()->executeBatch(batch);
+    ASSERT_EQ(results.size(), 6u);
+
+    ASSERT_TRUE(results[0].succeeded());
+    ASSERT_FALSE(results[1].succeeded());
+    ASSERT_THROW(results[1].getValue(), NotFoundException);
+    ASSERT_FALSE(results[2].succeeded());
+    ASSERT_THROW(results[2].getValue(), NotFoundException);
+    ASSERT_FALSE(results[3].succeeded());
+    ASSERT_FALSE(results[4].succeeded());
+    ASSERT_EQ(results[5].getValue(), 5);
+    ASSERT_EQ(serverDevice.getPropertyValue(getPropertyName(0)), 5);
+}
+
+TEST_F(ConfigProtocolBatchTest, ClearPropertyValue)
+{
+    serverDevice.setPropertyValue(getPropertyName(1), 7);
+    connect();
+
+    ConfigProtocolBatch batch;
+    batch.clearPropertyValue("//root", getPropertyName(1));
+    batch.getPropertyValue("//root", getPropertyName(1));
+
+    const auto results = client->getClientComm()->executeBatch(batch);
+    ASSERT_EQ(results.size(), 2u);
+    ASSERT_TRUE(results[0].succeeded());
+    ASSERT_EQ(results[1].getValue(), 0);
+    ASSERT_EQ(serverDevice.getPropertyValue(getPropertyName(1)), 0);
+}
+
+TEST_F(ConfigProtocolBatchTest, SequentialFallback)
+{
+    connect(24);
+
+    checkBatchResults();
+    ASSERT_EQ(requestCount.load(), 2 * ChannelCount);
+}
+
+TEST_F(ConfigProtocolBatchTest, PipelinedFallback)
+{
+    connect(24, true);
+
+    checkBatchResults();
+    ASSERT_EQ(requestCount.load(), 2 * ChannelCount);
+}
+
+TEST_F(ConfigProtocolBatchTest, UnsupportedCommandRejectsBatch)
+{
+    connect();
+
+    ConfigProtocolBatch batch;
+    batch.setPropertyValue("//root", getPropertyName(0), 5);
+    batch.addCommand(ClientCommand("FutureCommand", GetLatestConfigProtocolVersion() + 1), nullptr);
+
+    ASSERT_THROW(client->getClientComm()->executeBatch(batch), ServerVersionTooLowException);
+    ASSERT_EQ(requestCount.load(), 0u);
+    ASSERT_EQ(serverDevice.getPropertyValue(getPropertyName(0)), 0);
+}
+
+TEST_F(ConfigProtocolBatchTest, BatchRejectedBelowVersion25)
+{
+    connect(25);
+    server->setProtocolVersion(24);
+
+    ASSERT_THROW(client->getClientComm()->executeBatch(createConfigurationBatch(1)), GeneralErrorException);
+    ASSERT_EQ(serverDevice.getPropertyValue(getPropertyName(0)), 0);
+}
+
+TEST_F(ConfigProtocolBatchTest, TreeRevisionRejectedBelowVersion27)
+{
+    connect();
+
+    ConfigProtocolBatch batch;
+    batch.addCommand(ClientCommand("GetTreeRevision"), Dict<IString, IBaseObject>());
+    ASSERT_TRUE(client->getClientComm()->executeBatch(batch)[0].succeeded());
+
+    server->setProtocolVersion(26);
+    ASSERT_FALSE(client->getClientComm()->executeBatch(batch)[0].succeeded());
+}
+
+TEST_F(ConfigProtocolBatchTest, PipelinedSendFailureCancelsSentRequests)
+{
+    connect(24, true);
+    failedSendIndex = 3;
+
+    ASSERT_THROW(client->getClientComm()->executeBatch(createConfigurationBatch(1)), ConnectionLostException);
+    ASSERT_EQ(sentRequestIds.size(), 2u);
+    ASSERT_EQ(cancelledRequestIds, sentRequestIds);
+}
+
+TEST_F(ConfigProtocolBatchTest, PipelinedReplyFailureCancelsOutstandingRequests)
+{
+    connect(24, true);
+    failedReplyIndex = 2;
+
+    ASSERT_THROW(client->getClientComm()->executeBatch(createConfigurationBatch(1)), ConnectionLostException);
+    ASSERT_EQ(sentRequestIds.size(), ChannelCount);
+    ASSERT_EQ(cancelledRequestIds, std::vector<uint64_t>(sentRequestIds.begin() + 1, sentRequestIds.end()));
+}
+
+TEST_F(ConfigProtocolBatchTest, PipelinedBatchCancelsNothing)
+{
+    connect(24, true);
+
+    checkBatchResults();
+    ASSERT_TRUE(cancelledRequestIds.empty());
+}
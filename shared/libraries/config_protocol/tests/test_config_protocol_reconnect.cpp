@@ -0,0 +1,207 @@
+// ReSharper disable CppClangTidyModernizeAvoidBind
+#include <gtest/gtest.h>
+#include <config_protocol/config_protocol_server.h>
+#include <config_protocol/config_protocol_client.h>
+#include <config_protocol/config_client_device_impl.h>
+#include <config_protocol/config_server_revision_tracker.h>
+#include <opendaq/mock/advanced_components_setup_utils.h>
+#include <opendaq/mock/mock_physical_device.h>
+#include <opendaq/context_factory.h>
+#include <coreobjects/property_object_internal_ptr.h>
+#include <coreobjects/user_factory.h>
+
+using namespace daq;
+using namespace config_protocol;
+using namespace testing;
+
+class ConfigProtocolReconnectTest : public Test
+{
+public:
+    void SetUp() override
+    {
+        serverDevice = test_utils::createTestDevice();
+        revisionTracker = std::make_shared<ConfigServerRevisionTracker>(serverDevice.getContext(), serverDevice.getGlobalId());
+        createServer();
+
+        clientContext = NullContext();
+        client = std::make_unique<ConfigProtocolClient<ConfigClientDeviceImpl>>(
+            clientContext,
+            std::bind(&ConfigProtocolReconnectTest::sendRequestAndGetReply, this, std::placeholders::_1),
+            std::bind(&ConfigProtocolReconnectTest::sendNoReplyRequest, this, std::placeholders::_1),
+            nullptr,
+            nullptr,
+            nullptr);
+
+        clientDevice = client->connect();
+        clientDevice.asPtr<IPropertyObjectInternal>().enableCoreEventTrigger();
+
+        clientContext.getOnCoreEvent() += [this](const ComponentPtr& /*comp*/, const CoreEventArgsPtr& args)
+        {
+            if (args.getEventId() == static_cast<Int>(CoreEventId::ComponentUpdateEnd))
+                ++updateCount;
+        };
+    }
+
+    // each connection has its own server; the revision tracker is shared between them
+    void createServer()
+    {
+        server = std::make_unique<ConfigProtocolServer>(
+            serverDevice,
+            std::bind(&ConfigProtocolReconnectTest::serverNotificationReady, this, std::placeholders::_1),
+            User("", ""),
+            ClientType::Control,
+            test_utils::dummyExtSigFolder(serverDevice.getContext()));
+        server->setRevisionTracker(revisionTracker);
+    }
+
+    void disconnect()
+    {
+        connected = false;
+        server.reset();
+    }
+
+    void reconnect()
+    {
+        createServer();
+        connected = true;
+
+        replyBytes = 0;
+        client->reconnect(False);
+    }
+
+    PacketBuffer sendRequestAndGetReply(const PacketBuffer& requestPacket)
+    {
+        auto replyPacket = server->processRequestAndGetReply(requestPacket);
+        replyBytes += replyPacket.getPayloadSize();
+        return replyPacket;
+    }
+
+    void sendNoReplyRequest(const PacketBuffer& requestPacket) const
+    {
+        server->processNoReplyRequest(requestPacket);
+    }
+
+    void serverNotificationReady(const PacketBuffer& notificationPacket) const
+    {
+        if (connected)
+            client->triggerNotificationPacket(notificationPacket);
+    }
+
+    static StringPtr serializeComponent(const ComponentPtr& component)
+    {
+        const auto serializer = JsonSerializer(True);
+        component.serialize(serializer);
+        return serializer.getOutput();
+    }
+
+    static SizeT getSerializedSize(const ComponentPtr& component)
+    {
+        const auto serializer = JsonSerializer();
+        component.serialize(serializer);
+        return serializer.getOutput().getLength();
+    }
+
+protected:
+    DevicePtr serverDevice;
+    DevicePtr clientDevice;
+    ContextPtr clientContext;
+    ConfigServerRevisionTrackerPtr revisionTracker;
+    std::unique_ptr<ConfigProtocolServer> server;
+    std::unique_ptr<ConfigProtocolClient<ConfigClientDeviceImpl>> client;
+    bool connected = true;
+    size_t replyBytes = 0;
+    int updateCount = 0;
+};
+
+TEST_F(ConfigProtocolReconnectTest, NoChanges)
+{
+    disconnect();
+    reconnect();
+
+    ASSERT_EQ(updateCount, 0);
+    ASSERT_EQ(serializeComponent(clientDevice), serializeComponent(serverDevice));
+}
+
+TEST_F(ConfigProtocolReconnectTest, PropertyChanged)
+{
+    const auto fullReplySize = getSerializedSize(serverDevice);
+
+    disconnect();
+    serverDevice.findComponent("IO/AI/Ch").setPropertyValue("StrProp", "changed");
+    reconnect();
+
+    ASSERT_EQ(updateCount, 1);
+    ASSERT_EQ(clientDevice.findComponent("IO/AI/Ch").getPropertyValue("StrProp"), "changed");
+    ASSERT_EQ(serializeComponent(clientDevice), serializeComponent(serverDevice));
+    ASSERT_LT(replyBytes, fullReplySize);
+}
+
+TEST_F(ConfigProtocolReconnectTest, RootPropertyChanged)
+{
+    serverDevice.addProperty(StringProperty("String", "foo"));
+    ASSERT_TRUE(clientDevice.hasProperty("String"));
+
+    disconnect();
+    serverDevice.setPropertyValue("String", "bar");
+    reconnect();
+
+    ASSERT_EQ(clientDevice.getPropertyValue("String"), "bar");
+    ASSERT_EQ(serializeComponent(clientDevice), serializeComponent(serverDevice));
+}
+
+TEST_F(ConfigProtocolReconnectTest, ComponentAddedAndRemoved)
+{
+    const FolderConfigPtr serverDevicesFolder = serverDevice.getItem("Dev");
+
+    disconnect();
+    serverDevicesFolder.addItem(MockPhysicalDevice_Create(serverDevice.getContext(), serverDevicesFolder, "added_dev", nullptr));
+    reconnect();
+
+    const FolderPtr clientDevicesFolder = clientDevice.getItem("Dev");
+    ASSERT_TRUE(clientDevicesFolder.hasItem("added_dev"));
+    ASSERT_EQ(serializeComponent(clientDevice), serializeComponent(serverDevice));
+
+    disconnect();
+    serverDevicesFolder.removeItemWithLocalId("added_dev");
+    reconnect();
+
+    ASSERT_FALSE(clientDevicesFolder.hasItem("added_dev"));
+    ASSERT_EQ(serializeComponent(clientDevice), serializeComponent(serverDevice));
+}
+
+TEST_F(ConfigProtocolReconnectTest, ChangesWhileConnectedAreNotLost)
+{
+    const auto component = serverDevice.findComponent("IO/AI/Ch");
+    component.setPropertyValue("StrProp", "connected");
+    ASSERT_EQ(clientDevice.findComponent("IO/AI/Ch").getPropertyValue("StrProp"), "connected");
+
+    disconnect();
+    reconnect();
+    disconnect();
+    component.setPropertyValue("StrProp", "disconnected");
+    reconnect();
+
+    ASSERT_EQ(clientDevice.findComponent("IO/AI/Ch").getPropertyValue("StrProp"), "disconnected");
+}
+
+TEST_F(ConfigProtocolReconnectTest, ServerRestarted)
+{
+    disconnect();
+    revisionTracker = std::make_shared<ConfigServerRevisionTracker>(serverDevice.getContext(), serverDevice.getGlobalId());
+    reconnect();
+
+    ASSERT_EQ(updateCount, 1);
+    ASSERT_GE(replyBytes, getSerializedSize(serverDevice));
+    ASSERT_EQ(serializeComponent(clientDevice), serializeComponent(serverDevice));
+}
+
+TEST_F(ConfigProtocolReconnectTest, NoRevisionTracker)
+{
+    disconnect();
+    revisionTracker.reset();
+    serverDevice.findComponent("IO/AI/Ch").setPropertyValue("StrProp", "changed");
+    reconnect();
+
+    ASSERT_EQ(updateCount, 1);
+    ASSERT_EQ(clientDevice.findComponent("IO/AI/Ch").getPropertyValue("StrProp"), "changed");
+}
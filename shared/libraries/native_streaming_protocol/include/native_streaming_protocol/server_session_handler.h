@@ -51,6 +51,10 @@ public:
 
     void setReconnected(bool reconnected);
     bool getReconnected();
+    void setBinaryEventEncoding(bool enabled);
+    bool isBinaryEventEncodingEnabled();
+    void setCompactDataPacketHeaders(bool enabled);
+    bool isCompactDataPacketHeadersEnabled();
     UserPtr getUser();
     void setClientType(ClientType clientType);
     ClientType getClientType();
@@ -75,5 +79,7 @@ private:
     bool useConfigProtocol;
     ClientType clientType = ClientType::Control;
     bool exclusiveControlDropOthers = false;
+    bool binaryEventEncoding = false;
+    bool compactDataPacketHeaders = false;
 };
 END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
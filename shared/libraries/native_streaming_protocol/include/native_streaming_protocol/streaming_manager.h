@@ -104,12 +104,16 @@ public:
     /// @param clientId The unique string ID provided by the client or automatically assigned by the server.
     /// @param reconnected true if the client was reconnected, false otherwise.
     /// @param enablePacketBufferTimestamps enables timestamp creation for PacketBuffers
+    /// @param binaryEventEncoding true if the client supports binary encoded event packets, false otherwise.
+    /// @param compactDataPacketHeaders true if the client supports compact data packet headers, false otherwise.
     /// @throw NativeStreamingProtocolException if the client is already registered.
     void registerClient(const std::string& clientId,
                         bool reconnected,
                         bool enablePacketBufferTimestamps,
                         size_t packetStreamingReleaseThreshold,
-                        size_t cacheablePacketPayloadSizeMax);
+                        size_t cacheablePacketPayloadSizeMax,
+                        bool binaryEventEncoding = false,
+                        bool compactDataPacketHeaders = false);
 
     /// Removes a registered client on disconnection.
     /// @param clientId The unique string ID provided by the client or automatically assigned by the server.
@@ -76,6 +76,11 @@ void NativeStreamingClientImpl::manageTransportLayerProps()
     if (!transportLayerProperties.hasProperty("Reconnected"))
         transportLayerProperties.addProperty(BoolProperty("Reconnected", False));
 
+    if (!transportLayerProperties.hasProperty("EventPacketEncoding"))
+        transportLayerProperties.addProperty(IntProperty("EventPacketEncoding", EVENT_PACKET_ENCODING_BINARY));
+    if (!transportLayerProperties.hasProperty("DataPacketHeaderEncoding"))
+        transportLayerProperties.addProperty(IntProperty("DataPacketHeaderEncoding", DATA_PACKET_HEADER_ENCODING_COMPACT));
+
     if (!transportLayerProperties.hasProperty("HostName"))
         transportLayerProperties.addProperty(StringProperty("HostName", ""));
     transportLayerProperties.setPropertyValue("HostName", String(boost::asio::ip::host_name()));
@@ -553,6 +553,22 @@ void NativeStreamingServerHandler::handleTransportLayerProps(const PropertyObjec
         sessionHandler->setClientType(ClientType::Control);
     }
 
+    // clients which do not advertise the supported event packet encoding receive JSON-serialized event packets
+    if (propertyObject.hasProperty("EventPacketEncoding") &&
+        propertyObject.getProperty("EventPacketEncoding").getValueType() == ctInt)
+    {
+        Int eventPacketEncoding = propertyObject.getPropertyValue("EventPacketEncoding");
+        sessionHandler->setBinaryEventEncoding(eventPacketEncoding >= EVENT_PACKET_ENCODING_BINARY);
+    }
+
+    // likewise for the compact data packet headers
+    if (propertyObject.hasProperty("DataPacketHeaderEncoding") &&
+        propertyObject.getProperty("DataPacketHeaderEncoding").getValueType() == ctInt)
+    {
+        Int dataPacketHeaderEncoding = propertyObject.getPropertyValue("DataPacketHeaderEncoding");
+        sessionHandler->setCompactDataPacketHeaders(dataPacketHeaderEncoding >= DATA_PACKET_HEADER_ENCODING_COMPACT);
+    }
+
     try
     {
         auto errorGuard = DAQ_ERROR_GUARD();
@@ -745,7 +761,9 @@ void NativeStreamingServerHandler::handleStreamingInit(std::shared_ptr<ServerSes
                                     sessionHandler->getReconnected(),
                                     streamingPacketSendTimeout != UNLIMITED_PACKET_SEND_TIME,
                                     cacheablePacketPayloadSizeMax,
-                                    packetStreamingReleaseThreshold);
+                                    packetStreamingReleaseThreshold,
+                                    sessionHandler->isBinaryEventEncodingEnabled(),
+                                    sessionHandler->isCompactDataPacketHeadersEnabled());
 
     OnPacketBufferReceivedCallback packetBufferReceivedHandler =
         [clientId = sessionHandler->getClientId(), thisWeakPtr = this->weak_from_this()](const packet_streaming::PacketBufferPtr& packetBuffer)
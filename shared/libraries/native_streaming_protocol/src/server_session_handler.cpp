@@ -103,6 +103,26 @@ bool ServerSessionHandler::getReconnected()
     return this->reconnected;
 }
 
+void ServerSessionHandler::setBinaryEventEncoding(bool enabled)
+{
+    this->binaryEventEncoding = enabled;
+}
+
+bool ServerSessionHandler::isBinaryEventEncodingEnabled()
+{
+    return this->binaryEventEncoding;
+}
+
+void ServerSessionHandler::setCompactDataPacketHeaders(bool enabled)
+{
+    this->compactDataPacketHeaders = enabled;
+}
+
+bool ServerSessionHandler::isCompactDataPacketHeadersEnabled()
+{
+    return this->compactDataPacketHeaders;
+}
+
 void ServerSessionHandler::triggerUseConfigProtocol()
 {
     this->useConfigProtocol = true;
@@ -275,7 +275,9 @@ void StreamingManager::registerClient(const std::string& clientId,
                                       bool reconnected,
                                       bool enablePacketBufferTimestamps,
                                       size_t packetStreamingReleaseThreshold,
-                                      size_t cacheablePacketPayloadSizeMax)
+                                      size_t cacheablePacketPayloadSizeMax,
+                                      bool binaryEventEncoding,
+                                      bool compactDataPacketHeaders)
 {
     std::scoped_lock lock(sync);
 
@@ -305,7 +307,10 @@ void StreamingManager::registerClient(const std::string& clientId,
                 std::make_shared<packet_streaming::PacketStreamingServer>(
                     cacheablePacketPayloadSizeMax,
                     packetStreamingReleaseThreshold,
-                    enablePacketBufferTimestamps)
+                    enablePacketBufferTimestamps,
+                    0,
+                    binaryEventEncoding,
+                    compactDataPacketHeaders)
             }
         );
     }
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <packet_streaming/packet_streaming.h>
+#include <opendaq/data_descriptor_ptr.h>
+
+namespace daq::packet_streaming
+{
+
+// Compact variant of the data packet header, used instead of `DataPacketHeader` when negotiated with the peer.
+//
+// The generic header is followed by varint encoded fields: the packet ID relative to the previous data packet
+// of the same signal, the domain packet ID relative to the packet ID, the sample count relative to the previous
+// packet and the integer offset relative to the offset predicted from the previous packet. For signals with
+// a linear data rule the predicted offset is the previous offset advanced by the previous sample count,
+// so consecutive domain packets carry no offset information at all. Floating point offsets are sent as is.
+//
+// Both sides keep one `DataPacketHeaderState` per signal and reset it on every data descriptor changed event.
+
+struct DataPacketHeaderState
+{
+    Int packetId{0};
+    Int sampleCount{0};
+    Int offset{0};
+    Int linearDelta{0};
+};
+
+static constexpr size_t COMPACT_DATA_PACKET_HEADER_SIZE_MAX = sizeof(GenericPacketHeader) + 4 * 10 + sizeof(double);
+
+void resetDataPacketHeaderState(DataPacketHeaderState& state, const DataDescriptorPtr& descriptor);
+
+// Returns a header allocated with `std::malloc`.
+GenericPacketHeader* createCompactDataPacketHeader(const DataPacketHeader& header, DataPacketHeaderState& state);
+void expandCompactDataPacketHeader(const GenericPacketHeader* compactHeader, DataPacketHeader& header, DataPacketHeaderState& state);
+
+}
@@ -0,0 +1,35 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <packet_streaming/packet_streaming.h>
+#include <opendaq/event_packet_ptr.h>
+#include <vector>
+
+namespace daq::packet_streaming
+{
+
+// Compact binary encoding of event packets, used instead of JSON when negotiated with the peer.
+//
+// Covers the DATA_DESCRIPTOR_CHANGED and IMPLICIT_DOMAIN_GAP_DETECTED events. Descriptors with dimensions,
+// and rule or scaling parameters that are not scalar numbers, booleans or strings, are not covered;
+// for such packets `encodeEventPacket` returns false and the caller falls back to JSON.
+
+bool encodeEventPacket(const EventPacketPtr& packet, std::vector<uint8_t>& output);
+EventPacketPtr decodeEventPacket(const void* data, size_t size);
+
+}
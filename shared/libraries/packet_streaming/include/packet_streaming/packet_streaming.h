@@ -30,9 +30,18 @@ enum PacketType: uint8_t { event = 0, data, release, alreadySent };
 
 #define PACKET_FLAG_CAN_RELEASE            0x1
 #define PACKET_FLAG_OFFSET_TYPE_MASK       (0x2 | 0x4)
+#define PACKET_FLAG_HAS_DOMAIN_PACKET      0x8
 
 #define PACKET_FLAG_OFFSET_TYPE_SHIFT      1
 
+// encoding of event packet payloads, stored in the version field of the generic header
+#define EVENT_PACKET_ENCODING_JSON   0x0
+#define EVENT_PACKET_ENCODING_BINARY 0x1
+
+// encoding of data packet headers, stored in the version field of the generic header
+#define DATA_PACKET_HEADER_ENCODING_FULL    0x0
+#define DATA_PACKET_HEADER_ENCODING_COMPACT 0x1
+
 struct GenericPacketHeader
 {
     uint8_t size;
@@ -44,6 +53,7 @@ struct GenericPacketHeader
 };
 
 // TODO: this could be further optimized by create data with domain and/or offset packets
+// (see data_packet_header_encoding.h for the negotiated compact variant)
 struct DataPacketHeader
 {
     GenericPacketHeader genericHeader;
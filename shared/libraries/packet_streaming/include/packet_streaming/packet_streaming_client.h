@@ -17,6 +17,7 @@
 #pragma once
 
 #include <packet_streaming/packet_streaming.h>
+#include <packet_streaming/data_packet_header_encoding.h>
 #include <opendaq/data_packet_ptr.h>
 #include "opendaq/event_packet_ptr.h"
 #include <queue>
@@ -48,6 +49,7 @@ private:
     std::queue<std::tuple<uint32_t, PacketPtr>> queue;
     std::unordered_map<uint32_t, DataDescriptorPtr> dataDescriptors;
     std::unordered_map<uint32_t, DataDescriptorPtr> domainDescriptors;
+    std::unordered_map<uint32_t, DataPacketHeaderState> dataPacketHeaderStates;
 
     std::unordered_map<Int, DataPacketPtr> referencedPackets;
     std::unordered_map<Int, PacketBufferPtr> referencedPacketBuffers;
@@ -56,6 +58,7 @@ private:
     mutable std::mutex descriptorsSync;
 
     void addEventPacketBuffer(const PacketBufferPtr& packetBuffer);
+    PacketBufferPtr expandCompactDataPacketBuffer(const PacketBufferPtr& packetBuffer);
     DataPacketPtr addDataPacketBuffer(const PacketBufferPtr& packetBuffer, const DataPacketPtr& domainPacket);
     void addReleasePacketBuffer(const PacketBufferPtr& packetBuffer);
     void addAlreadySentPacketBuffer(const PacketBufferPtr& packetBuffer);
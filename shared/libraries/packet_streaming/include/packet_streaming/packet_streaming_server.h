@@ -17,6 +17,7 @@
 #pragma once
 
 #include <packet_streaming/packet_streaming.h>
+#include <packet_streaming/data_packet_header_encoding.h>
 #include <opendaq/data_packet_ptr.h>
 #include <opendaq/event_packet_ptr.h>
 #include <queue>
@@ -44,7 +45,9 @@ public:
     PacketStreamingServer(size_t cacheablePacketPayloadSizeMax,
                           size_t releaseThreshold,
                           bool attachTimestampToPacketBuffer,
-                          Int jsonSerializerVersion = 0);
+                          Int jsonSerializerVersion = 0,
+                          bool binaryEventEncoding = false,
+                          bool compactDataPacketHeaders = false);
 
     void addDaqPacket(const uint32_t signalId, const PacketPtr& packet);
     void addDaqPacket(const uint32_t signalId, PacketPtr&& packet);
@@ -61,6 +64,8 @@ public:
 
 private:
     SerializerPtr jsonSerializer;
+    const bool binaryEventEncoding;
+    const bool compactDataPacketHeaders;
     std::queue<PacketBufferPtr> queue;
 
     size_t countOfNonCacheableBuffers;
@@ -74,6 +79,7 @@ private:
     size_t currentCacheablePacketGroupId;
 
     std::unordered_map<uint32_t, DataDescriptorPtr> dataDescriptors;
+    std::unordered_map<uint32_t, DataPacketHeaderState> dataPacketHeaderStates;
     PacketCollectionPtr packetCollection;
     size_t releaseThreshold;
     const bool attachTimestampToPacketBuffer;
@@ -0,0 +1,170 @@
+#include <packet_streaming/data_packet_header_encoding.h>
+#include <cstdlib>
+#include <cstring>
+
+namespace daq::packet_streaming
+{
+
+namespace
+{
+
+uint64_t zigZagEncode(Int value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+Int zigZagDecode(uint64_t value)
+{
+    return static_cast<Int>(value >> 1) ^ -static_cast<Int>(value & 1);
+}
+
+uint8_t* writeVarInt(uint8_t* dest, Int value)
+{
+    uint64_t encoded = zigZagEncode(value);
+    while (encoded >= 0x80)
+    {
+        *dest++ = static_cast<uint8_t>(encoded | 0x80);
+        encoded >>= 7;
+    }
+    *dest++ = static_cast<uint8_t>(encoded);
+    return dest;
+}
+
+const uint8_t* readVarInt(const uint8_t* src, const uint8_t* end, Int& value)
+{
+    uint64_t decoded = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7)
+    {
+        if (src == end)
+            break;
+
+        const uint8_t byte = *src++;
+        decoded |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+        {
+            value = zigZagDecode(decoded);
+            return src;
+        }
+    }
+
+    throw PacketStreamingException("Malformed compact data packet header");
+}
+
+Int predictOffset(const DataPacketHeaderState& state)
+{
+    return state.offset + state.sampleCount * state.linearDelta;
+}
+
+}
+
+void resetDataPacketHeaderState(DataPacketHeaderState& state, const DataDescriptorPtr& descriptor)
+{
+    state = DataPacketHeaderState{};
+
+    if (!descriptor.assigned())
+        return;
+
+    const auto rule = descriptor.getRule();
+    if (rule.assigned() && rule.getType() == DataRuleType::Linear)
+    {
+        const auto delta = rule.getParameters().getOrDefault("delta");
+        if (delta.assigned() && delta.getCoreType() == ctInt)
+            state.linearDelta = delta;
+    }
+}
+
+GenericPacketHeader* createCompactDataPacketHeader(const DataPacketHeader& header, DataPacketHeaderState& state)
+{
+    uint8_t buffer[COMPACT_DATA_PACKET_HEADER_SIZE_MAX];
+    std::memcpy(buffer, &header.genericHeader, sizeof(GenericPacketHeader));
+    uint8_t* pos = buffer + sizeof(GenericPacketHeader);
+
+    auto genericHeader = reinterpret_cast<GenericPacketHeader*>(buffer);
+    genericHeader->version = DATA_PACKET_HEADER_ENCODING_COMPACT;
+
+    pos = writeVarInt(pos, header.packetId - state.packetId);
+    if (header.domainPacketId >= 0)
+    {
+        genericHeader->flags |= PACKET_FLAG_HAS_DOMAIN_PACKET;
+        pos = writeVarInt(pos, header.packetId - header.domainPacketId);
+    }
+    pos = writeVarInt(pos, header.sampleCount - state.sampleCount);
+
+    switch ((header.genericHeader.flags & PACKET_FLAG_OFFSET_TYPE_MASK) >> PACKET_FLAG_OFFSET_TYPE_SHIFT)
+    {
+        case PACKET_OFFSET_TYPE_INT:
+            pos = writeVarInt(pos, header.packetOffsetInt64 - predictOffset(state));
+            state.offset = header.packetOffsetInt64;
+            break;
+        case PACKET_OFFSET_TYPE_FLOAT:
+            std::memcpy(pos, &header.packetOffsetFloat64, sizeof(double));
+            pos += sizeof(double);
+            break;
+    }
+
+    state.packetId = header.packetId;
+    state.sampleCount = header.sampleCount;
+
+    const auto size = static_cast<size_t>(pos - buffer);
+    genericHeader->size = static_cast<uint8_t>(size);
+
+    const auto compactHeader = static_cast<GenericPacketHeader*>(std::malloc(size));
+    std::memcpy(compactHeader, buffer, size);
+    return compactHeader;
+}
+
+void expandCompactDataPacketHeader(const GenericPacketHeader* compactHeader, DataPacketHeader& header, DataPacketHeaderState& state)
+{
+    if (compactHeader->size < sizeof(GenericPacketHeader))
+        throw PacketStreamingException("Malformed compact data packet header");
+
+    const auto begin = reinterpret_cast<const uint8_t*>(compactHeader);
+    const auto end = begin + compactHeader->size;
+    const uint8_t* pos = begin + sizeof(GenericPacketHeader);
+
+    header.genericHeader = *compactHeader;
+    header.genericHeader.size = sizeof(DataPacketHeader);
+    header.genericHeader.version = DATA_PACKET_HEADER_ENCODING_FULL;
+    header.genericHeader.flags &= static_cast<uint8_t>(~PACKET_FLAG_HAS_DOMAIN_PACKET);
+
+    Int value;
+    pos = readVarInt(pos, end, value);
+    header.packetId = state.packetId + value;
+
+    if (compactHeader->flags & PACKET_FLAG_HAS_DOMAIN_PACKET)
+    {
+        pos = readVarInt(pos, end, value);
+        header.domainPacketId = header.packetId - value;
+    }
+    else
+    {
+        header.domainPacketId = -1;
+    }
+
+    pos = readVarInt(pos, end, value);
+    header.sampleCount = state.sampleCount + value;
+
+    header.packetOffsetInt64 = 0;
+    switch ((compactHeader->flags & PACKET_FLAG_OFFSET_TYPE_MASK) >> PACKET_FLAG_OFFSET_TYPE_SHIFT)
+    {
+        case PACKET_OFFSET_TYPE_INT:
+            pos = readVarInt(pos, end, value);
+            header.packetOffsetInt64 = predictOffset(state) + value;
+            state.offset = header.packetOffsetInt64;
+            break;
+        case PACKET_OFFSET_TYPE_FLOAT:
+            if (static_cast<size_t>(end - pos) < sizeof(double))
+                throw PacketStreamingException("Malformed compact data packet header");
+            std::memcpy(&header.packetOffsetFloat64, pos, sizeof(double));
+            pos += sizeof(double);
+            break;
+    }
+
+    if (pos != end)
+        throw PacketStreamingException("Malformed compact data packet header");
+
+    state.packetId = header.packetId;
+    state.sampleCount = header.sampleCount;
+}
+
+}
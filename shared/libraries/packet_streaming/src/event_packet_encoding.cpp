@@ -0,0 +1,484 @@
+#include <packet_streaming/event_packet_encoding.h>
+#include <opendaq/event_packet_ids.h>
+#include <opendaq/event_packet_params.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/data_rule_factory.h>
+#include <opendaq/scaling_factory.h>
+#include <opendaq/range_factory.h>
+#include <opendaq/reference_domain_info_factory.h>
+#include <coreobjects/unit_factory.h>
+#include <coretypes/boolean_factory.h>
+#include <coretypes/float_factory.h>
+#include <coretypes/integer_factory.h>
+#include <coretypes/ratio_factory.h>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace daq::packet_streaming
+{
+
+namespace
+{
+
+enum class EventKind : uint8_t
+{
+    dataDescriptorChanged = 1,
+    implicitDomainGapDetected = 2
+};
+
+enum class ValueTag : uint8_t
+{
+    integer = 0,
+    floating,
+    boolean,
+    string
+};
+
+constexpr uint32_t NULL_STRING_LENGTH = std::numeric_limits<uint32_t>::max();
+
+class EventPacketWriter
+{
+public:
+    explicit EventPacketWriter(std::vector<uint8_t>& output)
+        : output(output)
+    {
+    }
+
+    template <typename T>
+    void write(T value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        const auto pos = output.size();
+        output.resize(pos + sizeof(T));
+        std::memcpy(output.data() + pos, &value, sizeof(T));
+    }
+
+    void writeString(const StringPtr& str)
+    {
+        if (!str.assigned())
+        {
+            write(NULL_STRING_LENGTH);
+            return;
+        }
+
+        const auto length = static_cast<uint32_t>(str.getLength());
+        const auto chars = reinterpret_cast<const uint8_t*>(str.getCharPtr());
+        write(length);
+        output.insert(output.end(), chars, chars + length);
+    }
+
+    bool writeValue(const BaseObjectPtr& value)
+    {
+        if (!value.assigned())
+            return false;
+
+        switch (value.getCoreType())
+        {
+            case ctInt:
+                write(ValueTag::integer);
+                write(static_cast<Int>(value));
+                return true;
+            case ctFloat:
+                write(ValueTag::floating);
+                write(static_cast<Float>(value));
+                return true;
+            case ctBool:
+                write(ValueTag::boolean);
+                write(static_cast<uint8_t>(static_cast<Bool>(value) ? 1 : 0));
+                return true;
+            case ctString:
+                write(ValueTag::string);
+                writeString(value.asPtr<IString>());
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    bool writeParameters(const DictPtr<IString, IBaseObject>& parameters)
+    {
+        if (!parameters.assigned())
+            return false;
+
+        write(static_cast<uint32_t>(parameters.getCount()));
+        for (const auto& [key, value] : parameters)
+        {
+            writeString(key);
+            if (!writeValue(value))
+                return false;
+        }
+
+        return true;
+    }
+
+    bool writeDescriptor(const DataDescriptorPtr& descriptor)
+    {
+        const auto dimensions = descriptor.getDimensions();
+        if (dimensions.assigned() && dimensions.getCount() > 0)
+            return false;
+
+        writeString(descriptor.getName());
+        write(static_cast<uint32_t>(descriptor.getSampleType()));
+
+        if (const auto unit = descriptor.getUnit(); unit.assigned())
+        {
+            write<uint8_t>(1);
+            write(unit.getId());
+            writeString(unit.getSymbol());
+            writeString(unit.getName());
+            writeString(unit.getQuantity());
+        }
+        else
+        {
+            write<uint8_t>(0);
+        }
+
+        if (const auto range = descriptor.getValueRange(); range.assigned())
+        {
+            write<uint8_t>(1);
+            if (!writeValue(range.getLowValue()) || !writeValue(range.getHighValue()))
+                return false;
+        }
+        else
+        {
+            write<uint8_t>(0);
+        }
+
+        if (const auto rule = descriptor.getRule(); rule.assigned())
+        {
+            write<uint8_t>(1);
+            write(static_cast<uint32_t>(rule.getType()));
+            if (!writeParameters(rule.getParameters()))
+                return false;
+        }
+        else
+        {
+            write<uint8_t>(0);
+        }
+
+        if (const auto scaling = descriptor.getPostScaling(); scaling.assigned())
+        {
+            write<uint8_t>(1);
+            write(static_cast<uint32_t>(scaling.getInputSampleType()));
+            write(static_cast<uint32_t>(scaling.getOutputSampleType()));
+            write(static_cast<uint32_t>(scaling.getType()));
+            if (!writeParameters(scaling.getParameters()))
+                return false;
+        }
+        else
+        {
+            write<uint8_t>(0);
+        }
+
+        writeString(descriptor.getOrigin());
+
+        if (const auto resolution = descriptor.getTickResolution(); resolution.assigned())
+        {
+            write<uint8_t>(1);
+            write(resolution.getNumerator());
+            write(resolution.getDenominator());
+        }
+        else
+        {
+            write<uint8_t>(0);
+        }
+
+        const auto metadata = descriptor.getMetadata();
+        write(static_cast<uint32_t>(metadata.assigned() ? metadata.getCount() : 0));
+        if (metadata.assigned())
+        {
+            for (const auto& [key, value] : metadata)
+            {
+                writeString(key);
+                writeString(value);
+            }
+        }
+
+        const auto structFields = descriptor.getStructFields();
+        write(static_cast<uint32_t>(structFields.assigned() ? structFields.getCount() : 0));
+        if (structFields.assigned())
+        {
+            for (const auto& field : structFields)
+            {
+                if (!writeDescriptor(field))
+                    return false;
+            }
+        }
+
+        if (const auto referenceDomainInfo = descriptor.getReferenceDomainInfo(); referenceDomainInfo.assigned())
+        {
+            write<uint8_t>(1);
+            writeString(referenceDomainInfo.getReferenceDomainId());
+            if (const auto offset = referenceDomainInfo.getReferenceDomainOffset(); offset.assigned())
+            {
+                write<uint8_t>(1);
+                write(static_cast<Int>(offset));
+            }
+            else
+            {
+                write<uint8_t>(0);
+            }
+            write(static_cast<uint32_t>(referenceDomainInfo.getReferenceTimeProtocol()));
+            write(static_cast<uint32_t>(referenceDomainInfo.getUsesOffset()));
+        }
+        else
+        {
+            write<uint8_t>(0);
+        }
+
+        return true;
+    }
+
+    bool writeDescriptorParameter(const BaseObjectPtr& parameter)
+    {
+        if (!parameter.assigned())
+        {
+            write<uint8_t>(0);
+            return true;
+        }
+
+        const DataDescriptorPtr descriptor = parameter.asPtrOrNull<IDataDescriptor>();
+        if (!descriptor.assigned())
+            return false;
+
+        write<uint8_t>(1);
+        return writeDescriptor(descriptor);
+    }
+
+private:
+    std::vector<uint8_t>& output;
+};
+
+class EventPacketReader
+{
+public:
+    EventPacketReader(const void* data, size_t size)
+        : data(static_cast<const uint8_t*>(data))
+        , size(size)
+        , pos(0)
+    {
+    }
+
+    template <typename T>
+    T read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        require(sizeof(T));
+        T value;
+        std::memcpy(&value, data + pos, sizeof(T));
+        pos += sizeof(T);
+        return value;
+    }
+
+    bool readFlag()
+    {
+        return read<uint8_t>() != 0;
+    }
+
+    StringPtr readString()
+    {
+        const auto length = read<uint32_t>();
+        if (length == NULL_STRING_LENGTH)
+            return nullptr;
+
+        require(length);
+        StringPtr str = String(reinterpret_cast<ConstCharPtr>(data + pos), length);
+        pos += length;
+        return str;
+    }
+
+    BaseObjectPtr readValue()
+    {
+        switch (read<ValueTag>())
+        {
+            case ValueTag::integer:
+                return Integer(read<Int>());
+            case ValueTag::floating:
+                return Floating(read<Float>());
+            case ValueTag::boolean:
+                return Boolean(read<uint8_t>() != 0);
+            case ValueTag::string:
+                return readString();
+        }
+
+        throw PacketStreamingException("Malformed binary event packet - unknown value type");
+    }
+
+    DictPtr<IString, IBaseObject> readParameters()
+    {
+        auto parameters = Dict<IString, IBaseObject>();
+        const auto count = read<uint32_t>();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const auto key = readString();
+            parameters.set(key, readValue());
+        }
+
+        return parameters;
+    }
+
+    DataDescriptorPtr readDescriptor()
+    {
+        auto builder = DataDescriptorBuilder();
+
+        builder.setName(readString());
+        builder.setSampleType(static_cast<SampleType>(read<uint32_t>()));
+
+        if (readFlag())
+        {
+            const auto id = read<Int>();
+            const auto symbol = readString();
+            const auto name = readString();
+            const auto quantity = readString();
+            builder.setUnit(Unit(symbol, id, name, quantity));
+        }
+
+        if (readFlag())
+        {
+            const NumberPtr low = readValue();
+            const NumberPtr high = readValue();
+            builder.setValueRange(Range(low, high));
+        }
+
+        if (readFlag())
+        {
+            const auto type = static_cast<DataRuleType>(read<uint32_t>());
+            builder.setRule(DataRule(type, readParameters()));
+        }
+
+        if (readFlag())
+        {
+            const auto inputType = static_cast<SampleType>(read<uint32_t>());
+            const auto outputType = static_cast<ScaledSampleType>(read<uint32_t>());
+            const auto scalingType = static_cast<ScalingType>(read<uint32_t>());
+            builder.setPostScaling(Scaling(inputType, outputType, scalingType, readParameters()));
+        }
+
+        builder.setOrigin(readString());
+
+        if (readFlag())
+        {
+            const auto num = read<Int>();
+            const auto den = read<Int>();
+            builder.setTickResolution(Ratio(num, den));
+        }
+
+        auto metadata = Dict<IString, IString>();
+        const auto metadataCount = read<uint32_t>();
+        for (uint32_t i = 0; i < metadataCount; ++i)
+        {
+            const auto key = readString();
+            metadata.set(key, readString());
+        }
+        builder.setMetadata(metadata);
+
+        auto structFields = List<IDataDescriptor>();
+        const auto structFieldCount = read<uint32_t>();
+        for (uint32_t i = 0; i < structFieldCount; ++i)
+            structFields.pushBack(readDescriptor());
+        builder.setStructFields(structFields);
+
+        if (readFlag())
+        {
+            auto referenceDomainInfo = ReferenceDomainInfoBuilder();
+            referenceDomainInfo.setReferenceDomainId(readString());
+            if (readFlag())
+                referenceDomainInfo.setReferenceDomainOffset(Integer(read<Int>()));
+            referenceDomainInfo.setReferenceTimeProtocol(static_cast<TimeProtocol>(read<uint32_t>()));
+            referenceDomainInfo.setUsesOffset(static_cast<UsesOffset>(read<uint32_t>()));
+            builder.setReferenceDomainInfo(referenceDomainInfo.build());
+        }
+
+        return builder.build();
+    }
+
+    DataDescriptorPtr readDescriptorParameter()
+    {
+        if (!readFlag())
+            return nullptr;
+        return readDescriptor();
+    }
+
+    void expectEnd() const
+    {
+        if (pos != size)
+            throw PacketStreamingException("Malformed binary event packet - unexpected trailing data");
+    }
+
+private:
+    void require(size_t count) const
+    {
+        if (count > size - pos)
+            throw PacketStreamingException("Malformed binary event packet - payload too short");
+    }
+
+    const uint8_t* data;
+    size_t size;
+    size_t pos;
+};
+
+}
+
+bool encodeEventPacket(const EventPacketPtr& packet, std::vector<uint8_t>& output)
+{
+    output.clear();
+    EventPacketWriter writer(output);
+
+    const auto eventId = packet.getEventId();
+    const auto parameters = packet.getParameters();
+
+    if (eventId == event_packet_id::DATA_DESCRIPTOR_CHANGED)
+    {
+        if (parameters.getCount() != 2)
+            return false;
+
+        writer.write(EventKind::dataDescriptorChanged);
+        return writer.writeDescriptorParameter(parameters.getOrDefault(event_packet_param::DATA_DESCRIPTOR)) &&
+               writer.writeDescriptorParameter(parameters.getOrDefault(event_packet_param::DOMAIN_DATA_DESCRIPTOR));
+    }
+
+    if (eventId == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED)
+    {
+        if (parameters.getCount() != 1)
+            return false;
+
+        writer.write(EventKind::implicitDomainGapDetected);
+        return writer.writeValue(parameters.getOrDefault(event_packet_param::GAP_DIFF));
+    }
+
+    return false;
+}
+
+EventPacketPtr decodeEventPacket(const void* data, size_t size)
+{
+    EventPacketReader reader(data, size);
+
+    EventPacketPtr packet;
+    switch (reader.read<EventKind>())
+    {
+        case EventKind::dataDescriptorChanged:
+        {
+            const auto valueDescriptor = reader.readDescriptorParameter();
+            const auto domainDescriptor = reader.readDescriptorParameter();
+            packet = DataDescriptorChangedEventPacket(valueDescriptor, domainDescriptor);
+            break;
+        }
+        case EventKind::implicitDomainGapDetected:
+        {
+            const NumberPtr diff = reader.readValue();
+            packet = ImplicitDomainGapDetectedEventPacket(diff);
+            break;
+        }
+        default:
+            throw PacketStreamingException("Malformed binary event packet - unknown event");
+    }
+
+    reader.expectEnd();
+    return packet;
+}
+
+}
@@ -1,4 +1,5 @@
 #include <packet_streaming/packet_streaming_client.h>
+#include <packet_streaming/event_packet_encoding.h>
 #include <opendaq/event_packet_ids.h>
 #include <opendaq/event_packet_utils.h>
 #include <opendaq/packet_factory.h>
@@ -22,7 +23,10 @@ void PacketStreamingClient::addPacketBuffer(const PacketBufferPtr& packetBuffer)
             addEventPacketBuffer(packetBuffer);
             break;
         case PacketType::data:
-            addDataPacketBuffer(packetBuffer, nullptr);
+            if (packetBuffer->packetHeader->version == DATA_PACKET_HEADER_ENCODING_COMPACT)
+                addDataPacketBuffer(expandCompactDataPacketBuffer(packetBuffer), nullptr);
+            else
+                addDataPacketBuffer(packetBuffer, nullptr);
             break;
         case PacketType::release:
             addReleasePacketBuffer(packetBuffer);
@@ -53,9 +57,16 @@ void PacketStreamingClient::addEventPacketBuffer(const PacketBufferPtr& packetBu
     bool forwardPacket = false;
     auto signalId = packetBuffer->packetHeader->signalId;
 
-    const auto eventPayloadString = String((ConstCharPtr) packetBuffer->payload);
-
-    EventPacketPtr packet = jsonDeserializer.deserialize(eventPayloadString);
+    EventPacketPtr packet;
+    if (packetBuffer->packetHeader->version == EVENT_PACKET_ENCODING_BINARY)
+    {
+        packet = decodeEventPacket(packetBuffer->payload, packetBuffer->packetHeader->payloadSize);
+    }
+    else
+    {
+        const auto eventPayloadString = String((ConstCharPtr) packetBuffer->payload);
+        packet = jsonDeserializer.deserialize(eventPayloadString);
+    }
 
     if (packet.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
     {
@@ -78,6 +89,9 @@ void PacketStreamingClient::addEventPacketBuffer(const PacketBufferPtr& packetBu
             dataDescriptors.insert_or_assign(signalId, newValueDescriptor);
         if (domainDescriptorChanged)
             domainDescriptors.insert_or_assign(signalId, newDomainDescriptors);
+
+        const auto it = dataDescriptors.find(signalId);
+        resetDataPacketHeaderState(dataPacketHeaderStates[signalId], it != dataDescriptors.end() ? it->second : nullptr);
     }
 
     if (forwardPacket)
@@ -86,6 +100,35 @@ void PacketStreamingClient::addEventPacketBuffer(const PacketBufferPtr& packetBu
     }
 }
 
+PacketBufferPtr PacketStreamingClient::expandCompactDataPacketBuffer(const PacketBufferPtr& packetBuffer)
+{
+    const auto stateIt = dataPacketHeaderStates.find(packetBuffer->packetHeader->signalId);
+    if (stateIt == dataPacketHeaderStates.end())
+        throw PacketStreamingException("Descriptor not registered");
+
+    const auto packetHeader = static_cast<DataPacketHeader*>(std::malloc(sizeof(DataPacketHeader)));
+    try
+    {
+        expandCompactDataPacketHeader(packetBuffer->packetHeader, *packetHeader, stateIt->second);
+    }
+    catch (...)
+    {
+        std::free(packetHeader);
+        throw;
+    }
+
+    // the expanded buffer keeps the received one, which owns the payload, alive
+    return std::make_shared<PacketBuffer>(
+        reinterpret_cast<GenericPacketHeader*>(packetHeader),
+        packetBuffer->payload,
+        [packetHeader, packetBuffer]() mutable
+        {
+            std::free(packetHeader);
+            packetBuffer.reset();
+        },
+        false);
+}
+
 DataPacketPtr PacketStreamingClient::addDataPacketBuffer(const PacketBufferPtr& packetBuffer, const DataPacketPtr& domainPacket)
 {
     const auto dataPacketHeader = reinterpret_cast<DataPacketHeader*>(packetBuffer->packetHeader);
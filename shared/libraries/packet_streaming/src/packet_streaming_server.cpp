@@ -1,4 +1,5 @@
 #include <packet_streaming/packet_streaming_server.h>
+#include <packet_streaming/event_packet_encoding.h>
 #include <opendaq/event_packet_ids.h>
 #include <opendaq/packet_destruct_callback_factory.h>
 #include <opendaq/event_packet_utils.h>
@@ -12,8 +13,13 @@ namespace daq::packet_streaming
 PacketStreamingServer::PacketStreamingServer(size_t cacheablePacketPayloadSizeMax,
                                              size_t releaseThreshold,
                                              bool attachTimestampToPacketBuffer,
-                                             Int jsonSerializerVersion)
+                                             Int jsonSerializerVersion,
+                                             bool binaryEventEncoding,
+                                             bool compactDataPacketHeaders)
     : jsonSerializer(jsonSerializerVersion ? JsonSerializerWithVersion(jsonSerializerVersion) : JsonSerializer())
+    // peers that require a downgraded serializer predate the binary encoding
+    , binaryEventEncoding(binaryEventEncoding && jsonSerializerVersion == 0)
+    , compactDataPacketHeaders(compactDataPacketHeaders)
     , countOfNonCacheableBuffers(0)
     , currentCacheablePacketGroupId(0)
     , packetCollection(std::make_shared<PacketCollection>())
@@ -148,26 +154,49 @@ void PacketStreamingServer::addEventPacket(const uint32_t signalId, const EventP
     const auto packetHeader = new GenericPacketHeader();
     packetHeader->size = sizeof(GenericPacketHeader);
     packetHeader->type = PacketType::event;
-    packetHeader->version = 0;
     packetHeader->flags = 0;
     packetHeader->signalId = signalId;
 
-    jsonSerializer.reset();
-    packet.serialize(jsonSerializer);
-    auto serializedPacket = jsonSerializer.getOutput();
-
-    packetHeader->payloadSize = static_cast<uint32_t>(serializedPacket.getLength() + 1);
+    PacketBufferPtr packetBuffer;
 
-    const auto packetBuffer = std::make_shared<PacketBuffer>(
-            packetHeader,
-            reinterpret_cast<const void*>(serializedPacket.getCharPtr()),
-            [packetHeader, serializedPacket]() mutable {
-                delete packetHeader;
-                serializedPacket.release();
-            },
-            attachTimestampToPacketBuffer,
-            getPacketCacheableGroupId(packetHeader->size, packetHeader->payloadSize)
-        );
+    auto encodedPacket = std::make_shared<std::vector<uint8_t>>();
+    if (binaryEventEncoding && encodeEventPacket(packet, *encodedPacket))
+    {
+        packetHeader->version = EVENT_PACKET_ENCODING_BINARY;
+        packetHeader->payloadSize = static_cast<uint32_t>(encodedPacket->size());
+
+        packetBuffer = std::make_shared<PacketBuffer>(
+                packetHeader,
+                reinterpret_cast<const void*>(encodedPacket->data()),
+                [packetHeader, encodedPacket]() mutable {
+                    delete packetHeader;
+                    encodedPacket.reset();
+                },
+                attachTimestampToPacketBuffer,
+                getPacketCacheableGroupId(packetHeader->size, packetHeader->payloadSize)
+            );
+    }
+    else
+    {
+        packetHeader->version = EVENT_PACKET_ENCODING_JSON;
+
+        jsonSerializer.reset();
+        packet.serialize(jsonSerializer);
+        auto serializedPacket = jsonSerializer.getOutput();
+
+        packetHeader->payloadSize = static_cast<uint32_t>(serializedPacket.getLength() + 1);
+
+        packetBuffer = std::make_shared<PacketBuffer>(
+                packetHeader,
+                reinterpret_cast<const void*>(serializedPacket.getCharPtr()),
+                [packetHeader, serializedPacket]() mutable {
+                    delete packetHeader;
+                    serializedPacket.release();
+                },
+                attachTimestampToPacketBuffer,
+                getPacketCacheableGroupId(packetHeader->size, packetHeader->payloadSize)
+            );
+    }
 
     if (packet.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
     {
@@ -178,6 +207,12 @@ void PacketStreamingServer::addEventPacket(const uint32_t signalId, const EventP
 
         if (valueDescriptorChanged)
             dataDescriptors.insert_or_assign(signalId, newValueDescriptor);
+
+        if (compactDataPacketHeaders)
+        {
+            const auto it = dataDescriptors.find(signalId);
+            resetDataPacketHeaderState(dataPacketHeaderStates[signalId], it != dataDescriptors.end() ? it->second : nullptr);
+        }
     }
 
     queuePacketBuffer(packetBuffer);
@@ -343,32 +378,43 @@ void PacketStreamingServer::addDataPacket(const uint32_t signalId, DataPacket&&
         return;
     }
 
-    const auto packetHeader = static_cast<DataPacketHeader*>(std::malloc(sizeof(DataPacketHeader)));
-    packetHeader->genericHeader.size = sizeof(DataPacketHeader);
-    packetHeader->genericHeader.type = PacketType::data;
-    packetHeader->genericHeader.version = 0;
-    packetHeader->genericHeader.flags = markPacketForRelease ? PACKET_FLAG_CAN_RELEASE : 0;
-    packetHeader->genericHeader.signalId = signalId;
-    packetHeader->packetId = packetId;
-    packetHeader->domainPacketId = domainPacketId;
-    packetHeader->sampleCount = static_cast<Int>(packet.getSampleCount());
+    DataPacketHeader header{};
+    header.genericHeader.size = sizeof(DataPacketHeader);
+    header.genericHeader.type = PacketType::data;
+    header.genericHeader.version = DATA_PACKET_HEADER_ENCODING_FULL;
+    header.genericHeader.flags = markPacketForRelease ? PACKET_FLAG_CAN_RELEASE : 0;
+    header.genericHeader.signalId = signalId;
+    header.packetId = packetId;
+    header.domainPacketId = domainPacketId;
+    header.sampleCount = static_cast<Int>(packet.getSampleCount());
 
-    setOffset(packet, packetHeader);
+    setOffset(packet, &header);
 
     const auto packetDataPtr = packet.getRawData();
     const auto packetDataSize = packetDataPtr != nullptr ? packet.getRawDataSize() : 0;
-    packetHeader->genericHeader.payloadSize = static_cast<uint32_t>(packetDataSize);
+    header.genericHeader.payloadSize = static_cast<uint32_t>(packetDataSize);
+
+    GenericPacketHeader* genericHeader;
+    if (compactDataPacketHeaders)
+    {
+        genericHeader = createCompactDataPacketHeader(header, dataPacketHeaderStates[signalId]);
+    }
+    else
+    {
+        genericHeader = static_cast<GenericPacketHeader*>(std::malloc(sizeof(DataPacketHeader)));
+        std::memcpy(genericHeader, &header, sizeof(DataPacketHeader));
+    }
 
     const auto packetBuffer = std::make_shared<PacketBuffer>(
-        reinterpret_cast<GenericPacketHeader*>(packetHeader),
+        genericHeader,
         packetDataPtr,
-        [packetHeader, packet = packet]() mutable
+        [genericHeader, packet = packet]() mutable
         {
-            std::free(packetHeader);
+            std::free(genericHeader);
             packet.release();
         },
         attachTimestampToPacketBuffer,
-        getPacketCacheableGroupId(packetHeader->genericHeader.size, packetHeader->genericHeader.payloadSize)
+        getPacketCacheableGroupId(genericHeader->size, genericHeader->payloadSize)
     );
 
     if constexpr (isPacketRValue)
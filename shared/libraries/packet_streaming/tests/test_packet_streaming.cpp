@@ -1,11 +1,19 @@
 #include <gtest/gtest.h>
 #include <packet_streaming/packet_streaming_client.h>
 #include <packet_streaming/packet_streaming_server.h>
+#include <packet_streaming/event_packet_encoding.h>
 #include <opendaq/packet_factory.h>
 #include <opendaq/data_descriptor_factory.h>
 #include <opendaq/data_rule_factory.h>
 #include <opendaq/packet_destruct_callback_factory.h>
 #include <opendaq/sample_type_traits.h>
+#include <opendaq/scaling_factory.h>
+#include <opendaq/dimension_factory.h>
+#include <opendaq/dimension_rule_factory.h>
+#include <opendaq/range_factory.h>
+#include <opendaq/reference_domain_info_factory.h>
+#include <coreobjects/unit_factory.h>
+#include <coretypes/ratio_factory.h>
 #include "packet_transmission.h"
 
 using namespace daq;
@@ -25,11 +33,16 @@ protected:
 
     void transmitAll()
     {
-        while (const auto serverPacketBuffer = server.getNextPacketBuffer())
+        transmitAll(server, client);
+    }
+
+    void transmitAll(PacketStreamingServer& source, PacketStreamingClient& destination)
+    {
+        while (const auto serverPacketBuffer = source.getNextPacketBuffer())
         {
             transmission.sendPacketBuffer(serverPacketBuffer);
             while (const auto clientPacketBuffer = transmission.recvPacketBuffer())
-                client.addPacketBuffer(clientPacketBuffer);
+                destination.addPacketBuffer(clientPacketBuffer);
         }
     }
 
@@ -140,6 +153,137 @@ TEST_F(PacketStreamingTest, DataDescNullEventPacket)
     ASSERT_TRUE(client.areReferencesCleared());
 }
 
+static DataDescriptorPtr createFullValueDescriptor(const std::string& name)
+{
+    return DataDescriptorBuilder()
+        .setName(name)
+        .setSampleType(SampleType::Float64)
+        .setUnit(Unit("V", 1, "volt", "voltage"))
+        .setValueRange(Range(-10, 10))
+        .setPostScaling(LinearScaling(0.5, 1.0, SampleType::Int32, ScaledSampleType::Float64))
+        .setMetadata(Dict<IString, IString>({{"key", "value"}}))
+        .build();
+}
+
+static DataDescriptorPtr createFullDomainDescriptor()
+{
+    return DataDescriptorBuilder()
+        .setSampleType(SampleType::Int64)
+        .setRule(LinearDataRule(10, 0))
+        .setTickResolution(Ratio(1, 1000000))
+        .setUnit(Unit("s", -1, "second", "time"))
+        .setOrigin("1970-01-01T00:00:00")
+        .setReferenceDomainInfo(ReferenceDomainInfoBuilder()
+                                    .setReferenceDomainId("Domain")
+                                    .setReferenceDomainOffset(100)
+                                    .setReferenceTimeProtocol(TimeProtocol::Gps)
+                                    .build())
+        .build();
+}
+
+TEST_F(PacketStreamingTest, BinaryDataDescChangedEventPacket)
+{
+    PacketStreamingServer binaryServer(PACKET_ZERO_PAYLOAD_SIZE, PACKET_RELEASE_THRESHOLD_DEFAULT, false, 0, true);
+
+    const auto serverEventPacket = DataDescriptorChangedEventPacket(createFullValueDescriptor("Value"), createFullDomainDescriptor());
+
+    binaryServer.addDaqPacket(1, serverEventPacket);
+    const auto serverPacketBuffer = binaryServer.getNextPacketBuffer();
+    ASSERT_EQ(serverPacketBuffer->packetHeader->version, EVENT_PACKET_ENCODING_BINARY);
+
+    transmission.sendPacketBuffer(serverPacketBuffer);
+    client.addPacketBuffer(transmission.recvPacketBuffer());
+    auto [signalId, clientEventPacket] = client.getNextDaqPacket();
+
+    ASSERT_EQ(signalId, 1u);
+    ASSERT_EQ(serverEventPacket, clientEventPacket);
+
+    ASSERT_TRUE(client.areReferencesCleared());
+}
+
+TEST_F(PacketStreamingTest, BinaryDataDescPartialEventPacket)
+{
+    PacketStreamingServer binaryServer(PACKET_ZERO_PAYLOAD_SIZE, PACKET_RELEASE_THRESHOLD_DEFAULT, false, 0, true);
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
+    const auto domainDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Int64).build();
+
+    binaryServer.addDaqPacket(1, DataDescriptorChangedEventPacket(valueDescriptor, domainDescriptor));
+    binaryServer.addDaqPacket(1, DataDescriptorChangedEventPacket(NullDataDescriptor(), nullptr));
+    for (size_t i = 0; i < 2; ++i)
+    {
+        const auto serverPacketBuffer = binaryServer.getNextPacketBuffer();
+        ASSERT_EQ(serverPacketBuffer->packetHeader->version, EVENT_PACKET_ENCODING_BINARY);
+        transmission.sendPacketBuffer(serverPacketBuffer);
+        client.addPacketBuffer(transmission.recvPacketBuffer());
+    }
+
+    client.getNextDaqPacket();
+    auto [signalId, clientEventPacket] = client.getNextDaqPacket();
+
+    ASSERT_EQ(signalId, 1u);
+    ASSERT_EQ(clientEventPacket, DataDescriptorChangedEventPacket(NullDataDescriptor(), nullptr));
+}
+
+TEST_F(PacketStreamingTest, BinaryImplicitDomainGapEventPacket)
+{
+    PacketStreamingServer binaryServer(PACKET_ZERO_PAYLOAD_SIZE, PACKET_RELEASE_THRESHOLD_DEFAULT, false, 0, true);
+
+    const auto serverEventPacket = ImplicitDomainGapDetectedEventPacket(Integer(42));
+
+    binaryServer.addDaqPacket(1, serverEventPacket);
+    const auto serverPacketBuffer = binaryServer.getNextPacketBuffer();
+    ASSERT_EQ(serverPacketBuffer->packetHeader->version, EVENT_PACKET_ENCODING_BINARY);
+
+    transmission.sendPacketBuffer(serverPacketBuffer);
+    client.addPacketBuffer(transmission.recvPacketBuffer());
+    auto [signalId, clientEventPacket] = client.getNextDaqPacket();
+
+    ASSERT_EQ(signalId, 1u);
+    ASSERT_EQ(serverEventPacket, clientEventPacket);
+}
+
+TEST_F(PacketStreamingTest, BinaryEventPacketFallbackToJson)
+{
+    PacketStreamingServer binaryServer(PACKET_ZERO_PAYLOAD_SIZE, PACKET_RELEASE_THRESHOLD_DEFAULT, false, 0, true);
+
+    const auto valueDescriptor = DataDescriptorBuilder()
+                                     .setSampleType(SampleType::Float64)
+                                     .setDimensions(List<IDimension>(Dimension(LinearDimensionRule(1, 0, 10))))
+                                     .build();
+    const auto serverEventPacket = DataDescriptorChangedEventPacket(valueDescriptor, nullptr);
+
+    binaryServer.addDaqPacket(1, serverEventPacket);
+    const auto serverPacketBuffer = binaryServer.getNextPacketBuffer();
+    ASSERT_EQ(serverPacketBuffer->packetHeader->version, EVENT_PACKET_ENCODING_JSON);
+
+    transmission.sendPacketBuffer(serverPacketBuffer);
+    client.addPacketBuffer(transmission.recvPacketBuffer());
+    auto [signalId, clientEventPacket] = client.getNextDaqPacket();
+
+    ASSERT_EQ(signalId, 1u);
+    ASSERT_EQ(serverEventPacket, clientEventPacket);
+}
+
+TEST_F(PacketStreamingTest, BinaryEventPacketDowngradedSerializer)
+{
+    PacketStreamingServer downgradedServer(PACKET_ZERO_PAYLOAD_SIZE, PACKET_RELEASE_THRESHOLD_DEFAULT, false, 1, true);
+
+    downgradedServer.addDaqPacket(1, ImplicitDomainGapDetectedEventPacket(Integer(42)));
+    ASSERT_EQ(downgradedServer.getNextPacketBuffer()->packetHeader->version, EVENT_PACKET_ENCODING_JSON);
+}
+
+TEST_F(PacketStreamingTest, BinaryEventPacketMalformed)
+{
+    std::vector<uint8_t> encoded;
+    ASSERT_TRUE(encodeEventPacket(DataDescriptorChangedEventPacket(createFullValueDescriptor("Value"), nullptr), encoded));
+
+    ASSERT_THROW(decodeEventPacket(encoded.data(), encoded.size() - 1), PacketStreamingException);
+
+    encoded.push_back(0);
+    ASSERT_THROW(decodeEventPacket(encoded.data(), encoded.size()), PacketStreamingException);
+}
+
 TEST_F(PacketStreamingTest, DataPacket)
 {
     const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
@@ -1077,4 +1221,87 @@ TEST_F(PacketStreamingTest, CacheablePacketsAny)
     EXPECT_EQ(server.getCountOfCacheableGroups(), 0u);
 }
 
+TEST_F(PacketStreamingTest, CompactDataPacketHeaderLinearDomain)
+{
+    PacketStreamingServer compactServer(PACKET_ZERO_PAYLOAD_SIZE, PACKET_RELEASE_THRESHOLD_DEFAULT, false, 0, false, true);
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
+    const auto domainDescriptor =
+        DataDescriptorBuilder().setSampleType(SampleType::Int64).setRule(LinearDataRule(10, 0)).setTickResolution(Ratio(1, 1000)).build();
+
+    compactServer.addDaqPacket(1, DataDescriptorChangedEventPacket(valueDescriptor, domainDescriptor));
+    compactServer.addDaqPacket(2, DataDescriptorChangedEventPacket(domainDescriptor, nullptr));
+    transmitAll(compactServer, client);
+    client.getNextDaqPacket();
+    client.getNextDaqPacket();
+
+    constexpr size_t sampleCount = 16;
+    for (Int i = 0; i < 10; ++i)
+    {
+        auto domainPacket = DataPacket(domainDescriptor, sampleCount, 1000 + i * static_cast<Int>(sampleCount) * 10);
+        auto valuePacket = DataPacketWithDomain(domainPacket, valueDescriptor, sampleCount);
+        auto data = static_cast<float*>(valuePacket.getRawData());
+        for (size_t j = 0; j < sampleCount; j++)
+            *data++ = static_cast<float>(j);
+
+        compactServer.addDaqPacket(2, domainPacket);
+        compactServer.addDaqPacket(1, valuePacket);
+
+        while (const auto serverPacketBuffer = compactServer.getNextPacketBuffer())
+        {
+            ASSERT_EQ(serverPacketBuffer->packetHeader->version, DATA_PACKET_HEADER_ENCODING_COMPACT);
+            ASSERT_LT(serverPacketBuffer->packetHeader->size, sizeof(DataPacketHeader));
+            // after the first packet, the domain packet offset is fully predicted from the linear rule
+            if (i > 0 && serverPacketBuffer->packetHeader->signalId == 2u)
+                ASSERT_EQ(serverPacketBuffer->packetHeader->size, sizeof(GenericPacketHeader) + 3u);
+
+            transmission.sendPacketBuffer(serverPacketBuffer);
+            client.addPacketBuffer(transmission.recvPacketBuffer());
+        }
+
+        auto [domainSignalId, clientDomainPacket] = client.getNextDaqPacket();
+        ASSERT_EQ(domainSignalId, 2u);
+        ASSERT_EQ(clientDomainPacket, domainPacket);
+
+        auto [valueSignalId, clientValuePacket] = client.getNextDaqPacket();
+        ASSERT_EQ(valueSignalId, 1u);
+        ASSERT_EQ(clientValuePacket, valuePacket);
+    }
+
+    compactServer.checkAndSendReleasePacket(true);
+    transmitAll(compactServer, client);
+    ASSERT_TRUE(client.areReferencesCleared());
+}
+
+TEST_F(PacketStreamingTest, CompactDataPacketHeaderDescriptorChanged)
+{
+    PacketStreamingServer compactServer(PACKET_ZERO_PAYLOAD_SIZE, PACKET_RELEASE_THRESHOLD_DEFAULT, false, 0, false, true);
+
+    const auto descriptor1 = DataDescriptorBuilder().setSampleType(SampleType::Int64).setRule(LinearDataRule(1, 0)).build();
+    const auto descriptor2 = DataDescriptorBuilder().setSampleType(SampleType::Int64).setRule(LinearDataRule(2, 0)).build();
+    const auto descriptor3 = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+
+    std::vector<PacketPtr> serverPackets;
+    serverPackets.push_back(DataDescriptorChangedEventPacket(descriptor1, nullptr));
+    serverPackets.push_back(DataPacket(descriptor1, 5, 100));
+    serverPackets.push_back(DataPacket(descriptor1, 7, 105));
+    serverPackets.push_back(DataDescriptorChangedEventPacket(descriptor2, nullptr));
+    serverPackets.push_back(DataPacket(descriptor2, 5, -50));
+    serverPackets.push_back(DataPacket(descriptor2, 5, -40));
+    serverPackets.push_back(DataDescriptorChangedEventPacket(descriptor3, nullptr));
+    serverPackets.push_back(DataPacket(descriptor3, 3, 1.5));
+    serverPackets.push_back(DataPacket(descriptor3, 3));
+
+    for (const auto& packet : serverPackets)
+        compactServer.addDaqPacket(1, packet);
+    transmitAll(compactServer, client);
+
+    for (const auto& packet : serverPackets)
+    {
+        auto [signalId, clientPacket] = client.getNextDaqPacket();
+        ASSERT_EQ(signalId, 1u);
+        ASSERT_EQ(clientPacket, packet);
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(MovePacket, ValuePacketDestroyedBeforeDomainSentTest, testing::Values(true, false));
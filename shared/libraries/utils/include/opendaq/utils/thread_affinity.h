@@ -0,0 +1,46 @@
+/*
+ * Copyright 2022-2025 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <opendaq/utils/utils.h>
+#include <cstddef>
+#include <vector>
+
+BEGIN_NAMESPACE_UTILS
+
+enum class ThreadPriority
+{
+    Low,
+    Normal,
+    High
+};
+
+/*!
+ * @brief Restricts the calling thread to the given CPU cores.
+ * @returns False if the cores cannot be set on this platform or the request was rejected by the OS.
+ */
+bool setThreadAffinity(const std::vector<std::size_t>& cpuCores);
+
+/*!
+ * @brief Sets the OS scheduling priority of the calling thread.
+ * @returns False if the priority cannot be set on this platform or the request was rejected by the OS,
+ * e.g. raising the priority without the required privileges.
+ */
+bool setThreadPriority(ThreadPriority priority);
+
+END_NAMESPACE_UTILS
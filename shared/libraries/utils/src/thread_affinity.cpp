@@ -0,0 +1,70 @@
+#include <opendaq/utils/thread_affinity.h>
+
+#if defined(_WIN32)
+    #include <Windows.h>
+#elif defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+    #include <sys/resource.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+BEGIN_NAMESPACE_UTILS
+
+bool setThreadAffinity(const std::vector<std::size_t>& cpuCores)
+{
+    if (cpuCores.empty())
+        return true;
+
+#if defined(_WIN32)
+    DWORD_PTR mask = 0;
+    for (const auto core : cpuCores)
+    {
+        if (core >= sizeof(DWORD_PTR) * 8)
+            return false;
+        mask |= static_cast<DWORD_PTR>(1) << core;
+    }
+
+    return SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+#elif defined(__linux__)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (const auto core : cpuCores)
+    {
+        if (core >= CPU_SETSIZE)
+            return false;
+        CPU_SET(core, &cpuSet);
+    }
+
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+#else
+    return false;
+#endif
+}
+
+bool setThreadPriority(ThreadPriority priority)
+{
+#if defined(_WIN32)
+    int level = THREAD_PRIORITY_NORMAL;
+    if (priority == ThreadPriority::Low)
+        level = THREAD_PRIORITY_BELOW_NORMAL;
+    else if (priority == ThreadPriority::High)
+        level = THREAD_PRIORITY_ABOVE_NORMAL;
+
+    return SetThreadPriority(GetCurrentThread(), level) != 0;
+#elif defined(__linux__)
+    // Linux threads have their own nice value; raising it above the default requires CAP_SYS_NICE
+    int nice = 0;
+    if (priority == ThreadPriority::Low)
+        nice = 10;
+    else if (priority == ThreadPriority::High)
+        nice = -10;
+
+    return setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), nice) == 0;
+#else
+    return priority == ThreadPriority::Normal;
+#endif
+}
+
+END_NAMESPACE_UTILS
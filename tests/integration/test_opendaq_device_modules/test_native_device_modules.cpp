@@ -29,7 +29,7 @@ using NativeDeviceModulesTest = testing::Test;
 
 using namespace daq;
 
-const uint16_t LATEST_CONFIG_PROTOCOL_VERSION = 24;
+const uint16_t LATEST_CONFIG_PROTOCOL_VERSION = 27;
 
 static InstancePtr CreateCustomServerInstance(AuthenticationProviderPtr authenticationProvider)
 {
@@ -250,6 +250,24 @@ TEST_F(NativeDeviceModulesTest, CheckProtocolVersion)
     server.detach();
 }
 
+TEST_F(NativeDeviceModulesTest, OnReadPropertyValueReadFromServer)
+{
+    SKIP_TEST_MAC_CI;
+    auto server = CreateServerInstance();
+    server.addProperty(IntProperty("PolledValue", 0));
+    Int readCount = 0;
+    server.getRootDevice().getOnPropertyValueRead("PolledValue") +=
+        [&readCount](PropertyObjectPtr&, PropertyValueEventArgsPtr& args) { args.setValue(++readCount); };
+
+    auto client = CreateClientInstance();
+    auto clientDevice = client.getDevices()[0];
+
+    // the read handler changes the value without a value changed event, so each read must reach the server
+    ASSERT_EQ(clientDevice.getPropertyValue("PolledValue"), 1);
+    ASSERT_EQ(clientDevice.getPropertyValue("PolledValue"), 2);
+    ASSERT_EQ(clientDevice.getPropertyValue("PolledValue"), 3);
+}
+
 TEST_F(NativeDeviceModulesTest, FailedToSetAsRoot)
 {
     auto server = CreateServerInstance();
@@ -997,3 +997,53 @@ TEST_F(NativeStreamingModulesTest, StreamDataLowMaxPacketReadCount)
     EXPECT_EQ(clientReceivedPackets.getCount(), packetsToRead);
     EXPECT_TRUE(test_helpers::packetsEqual(serverReceivedPackets, clientReceivedPackets));
 }
+
+TEST_F(NativeStreamingModulesTest, StreamDataEventDriven)
+{
+    DevicePtr serverDevice{};
+    auto server = Instance("[[none]]");
+    {
+        auto moduleManager = server.getModuleManager();
+        const ModulePtr deviceModule(MockDeviceModule_Create(server.getContext()));
+        moduleManager.addModule(deviceModule);
+
+        serverDevice = server.addDevice("daqmock://phys_device");
+
+        auto config = PropertyObject();
+        config.addProperty(BoolProperty("StreamingDataEventDriven", True));
+        config.addProperty(IntProperty("MaxPacketReadCount", 1));
+
+        addNativeServerModule(server);
+        server.addServer("OpenDAQNativeStreaming", config);
+    }
+
+    auto client = Instance("[[none]]");
+
+    addNativeClientModule(client);
+    auto clientDevice = client.addDevice("daq.nd://127.0.0.1");
+
+    auto clientSignal = clientDevice.getSignals(search::Recursive(search::LocalId("ByteStep")))[0];
+    auto serverSignal = serverDevice.getSignals(search::Recursive(search::LocalId("ByteStep")))[0];
+
+    auto mirroredSignalPtr = clientSignal.asPtr<IMirroredSignalConfig>();
+    std::promise<StringPtr> subscribeCompletePromise;
+    std::future<StringPtr> subscribeCompleteFuture;
+    test_helpers::setupSubscribeAckHandler(subscribeCompletePromise, subscribeCompleteFuture, mirroredSignalPtr);
+
+    auto serverReader = PacketReader(serverSignal);
+    auto clientReader = PacketReader(clientSignal);
+
+    ASSERT_TRUE(test_helpers::waitForAcknowledgement(subscribeCompleteFuture));
+
+    const size_t packetsToGenerate = 50;
+    const size_t packetsToRead = packetsToGenerate + 1;
+
+    serverDevice.setPropertyValue("GeneratePackets", packetsToGenerate);
+
+    auto serverReceivedPackets = test_helpers::tryReadPackets(serverReader, packetsToRead);
+    auto clientReceivedPackets = test_helpers::tryReadPackets(clientReader, packetsToRead);
+
+    EXPECT_EQ(serverReceivedPackets.getCount(), packetsToRead);
+    EXPECT_EQ(clientReceivedPackets.getCount(), packetsToRead);
+    EXPECT_TRUE(test_helpers::packetsEqual(serverReceivedPackets, clientReceivedPackets));
+}